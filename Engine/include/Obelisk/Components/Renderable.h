@@ -0,0 +1,141 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include "Obelisk/Core/Bounds.h"
+#include "Obelisk/Renderer/Material.h"
+#include "Obelisk/Renderer/Mesh.h"
+#include "Obelisk/Renderer/ResourceRegistry.h"
+#include "Obelisk/Scene/SparseSet.h"
+
+namespace Obelisk {
+
+/**
+ * @brief Mesh an entity draws.
+ *
+ * Only present while the entity has a mesh. The handle still resolves to
+ * nullptr once the mesh is released from the ResourceRegistry, and such
+ * entities are skipped.
+ */
+struct MeshRef {
+        MeshHandle Handle;  ///< Shared geometry
+};
+
+/**
+ * @brief Material an entity draws with.
+ *
+ * Only present while the entity has a material; see MeshRef.
+ */
+struct MaterialRef {
+        MaterialHandle Handle;  ///< Shared material
+};
+
+/**
+ * @brief ComponentPool that counts the users of the referenced resources.
+ *
+ * Every component added, replaced, removed or cleared is reported to the
+ * ResourceRegistry (see ResourceRegistry::AddUser()), so resources added
+ * with AddReleasedWhenUnused() go away with their last entity. Handles must
+ * therefore be changed through Registry::Add(), not by writing to a stored
+ * component.
+ *
+ * @tparam Ref MeshRef or MaterialRef
+ */
+template <typename Ref>
+class ResourceRefPool : public ComponentPool<Ref> {
+    public:
+        ResourceRefPool() = default;
+        ResourceRefPool(const ResourceRefPool&) = delete;
+        ResourceRefPool& operator=(const ResourceRefPool&) = delete;
+
+        /**
+         * @brief Drop the users of every remaining component.
+         */
+        ~ResourceRefPool() override { Clear(); }
+
+        /**
+         * @brief Add a component, or replace the entity's existing one.
+         *
+         * @param id Entity to add the component to
+         * @param args Arguments for the component's brace initializer
+         * @return The stored component
+         */
+        template <typename... Args>
+        Ref& Emplace(EntityID id, Args&&... args) {
+            const Ref* previous = this->TryGet(id);
+            auto previousHandle =
+                previous ? previous->Handle : decltype(Ref::Handle)();
+            Ref& ref =
+                ComponentPool<Ref>::Emplace(id, std::forward<Args>(args)...);
+
+            // Counting the new user first keeps a re-added handle alive
+            ResourceRegistry::AddUser(ref.Handle);
+            ResourceRegistry::RemoveUser(previousHandle);
+            return ref;
+        }
+
+        /**
+         * @brief Add components to many entities at once.
+         *
+         * @param ids Entities to add, none of them members
+         * @param components Component of each entity
+         */
+        void Append(std::span<const EntityID> ids,
+                    std::span<const Ref> components) {
+            ComponentPool<Ref>::Append(ids, components);
+            for (const Ref& ref : components) {
+                ResourceRegistry::AddUser(ref.Handle);
+            }
+        }
+
+        void Remove(EntityID id) override {
+            const Ref* ref = this->TryGet(id);
+            if (!ref) {
+                return;
+            }
+            auto handle = ref->Handle;
+            ComponentPool<Ref>::Remove(id);
+            ResourceRegistry::RemoveUser(handle);
+        }
+
+        void Clear() override {
+            for (const Ref& ref : this->GetComponents()) {
+                ResourceRegistry::RemoveUser(ref.Handle);
+            }
+            ComponentPool<Ref>::Clear();
+        }
+};
+
+/**
+ * @brief Store MeshRef components in a ResourceRefPool.
+ */
+template <>
+struct ComponentStorage<MeshRef> {
+        using Type = ResourceRefPool<MeshRef>;  ///< Pool class for MeshRef
+};
+
+/**
+ * @brief Store MaterialRef components in a ResourceRefPool.
+ */
+template <>
+struct ComponentStorage<MaterialRef> {
+        using Type =
+            ResourceRefPool<MaterialRef>;  ///< Pool class for MaterialRef
+};
+
+/**
+ * @brief Object-space bounds of an entity's mesh.
+ *
+ * A copy of Mesh::GetBounds(), kept in its own packed array so culling reads
+ * transforms and bounds without dereferencing every mesh. Empty while the
+ * entity has no mesh.
+ */
+struct LocalBounds {
+        AABB Box;  ///< Bounds before the entity's transform
+};
+
+/**
+ * @brief Marks entities that never move; see Entity::SetStatic().
+ */
+struct StaticTag {};
+
+}  // namespace Obelisk
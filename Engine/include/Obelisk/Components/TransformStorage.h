@@ -0,0 +1,615 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include <array>
+#include "Obelisk/Components/Transform.h"
+#include "Obelisk/Scene/SparseSet.h"
+
+namespace Obelisk {
+
+class TransformStorage;
+
+/**
+ * @brief Reference to one entity's transform in a TransformStorage.
+ *
+ * Offers the Transform interface on top of the packed arrays, so entity code
+ * reads the same whether it holds a Transform or a TransformRef. Setters mark
+ * the entity dirty; its matrix is rebuilt by the next
+ * TransformStorage::UpdateMatrices(), or on demand by GetModelMatrix().
+ *
+ * Position, rotation and scale are relative to the parent, if the entity has
+ * one (see TransformStorage::SetParent()); the model matrix is local-to-world.
+ *
+ * The reference addresses a dense slot, so it is invalidated when any entity
+ * with a transform is destroyed. Do not keep it across frames.
+ */
+class OBELISK_API TransformRef {
+    private:
+        TransformStorage* m_Storage;  ///< Storage holding the transform
+        uint32_t m_Slot;              ///< Dense slot of the entity
+
+    public:
+        /**
+         * @brief Refer to a dense slot; see TransformStorage::Get().
+         */
+        TransformRef(TransformStorage* storage, uint32_t slot)
+            : m_Storage(storage), m_Slot(slot) {}
+
+        /**
+         * @brief Get the 4x4 transformation matrix (T * R * S).
+         *
+         * @return Local-to-world matrix, composed now if the transform is
+         * dirty
+         */
+        glm::mat4 GetModelMatrix() const;
+
+        /**
+         * @brief Get the position in world space.
+         *
+         * @return Translation of the model matrix
+         */
+        glm::vec3 GetWorldPosition() const {
+            return glm::vec3(GetModelMatrix()[3]);
+        }
+
+        /**
+         * @brief Get the inverse of the transformation matrix.
+         *
+         * @return Inverse of the model matrix
+         */
+        glm::mat4 GetInverseModelMatrix() const {
+            return glm::inverse(GetModelMatrix());
+        }
+
+        /**
+         * @brief Get the position.
+         * @return World space position
+         */
+        glm::vec3 GetPosition() const;
+
+        /**
+         * @brief Get the rotation as Euler angles.
+         * @return Pitch, yaw and roll in degrees
+         */
+        glm::vec3 GetRotation() const {
+            return glm::degrees(glm::eulerAngles(GetRotationQuat()));
+        }
+
+        /**
+         * @brief Get the rotation.
+         * @return Rotation quaternion
+         */
+        glm::quat GetRotationQuat() const;
+
+        /**
+         * @brief Get the scale.
+         * @return Scale factors for each axis
+         */
+        glm::vec3 GetScale() const;
+
+        /**
+         * @brief Set the position.
+         * @param position World space position
+         */
+        void SetPosition(glm::vec3 position);
+
+        /**
+         * @brief Set the position from components.
+         */
+        void SetPosition(float x, float y, float z) {
+            SetPosition(glm::vec3(x, y, z));
+        }
+
+        /**
+         * @brief Set the rotation from Euler angles.
+         * @param rotation Pitch, yaw and roll in degrees
+         */
+        void SetRotation(glm::vec3 rotation) {
+            SetRotation(glm::quat(glm::radians(rotation)));
+        }
+
+        /**
+         * @brief Set the rotation from Euler angle components in degrees.
+         */
+        void SetRotation(float pitch, float yaw, float roll) {
+            SetRotation(glm::vec3(pitch, yaw, roll));
+        }
+
+        /**
+         * @brief Set the rotation.
+         * @param quaternion Rotation quaternion
+         */
+        void SetRotation(const glm::quat& quaternion);
+
+        /**
+         * @brief Rotate to face a target position.
+         *
+         * @param target Position to look at
+         * @param up Up direction
+         */
+        void LookAt(const glm::vec3& target,
+                    const glm::vec3& up = glm::vec3(0.0f, 1.0f, 0.0f)) {
+            glm::vec3 direction = glm::normalize(target - GetPosition());
+            SetRotation(glm::quatLookAt(direction, up));
+        }
+
+        /**
+         * @brief Set the scale.
+         * @param scale Scale factors for each axis
+         */
+        void SetScale(glm::vec3 scale);
+
+        /**
+         * @brief Set the scale from components.
+         */
+        void SetScale(float x, float y, float z) {
+            SetScale(glm::vec3(x, y, z));
+        }
+
+        /**
+         * @brief Move by an offset.
+         * @param delta World space offset
+         */
+        void Translate(const glm::vec3& delta) {
+            SetPosition(GetPosition() + delta);
+        }
+
+        /**
+         * @brief Rotate by Euler angles, relative to the current rotation.
+         * @param eulerDelta Pitch, yaw and roll in degrees
+         */
+        void Rotate(const glm::vec3& eulerDelta) {
+            Rotate(glm::quat(glm::radians(eulerDelta)));
+        }
+
+        /**
+         * @brief Rotate by a quaternion, relative to the current rotation.
+         * @param quaternionDelta Rotation to apply
+         */
+        void Rotate(const glm::quat& quaternionDelta) {
+            SetRotation(GetRotationQuat() * quaternionDelta);
+        }
+
+        /**
+         * @brief Rotate around an axis.
+         *
+         * @param axis Rotation axis, normalized here
+         * @param angleDegrees Angle in degrees
+         */
+        void RotateAroundAxis(const glm::vec3& axis, float angleDegrees) {
+            Rotate(glm::angleAxis(glm::radians(angleDegrees),
+                                  glm::normalize(axis)));
+        }
+
+        /**
+         * @brief Interpolate towards a rotation.
+         *
+         * @param targetRotation Rotation to move towards
+         * @param t Interpolation factor in [0, 1]
+         */
+        void SlerpRotation(const glm::quat& targetRotation, float t) {
+            SetRotation(glm::slerp(GetRotationQuat(), targetRotation, t));
+        }
+
+        /**
+         * @brief Multiply the scale per axis.
+         * @param scaleFactor Factors for each axis
+         */
+        void Scale(const glm::vec3& scaleFactor) {
+            SetScale(GetScale() * scaleFactor);
+        }
+
+        /**
+         * @brief Multiply the scale uniformly.
+         * @param scaleFactor Factor for all axes
+         */
+        void Scale(float scaleFactor) { SetScale(GetScale() * scaleFactor); }
+
+        /**
+         * @brief Get the forward direction (-Z rotated).
+         * @return Unit forward vector
+         */
+        glm::vec3 GetForward() const {
+            return GetRotationQuat() * glm::vec3(0.0f, 0.0f, -1.0f);
+        }
+
+        /**
+         * @brief Get the right direction (+X rotated).
+         * @return Unit right vector
+         */
+        glm::vec3 GetRight() const {
+            return GetRotationQuat() * glm::vec3(1.0f, 0.0f, 0.0f);
+        }
+
+        /**
+         * @brief Get the up direction (+Y rotated).
+         * @return Unit up vector
+         */
+        glm::vec3 GetUp() const {
+            return GetRotationQuat() * glm::vec3(0.0f, 1.0f, 0.0f);
+        }
+};
+
+/**
+ * @brief Structure-of-arrays storage for the Transform component.
+ *
+ * Positions, rotations and scales are kept as one float array per component
+ * (X, Y, Z, ...) in dense slot order, with the composed model matrices in a
+ * separate contiguous array that can be uploaded as it is. Setters record
+ * the slot in a compact dirty list instead of flagging a per-object cache.
+ *
+ * UpdateMatrices() rebuilds the dirty matrices directly from translation,
+ * rotation and scale, without building or multiplying intermediate
+ * matrices. It runs on the JobSystem and, per batch, uses an 8-wide AVX2
+ * kernel when compiled with AVX2 (OBELISK_AVX2), a 4-wide SSE2 kernel on
+ * other x86-64 builds and scalar code elsewhere.
+ *
+ * Transforms can be parented to each other. Entities that have a parent or
+ * children are also kept in a hierarchy array in depth-first order, each
+ * root's subtree contiguous and every parent ahead of its children. After
+ * the local matrices are built, only the subtrees of roots with a dirty
+ * member are walked, front to back, multiplying in parent matrices where
+ * something above changed; separate subtrees are walked in parallel. A frame
+ * where nothing moved returns before touching any array.
+ *
+ * Registries store Transform components here (see ComponentStorage), so
+ * Registry::Get<Transform>() and views return TransformRefs.
+ *
+ * @example
+ * ```cpp
+ * TransformStorage& transforms = registry.GetPool<Transform>();
+ * transforms.Get(id).SetPosition(0.0f, 1.0f, 0.0f);
+ *
+ * transforms.SetParent(weaponID, id);  // weapon follows the entity
+ *
+ * transforms.UpdateMatrices();  // once per frame
+ * const glm::mat4& model = transforms.GetMatrix(transforms.GetSlot(id));
+ * ```
+ */
+class OBELISK_API TransformStorage : public SparseSet {
+    public:
+        static constexpr size_t PARALLEL_BATCH =
+            4096;  ///< Dirty matrices per JobSystem batch
+        static constexpr size_t SUBTREE_BATCH =
+            16;  ///< Dirty hierarchy roots per JobSystem batch
+
+        /**
+         * @brief Float array of each stored value.
+         */
+        enum Channel : uint32_t {
+            PositionX,
+            PositionY,
+            PositionZ,
+            RotationX,
+            RotationY,
+            RotationZ,
+            RotationW,
+            ScaleX,
+            ScaleY,
+            ScaleZ,
+            ChannelCount
+        };
+
+    private:
+        std::array<std::vector<float>, ChannelCount>
+            m_Channels;                     ///< Values per slot, by channel
+        std::vector<glm::mat4> m_Matrices;  ///< Model matrix per slot
+        std::vector<uint8_t> m_Dirty;  ///< Whether a slot's matrix is stale
+        std::vector<uint32_t>
+            m_DirtySlots;  ///< Slots marked dirty; may hold stale entries
+        std::vector<uint8_t> m_Moved;  ///< Whether a slot is in m_MovedIDs
+        std::vector<EntityID>
+            m_MovedIDs;  ///< Entities moved since the last ConsumeMoved()
+
+        /**
+         * @brief An entity with a parent or children.
+         */
+        struct HierarchyNode {
+                glm::mat4 Local =
+                    glm::mat4(1.0f);        ///< Matrix relative to the parent
+                EntityID Entity;            ///< Entity this node belongs to
+                EntityID ParentEntity;      ///< Parent, null for roots
+                uint32_t Parent = NO_SLOT;  ///< Parent's node index
+                uint32_t Root = 0;          ///< Node index of the root
+                uint32_t SubtreeSize = 1;   ///< This node plus descendants
+                bool LocalChanged = false;  ///< Local matrix was rebuilt
+                bool WorldChanged = false;  ///< World matrix was rebuilt
+                bool Queued = false;        ///< Root is in m_DirtyRoots
+        };
+
+        std::vector<HierarchyNode>
+            m_Nodes;  ///< Depth-first, parents before their children
+        std::vector<uint32_t> m_NodeOf;  ///< Entity index to node index
+        std::vector<uint32_t>
+            m_DirtyRoots;  ///< Roots to walk in the current update
+
+    public:
+        /**
+         * @brief Give an entity an identity transform, or reset its own.
+         *
+         * @param id Entity to add
+         * @return Reference to the transform
+         */
+        TransformRef Emplace(EntityID id);
+
+        /**
+         * @brief Give an entity a copy of a transform, or overwrite its own.
+         *
+         * @param id Entity to add
+         * @param transform Position, rotation and scale to copy
+         * @return Reference to the transform
+         */
+        TransformRef Emplace(EntityID id, const Transform& transform);
+
+        /**
+         * @brief Add transforms to many entities at once.
+         *
+         * The values are copied channel by channel, as blocks; the added
+         * slots are dirty and reported as moved.
+         *
+         * @param ids Entities to add, none of them members
+         * @param channels ChannelCount arrays of ids.size() floats, in
+         * Channel order, laid out like GetChannel()
+         */
+        void Append(std::span<const EntityID> ids,
+                    std::span<const float> channels);
+
+        void Remove(EntityID id) override;
+        void Clear() override;
+
+        /**
+         * @brief Get a member's transform.
+         *
+         * @param id Entity that must be a member
+         * @return Reference to its transform
+         */
+        TransformRef Get(EntityID id) {
+            return TransformRef(this, GetSlot(id));
+        }
+
+        /**
+         * @brief Get the position in a slot.
+         */
+        glm::vec3 GetPosition(uint32_t slot) const {
+            return glm::vec3(m_Channels[PositionX][slot],
+                             m_Channels[PositionY][slot],
+                             m_Channels[PositionZ][slot]);
+        }
+
+        /**
+         * @brief Get the rotation in a slot.
+         */
+        glm::quat GetRotation(uint32_t slot) const {
+            return glm::quat(
+                m_Channels[RotationW][slot], m_Channels[RotationX][slot],
+                m_Channels[RotationY][slot], m_Channels[RotationZ][slot]);
+        }
+
+        /**
+         * @brief Get the scale in a slot.
+         */
+        glm::vec3 GetScale(uint32_t slot) const {
+            return glm::vec3(m_Channels[ScaleX][slot], m_Channels[ScaleY][slot],
+                             m_Channels[ScaleZ][slot]);
+        }
+
+        /**
+         * @brief Set the position in a slot and mark it dirty.
+         */
+        void SetPosition(uint32_t slot, const glm::vec3& position);
+
+        /**
+         * @brief Set the rotation in a slot and mark it dirty.
+         */
+        void SetRotation(uint32_t slot, const glm::quat& rotation);
+
+        /**
+         * @brief Set the scale in a slot and mark it dirty.
+         */
+        void SetScale(uint32_t slot, const glm::vec3& scale);
+
+        /**
+         * @brief Get the model matrix of a slot.
+         *
+         * A dirty slot is composed on the spot; prefer UpdateMatrices() when
+         * many slots are read.
+         *
+         * @param slot Dense slot
+         * @return Its model matrix
+         */
+        const glm::mat4& GetMatrix(uint32_t slot);
+
+        /**
+         * @brief Rebuild the matrices of every dirty slot, then propagate
+         * them down the hierarchy.
+         *
+         * @return Number of local matrices rebuilt
+         */
+        size_t UpdateMatrices();
+
+        /**
+         * @brief Get all model matrices in dense slot order.
+         *
+         * @return Matrices, current after UpdateMatrices()
+         */
+        const std::vector<glm::mat4>& GetMatrices() const {
+            return m_Matrices;
+        }
+
+        /**
+         * @brief Get one stored value of every slot.
+         *
+         * @param channel Value to get
+         * @return Floats in dense slot order
+         */
+        const std::vector<float>& GetChannel(Channel channel) const {
+            return m_Channels[channel];
+        }
+
+        /**
+         * @brief Attach a transform to a parent, or detach it.
+         *
+         * The local position, rotation and scale are kept, so the entity
+         * moves to the same place relative to the new parent. Its children
+         * come along.
+         *
+         * @param child Member to reparent
+         * @param parent New parent, or a null ID to make the child a root
+         * @return false if either is not a member or the parent is the child
+         * or one of its descendants
+         */
+        bool SetParent(EntityID child, EntityID parent);
+
+        /**
+         * @brief Get a member's parent.
+         *
+         * @param id Member to look up
+         * @return Its parent, or a null ID for roots
+         */
+        EntityID GetParent(EntityID id) const;
+
+        /**
+         * @brief Get every descendant of a member.
+         *
+         * @param id Member to look up
+         * @return Children, grandchildren, ..., parents before children
+         */
+        std::vector<EntityID> GetDescendants(EntityID id) const;
+
+        /**
+         * @brief Report a member as moved without changing its transform,
+         * e.g. because its bounds changed.
+         *
+         * @param id Entity that must be a member
+         */
+        void MarkMoved(EntityID id) { MarkMoved(GetSlot(id)); }
+
+        /**
+         * @brief Take the entities whose world matrix may have changed since
+         * the last call.
+         *
+         * Covers every member that was set, reset, added or reported with
+         * MarkMoved(), and every hierarchy member whose world matrix
+         * UpdateMatrices() rebuilt because an ancestor moved. Call after
+         * UpdateMatrices(). Each entity is listed once; entities removed in
+         * the meantime may still be listed.
+         *
+         * @param moved Receives the entities; cleared first
+         */
+        void ConsumeMoved(std::vector<EntityID>& moved);
+
+        /**
+         * @brief Get the name of the kernel UpdateMatrices() uses.
+         *
+         * @return "AVX2", "SSE2" or "Scalar"
+         */
+        static const char* GetKernelName();
+
+    private:
+        /**
+         * @brief Mark a slot dirty, adding it to the dirty list once.
+         */
+        void MarkDirty(uint32_t slot) {
+            if (!m_Dirty[slot]) {
+                m_Dirty[slot] = 1;
+                m_DirtySlots.push_back(slot);
+            }
+            MarkMoved(slot);
+        }
+
+        /**
+         * @brief Add a slot's entity to the moved list once.
+         */
+        void MarkMoved(uint32_t slot) {
+            if (!m_Moved[slot]) {
+                m_Moved[slot] = 1;
+                m_MovedIDs.push_back(m_Dense[slot]);
+            }
+        }
+
+        /**
+         * @brief Compose the matrices of a list of slots.
+         *
+         * @param slots Slots to compose
+         * @param count Number of slots
+         */
+        void ComposeSlots(const uint32_t* slots, size_t count);
+
+        /**
+         * @brief Compose one matrix without SIMD.
+         */
+        void ComposeScalar(uint32_t slot);
+
+        /**
+         * @brief Get an entity's hierarchy node.
+         *
+         * @return Node index, or NO_SLOT if it has no parent or children
+         */
+        uint32_t GetNode(EntityID id) const {
+            return id.Index < m_NodeOf.size() ? m_NodeOf[id.Index] : NO_SLOT;
+        }
+
+        /**
+         * @brief Get a member's hierarchy node, adding a root node if needed.
+         */
+        uint32_t AddNode(EntityID id);
+
+        /**
+         * @brief Remove a member's node; its children become roots.
+         */
+        void RemoveNode(uint32_t node);
+
+        /**
+         * @brief Recompute node indices after nodes moved in m_Nodes.
+         *
+         * Nodes before the first moved one keep their indices, as do their
+         * parents, so only the rest of the array is visited.
+         *
+         * @param first Index of the first node that moved
+         */
+        void RebuildHierarchy(uint32_t first);
+
+        /**
+         * @brief Walk a root's subtree and rebuild world matrices where a
+         * node or one of its ancestors changed.
+         */
+        void PropagateSubtree(uint32_t root);
+};
+
+/**
+ * @brief Store Transform components in a TransformStorage.
+ */
+template <>
+struct ComponentStorage<Transform> {
+        using Type = TransformStorage;  ///< Pool class for Transform
+};
+
+inline glm::mat4 TransformRef::GetModelMatrix() const {
+    return m_Storage->GetMatrix(m_Slot);
+}
+
+inline glm::vec3 TransformRef::GetPosition() const {
+    return m_Storage->GetPosition(m_Slot);
+}
+
+inline glm::quat TransformRef::GetRotationQuat() const {
+    return m_Storage->GetRotation(m_Slot);
+}
+
+inline glm::vec3 TransformRef::GetScale() const {
+    return m_Storage->GetScale(m_Slot);
+}
+
+inline void TransformRef::SetPosition(glm::vec3 position) {
+    m_Storage->SetPosition(m_Slot, position);
+}
+
+inline void TransformRef::SetRotation(const glm::quat& quaternion) {
+    m_Storage->SetRotation(m_Slot, quaternion);
+}
+
+inline void TransformRef::SetScale(glm::vec3 scale) {
+    m_Storage->SetScale(m_Slot, scale);
+}
+
+}  // namespace Obelisk
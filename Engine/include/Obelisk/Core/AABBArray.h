@@ -0,0 +1,151 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include <bit>
+#include "Obelisk/Core/Bounds.h"
+
+namespace Obelisk {
+
+/**
+ * @brief Boxes stored as structure-of-arrays for SIMD tests.
+ *
+ * Each corner coordinate has an array of its own, padded to whole packets,
+ * so Raycast() tests PACKET_SIZE boxes with a few vector instructions
+ * (AVX or SSE2 when the compiler targets them, scalar otherwise). Meant for
+ * flat sets of boxes scanned front to back, such as the bounds of a
+ * Scene's entities in HashGrid mode.
+ *
+ * @example
+ * ```cpp
+ * AABBArray boxes;
+ * boxes.Resize(bounds.size());
+ * for (size_t i = 0; i < bounds.size(); i++) {
+ *     boxes.Set(i, bounds[i]);
+ * }
+ *
+ * boxes.Raycast(ray, 100.0f, [&](uint32_t index, float distance) {
+ *     closest = index;
+ *     return distance;  // only closer boxes from here on
+ * });
+ * ```
+ */
+class OBELISK_API AABBArray {
+    public:
+        static constexpr size_t PACKET_SIZE =
+            8;  ///< Boxes tested together by Raycast()
+
+    private:
+        std::vector<float> m_MinX;  ///< Min.x of every box
+        std::vector<float> m_MinY;  ///< Min.y of every box
+        std::vector<float> m_MinZ;  ///< Min.z of every box
+        std::vector<float> m_MaxX;  ///< Max.x of every box
+        std::vector<float> m_MaxY;  ///< Max.y of every box
+        std::vector<float> m_MaxZ;  ///< Max.z of every box
+        size_t m_Size = 0;          ///< Boxes, without the padding
+
+    public:
+        /**
+         * @brief Change the number of boxes.
+         *
+         * Added boxes are empty.
+         *
+         * @param size New number of boxes
+         */
+        void Resize(size_t size);
+
+        /**
+         * @brief Remove every box, keeping the memory.
+         */
+        void Clear() { Resize(0); }
+
+        /**
+         * @brief Get the number of boxes.
+         * @return Boxes, without the padding
+         */
+        size_t Size() const { return m_Size; }
+
+        /**
+         * @brief Replace a box.
+         *
+         * Different boxes may be set from different threads.
+         *
+         * @param index Box below Size()
+         * @param box New box
+         */
+        void Set(size_t index, const AABB& box) {
+            m_MinX[index] = box.Min.x;
+            m_MinY[index] = box.Min.y;
+            m_MinZ[index] = box.Min.z;
+            m_MaxX[index] = box.Max.x;
+            m_MaxY[index] = box.Max.y;
+            m_MaxZ[index] = box.Max.z;
+        }
+
+        /**
+         * @brief Get a box.
+         *
+         * @param index Box below Size()
+         * @return Copy of the box
+         */
+        AABB Get(size_t index) const {
+            return AABB(glm::vec3(m_MinX[index], m_MinY[index], m_MinZ[index]),
+                        glm::vec3(m_MaxX[index], m_MaxY[index], m_MaxZ[index]));
+        }
+
+        /**
+         * @brief Visit the boxes a ray enters, in index order.
+         *
+         * @param ray Ray to cast
+         * @param maxDistance Length of the ray
+         * @param func Called as float func(uint32_t index, float distance)
+         * with the box's entry distance; returns the new length of the ray,
+         * so returning distance looks for closer boxes only and returning
+         * 0 stops the cast
+         */
+        template <typename Func>
+        void Raycast(const Ray& ray, float maxDistance, Func&& func) const {
+            float entries[PACKET_SIZE];
+            for (size_t first = 0; first < m_Size; first += PACKET_SIZE) {
+                uint32_t hits = IntersectPacket(ray, first, maxDistance,
+                                                entries);
+                if (m_Size - first < PACKET_SIZE) {
+                    // The padding never counts
+                    hits &= (1u << (m_Size - first)) - 1;
+                }
+
+                while (hits) {
+                    int lane = std::countr_zero(hits);
+                    hits &= hits - 1;
+                    if (entries[lane] <= maxDistance) {
+                        maxDistance = func(static_cast<uint32_t>(first + lane),
+                                           entries[lane]);
+                        if (maxDistance <= 0.0f) {
+                            return;
+                        }
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Get the name of the kernel Raycast() uses.
+         *
+         * @return "AVX", "SSE2" or "Scalar"
+         */
+        static const char* GetKernelName();
+
+    private:
+        /**
+         * @brief Slab-test the ray against one packet of boxes.
+         *
+         * @param ray Ray to cast
+         * @param first First box of the packet, a multiple of PACKET_SIZE
+         * @param maxDistance Length of the ray
+         * @param entries Receives the entry distance of every box
+         * @return Bit i set if box first + i is entered within maxDistance
+         */
+        uint32_t IntersectPacket(const Ray& ray, size_t first,
+                                 float maxDistance, float* entries) const;
+};
+
+}  // namespace Obelisk
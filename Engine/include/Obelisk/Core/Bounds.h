@@ -0,0 +1,269 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include <limits>
+
+namespace Obelisk {
+
+/**
+ * @brief Axis-aligned bounding box.
+ *
+ * A default-constructed AABB is empty (Min > Max), so it can be grown point
+ * by point with Expand() without special-casing the first point.
+ *
+ * @example
+ * ```cpp
+ * AABB bounds;
+ * for (const auto& vertex : vertices) {
+ *     bounds.Expand(vertex.Position);
+ * }
+ * AABB world = bounds.Transformed(transform.GetModelMatrix());
+ * ```
+ */
+struct AABB {
+        glm::vec3 Min = glm::vec3(
+            std::numeric_limits<float>::max());  ///< Minimum corner
+        glm::vec3 Max = glm::vec3(
+            -std::numeric_limits<float>::max());  ///< Maximum corner
+
+        AABB() = default;
+
+        /**
+         * @brief Create a box from its corners.
+         *
+         * @param min Minimum corner
+         * @param max Maximum corner
+         */
+        AABB(const glm::vec3& min, const glm::vec3& max) : Min(min), Max(max) {}
+
+        /**
+         * @brief Create a box from its center and half extents.
+         *
+         * @param center Center of the box
+         * @param extents Half the size along each axis
+         * @return The box
+         */
+        static AABB FromCenterExtents(const glm::vec3& center,
+                                      const glm::vec3& extents) {
+            return AABB(center - extents, center + extents);
+        }
+
+        /**
+         * @brief Check whether the box contains no points.
+         * @return true if Min exceeds Max on any axis
+         */
+        bool IsEmpty() const {
+            return Min.x > Max.x || Min.y > Max.y || Min.z > Max.z;
+        }
+
+        /**
+         * @brief Get the center of the box.
+         * @return Center point
+         */
+        glm::vec3 GetCenter() const { return (Min + Max) * 0.5f; }
+
+        /**
+         * @brief Get the half extents of the box.
+         * @return Half the size along each axis
+         */
+        glm::vec3 GetExtents() const { return (Max - Min) * 0.5f; }
+
+        /**
+         * @brief Get the size of the box.
+         * @return Size along each axis
+         */
+        glm::vec3 GetSize() const { return Max - Min; }
+
+        /**
+         * @brief Get the surface area, the usual cost metric for bounding
+         * volume hierarchies.
+         * @return Surface area
+         */
+        float GetSurfaceArea() const {
+            glm::vec3 size = GetSize();
+            return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+        }
+
+        /**
+         * @brief Grow the box to include a point.
+         * @param point Point to include
+         */
+        void Expand(const glm::vec3& point) {
+            Min = glm::min(Min, point);
+            Max = glm::max(Max, point);
+        }
+
+        /**
+         * @brief Grow the box to include another box.
+         * @param other Box to include
+         */
+        void Expand(const AABB& other) {
+            Min = glm::min(Min, other.Min);
+            Max = glm::max(Max, other.Max);
+        }
+
+        /**
+         * @brief Check whether a point lies inside the box (inclusive).
+         * @param point Point to test
+         * @return true if the point is inside
+         */
+        bool Contains(const glm::vec3& point) const {
+            return point.x >= Min.x && point.x <= Max.x && point.y >= Min.y &&
+                   point.y <= Max.y && point.z >= Min.z && point.z <= Max.z;
+        }
+
+        /**
+         * @brief Check whether another box lies entirely inside this one.
+         * @param other Box to test
+         * @return true if other is contained
+         */
+        bool Contains(const AABB& other) const {
+            return Contains(other.Min) && Contains(other.Max);
+        }
+
+        /**
+         * @brief Check whether two boxes overlap (touching counts).
+         * @param other Box to test
+         * @return true if the boxes intersect
+         */
+        bool Intersects(const AABB& other) const {
+            return Min.x <= other.Max.x && Max.x >= other.Min.x &&
+                   Min.y <= other.Max.y && Max.y >= other.Min.y &&
+                   Min.z <= other.Max.z && Max.z >= other.Min.z;
+        }
+
+        /**
+         * @brief Get the box enclosing this box after a transformation.
+         *
+         * Uses the absolute-matrix method, so the result is exact for the
+         * transformed corners without transforming all eight of them.
+         *
+         * @param transform Affine transformation matrix
+         * @return Axis-aligned bounds of the transformed box
+         */
+        AABB Transformed(const glm::mat4& transform) const {
+            glm::vec3 center =
+                glm::vec3(transform * glm::vec4(GetCenter(), 1.0f));
+            glm::vec3 extents = GetExtents();
+            glm::vec3 newExtents(0.0f);
+            for (int axis = 0; axis < 3; axis++) {
+                newExtents += glm::abs(glm::vec3(transform[axis])) *
+                              extents[axis];
+            }
+            return FromCenterExtents(center, newExtents);
+        }
+};
+
+/**
+ * @brief Half-line from an origin along a direction.
+ *
+ * The reciprocal of the direction is cached for slab tests, so the members
+ * are set through the constructor only.
+ *
+ * @example
+ * ```cpp
+ * Ray ray(camera.GetPosition(), camera.GetForward());
+ * float distance;
+ * if (ray.Intersects(entity.GetBounds(), 100.0f, distance)) {
+ *     glm::vec3 hit = ray.GetPoint(distance);
+ * }
+ * ```
+ */
+struct Ray {
+        glm::vec3 Origin = glm::vec3(0.0f);                  ///< Start point
+        glm::vec3 Direction = glm::vec3(0.0f, 0.0f, -1.0f);  ///< Normalized
+        glm::vec3 InverseDirection =
+            1.0f / glm::vec3(0.0f, 0.0f, -1.0f);  ///< 1 / Direction
+
+        Ray() = default;
+
+        /**
+         * @brief Create a ray.
+         *
+         * @param origin Start point
+         * @param direction Direction; distances are in its length units, so
+         * it is normally normalized
+         */
+        Ray(const glm::vec3& origin, const glm::vec3& direction)
+            : Origin(origin),
+              Direction(direction),
+              InverseDirection(1.0f / direction) {}
+
+        /**
+         * @brief Get the point at a distance along the ray.
+         * @param distance Distance from the origin
+         * @return Origin + Direction * distance
+         */
+        glm::vec3 GetPoint(float distance) const {
+            return Origin + Direction * distance;
+        }
+
+        /**
+         * @brief Intersect the ray with a box (slab test).
+         *
+         * @param box Box to test
+         * @param maxDistance Ignore hits beyond this distance
+         * @param distance Receives the entry distance, 0 if the origin is
+         * inside the box
+         * @return true if the ray enters the box within maxDistance
+         */
+        bool Intersects(const AABB& box, float maxDistance,
+                        float& distance) const {
+            glm::vec3 t1 = (box.Min - Origin) * InverseDirection;
+            glm::vec3 t2 = (box.Max - Origin) * InverseDirection;
+            glm::vec3 entries = glm::min(t1, t2);
+            glm::vec3 exits = glm::max(t1, t2);
+            float enter = std::max(std::max(entries.x, entries.y),
+                                   std::max(entries.z, 0.0f));
+            float exit = std::min(std::min(exits.x, exits.y),
+                                  std::min(exits.z, maxDistance));
+            distance = enter;
+            return enter <= exit;
+        }
+
+        /**
+         * @brief Intersect the ray with a triangle (Moller-Trumbore).
+         *
+         * Both faces count as hits.
+         *
+         * @param a First corner
+         * @param b Second corner
+         * @param c Third corner
+         * @param maxDistance Ignore hits beyond this distance
+         * @param distance Receives the hit distance
+         * @return true if the ray hits the triangle within maxDistance
+         */
+        bool Intersects(const glm::vec3& a, const glm::vec3& b,
+                        const glm::vec3& c, float maxDistance,
+                        float& distance) const {
+            glm::vec3 edge1 = b - a;
+            glm::vec3 edge2 = c - a;
+            glm::vec3 p = glm::cross(Direction, edge2);
+            float determinant = glm::dot(edge1, p);
+            if (determinant == 0.0f) {
+                // Parallel to the triangle, or the triangle is degenerate
+                return false;
+            }
+
+            // Barycentric coordinates of the hit, then its distance
+            float inverse = 1.0f / determinant;
+            glm::vec3 s = Origin - a;
+            float u = glm::dot(s, p) * inverse;
+            if (u < 0.0f || u > 1.0f) {
+                return false;
+            }
+            glm::vec3 q = glm::cross(s, edge1);
+            float v = glm::dot(Direction, q) * inverse;
+            if (v < 0.0f || u + v > 1.0f) {
+                return false;
+            }
+            float t = glm::dot(edge2, q) * inverse;
+            if (t < 0.0f || t > maxDistance) {
+                return false;
+            }
+            distance = t;
+            return true;
+        }
+};
+
+}  // namespace Obelisk
@@ -2,6 +2,7 @@
 
 #include "ObeliskPCH.h"
 #include "Obelisk/Components/Transform.h"
+#include "Obelisk/Core/Bounds.h"
 
 namespace Obelisk {
 
@@ -43,6 +44,10 @@ class OBELISK_API Camera {
             glm::mat4(1.0f);  ///< Cached projection matrix
         mutable glm::mat4 m_ViewMatrix =
             glm::mat4(1.0f);  ///< Cached view matrix
+        mutable glm::mat4 m_InverseProjectionMatrix =
+            glm::mat4(1.0f);  ///< Cached inverse of m_ProjectionMatrix
+        mutable glm::mat4 m_InverseViewMatrix =
+            glm::mat4(1.0f);  ///< Cached inverse of m_ViewMatrix
         mutable bool m_ProjectionDirty =
             true;  ///< Flag indicating projection matrix needs recalculation
         mutable bool m_ViewDirty =
@@ -251,6 +256,20 @@ class OBELISK_API Camera {
          */
         glm::mat4 GetViewProjectionMatrix() const;
 
+        /**
+         * @brief Get inverse view matrix
+         * @return Inverse view matrix (camera to world space), cached
+         * alongside the view matrix
+         */
+        const glm::mat4& GetInverseViewMatrix() const;
+
+        /**
+         * @brief Get inverse projection matrix
+         * @return Inverse projection matrix (clip to camera space), cached
+         * alongside the projection matrix
+         */
+        const glm::mat4& GetInverseProjectionMatrix() const;
+
         // === Utility Methods ===
 
         /**
@@ -260,6 +279,35 @@ class OBELISK_API Camera {
          */
         glm::vec3 ScreenToWorldRay(const glm::vec2& screenPos) const;
 
+        /**
+         * @brief Get the ray through a screen position, e.g. for picking
+         *
+         * Starts on the near plane, so it also works for orthographic
+         * projections, where rays do not start at the camera position.
+         *
+         * @param screenPos Screen position (normalized device coordinates)
+         * @return World-space ray with a normalized direction
+         *
+         * @example
+         * ```cpp
+         * RaycastHit hit;
+         * if (scene.Pick(camera.ScreenPointToRay(cursor), 100.0f, hit)) {
+         *     Select(hit.HitEntity);
+         * }
+         * ```
+         */
+        Ray ScreenPointToRay(const glm::vec2& screenPos) const;
+
+        /**
+         * @brief Get the ray through a screen position and its length
+         *
+         * @param screenPos Screen position (normalized device coordinates)
+         * @param length Receives the distance from the near plane to the far
+         * plane along the ray, i.e. the longest useful ray
+         * @return World-space ray with a normalized direction
+         */
+        Ray ScreenPointToRay(const glm::vec2& screenPos, float& length) const;
+
         /**
          * @brief Convert world position to screen coordinates
          * @param worldPos World position
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include "Obelisk/Core/Bounds.h"
+
+namespace Obelisk {
+
+/**
+ * @brief View frustum as six inward-facing planes, used for culling.
+ *
+ * The planes are extracted directly from a view-projection matrix
+ * (Gribb/Hartmann), so they are in the space the matrix transforms from,
+ * normally world space.
+ *
+ * @example
+ * ```cpp
+ * Frustum frustum(camera.GetViewProjectionMatrix());
+ * if (frustum.Intersects(entity.GetBounds())) {
+ *     entity.Submit();
+ * }
+ * ```
+ */
+struct Frustum {
+        /**
+         * @brief Indices into Planes.
+         */
+        enum Plane { Left, Right, Bottom, Top, Near, Far, PlaneCount };
+
+        glm::vec4 Planes[PlaneCount] = {};  ///< xyz: normal, w: distance
+
+        Frustum() = default;
+
+        /**
+         * @brief Extract the planes of a view-projection matrix.
+         * @param viewProjection Matrix mapping into OpenGL clip space
+         */
+        explicit Frustum(const glm::mat4& viewProjection) {
+            glm::mat4 m = glm::transpose(viewProjection);
+            Planes[Left] = m[3] + m[0];
+            Planes[Right] = m[3] - m[0];
+            Planes[Bottom] = m[3] + m[1];
+            Planes[Top] = m[3] - m[1];
+            Planes[Near] = m[3] + m[2];
+            Planes[Far] = m[3] - m[2];
+
+            for (glm::vec4& plane : Planes) {
+                plane /= glm::length(glm::vec3(plane));
+            }
+        }
+
+        /**
+         * @brief Check whether a point lies inside the frustum.
+         * @param point Point to test
+         * @return true if the point is on the inner side of every plane
+         */
+        bool Contains(const glm::vec3& point) const {
+            for (const glm::vec4& plane : Planes) {
+                if (glm::dot(glm::vec3(plane), point) + plane.w < 0.0f) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Conservatively check whether a box overlaps the frustum.
+         *
+         * A box is only rejected when it lies entirely outside one plane, so
+         * some boxes near the frustum corners are reported as visible.
+         *
+         * @param box Box to test
+         * @return false if the box is definitely outside
+         */
+        bool Intersects(const AABB& box) const {
+            glm::vec3 center = box.GetCenter();
+            glm::vec3 extents = box.GetExtents();
+            for (const glm::vec4& plane : Planes) {
+                glm::vec3 normal(plane);
+                float radius = glm::dot(extents, glm::abs(normal));
+                if (glm::dot(normal, center) + plane.w < -radius) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Check whether a box lies entirely inside the frustum.
+         *
+         * Lets hierarchical culling accept whole subtrees without testing
+         * their contents.
+         *
+         * @param box Box to test
+         * @return true if the box is on the inner side of every plane
+         */
+        bool Contains(const AABB& box) const {
+            glm::vec3 center = box.GetCenter();
+            glm::vec3 extents = box.GetExtents();
+            for (const glm::vec4& plane : Planes) {
+                glm::vec3 normal(plane);
+                float radius = glm::dot(extents, glm::abs(normal));
+                if (glm::dot(normal, center) + plane.w < radius) {
+                    return false;
+                }
+            }
+            return true;
+        }
+};
+
+}  // namespace Obelisk
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include <string_view>
+
+namespace Obelisk {
+
+/**
+ * @brief Small, dependency-free hashing helpers.
+ *
+ * Provides a 64-bit FNV-1a implementation for content hashing (cache keys,
+ * resource deduplication, change detection). FNV-1a is not cryptographic, but
+ * it is fast, stable across platforms and runs, and good enough to key on-disk
+ * caches where a collision only costs a cache miss.
+ *
+ * @example
+ * ```cpp
+ * uint64_t key = Hash::FNV1a(vertexSource);
+ * key = Hash::FNV1a(fragmentSource, key);  // Chain further input
+ * ```
+ */
+class Hash {
+    public:
+        static constexpr uint64_t FNV_OFFSET_BASIS =
+            14695981039346656037ull;  ///< FNV-1a 64-bit offset basis
+        static constexpr uint64_t FNV_PRIME =
+            1099511628211ull;  ///< FNV-1a 64-bit prime
+
+        /**
+         * @brief Hash a block of raw bytes.
+         *
+         * @param data Pointer to the bytes to hash
+         * @param size Number of bytes to hash
+         * @param seed Previous hash value to continue from (default: offset
+         * basis)
+         * @return 64-bit FNV-1a hash
+         */
+        static uint64_t FNV1a(const void* data, size_t size,
+                              uint64_t seed = FNV_OFFSET_BASIS) {
+            const auto* bytes = static_cast<const unsigned char*>(data);
+            uint64_t hash = seed;
+            for (size_t i = 0; i < size; ++i) {
+                hash ^= bytes[i];
+                hash *= FNV_PRIME;
+            }
+            return hash;
+        }
+
+        /**
+         * @brief Hash a string.
+         *
+         * @param text Text to hash
+         * @param seed Previous hash value to continue from (default: offset
+         * basis)
+         * @return 64-bit FNV-1a hash
+         */
+        static uint64_t FNV1a(std::string_view text,
+                              uint64_t seed = FNV_OFFSET_BASIS) {
+            return FNV1a(text.data(), text.size(), seed);
+        }
+
+        /**
+         * @brief Combine two hash values into one.
+         *
+         * @param seed Existing hash value
+         * @param value Hash value to mix in
+         * @return Combined hash
+         */
+        static uint64_t Combine(uint64_t seed, uint64_t value) {
+            return FNV1a(&value, sizeof(value), seed);
+        }
+};
+
+}  // namespace Obelisk
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Obelisk {
+
+/**
+ * @brief Persistent worker threads for data-parallel engine work.
+ *
+ * Spawning threads every frame costs more than most per-frame jobs take, so
+ * the JobSystem keeps a fixed set of workers alive and hands them ranges of
+ * a ParallelFor. The calling thread works on the same job, and the call
+ * returns once every range is done.
+ *
+ * Only one ParallelFor runs at a time; it is meant for short, frame-level
+ * work such as light binning, not for long-running tasks. Before
+ * Initialize() (or with zero workers) ParallelFor runs inline.
+ *
+ * @example
+ * ```cpp
+ * JobSystem::ParallelFor(items.size(), 64, [&](size_t begin, size_t end) {
+ *     for (size_t i = begin; i < end; i++) {
+ *         Process(items[i]);
+ *     }
+ * });
+ * ```
+ */
+class OBELISK_API JobSystem {
+    public:
+        using RangeFunction = std::function<void(size_t begin, size_t end)>;
+
+    private:
+        static std::vector<std::thread> s_Workers;  ///< Worker threads
+        static std::mutex s_Mutex;  ///< Guards the job state below
+        static std::condition_variable
+            s_WorkAvailable;  ///< Wakes workers for a new job
+        static std::condition_variable
+            s_WorkFinished;  ///< Wakes the caller when a job completes
+        static std::mutex s_SubmitMutex;  ///< Serializes ParallelFor calls
+
+        static const RangeFunction* s_Function;  ///< Current job
+        static size_t s_Count;                   ///< Items in the current job
+        static size_t s_BatchSize;               ///< Items per range
+        static std::atomic<size_t> s_NextItem;   ///< Next unclaimed item
+        static size_t s_ActiveWorkers;  ///< Workers still on the current job
+        static uint64_t s_Generation;   ///< Incremented for every job
+        static bool s_Running;          ///< Cleared to stop the workers
+
+    public:
+        /**
+         * @brief Start the worker threads.
+         *
+         * @param workerCount Number of workers; 0 picks one less than the
+         * number of hardware threads
+         */
+        static void Initialize(size_t workerCount = 0);
+
+        /**
+         * @brief Stop and join all worker threads.
+         */
+        static void Shutdown();
+
+        /**
+         * @brief Run a function over [0, count) in parallel.
+         *
+         * The range is split into batches of at least batchSize items, which
+         * are claimed by the workers and the calling thread. Blocks until
+         * every batch has been processed.
+         *
+         * @param count Number of items
+         * @param batchSize Minimum number of items per call
+         * @param function Called with [begin, end) item ranges
+         */
+        static void ParallelFor(size_t count, size_t batchSize,
+                                const RangeFunction& function);
+
+        /**
+         * @brief Get the number of worker threads (excluding the caller).
+         * @return Worker count
+         */
+        static size_t GetWorkerCount() { return s_Workers.size(); }
+
+    private:
+        /**
+         * @brief Claim and run batches of the current job until none remain.
+         */
+        static void RunBatches();
+
+        /**
+         * @brief Worker thread main loop.
+         */
+        static void WorkerLoop();
+};
+
+}  // namespace Obelisk
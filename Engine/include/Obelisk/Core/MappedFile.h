@@ -0,0 +1,74 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include <filesystem>
+
+namespace Obelisk {
+
+/**
+ * @brief Read-only memory mapping of a whole file.
+ *
+ * The operating system pages the contents in on first access, so opening
+ * costs no copy and data that is never touched is never read. The mapping
+ * is released when the object is closed or destroyed; pointers into it must
+ * not outlive that.
+ *
+ * @example
+ * ```cpp
+ * MappedFile file;
+ * if (file.Open("levels/forest.oscene")) {
+ *     Parse(file.GetData(), file.GetSize());
+ * }
+ * ```
+ */
+class OBELISK_API MappedFile {
+    private:
+        const std::byte* m_Data = nullptr;  ///< Start of the mapping
+        size_t m_Size = 0;                  ///< Mapped bytes
+#ifdef _WIN32
+        void* m_File = nullptr;     ///< File handle
+        void* m_Mapping = nullptr;  ///< File mapping object
+#endif
+
+    public:
+        MappedFile() = default;
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+        ~MappedFile() { Close(); }
+
+        /**
+         * @brief Map a file, closing the current one first.
+         *
+         * @param path File to map
+         * @return false if the file cannot be opened or mapped; empty files
+         * fail as well
+         */
+        bool Open(const std::filesystem::path& path);
+
+        /**
+         * @brief Release the mapping, if any.
+         */
+        void Close();
+
+        /**
+         * @brief Check whether a file is mapped.
+         * @return true between a successful Open() and Close()
+         */
+        bool IsOpen() const { return m_Data != nullptr; }
+
+        /**
+         * @brief Get the mapped contents.
+         * @return First byte of the file, or nullptr when closed
+         */
+        const std::byte* GetData() const { return m_Data; }
+
+        /**
+         * @brief Get the size of the mapped file.
+         * @return Bytes, 0 when closed
+         */
+        size_t GetSize() const { return m_Size; }
+};
+
+}  // namespace Obelisk
@@ -20,6 +20,7 @@ namespace Obelisk {
  * - Frame time history for smoothing and analysis
  * - Time scaling support for slow motion or fast forward effects
  * - High-precision timing using std::chrono
+ * - GPU frame and render pass timing (see GPUProfiler)
  *
  * @example
  * ```cpp
@@ -71,6 +72,11 @@ class OBELISK_API Time {
         static float s_FrameTimeSum;       ///< Sum of recent frame times
         static TimePoint s_LastFPSUpdate;  ///< Last time FPS was calculated
 
+        // GPU timing (resolved a few frames late by GPUProfiler)
+        static float s_GPUFrameTime;  ///< GPU time of last resolved frame (ms)
+        static std::vector<std::pair<std::string, float>>
+            s_GPUPassTimes;  ///< GPU time per render pass (ms)
+
     public:
         /**
          * @brief Initialize the time system
@@ -203,6 +209,43 @@ class OBELISK_API Time {
          */
         static bool IsFrameRateStable(float threshold = 5.0f);
 
+        // === GPU Timing ===
+
+        /**
+         * @brief Record GPU timings for a resolved frame
+         *
+         * Called by GPUProfiler::Publish() on the thread that updates Time,
+         * a few frames after the frame was rendered.
+         *
+         * @param frameTimeMS GPU time of the whole frame in milliseconds
+         * @param passTimesMS GPU time per render pass in milliseconds, in the
+         * order the passes were issued
+         */
+        static void RecordGPUTimings(
+            float frameTimeMS,
+            std::vector<std::pair<std::string, float>> passTimesMS);
+
+        /**
+         * @brief Get GPU frame time in milliseconds
+         * @return GPU time of the most recently resolved frame, or 0 if GPU
+         * timing is unavailable
+         */
+        static float GetGPUFrameTimeMS();
+
+        /**
+         * @brief Get GPU time of a render pass in milliseconds
+         * @param pass Pass name as given to GPUProfiler::BeginPass
+         * @return GPU time of the pass, or 0 if it was not issued
+         */
+        static float GetGPUPassTimeMS(const std::string& pass);
+
+        /**
+         * @brief Get GPU times of all render passes
+         * @return Pass names and GPU times in milliseconds
+         */
+        static const std::vector<std::pair<std::string, float>>&
+        GetGPUPassTimes();
+
         // === Utility Methods ===
 
         /**
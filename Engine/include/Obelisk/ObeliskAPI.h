@@ -2,6 +2,7 @@
 
 #include "ObeliskPCH.h"
 #include "Obelisk/Core/AssetManager.h"
+#include "Obelisk/Renderer/RenderThread.h"
 #include "Obelisk/Renderer/Window.h"
 
 namespace Obelisk {
@@ -26,8 +27,9 @@ namespace Obelisk {
  * engine.SetUpdateCallback([]() {
  *     // Update game logic
  * });
- * engine.Init(1280, 720, "My Game");
- * engine.Run();
+ * if (engine.Init(1280, 720, "My Game")) {
+ *     engine.Run();
+ * }
  * engine.Shutdown();
  * ```
  */
@@ -38,12 +40,23 @@ class OBELISK_API ObeliskAPI {
         std::function<void()>
             m_UpdateCallback;  ///< User-defined update callback (called each
                                ///< frame)
+        std::function<void(const RenderSnapshot&)>
+            m_RenderCallback;  ///< User-defined render callback (called each
+                               ///< frame after the scene is drawn)
         std::function<void()>
             m_ShutdownCallback;  ///< User-defined shutdown cleanup callback
 
         std::unique_ptr<Window>
             m_Window;  ///< Main application window (managed via RAII)
 
+        std::filesystem::path
+            m_CapturePath;  ///< GL capture destination (empty = no capture)
+        size_t m_CaptureFrames = 0;  ///< Number of frames to capture
+
+        bool m_Pipelined = false;  ///< Render on a separate thread in Run()
+        std::unique_ptr<RenderThread>
+            m_RenderThread;  ///< Render thread while a pipelined Run() lasts
+
     public:
         /**
          * @brief Get the singleton instance of the engine API.
@@ -77,6 +90,21 @@ class OBELISK_API ObeliskAPI {
          */
         void SetUpdateCallback(std::function<void()> callback);
 
+        /**
+         * @brief Set the render callback function.
+         *
+         * This callback is executed every frame after the scene has been
+         * drawn and before the frame is presented. Use this to draw UI and
+         * 2D content, e.g. through a SpriteBatch. May be set before or after
+         * Init().
+         *
+         * @param callback Function to call each frame with the snapshot
+         * being drawn; use its TotalTime and DeltaTime instead of Time,
+         * since in pipelined mode the callback runs on the render thread
+         */
+        void SetRenderCallback(
+            std::function<void(const RenderSnapshot&)> callback);
+
         /**
          * @brief Set the shutdown callback function.
          *
@@ -88,6 +116,32 @@ class OBELISK_API ObeliskAPI {
          */
         void SetShutdownCallback(std::function<void()> callback);
 
+        /**
+         * @brief Request a GL capture of the first frames.
+         *
+         * Must be called before Init(). Recording starts as soon as the
+         * context exists, so asset loading in the init callback is part of
+         * the capture. See GLCapture and the ObeliskReplay tool.
+         *
+         * @param path File the capture is written to
+         * @param frames Number of frames to capture
+         */
+        void SetCapture(const std::filesystem::path& path, size_t frames);
+
+        /**
+         * @brief Render on a separate thread, overlapping frames.
+         *
+         * When enabled, Run() moves the GL context to a RenderThread. The
+         * update callback and scene capture run on the calling thread while
+         * the render thread draws the previous frame, one frame behind at
+         * most. The render callback then runs on the render thread, and GL
+         * work started from the update callback must go through
+         * RenderThread::Enqueue(). Must be called before Run().
+         *
+         * @param pipelined Whether to render on a separate thread
+         */
+        void SetPipelined(bool pipelined) { m_Pipelined = pipelined; }
+
         /**
          * @brief Initialize the engine with specified window parameters.
          *
@@ -98,9 +152,15 @@ class OBELISK_API ObeliskAPI {
          * @param width Window width in pixels (default: 640)
          * @param height Window height in pixels (default: 480)
          * @param title Window title text (default: "Obelisk")
+         * @param backend Context backend; use WindowBackend::Headless to render
+         * offscreen without a display (default: Windowed)
+         * @return true on success; false if the window or its context could
+         * not be created, in which case no graphics systems were set up, the
+         * init callback was not called and only Shutdown() may follow
          */
-        void Init(int width = 640, int height = 480,
-                  const char* title = "Obelisk");
+        [[nodiscard]] bool Init(
+            int width = 640, int height = 480, const char* title = "Obelisk",
+            WindowBackend backend = WindowBackend::Windowed);
 
         /**
          * @brief Start the main engine loop.
@@ -108,7 +168,7 @@ class OBELISK_API ObeliskAPI {
          * Begins the main game loop, which continues until the window is
          * closed. Each iteration calls the update callback (if set) and renders
          * the current frame. This function blocks until the application should
-         * terminate.
+         * terminate. Returns at once if Init() failed.
          */
         void Run();
 
@@ -116,7 +176,8 @@ class OBELISK_API ObeliskAPI {
          * @brief Shutdown the engine and clean up resources.
          *
          * Calls the shutdown callback (if set), destroys the window,
-         * terminates graphics systems, and performs final cleanup.
+         * terminates graphics systems, and performs final cleanup. Also safe
+         * after a failed Init(), where the shutdown callback is skipped.
          */
         void Shutdown();
 
@@ -131,7 +192,20 @@ class OBELISK_API ObeliskAPI {
          */
         Window* GetWindow() { return m_Window.get(); };
 
+        /**
+         * @brief Get the render thread of a pipelined Run().
+         *
+         * @return Pointer to the RenderThread, or nullptr when not running
+         * pipelined
+         */
+        RenderThread* GetRenderThread() { return m_RenderThread.get(); }
+
     private:
+        /**
+         * @brief Main loop with rendering on a RenderThread.
+         */
+        void RunPipelined();
+
         /**
          * @brief Private constructor for singleton pattern.
          */
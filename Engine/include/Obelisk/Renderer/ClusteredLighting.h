@@ -0,0 +1,167 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include "Obelisk/Scene/Light.h"
+
+namespace Obelisk {
+
+class Camera;
+class Shader;
+
+/**
+ * @brief Clustered forward lighting for large numbers of point lights.
+ *
+ * Looping over every light per pixel does not scale. Instead, the camera
+ * frustum is split into a CLUSTERS_X x CLUSTERS_Y x CLUSTERS_Z grid of
+ * clusters (screen tiles, sliced exponentially in depth) and each frame every
+ * light is binned into the clusters its sphere of influence overlaps. The
+ * fragment shader looks up its cluster and only shades the lights listed
+ * there, so cost depends on local light density rather than the total light
+ * count.
+ *
+ * Binning runs on the JobSystem, one depth slice per job, with an SSE
+ * sphere-vs-AABB test handling four lights at a time (scalar fallback on
+ * other targets). Results are uploaded as three texture buffers, since
+ * OpenGL 3.3 has no shader storage buffers:
+ * - cluster grid: (offset, count) into the light index list per cluster
+ * - light index list: compacted light indices for all clusters
+ * - light data: view-space position/radius and color per light
+ *
+ * Shaders opt in with the CLUSTERED_LIGHTING define and
+ * `#include "clustered_lighting.glsl"`; see basic.frag.
+ *
+ * @example
+ * ```cpp
+ * ClusteredLighting::Initialize();
+ *
+ * // Each frame, before drawing:
+ * ClusteredLighting::Update(camera, scene.GetLights(), width, height);
+ *
+ * // Per draw, after binding the shader:
+ * ClusteredLighting::Apply(shader);
+ * ```
+ */
+class OBELISK_API ClusteredLighting {
+    public:
+        static constexpr uint32_t CLUSTERS_X = 16;  ///< Screen tiles across
+        static constexpr uint32_t CLUSTERS_Y = 9;   ///< Screen tiles down
+        static constexpr uint32_t CLUSTERS_Z = 24;  ///< Depth slices
+        static constexpr uint32_t CLUSTER_COUNT =
+            CLUSTERS_X * CLUSTERS_Y * CLUSTERS_Z;  ///< Total clusters
+        static constexpr uint32_t MAX_LIGHTS = 4096;  ///< Lights per frame
+        static constexpr uint32_t MAX_LIGHTS_PER_CLUSTER =
+            128;  ///< Excess lights in a cluster are dropped
+        static constexpr int FIRST_TEXTURE_UNIT =
+            4;  ///< Units 4-6 hold the light buffers (0-3 are the material's)
+
+    private:
+        /**
+         * @brief View-space bounds of one cluster.
+         */
+        struct ClusterBounds {
+                glm::vec3 Min;  ///< Minimum corner
+                glm::vec3 Max;  ///< Maximum corner
+        };
+
+        static std::vector<ClusterBounds>
+            s_Clusters;  ///< Cluster bounds in view space
+        static glm::mat4
+            s_ClusterProjection;  ///< Projection the bounds were built for
+
+        // Lights in view space, structure-of-arrays for SIMD tests
+        static std::vector<float> s_LightX;        ///< View-space x
+        static std::vector<float> s_LightY;        ///< View-space y
+        static std::vector<float> s_LightZ;        ///< View-space z
+        static std::vector<float> s_LightRadius;   ///< Radius
+        static std::vector<glm::vec4> s_LightData;  ///< GPU light records
+
+        static std::vector<std::vector<uint32_t>>
+            s_SliceIndices;  ///< Light indices binned per depth slice
+        static std::vector<glm::uvec2>
+            s_Grid;  ///< (offset, count) per cluster
+        static std::vector<uint32_t> s_Indices;  ///< Compacted light indices
+
+        static unsigned int s_Buffers[3];   ///< Grid, index and light buffers
+        static unsigned int s_Textures[3];  ///< Texture buffer views
+        static int s_MaxTexels;             ///< GL_MAX_TEXTURE_BUFFER_SIZE
+        static glm::vec2 s_ScreenSize;      ///< Viewport size in pixels
+        static glm::vec2 s_DepthParams;     ///< Slice = log(z) * x - y
+        static glm::vec3 s_AmbientLight;    ///< Constant ambient term
+        static size_t s_LightCount;         ///< Lights binned this frame
+        static bool s_Initialized;          ///< Whether GL objects exist
+
+    public:
+        /**
+         * @brief Create the GPU buffers.
+         *
+         * Must be called once after the OpenGL context has been created.
+         */
+        static void Initialize();
+
+        /**
+         * @brief Release the GPU buffers.
+         */
+        static void Shutdown();
+
+        /**
+         * @brief Bin the lights for this frame and upload the results.
+         *
+         * @param camera Camera the frame is rendered from
+         * @param lights Lights to bin (at most MAX_LIGHTS are used)
+         * @param width Viewport width in pixels
+         * @param height Viewport height in pixels
+         */
+        static void Update(const Camera& camera,
+                           const std::vector<PointLight>& lights, int width,
+                           int height);
+
+        /**
+         * @brief Set the lighting uniforms of a shader.
+         *
+         * Shaders built without CLUSTERED_LIGHTING ignore these uniforms.
+         *
+         * @param shader Shader about to draw
+         */
+        static void Apply(const Shader& shader);
+
+        /**
+         * @brief Set the constant light added to every lit fragment.
+         * @param ambient Linear RGB ambient light
+         */
+        static void SetAmbientLight(const glm::vec3& ambient) {
+            s_AmbientLight = ambient;
+        }
+
+        /**
+         * @brief Get the number of lights binned in the last update.
+         * @return Light count
+         */
+        static size_t GetLightCount() { return s_LightCount; }
+
+        /**
+         * @brief Get the total length of the light index list, i.e. the sum
+         * of the light counts of all clusters.
+         * @return Light index count
+         */
+        static size_t GetIndexCount() { return s_Indices.size(); }
+
+    private:
+        /**
+         * @brief Rebuild the cluster bounds for a projection matrix.
+         *
+         * @param projection Camera projection matrix
+         * @param nearPlane Near clipping plane distance
+         * @param farPlane Far clipping plane distance
+         */
+        static void BuildClusters(const glm::mat4& projection, float nearPlane,
+                                  float farPlane);
+
+        /**
+         * @brief Bin all lights into the clusters of one depth slice.
+         *
+         * @param slice Depth slice index
+         */
+        static void BinSlice(uint32_t slice);
+};
+
+}  // namespace Obelisk
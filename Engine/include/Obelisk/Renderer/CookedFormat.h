@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Obelisk {
+
+/**
+ * @brief File layouts shared by the ObeliskCook tool and the runtime loaders.
+ *
+ * ObeliskCook converts source assets into blobs that can be handed to OpenGL
+ * as they are. Next to every source it cooks, it writes a file with an extra
+ * extension:
+ * - `textures/name.png.otex`: a CookedTextureHeader followed by every mip
+ *   level, largest first, each GetCookedMipSize() bytes and tightly packed.
+ *   Rows are stored bottom-up, as OpenGL expects them.
+ * - `meshes/name.obj.omesh`: a CookedMeshHeader followed by VertexCount
+ *   Vertex structs and IndexCount uint32_t indices, ready for
+ *   glBufferData().
+ *
+ * All values are little-endian. Loaders reject files whose version does not
+ * match, so stale blobs fall back to the source asset until recooked.
+ */
+constexpr uint32_t COOKED_TEXTURE_MAGIC = 0x5845544F;  // "OTEX"
+constexpr uint32_t COOKED_MESH_MAGIC = 0x48534D4F;     // "OMSH"
+constexpr uint32_t COOKED_FORMAT_VERSION = 1;
+
+constexpr const char* COOKED_TEXTURE_EXTENSION = ".otex";
+constexpr const char* COOKED_MESH_EXTENSION = ".omesh";
+
+/**
+ * @brief Pixel format of a cooked texture.
+ *
+ * Values are part of the file format: append new formats, never reorder.
+ */
+enum class CookedTextureFormat : uint32_t {
+    R8 = 0,     ///< One byte per pixel, uploaded as GL_RED
+    RGBA8 = 1,  ///< Four bytes per pixel
+    BC1 = 2,    ///< S3TC DXT1, 8 bytes per 4x4 block, opaque RGB
+};
+
+/**
+ * @brief Header at the start of a cooked texture.
+ */
+struct CookedTextureHeader {
+        uint32_t Magic;              ///< COOKED_TEXTURE_MAGIC
+        uint32_t Version;            ///< COOKED_FORMAT_VERSION
+        CookedTextureFormat Format;  ///< Pixel format of every level
+        uint32_t Width;              ///< Level 0 width in pixels
+        uint32_t Height;             ///< Level 0 height in pixels
+        uint32_t MipCount;           ///< Levels stored, down to 1x1
+};
+
+/**
+ * @brief Header at the start of a cooked mesh.
+ */
+struct CookedMeshHeader {
+        uint32_t Magic;        ///< COOKED_MESH_MAGIC
+        uint32_t Version;      ///< COOKED_FORMAT_VERSION
+        uint32_t VertexCount;  ///< Vertices following the header
+        uint32_t IndexCount;   ///< Indices following the vertices
+};
+
+/**
+ * @brief Get the size of one stored mip level.
+ *
+ * @param format Pixel format
+ * @param width Level width in pixels
+ * @param height Level height in pixels
+ * @return Bytes the level occupies in the file
+ */
+inline size_t GetCookedMipSize(CookedTextureFormat format, uint32_t width,
+                               uint32_t height) {
+    switch (format) {
+        case CookedTextureFormat::R8:
+            return static_cast<size_t>(width) * height;
+        case CookedTextureFormat::RGBA8:
+            return static_cast<size_t>(width) * height * 4;
+        case CookedTextureFormat::BC1:
+            return static_cast<size_t>((width + 3) / 4) * ((height + 3) / 4) *
+                   8;
+    }
+    return 0;
+}
+
+}  // namespace Obelisk
@@ -0,0 +1,258 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include <string_view>
+#include "Obelisk/Core/Bounds.h"
+
+/**
+ * @def OBELISK_DEBUG_DRAW
+ * @brief Defined when DebugDraw is compiled in.
+ *
+ * Debug drawing is enabled in builds without NDEBUG unless
+ * OBELISK_NO_DEBUG_DRAW is defined. Otherwise every DebugDraw function is an
+ * empty inline function the compiler removes entirely. Arguments are still
+ * evaluated, so guard expensive setup with `#ifdef OBELISK_DEBUG_DRAW`.
+ */
+#if !defined(NDEBUG) && !defined(OBELISK_NO_DEBUG_DRAW)
+#define OBELISK_DEBUG_DRAW
+#define OBELISK_DEBUG_DRAW_FUNCTION
+#else
+#define OBELISK_DEBUG_DRAW_FUNCTION \
+    {}
+#endif
+
+namespace Obelisk {
+
+class Camera;
+class Shader;
+
+/**
+ * @brief Immediate-mode debug shapes, batched into one stream per frame.
+ *
+ * Shapes can be submitted from anywhere on the main thread during a frame.
+ * They are appended as line vertices to a CPU-side stream (whose capacity is
+ * kept across frames, so steady-state submission does not allocate) and
+ * drawn at the end of the frame with one upload and at most two draws:
+ * one depth-tested, one drawn on top of everything. The GPU time shows up as
+ * the "DebugDraw" pass of the GPUProfiler, separate from the scene.
+ *
+ * Latch() hands the recorded shapes over to Flush(), so with a RenderThread
+ * the update thread can record the next frame's shapes while the current
+ * ones are drawn.
+ *
+ * Everything compiles to nothing in release builds; see OBELISK_DEBUG_DRAW.
+ *
+ * @example
+ * ```cpp
+ * DebugDraw::Box(entityBounds, glm::vec4(0.0f, 1.0f, 0.0f, 1.0f));
+ * DebugDraw::Frustum(camera.GetViewProjectionMatrix());
+ * DebugDraw::Text(glm::vec3(0.0f, 2.0f, 0.0f), "SPAWN", 0.25f);
+ * DebugDraw::Line(from, to, glm::vec4(1.0f, 0.0f, 0.0f, 1.0f), false);
+ * ```
+ */
+class OBELISK_API DebugDraw {
+    public:
+        static constexpr size_t MAX_VERTICES =
+            1 << 21;  ///< Per-frame cap; further shapes are dropped
+
+#ifdef OBELISK_DEBUG_DRAW
+    private:
+        /**
+         * @brief Vertex layout streamed to the GPU.
+         */
+        struct DebugVertex {
+                glm::vec3 Position;  ///< World-space position
+                uint32_t Color;      ///< Packed RGBA8 color
+        };
+
+        /**
+         * @brief Text waiting to be laid out facing the camera.
+         */
+        struct DebugText {
+                glm::vec3 Position;  ///< World-space position of the first
+                                     ///< character's bottom-left corner
+                uint32_t Offset;     ///< First character in s_TextChars
+                uint32_t Length;     ///< Number of characters
+                float Height;        ///< Character height in world units
+                uint32_t Color;      ///< Packed RGBA8 color
+                bool DepthTest;      ///< Which stream the text goes to
+        };
+
+        static std::vector<DebugVertex>
+            s_Vertices[2];  ///< Overlay (0) and depth-tested (1) lines
+        static std::vector<DebugText> s_Text;  ///< Text queued this frame
+        static std::vector<char>
+            s_TextChars;  ///< Characters of s_Text, capacity kept
+        static std::vector<DebugVertex>
+            s_Latched[2];  ///< Lines handed to Flush() by Latch()
+        static std::unique_ptr<Shader> s_Shader;  ///< Line shader
+        static unsigned int s_VAO;                ///< Vertex array object
+        static unsigned int s_VBO;                ///< Streamed vertex buffer
+        static bool s_Overflowed;  ///< MAX_VERTICES was hit this frame
+#endif
+
+    public:
+        /**
+         * @brief Create the GPU buffers and load the line shader.
+         *
+         * Must be called once after the OpenGL context has been created.
+         */
+        static void Initialize() OBELISK_DEBUG_DRAW_FUNCTION;
+
+        /**
+         * @brief Release the GPU buffers and any queued shapes.
+         */
+        static void Shutdown() OBELISK_DEBUG_DRAW_FUNCTION;
+
+        /**
+         * @brief Draw a line segment.
+         *
+         * @param from Start point
+         * @param to End point
+         * @param color Line color
+         * @param depthTest Whether scene geometry hides the line
+         */
+        static void Line(const glm::vec3& from, const glm::vec3& to,
+                         const glm::vec4& color = glm::vec4(1.0f),
+                         bool depthTest = true) OBELISK_DEBUG_DRAW_FUNCTION;
+
+        /**
+         * @brief Draw a small axis-aligned cross marking a point.
+         *
+         * @param point Center of the cross
+         * @param size Length of each arm
+         * @param color Line color
+         * @param depthTest Whether scene geometry hides the cross
+         */
+        static void Cross(const glm::vec3& point, float size,
+                          const glm::vec4& color = glm::vec4(1.0f),
+                          bool depthTest = true) OBELISK_DEBUG_DRAW_FUNCTION;
+
+        /**
+         * @brief Draw the edges of an axis-aligned box.
+         *
+         * @param box Box to draw
+         * @param color Line color
+         * @param depthTest Whether scene geometry hides the box
+         */
+        static void Box(const AABB& box,
+                        const glm::vec4& color = glm::vec4(1.0f),
+                        bool depthTest = true) OBELISK_DEBUG_DRAW_FUNCTION;
+
+        /**
+         * @brief Draw the edges of a transformed box, e.g. a model's local
+         * bounds placed by its model matrix.
+         *
+         * @param box Box in local space
+         * @param transform Local-to-world matrix
+         * @param color Line color
+         * @param depthTest Whether scene geometry hides the box
+         */
+        static void Box(const AABB& box, const glm::mat4& transform,
+                        const glm::vec4& color = glm::vec4(1.0f),
+                        bool depthTest = true) OBELISK_DEBUG_DRAW_FUNCTION;
+
+        /**
+         * @brief Draw a circle.
+         *
+         * @param center Center of the circle
+         * @param normal Normal of the circle's plane
+         * @param radius Radius
+         * @param color Line color
+         * @param segments Number of line segments
+         * @param depthTest Whether scene geometry hides the circle
+         */
+        static void Circle(const glm::vec3& center, const glm::vec3& normal,
+                           float radius,
+                           const glm::vec4& color = glm::vec4(1.0f),
+                           int segments = 24,
+                           bool depthTest = true) OBELISK_DEBUG_DRAW_FUNCTION;
+
+        /**
+         * @brief Draw a sphere as three axis-aligned great circles.
+         *
+         * @param center Center of the sphere
+         * @param radius Radius
+         * @param color Line color
+         * @param depthTest Whether scene geometry hides the sphere
+         */
+        static void Sphere(const glm::vec3& center, float radius,
+                           const glm::vec4& color = glm::vec4(1.0f),
+                           bool depthTest = true) OBELISK_DEBUG_DRAW_FUNCTION;
+
+        /**
+         * @brief Draw the edges of a view frustum.
+         *
+         * @param viewProjection View-projection matrix of the frustum, e.g.
+         * Camera::GetViewProjectionMatrix()
+         * @param color Line color
+         * @param depthTest Whether scene geometry hides the frustum
+         */
+        static void Frustum(const glm::mat4& viewProjection,
+                            const glm::vec4& color = glm::vec4(1.0f),
+                            bool depthTest = true) OBELISK_DEBUG_DRAW_FUNCTION;
+
+        /**
+         * @brief Draw text in a line-segment font, facing the camera.
+         *
+         * Covers printable ASCII; lowercase is drawn as uppercase and '\n'
+         * starts a new line.
+         *
+         * @param position World-space position of the bottom-left corner
+         * @param text Text to draw
+         * @param height Character height in world units
+         * @param color Line color
+         * @param depthTest Whether scene geometry hides the text
+         */
+        static void Text(const glm::vec3& position, std::string_view text,
+                         float height = 0.2f,
+                         const glm::vec4& color = glm::vec4(1.0f),
+                         bool depthTest = false) OBELISK_DEBUG_DRAW_FUNCTION;
+
+        /**
+         * @brief Hand everything queued this frame to the next Flush().
+         *
+         * Lays out queued text facing the camera and swaps the recorded
+         * lines into the latched streams, leaving the queue empty for the
+         * next frame. Must not run concurrently with Flush().
+         *
+         * @param camera Camera the frame is rendered with
+         */
+        static void Latch(const Camera& camera) OBELISK_DEBUG_DRAW_FUNCTION;
+
+        /**
+         * @brief Draw the latched shapes and release them.
+         *
+         * Called by Window::Render() after the scene has been drawn.
+         *
+         * @param camera Camera the frame was rendered with
+         */
+        static void Flush(const Camera& camera) OBELISK_DEBUG_DRAW_FUNCTION;
+
+        /**
+         * @brief Drop everything queued and latched without drawing it.
+         */
+        static void Clear() OBELISK_DEBUG_DRAW_FUNCTION;
+
+#ifdef OBELISK_DEBUG_DRAW
+    private:
+        /**
+         * @brief Reserve space for line vertices in one of the streams.
+         *
+         * @param count Number of vertices
+         * @param depthTest Which stream to append to
+         * @return Pointer to the new vertices, or nullptr if the frame is
+         * over MAX_VERTICES
+         */
+        static DebugVertex* Append(size_t count, bool depthTest);
+
+        /**
+         * @brief Lay out queued text along the camera's right and up axes.
+         *
+         * @param camera Camera the text faces
+         */
+        static void BuildText(const Camera& camera);
+#endif
+};
+
+}  // namespace Obelisk
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include <atomic>
+#include <filesystem>
+
+namespace Obelisk {
+
+/**
+ * @brief Records the GL calls issued by the engine for deterministic replay.
+ *
+ * While a capture is active, the glad function pointers of every call the
+ * engine uses are swapped for recording wrappers that serialize the call and
+ * its payload (buffer contents, texture pixels, shader sources) before
+ * forwarding it to the driver. After the requested number of frames the
+ * original pointers are restored and the stream is written to disk in the
+ * format described in GLCaptureFormat.h. The ObeliskReplay tool re-issues
+ * the stream with timing, independent of the game.
+ *
+ * Object creation is part of the stream, so a capture should start right
+ * after the context is created (see ObeliskAPI::SetCapture); objects created
+ * before Begin() are unknown to the replay. Query results and other reads
+ * (glGet*, glReadPixels) are not recorded.
+ *
+ * So a capture does not hold every GL call. These are left out:
+ * - Entry points beyond OpenGL 3.3, which are called through GLExtensions:
+ *   ProgramBinary, DispatchCompute, MultiDrawElementsIndirect,
+ *   BindImageTexture and GLMemoryBarrier. They are not used while
+ *   capturing: ShaderCache compiles from source, so the stream stays
+ *   portable across drivers, and GPUCulling suspends itself.
+ * - glFenceSync, glClientWaitSync and glDeleteSync. UniformRingBuffer only
+ *   uses them to wait before reusing a region, and the uploads themselves
+ *   are recorded, so the replay draws the same frames without them.
+ *
+ * @example
+ * ```cpp
+ * GLCapture::Begin("frames.obcap", 120);
+ *
+ * // Once per frame, after rendering:
+ * GLCapture::EndFrame();  // writes the file after 120 frames
+ * ```
+ */
+class OBELISK_API GLCapture {
+    private:
+        static std::filesystem::path s_OutputPath;  ///< Destination file
+        static size_t s_FramesRemaining;  ///< Frames left to capture
+        static uint32_t s_FrameCount;     ///< Frames captured so far
+        static std::atomic<bool>
+            s_Capturing;  ///< Whether hooks are installed; read off the
+                          ///< render thread by GPUCulling::IsActive()
+
+    public:
+        /**
+         * @brief Start recording GL calls.
+         *
+         * Requires a current context with glad loaded.
+         *
+         * @param path File the capture is written to
+         * @param frames Number of frames to record before writing the file
+         * @return true if recording started
+         */
+        static bool Begin(const std::filesystem::path& path, size_t frames);
+
+        /**
+         * @brief Mark the end of a frame.
+         *
+         * Stops the capture and writes the file once the requested number of
+         * frames has been recorded. Does nothing if no capture is active.
+         */
+        static void EndFrame();
+
+        /**
+         * @brief Stop recording and write the capture file.
+         *
+         * @return true if the file was written
+         */
+        static bool End();
+
+        /**
+         * @brief Check whether a capture is in progress.
+         * @return true while GL calls are being recorded
+         */
+        static bool IsCapturing() { return s_Capturing; }
+
+    private:
+        /**
+         * @brief Swap glad's function pointers for the recording wrappers.
+         */
+        static void InstallHooks();
+
+        /**
+         * @brief Restore glad's original function pointers.
+         */
+        static void RemoveHooks();
+
+        /**
+         * @brief Record the state the capture starts in.
+         */
+        static void RecordPrologue();
+};
+
+}  // namespace Obelisk
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Obelisk {
+
+/**
+ * @brief File layout shared by GLCapture and the ObeliskReplay tool.
+ *
+ * A capture file starts with a GLCaptureHeader, followed by a stream of
+ * commands. Every command is a GLCaptureCommand id (uint16_t) and a payload
+ * size (uint32_t), followed by the payload. All values are little-endian and
+ * tightly packed:
+ * - enums, object names and bitfields are stored as uint32_t
+ * - sizes and buffer offsets are stored as uint64_t
+ * - strings and payloads are stored as a uint64_t byte count plus the bytes
+ *
+ * The stream begins with a prologue restoring the state the capture started
+ * in (viewport and common capabilities), so the replay does not depend on
+ * how its own context was set up.
+ *
+ * Object names are the ones the capturing driver returned; the replay keeps a
+ * table per object type to map them to its own names. Uniform locations are
+ * remapped the same way through the recorded GetUniformLocation calls.
+ */
+constexpr uint32_t GL_CAPTURE_MAGIC = 0x4347424F;  // "OBGC"
+constexpr uint32_t GL_CAPTURE_VERSION = 1;
+
+/**
+ * @brief Header at the start of a capture file.
+ */
+struct GLCaptureHeader {
+        uint32_t Magic;         ///< GL_CAPTURE_MAGIC
+        uint32_t Version;       ///< GL_CAPTURE_VERSION
+        uint32_t FrameCount;    ///< Number of Frame markers in the stream
+        uint32_t Width;         ///< Viewport width when capture started
+        uint32_t Height;        ///< Viewport height when capture started
+        uint32_t Reserved;      ///< Padding, always zero
+        uint64_t CommandCount;  ///< Number of commands in the stream
+        uint64_t StreamSize;    ///< Size of the command stream in bytes
+};
+
+/**
+ * @brief Identifies a recorded call.
+ *
+ * Values are part of the file format: append new commands, never reorder.
+ */
+enum class GLCaptureCommand : uint16_t {
+    Frame = 0,  ///< End of a frame (no payload)
+
+    // Object lifetime
+    GenBuffers,
+    GenTextures,
+    GenVertexArrays,
+    GenFramebuffers,
+    GenRenderbuffers,
+    DeleteBuffers,
+    DeleteTextures,
+    DeleteVertexArrays,
+    DeleteFramebuffers,
+    DeleteRenderbuffers,
+    CreateShader,
+    CreateProgram,
+    DeleteShader,
+    DeleteProgram,
+
+    // Shaders
+    ShaderSource,
+    CompileShader,
+    AttachShader,
+    DetachShader,
+    LinkProgram,
+    UseProgram,
+    GetUniformLocation,
+    Uniform1i,
+    Uniform1f,
+    Uniform2f,
+    Uniform3f,
+    Uniform4f,
+    UniformMatrix4fv,
+
+    // Buffers and vertex layout
+    BindBuffer,
+    BufferData,
+    BufferSubData,
+    BindVertexArray,
+    VertexAttribPointer,
+    EnableVertexAttribArray,
+
+    // Textures
+    ActiveTexture,
+    BindTexture,
+    TexImage2D,
+    TexParameteri,
+    GenerateMipmap,
+    PixelStorei,
+
+    // Framebuffers
+    BindFramebuffer,
+    BindRenderbuffer,
+    RenderbufferStorage,
+    FramebufferRenderbuffer,
+    FramebufferTexture2D,
+
+    // State and drawing
+    Enable,
+    Disable,
+    BlendFunc,
+    DepthMask,
+    Viewport,
+    ClearColor,
+    Clear,
+    DrawArrays,
+    DrawElements,
+
+    // Appended after version 1 shipped; ids above must never change
+    TexBuffer,
+    DrawElementsBaseVertex,
+    GetUniformBlockIndex,
+    UniformBlockBinding,
+    BindBufferRange,
+    DrawArraysInstanced,
+    VertexAttribDivisor,
+    BindBufferBase,
+    BlitFramebuffer,
+    CompressedTexImage2D,
+
+    Count  ///< Number of command ids
+};
+
+}  // namespace Obelisk
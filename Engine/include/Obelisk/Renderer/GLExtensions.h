@@ -0,0 +1,223 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include <string>
+#include <unordered_set>
+
+// ARB_get_program_binary (core in OpenGL 4.1)
+#ifndef GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+    #define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#endif
+#ifndef GL_PROGRAM_BINARY_LENGTH
+    #define GL_PROGRAM_BINARY_LENGTH 0x8741
+#endif
+#ifndef GL_NUM_PROGRAM_BINARY_FORMATS
+    #define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+#endif
+#ifndef GL_PROGRAM_BINARY_FORMATS
+    #define GL_PROGRAM_BINARY_FORMATS 0x87FF
+#endif
+
+// KHR_parallel_shader_compile / ARB_parallel_shader_compile
+#ifndef GL_MAX_SHADER_COMPILER_THREADS_KHR
+    #define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#endif
+#ifndef GL_COMPLETION_STATUS_KHR
+    #define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+// Compute shaders, storage buffers and indirect draws (core in OpenGL 4.3)
+#ifndef GL_COMPUTE_SHADER
+    #define GL_COMPUTE_SHADER 0x91B9
+#endif
+#ifndef GL_SHADER_STORAGE_BUFFER
+    #define GL_SHADER_STORAGE_BUFFER 0x90D2
+#endif
+#ifndef GL_DRAW_INDIRECT_BUFFER
+    #define GL_DRAW_INDIRECT_BUFFER 0x8F3F
+#endif
+#ifndef GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT
+    #define GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT 0x00000001
+#endif
+#ifndef GL_TEXTURE_FETCH_BARRIER_BIT
+    #define GL_TEXTURE_FETCH_BARRIER_BIT 0x00000008
+#endif
+#ifndef GL_SHADER_IMAGE_ACCESS_BARRIER_BIT
+    #define GL_SHADER_IMAGE_ACCESS_BARRIER_BIT 0x00000020
+#endif
+#ifndef GL_COMMAND_BARRIER_BIT
+    #define GL_COMMAND_BARRIER_BIT 0x00000040
+#endif
+#ifndef GL_SHADER_STORAGE_BARRIER_BIT
+    #define GL_SHADER_STORAGE_BARRIER_BIT 0x00002000
+#endif
+
+// EXT_texture_compression_s3tc
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+    #define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#endif
+
+namespace Obelisk {
+
+/**
+ * @brief Loader for OpenGL entry points beyond the 3.3 core profile.
+ *
+ * The bundled glad loader only covers OpenGL 3.3 core. Features that are
+ * optional on our minimum target (program binaries, parallel compilation,
+ * compute, ...) are resolved here at runtime and exposed as nullable function
+ * pointers together with a capability flag. Callers must check the flag before
+ * using the matching pointers.
+ *
+ * @example
+ * ```cpp
+ * if (GLExtensions::HasProgramBinary()) {
+ *     GLExtensions::ProgramBinary(program, format, data, length);
+ * }
+ * ```
+ */
+class OBELISK_API GLExtensions {
+    public:
+        using GetProgramBinaryProc = void(APIENTRYP)(GLuint program,
+                                                     GLsizei bufSize,
+                                                     GLsizei* length,
+                                                     GLenum* binaryFormat,
+                                                     void* binary);
+        using ProgramBinaryProc = void(APIENTRYP)(GLuint program,
+                                                  GLenum binaryFormat,
+                                                  const void* binary,
+                                                  GLsizei length);
+        using ProgramParameteriProc = void(APIENTRYP)(GLuint program,
+                                                      GLenum pname,
+                                                      GLint value);
+        using MaxShaderCompilerThreadsProc = void(APIENTRYP)(GLuint count);
+        using DispatchComputeProc = void(APIENTRYP)(GLuint numGroupsX,
+                                                    GLuint numGroupsY,
+                                                    GLuint numGroupsZ);
+        using MemoryBarrierProc = void(APIENTRYP)(GLbitfield barriers);
+        using MultiDrawElementsIndirectProc = void(APIENTRYP)(
+            GLenum mode, GLenum type, const void* indirect, GLsizei drawCount,
+            GLsizei stride);
+        using BindImageTextureProc = void(APIENTRYP)(GLuint unit,
+                                                     GLuint texture,
+                                                     GLint level,
+                                                     GLboolean layered,
+                                                     GLint layer,
+                                                     GLenum access,
+                                                     GLenum format);
+
+        // ARB_get_program_binary
+        static GetProgramBinaryProc
+            GetProgramBinary;  ///< glGetProgramBinary, or nullptr
+        static ProgramBinaryProc
+            ProgramBinary;  ///< glProgramBinary, or nullptr
+        static ProgramParameteriProc
+            ProgramParameteri;  ///< glProgramParameteri, or nullptr
+
+        // KHR_parallel_shader_compile
+        static MaxShaderCompilerThreadsProc
+            MaxShaderCompilerThreads;  ///< glMaxShaderCompilerThreadsKHR, or
+                                       ///< nullptr
+
+        // ARB_compute_shader, ARB_shader_image_load_store,
+        // ARB_multi_draw_indirect. windows.h defines MemoryBarrier as a
+        // macro, hence the GL prefix on that one.
+        static DispatchComputeProc
+            DispatchCompute;  ///< glDispatchCompute, or nullptr
+        static MemoryBarrierProc
+            GLMemoryBarrier;  ///< glMemoryBarrier, or nullptr
+        static MultiDrawElementsIndirectProc
+            MultiDrawElementsIndirect;  ///< glMultiDrawElementsIndirect, or
+                                        ///< nullptr
+        static BindImageTextureProc
+            BindImageTexture;  ///< glBindImageTexture, or nullptr
+
+    private:
+        static int s_MajorVersion;  ///< Context major version
+        static int s_MinorVersion;  ///< Context minor version
+        static std::unordered_set<std::string>
+            s_Extensions;  ///< Extension names advertised by the driver
+
+        static bool s_HasProgramBinary;  ///< Program binaries usable
+        static bool
+            s_HasParallelShaderCompile;  ///< GL_COMPLETION_STATUS queryable
+        static bool s_HasCompute;        ///< Compute and indirect draws usable
+        static bool s_HasS3TC;           ///< DXT1 textures can be uploaded
+
+    public:
+        /**
+         * @brief Query the current context and resolve extension entry points.
+         *
+         * Must be called once after an OpenGL context has been made current
+         * and glad has been loaded.
+         *
+         * @param loader Function used to resolve GL entry points (e.g.
+         * glfwGetProcAddress)
+         */
+        static void Initialize(GLADloadproc loader);
+
+        /**
+         * @brief Check whether the context is at least the given version.
+         *
+         * @param major Required major version
+         * @param minor Required minor version
+         * @return True if the current context version is >= major.minor
+         */
+        static bool IsVersionAtLeast(int major, int minor);
+
+        /**
+         * @brief Check whether the driver advertises an extension.
+         *
+         * @param name Extension name (e.g. "GL_ARB_get_program_binary")
+         * @return True if the extension is supported
+         */
+        static bool IsExtensionSupported(const std::string& name);
+
+        /**
+         * @brief Check whether program binaries can be fetched and reloaded.
+         *
+         * Requires OpenGL 4.1 or ARB_get_program_binary, and at least one
+         * binary format reported by the driver.
+         *
+         * @return True if glGetProgramBinary/glProgramBinary are usable
+         */
+        static bool HasProgramBinary() { return s_HasProgramBinary; }
+
+        /**
+         * @brief Check whether shader compilation can be polled.
+         *
+         * Requires KHR_parallel_shader_compile or ARB_parallel_shader_compile.
+         * When available, GL_COMPLETION_STATUS_KHR can be queried on shaders
+         * and programs without blocking on the driver.
+         *
+         * @return True if compile completion can be polled
+         */
+        static bool HasParallelShaderCompile() {
+            return s_HasParallelShaderCompile;
+        }
+
+        /**
+         * @brief Check whether GPU-driven rendering is possible.
+         *
+         * Requires OpenGL 4.3, or ARB_compute_shader together with
+         * ARB_shader_storage_buffer_object, ARB_shader_image_load_store,
+         * ARB_multi_draw_indirect and ARB_base_instance. Compute shaders can
+         * then write storage buffers and images that later draws consume
+         * through glMultiDrawElementsIndirect.
+         *
+         * @return True if DispatchCompute, GLMemoryBarrier,
+         * MultiDrawElementsIndirect and BindImageTexture are usable
+         */
+        static bool HasCompute() { return s_HasCompute; }
+
+        /**
+         * @brief Check whether S3TC (BC1) compressed textures can be used.
+         *
+         * Requires EXT_texture_compression_s3tc. Uploads go through the core
+         * glCompressedTexImage2D, so no extra entry point is needed.
+         *
+         * @return True if GL_COMPRESSED_RGB_S3TC_DXT1_EXT is accepted
+         */
+        static bool HasS3TC() { return s_HasS3TC; }
+};
+
+}  // namespace Obelisk
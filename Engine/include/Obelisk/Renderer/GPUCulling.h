@@ -0,0 +1,287 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+
+namespace Obelisk {
+
+class Camera;
+class Material;
+class Mesh;
+class Shader;
+
+/**
+ * @brief Layout of one glMultiDrawElementsIndirect command.
+ */
+struct OBELISK_API DrawElementsIndirectCommand {
+        uint32_t Count;          ///< Indices per instance
+        uint32_t InstanceCount;  ///< Instances, written by the cull shader
+        uint32_t FirstIndex;     ///< First index in the shared index buffer
+        int32_t BaseVertex;      ///< Added to every index
+        uint32_t BaseInstance;   ///< First slot in the visible buffer
+};
+
+/**
+ * @brief An object handed to GPUCulling::Build().
+ */
+struct OBELISK_API GPUCullingItem {
+        const Mesh* DrawMesh;          ///< Geometry
+        const Material* DrawMaterial;  ///< Shader, textures, params
+        glm::mat4 Model;               ///< Object-to-world matrix
+};
+
+/**
+ * @brief Culls and draws a scene's objects entirely on the GPU.
+ *
+ * Culling objects on the CPU costs a bounds transform and a frustum test per
+ * object per frame, plus a Renderer::Submit() for each survivor. On OpenGL
+ * 4.3 that work moves to the GPU: Build() copies every object's model matrix
+ * and object-space bounds into storage buffers once, and merges all meshes
+ * into one vertex and index buffer with an indirect draw command per mesh
+ * and material pair. Each frame, a compute shader (gpu_cull.comp) tests
+ * every object against the frustum and, optionally, against a depth pyramid
+ * (Hi-Z) built from the previous frame's depth buffer, then appends the
+ * survivors' model matrices to their command's range of a visible buffer and
+ * bumps its instance count. Draw() issues one glMultiDrawElementsIndirect
+ * per material; vertex shaders compiled with `GPU_DRIVEN` read the model
+ * matrix from instanced attributes 3 to 6 instead of the PerDraw block.
+ *
+ * The CPU's per-frame cost is uploading the model matrices of objects that
+ * may move (see Update()) and a handful of dispatches and draws, regardless
+ * of the object count. The GPU does not report back what it culled, so
+ * RenderStats only count the indirect draws.
+ *
+ * Occlusion culling tests against where things were last frame, so objects
+ * revealed by a fast camera move can stay hidden for one frame. Materials
+ * are drawn with a `GPU_DRIVEN` permutation of their shader, which must
+ * support that define (basic.vert does).
+ *
+ * Where compute shaders are unavailable (see GLExtensions::HasCompute()),
+ * Build() fails and Scene keeps culling on the CPU. While a GLCapture is
+ * running the GPU path is suspended as well, since captures only record
+ * OpenGL 3.3 calls.
+ *
+ * @example
+ * ```cpp
+ * GPUCulling::SetEnabled(true);
+ * scene.Finalize();  // Hands the scene to GPUCulling when supported
+ *
+ * // Per frame, done by Window::Render():
+ * GPUCulling::Update(snapshot.GPUTransforms);
+ * GPUCulling::Cull(camera);
+ * GPUCulling::Draw(camera, totalTime, deltaTime);
+ * GPUCulling::BuildDepthPyramid(width, height);
+ * ```
+ */
+class OBELISK_API GPUCulling {
+    public:
+        static constexpr unsigned int WORKGROUP_SIZE =
+            64;  ///< local_size_x of gpu_cull.comp
+        static constexpr unsigned int REDUCE_GROUP_SIZE =
+            8;  ///< local_size_x/y of hiz_reduce.comp
+
+    private:
+        /**
+         * @brief Instance data read by the cull shader (std430).
+         */
+        struct Instance {
+                glm::vec4 Center;   ///< Object-space bounds center
+                glm::vec4 Extents;  ///< Object-space bounds half size
+                uint32_t Command;   ///< Index of the instance's command
+                uint32_t Padding[3];
+        };
+
+        /**
+         * @brief Commands drawn with one material.
+         */
+        struct DrawGroup {
+                std::shared_ptr<Shader> DrawShader;  ///< GPU_DRIVEN variant
+                const Material* DrawMaterial;        ///< Textures and params
+                size_t FirstCommand;                 ///< Into s_Commands
+                size_t CommandCount;                 ///< Commands to draw
+        };
+
+        static bool s_Enabled;                ///< Scene may use the path
+        static bool s_OcclusionCulling;       ///< Whether Hi-Z culling runs
+        static unsigned int s_CullProgram;    ///< gpu_cull.comp
+        static unsigned int s_ReduceProgram;  ///< hiz_reduce.comp
+
+        static unsigned int s_VAO;              ///< Merged geometry + instances
+        static unsigned int s_VertexBuffer;     ///< Every mesh's vertices
+        static unsigned int s_IndexBuffer;      ///< Every mesh's indices
+        static unsigned int s_TransformBuffer;  ///< Model matrix per instance
+        static unsigned int s_InstanceBuffer;   ///< Bounds per instance
+        static unsigned int s_CommandBuffer;    ///< Indirect draw commands
+        static unsigned int s_VisibleBuffer;    ///< Survivors' model matrices
+        static unsigned int s_FrameBuffer;      ///< PerFrame uniform block
+
+        static std::vector<DrawElementsIndirectCommand>
+            s_Commands;                          ///< Zeroed instance counts
+        static std::vector<DrawGroup> s_Groups;  ///< Commands by material
+        static std::unordered_map<const Shader*, std::shared_ptr<Shader>>
+            s_Variants;                 ///< GPU_DRIVEN variants by shader
+        static size_t s_InstanceCount;  ///< Instances in the buffers
+        static size_t s_StaticCount;    ///< Leading instances never updated
+
+        static unsigned int s_DepthTexture;        ///< Copy of the depth buffer
+        static unsigned int s_DepthFramebuffer;    ///< Blit target for the copy
+        static unsigned int s_Pyramid;             ///< R32F max-depth mip chain
+        static int s_PyramidWidth;                 ///< Level 0 width
+        static int s_PyramidHeight;                ///< Level 0 height
+        static int s_PyramidLevels;                ///< Mip levels
+        static bool s_PyramidValid;                ///< Built since last resize
+        static glm::mat4 s_PyramidViewProjection;  ///< Camera it was built by
+        static glm::mat4 s_CullViewProjection;     ///< Camera of last Cull()
+
+    public:
+        /**
+         * @brief Compile the compute shaders if the context supports them.
+         *
+         * Must be called after GLExtensions::Initialize(). Does nothing
+         * without compute support.
+         */
+        static void Initialize();
+
+        /**
+         * @brief Release every GL object and the shader permutations.
+         */
+        static void Shutdown();
+
+        /**
+         * @brief Check whether the GPU path can run on this context.
+         *
+         * @return true if the compute shaders compiled
+         */
+        static bool IsSupported() { return s_CullProgram != 0; }
+
+        /**
+         * @brief Allow or forbid Scene to hand objects to the GPU path.
+         *
+         * Takes effect at the next Scene::Finalize().
+         *
+         * @param enabled Whether to cull on the GPU when supported
+         */
+        static void SetEnabled(bool enabled) { s_Enabled = enabled; }
+
+        /**
+         * @brief Check whether Scene may use the GPU path.
+         *
+         * @return true unless disabled with SetEnabled(false)
+         */
+        static bool IsEnabled() { return s_Enabled; }
+
+        /**
+         * @brief Check whether built data may be culled and drawn this frame.
+         *
+         * @return false without a Build(), when unsupported, or while a
+         * GLCapture is recording
+         */
+        static bool IsActive();
+
+        /**
+         * @brief Enable or disable Hi-Z occlusion culling.
+         *
+         * @param enabled Whether to also cull against the previous frame's
+         * depth
+         */
+        static void SetOcclusionCulling(bool enabled) {
+            s_OcclusionCulling = enabled;
+        }
+
+        /**
+         * @brief Check whether Hi-Z occlusion culling is enabled.
+         *
+         * @return true if enabled (the default)
+         */
+        static bool IsOcclusionCulling() { return s_OcclusionCulling; }
+
+        /**
+         * @brief Upload objects to the GPU, replacing any previous Build().
+         *
+         * Static items are uploaded once; dynamic items follow them and have
+         * their model matrices replaced by every Update(). Meshes are read
+         * back and merged, so they may be destroyed afterwards; materials
+         * must outlive the next Build() or Shutdown(). Items whose material
+         * has no shader are skipped.
+         *
+         * Must be called with the GL context current and outside a frame.
+         *
+         * @param staticItems Objects that never move
+         * @param dynamicItems Objects that may move, in Update() order
+         * @return true if the GPU path is ready, false if unsupported
+         */
+        static bool Build(const std::vector<GPUCullingItem>& staticItems,
+                          const std::vector<GPUCullingItem>& dynamicItems);
+
+        /**
+         * @brief Drop the built objects.
+         */
+        static void Clear();
+
+        /**
+         * @brief Replace the model matrices of the dynamic items.
+         *
+         * @param transforms One matrix per dynamic item, in Build() order
+         */
+        static void Update(const std::vector<glm::mat4>& transforms);
+
+        /**
+         * @brief Cull every object and write the frame's draw commands.
+         *
+         * @param camera Camera the frame is rendered from
+         */
+        static void Cull(const Camera& camera);
+
+        /**
+         * @brief Draw the objects that survived the last Cull().
+         *
+         * Binds its own PerFrame block; may be called after
+         * Renderer::EndFrame().
+         *
+         * @param camera Camera the frame is rendered from
+         * @param totalTime Seconds since startup (PerFrame.time.x)
+         * @param deltaTime Seconds since the previous frame (PerFrame.time.y)
+         */
+        static void Draw(const Camera& camera, float totalTime,
+                         float deltaTime);
+
+        /**
+         * @brief Build the depth pyramid for the next frame's Cull().
+         *
+         * Call once the frame's opaque geometry has been drawn into the
+         * current framebuffer. Does nothing if occlusion culling is off.
+         *
+         * @param width Framebuffer width
+         * @param height Framebuffer height
+         */
+        static void BuildDepthPyramid(int width, int height);
+
+        /**
+         * @brief Get the number of objects culled on the GPU.
+         *
+         * @return Instances uploaded by the last Build()
+         */
+        static size_t GetInstanceCount() { return s_InstanceCount; }
+
+    private:
+        /**
+         * @brief (Re)create the depth copy and pyramid for a framebuffer
+         * size.
+         *
+         * @return true if the depth copy framebuffer is complete
+         */
+        static bool CreatePyramid(int width, int height);
+
+        /**
+         * @brief Release the depth copy and pyramid.
+         */
+        static void DestroyPyramid();
+
+        /**
+         * @brief Get the GPU_DRIVEN permutation of a material shader.
+         *
+         * @return Ready permutation, or nullptr if it failed to build
+         */
+        static std::shared_ptr<Shader> GetVariant(const Shader& shader);
+};
+
+}  // namespace Obelisk
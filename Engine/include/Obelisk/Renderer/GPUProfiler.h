@@ -0,0 +1,189 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include <array>
+
+namespace Obelisk {
+
+/**
+ * @brief Measures GPU execution time per frame and per render pass.
+ *
+ * CPU frame time alone cannot tell whether a frame is CPU- or GPU-bound. The
+ * GPUProfiler brackets the frame and each named render pass with
+ * GL_TIMESTAMP queries (glQueryCounter). Queries are kept in a ring of
+ * FRAME_LATENCY frames and only read back once the driver reports them as
+ * available, several frames later, so profiling never stalls the pipeline.
+ *
+ * Resolved timings stay with the profiler, on the thread that renders, until
+ * Publish() copies them to Time::GetGPUFrameTimeMS() and
+ * Time::GetGPUPassTimeMS(), next to the CPU frame time. With a RenderThread
+ * that happens at the frame handover, so the update thread never reads them
+ * while they change.
+ *
+ * Timestamps (rather than GL_TIME_ELAPSED) are used so passes may nest.
+ *
+ * @example
+ * ```cpp
+ * GPUProfiler::BeginFrame();
+ * {
+ *     GPUProfiler::ScopedPass pass("Scene");
+ *     // ... draw calls ...
+ * }
+ * GPUProfiler::EndFrame();
+ * GPUProfiler::Publish();
+ *
+ * LOG_INFO("GPU: {:.2f}ms", Time::GetGPUFrameTimeMS());
+ * ```
+ */
+class OBELISK_API GPUProfiler {
+    public:
+        static constexpr size_t FRAME_LATENCY =
+            4;  ///< Frames between issuing queries and reading them back
+
+        /**
+         * @brief RAII helper that brackets a scope as a render pass.
+         */
+        class OBELISK_API ScopedPass {
+            public:
+                /**
+                 * @brief Begin a named pass.
+                 * @param name Pass name as reported by Time::GetGPUPassTimeMS
+                 */
+                explicit ScopedPass(const std::string& name) {
+                    BeginPass(name);
+                }
+
+                /**
+                 * @brief End the pass.
+                 */
+                ~ScopedPass() { EndPass(); }
+
+                ScopedPass(const ScopedPass&) = delete;
+                ScopedPass& operator=(const ScopedPass&) = delete;
+        };
+
+    private:
+        /**
+         * @brief Query pair bracketing one pass.
+         */
+        struct PassQueries {
+                std::string Name;         ///< Pass name
+                unsigned int StartQuery;  ///< Timestamp at pass begin
+                unsigned int EndQuery;    ///< Timestamp at pass end
+        };
+
+        /**
+         * @brief All queries issued during one frame.
+         */
+        struct FrameQueries {
+                std::vector<unsigned int> Pool;  ///< Query objects owned
+                size_t Used = 0;  ///< Query objects used this frame
+                std::vector<PassQueries> Passes;  ///< Passes issued
+                unsigned int FrameStart = 0;      ///< Timestamp at frame begin
+                unsigned int FrameEnd = 0;        ///< Timestamp at frame end
+                bool Submitted = false;  ///< Whether results are outstanding
+        };
+
+        static std::array<FrameQueries, FRAME_LATENCY>
+            s_Frames;                  ///< Ring of in-flight frames
+        static size_t s_FrameIndex;    ///< Ring slot of the current frame
+        static std::vector<size_t>
+            s_OpenPasses;  ///< Indices of passes begun but not ended
+        static size_t s_DroppedFrames;  ///< Frames whose results were late
+        static bool s_Initialized;      ///< Whether a context is available
+        static bool s_InFrame;          ///< Between BeginFrame and EndFrame
+        static float s_FrameTimeMS;     ///< Latest resolved frame time
+        static std::vector<std::pair<std::string, float>>
+            s_PassTimesMS;  ///< Latest resolved pass times
+        static bool s_HasNewTimings;  ///< Resolved since the last Publish()
+
+    public:
+        /**
+         * @brief Enable profiling for the current OpenGL context.
+         *
+         * Must be called once after the context has been created.
+         */
+        static void Initialize();
+
+        /**
+         * @brief Release all query objects.
+         *
+         * Must be called while the OpenGL context is still current.
+         */
+        static void Shutdown();
+
+        /**
+         * @brief Start a frame.
+         *
+         * Reads back the frame issued FRAME_LATENCY frames ago, if the GPU is
+         * done with it; see Publish().
+         */
+        static void BeginFrame();
+
+        /**
+         * @brief End the current frame.
+         *
+         * Any pass still open is closed.
+         */
+        static void EndFrame();
+
+        /**
+         * @brief Begin a named render pass.
+         *
+         * Passes may nest. Passes with the same name within a frame are
+         * summed.
+         *
+         * @param name Pass name
+         */
+        static void BeginPass(const std::string& name);
+
+        /**
+         * @brief End the most recently begun pass.
+         */
+        static void EndPass();
+
+        /**
+         * @brief Copy the latest resolved timings to Time.
+         *
+         * Call on the thread that updates Time, while no frame is being
+         * profiled: after rendering when both happen on one thread, or at
+         * the RenderThread handover. Does nothing if no frame was resolved
+         * since the last call.
+         */
+        static void Publish();
+
+        /**
+         * @brief Get the GPU time of the latest resolved frame.
+         *
+         * Meant for the rendering thread; other threads read
+         * Time::GetGPUFrameTimeMS().
+         *
+         * @return Milliseconds, 0 until a frame has been resolved
+         */
+        static float GetFrameTimeMS() { return s_FrameTimeMS; }
+
+        /**
+         * @brief Get the number of frames whose results were not available
+         * in time and had to be discarded.
+         *
+         * @return Dropped frame count
+         */
+        static size_t GetDroppedFrameCount() { return s_DroppedFrames; }
+
+    private:
+        /**
+         * @brief Issue a timestamp query from the current frame's pool.
+         *
+         * @return Query object the timestamp was written to
+         */
+        static unsigned int IssueTimestamp();
+
+        /**
+         * @brief Read back a submitted frame without blocking.
+         *
+         * @param frame Frame to resolve
+         */
+        static void CollectResults(FrameQueries& frame);
+};
+
+}  // namespace Obelisk
@@ -0,0 +1,158 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include <mutex>
+
+namespace Obelisk {
+
+class Camera;
+class Material;
+class Mesh;
+class Shader;
+
+/**
+ * @brief A mesh and material baked into the impostor atlas.
+ */
+struct OBELISK_API Impostor {
+        uint32_t FirstTile = 0;  ///< Atlas tile of the first baked view
+        glm::vec3 Center{0.0f};  ///< Object-space bounding sphere center
+        float Radius = 0.0f;     ///< Object-space bounding sphere radius
+};
+
+/**
+ * @brief Per-instance data of a drawn impostor (vertex attributes 1 and 2).
+ */
+struct OBELISK_API ImpostorInstance {
+        glm::vec4 CenterRadius;  ///< World-space center (xyz) and radius (w)
+        glm::vec4 Params;  ///< x: first tile, y: yaw in radians, zw: unused
+};
+
+/**
+ * @brief Bakes meshes into billboard impostors and draws them instanced.
+ *
+ * Far away, a detailed mesh covers a handful of pixels but still costs a
+ * draw call and all of its vertices. Bake() renders a mesh with its
+ * material from YAW_VIEWS x PITCH_VIEWS directions around its bounding
+ * sphere into tiles of a shared atlas texture, using an offscreen
+ * framebuffer. Draw() then renders any number of such objects as
+ * camera-facing quads in a single instanced draw call; each quad selects the
+ * baked view closest to the direction it is seen from.
+ *
+ * Views are taken around the vertical axis and above the horizon, so
+ * impostors suit upright objects (trees, rocks, buildings) that are only
+ * rotated around Y and scaled uniformly. Baking uses ambient light only;
+ * dynamic lights do not affect impostors.
+ *
+ * Scene::Finalize() bakes every entity whose mesh is marked with
+ * Mesh::SetImpostorEnabled(), and Scene::Capture() swaps such entities for
+ * impostors beyond Scene::SetImpostorDistance().
+ *
+ * @example
+ * ```cpp
+ * treeMesh->SetImpostorEnabled(true);
+ * scene.SetImpostorDistance(40.0f);
+ * scene.Finalize();  // Bakes the tree impostor
+ * ```
+ */
+class OBELISK_API ImpostorAtlas {
+    public:
+        static constexpr int YAW_VIEWS = 8;    ///< Views around the Y axis
+        static constexpr int PITCH_VIEWS = 3;  ///< Elevations 0, 30, 60 deg
+        static constexpr int VIEWS = YAW_VIEWS * PITCH_VIEWS;
+        static constexpr int TILE_SIZE = 64;     ///< Tile edge in pixels
+        static constexpr int ATLAS_SIZE = 2048;  ///< Atlas edge in pixels
+        static constexpr int TILES_PER_ROW = ATLAS_SIZE / TILE_SIZE;
+        static constexpr uint32_t MAX_TILES = TILES_PER_ROW * TILES_PER_ROW;
+
+    private:
+        static std::unordered_map<uint64_t, Impostor>
+            s_Impostors;                          ///< Baked impostors by key
+        static uint32_t s_NextTile;               ///< First unused atlas tile
+        static unsigned int s_Texture;            ///< RGBA atlas
+        static unsigned int s_Depth;              ///< Depth renderbuffer
+        static unsigned int s_Framebuffer;        ///< Renders into the atlas
+        static unsigned int s_VAO;                ///< Quad and instance layout
+        static unsigned int s_QuadVBO;            ///< Unit quad corners
+        static unsigned int s_InstanceVBO;        ///< Streamed instance data
+        static std::unique_ptr<Shader> s_Shader;  ///< Billboard shader
+        static std::mutex s_Mutex;                ///< Guards s_Impostors
+
+    public:
+        /**
+         * @brief Create the billboard shader and vertex layout.
+         *
+         * The atlas itself is only allocated by the first Bake().
+         */
+        static void Initialize();
+
+        /**
+         * @brief Release the atlas and all GL objects.
+         *
+         * Every Impostor returned so far becomes invalid.
+         */
+        static void Shutdown();
+
+        /**
+         * @brief Bake a mesh with a material into the atlas.
+         *
+         * Baking the same pair again returns the existing impostor. Must be
+         * called with the GL context current and outside a Renderer frame;
+         * waits for the material's shader to finish compiling.
+         *
+         * @param mesh Geometry to bake
+         * @param material Material to bake it with
+         * @return The impostor, or nullptr if the atlas is full or not
+         * initialized
+         */
+        static const Impostor* Bake(const Mesh& mesh, const Material& material);
+
+        /**
+         * @brief Look up a baked impostor.
+         *
+         * @param mesh Geometry
+         * @param material Material
+         * @return The impostor, or nullptr if the pair has not been baked
+         */
+        static const Impostor* Find(const Mesh& mesh, const Material& material);
+
+        /**
+         * @brief Build the instance data of an impostor at a transform.
+         *
+         * @param impostor Baked impostor
+         * @param model Object-to-world matrix of the replaced entity
+         * @return Instance to pass to Draw()
+         */
+        static ImpostorInstance MakeInstance(const Impostor& impostor,
+                                             const glm::mat4& model);
+
+        /**
+         * @brief Draw impostors in one instanced draw call.
+         *
+         * @param camera Camera the frame is rendered from
+         * @param instances Impostors to draw
+         */
+        static void Draw(const Camera& camera,
+                         const std::vector<ImpostorInstance>& instances);
+
+        /**
+         * @brief Get the number of atlas tiles in use.
+         *
+         * @return Used tile count, out of MAX_TILES
+         */
+        static uint32_t GetUsedTileCount() { return s_NextTile; }
+
+    private:
+        /**
+         * @brief Allocate the atlas texture and framebuffer.
+         *
+         * @return true if the framebuffer is complete
+         */
+        static bool CreateAtlas();
+
+        /**
+         * @brief Get the lookup key of a mesh and material pair.
+         */
+        static uint64_t MakeKey(const Mesh& mesh, const Material& material);
+};
+
+}  // namespace Obelisk
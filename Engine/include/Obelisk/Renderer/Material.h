@@ -0,0 +1,207 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include <array>
+
+namespace Obelisk {
+
+class Shader;
+class Texture;
+
+/**
+ * @brief std140 layout of the `Material` uniform block.
+ */
+struct MaterialBlock {
+        glm::vec4 BaseColor = glm::vec4(1.0f);  ///< Multiplied with texture 0
+        glm::vec4 UVTransform =
+            glm::vec4(1.0f, 1.0f, 0.0f, 0.0f);  ///< xy: UV scale, zw: offset
+        glm::vec4 Params = glm::vec4(0.0f);     ///< Free material parameters
+};
+
+static_assert(sizeof(MaterialBlock) % 16 == 0, "std140 blocks are vec4-sized");
+
+/**
+ * @brief A shader variant together with its textures and parameters.
+ *
+ * Materials are the unit the Renderer sorts and batches on: two draws with
+ * the same material render identically apart from their mesh and transform.
+ * They are only created through MaterialLibrary::Create(), which returns the
+ * existing material when one with the same content already exists, so
+ * comparing material pointers (or IDs) is enough to detect identical state.
+ *
+ * Each material owns a slot in the MaterialLibrary's uniform buffer holding
+ * its MaterialBlock. Changing a parameter only marks the material dirty; the
+ * block is rewritten once, at the start of the next Renderer::EndFrame().
+ *
+ * The sort key is computed once at creation:
+ * - bits 48-63: shader program (lowest 16 bits)
+ * - bits 24-47: material ID
+ * - bits 0-23: left free for the Renderer (mesh ID)
+ *
+ * @note Materials are shared. Changing a parameter affects every entity
+ * using the material; create a new material to change a single entity.
+ *
+ * @example
+ * ```cpp
+ * MaterialBlock block;
+ * block.BaseColor = glm::vec4(1.0f, 0.5f, 0.5f, 1.0f);
+ * auto material = MaterialLibrary::Create(shader, {brickTexture}, block);
+ *
+ * Renderer::Submit(mesh, *material, transform.GetModelMatrix());
+ * ```
+ */
+class OBELISK_API Material {
+    public:
+        static constexpr int MAX_TEXTURES =
+            4;  ///< Textures per material, bound to units 0-3
+
+        using TextureSet =
+            std::array<std::shared_ptr<Texture>, MAX_TEXTURES>;  ///< By unit
+
+    private:
+        std::shared_ptr<Shader> m_Shader;  ///< Program variant
+        TextureSet m_Textures;             ///< Textures by texture unit
+        MaterialBlock m_Block;             ///< Parameters
+
+        uint32_t m_ID = 0;       ///< Stable ID, unique per material
+        uint32_t m_Slot = 0;     ///< Uniform buffer slot
+        uint64_t m_Hash = 0;     ///< Content hash of the current state
+        uint64_t m_SortKey = 0;  ///< Precomputed sort key
+        bool m_Dirty = false;    ///< Block is queued for upload
+
+        friend class MaterialLibrary;
+
+        /**
+         * @brief Create a material; see MaterialLibrary::Create().
+         *
+         * @param shader Program variant
+         * @param textures Textures by texture unit
+         * @param block Parameters
+         * @param id Stable material ID
+         * @param slot Uniform buffer slot
+         */
+        Material(std::shared_ptr<Shader> shader, TextureSet textures,
+                 const MaterialBlock& block, uint32_t id, uint32_t slot);
+
+        /**
+         * @brief Rehash after a parameter change and queue the upload.
+         */
+        void MarkDirty();
+
+    public:
+        /**
+         * @brief Release the uniform buffer slot.
+         */
+        ~Material();
+
+        Material(const Material&) = delete;
+        Material& operator=(const Material&) = delete;
+
+        /**
+         * @brief Compute the content hash of a material.
+         *
+         * Shaders are identified by their ShaderCache key, so separately
+         * loaded copies of the same variant hash equally. Textures are
+         * identified by object.
+         *
+         * @param shader Program variant
+         * @param textures Textures by texture unit
+         * @param block Parameters
+         * @return 64-bit content hash
+         */
+        static uint64_t ComputeHash(const Shader* shader,
+                                    const TextureSet& textures,
+                                    const MaterialBlock& block);
+
+        /**
+         * @brief Check whether this material has the given content.
+         *
+         * Compares what ComputeHash() hashes, so materials whose hashes
+         * merely collide are told apart.
+         *
+         * @param shader Program variant
+         * @param textures Textures by texture unit
+         * @param block Parameters
+         * @return true if shader, textures and parameters all match
+         */
+        bool Matches(const Shader* shader, const TextureSet& textures,
+                     const MaterialBlock& block) const;
+
+        /**
+         * @brief Replace all parameters.
+         * @param block New parameters
+         */
+        void SetBlock(const MaterialBlock& block);
+
+        /**
+         * @brief Set the color multiplied with texture 0.
+         * @param color RGBA color
+         */
+        void SetBaseColor(const glm::vec4& color);
+
+        /**
+         * @brief Set the texture coordinate transformation.
+         * @param scale UV scale
+         * @param offset UV offset, applied after scaling
+         */
+        void SetUVTransform(const glm::vec2& scale, const glm::vec2& offset);
+
+        /**
+         * @brief Set the free material parameters.
+         * @param params Shader-defined parameters
+         */
+        void SetParams(const glm::vec4& params);
+
+        /**
+         * @brief Get the program variant.
+         * @return Shader, or nullptr if none is set
+         */
+        const std::shared_ptr<Shader>& GetShader() const { return m_Shader; }
+
+        /**
+         * @brief Get the texture bound to a texture unit.
+         * @param unit Texture unit, 0 to MAX_TEXTURES - 1
+         * @return Texture, or nullptr if the unit is unused
+         */
+        const Texture* GetTexture(int unit) const {
+            return m_Textures[unit].get();
+        }
+
+        /**
+         * @brief Get all textures.
+         * @return Textures by texture unit
+         */
+        const TextureSet& GetTextures() const { return m_Textures; }
+
+        /**
+         * @brief Get the parameters.
+         * @return Parameter block
+         */
+        const MaterialBlock& GetBlock() const { return m_Block; }
+
+        /**
+         * @brief Get the stable material ID.
+         * @return ID, unique among all materials created this run
+         */
+        uint32_t GetID() const { return m_ID; }
+
+        /**
+         * @brief Get the uniform buffer slot.
+         * @return Slot index
+         */
+        uint32_t GetSlot() const { return m_Slot; }
+
+        /**
+         * @brief Get the content hash of the current state.
+         * @return Content hash
+         */
+        uint64_t GetHash() const { return m_Hash; }
+
+        /**
+         * @brief Get the precomputed sort key.
+         * @return Sort key with the lowest 24 bits clear
+         */
+        uint64_t GetSortKey() const { return m_SortKey; }
+};
+
+}  // namespace Obelisk
@@ -0,0 +1,146 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include "Obelisk/Renderer/Material.h"
+#include <mutex>
+#include <unordered_map>
+
+namespace Obelisk {
+
+/**
+ * @brief Creates, deduplicates and uploads Materials.
+ *
+ * Create() hashes the requested shader, textures and parameters and returns
+ * the live material with the same content if there is one, so entities that
+ * render identically share a single material and ID. Candidates with the
+ * same hash are compared in full, so a hash collision never shares a
+ * material. Materials are held
+ * weakly; a material is destroyed with its last user and its slot reused.
+ *
+ * All material parameter blocks live in one uniform buffer, one aligned
+ * slot per material. UploadDirty() rewrites only the slots of materials that
+ * changed since the last frame, and Bind() selects a material's slot with
+ * glBindBufferRange on UniformBinding::Material.
+ *
+ * @example
+ * ```cpp
+ * MaterialLibrary::Initialize();
+ *
+ * auto a = MaterialLibrary::Create(shader, {texture});
+ * auto b = MaterialLibrary::Create(shader, {texture});
+ * assert(a == b);
+ *
+ * // Each frame, before drawing:
+ * MaterialLibrary::UploadDirty();
+ * MaterialLibrary::Bind(*a);
+ * ```
+ */
+class OBELISK_API MaterialLibrary {
+    public:
+        static constexpr uint32_t INITIAL_CAPACITY =
+            256;  ///< Initial uniform buffer slots
+
+    private:
+        static std::unordered_multimap<uint64_t, std::weak_ptr<Material>>
+            s_Materials;  ///< Live materials by content hash
+        static std::vector<Material*>
+            s_Slots;  ///< Material per slot, nullptr when free
+        static std::vector<uint32_t> s_FreeSlots;  ///< Reusable slots
+        static std::vector<Material*> s_Dirty;  ///< Blocks to upload
+
+        static unsigned int s_Buffer;  ///< Uniform buffer with all blocks
+        static uint32_t s_Capacity;    ///< Slots allocated in s_Buffer
+        static size_t s_SlotStride;    ///< Aligned bytes per slot
+        static uint32_t s_NextID;      ///< ID of the next material
+        static size_t s_UploadCount;   ///< Blocks written last upload
+        static std::mutex
+            s_Mutex;  ///< Guards the library and material blocks, which the
+                      ///< render thread uploads while materials change
+
+        friend class Material;
+
+        /**
+         * @brief Queue a material's block for upload.
+         * @param material Material whose parameters changed
+         */
+        static void MarkDirty(Material* material);
+
+        /**
+         * @brief Move a material to its new content hash.
+         * @param material Material whose parameters changed
+         * @param previousHash Hash the material was registered under
+         */
+        static void Rehash(Material* material, uint64_t previousHash);
+
+        /**
+         * @brief Forget a material that is being destroyed.
+         * @param material Material being destroyed
+         */
+        static void Release(Material* material);
+
+        /**
+         * @brief Reallocate the uniform buffer and re-upload every block.
+         * @param capacity New number of slots
+         */
+        static void Grow(uint32_t capacity);
+
+    public:
+        /**
+         * @brief Create the uniform buffer.
+         *
+         * Must be called once after the OpenGL context has been created.
+         * Materials may be created before, but are not uploaded until then.
+         */
+        static void Initialize();
+
+        /**
+         * @brief Release the uniform buffer.
+         *
+         * Materials still alive keep working on the CPU side but are no
+         * longer uploaded.
+         */
+        static void Shutdown();
+
+        /**
+         * @brief Get the material for a shader, textures and parameters.
+         *
+         * @param shader Program variant
+         * @param textures Textures by texture unit
+         * @param block Parameters
+         * @return Existing material with the same content, or a new one
+         */
+        static std::shared_ptr<Material> Create(
+            std::shared_ptr<Shader> shader,
+            const Material::TextureSet& textures = {},
+            const MaterialBlock& block = MaterialBlock());
+
+        /**
+         * @brief Upload the blocks of all materials changed since the last
+         * call.
+         *
+         * Called by the Renderer before it issues the frame's draws.
+         */
+        static void UploadDirty();
+
+        /**
+         * @brief Bind a material's block to UniformBinding::Material.
+         * @param material Material to bind
+         */
+        static void Bind(const Material& material);
+
+        /**
+         * @brief Get the number of live materials.
+         * @return Material count
+         */
+        static size_t GetMaterialCount() {
+            return s_Slots.size() - s_FreeSlots.size();
+        }
+
+        /**
+         * @brief Get the number of blocks the last UploadDirty() wrote.
+         * @return Uploaded block count
+         */
+        static size_t GetUploadCount() { return s_UploadCount; }
+};
+
+}  // namespace Obelisk
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ObeliskPCH.h"
+#include "Obelisk/Core/Bounds.h"
 
 namespace Obelisk {
 
@@ -65,6 +66,12 @@ class OBELISK_API Mesh {
 
         int m_NumVertices = 0;  ///< Number of vertices in this mesh
         int m_NumIndices = 0;   ///< Number of indices in this mesh
+        AABB m_Bounds;          ///< Object-space bounds of the vertices
+        bool m_ImpostorEnabled = false;  ///< Drawn as impostor when far away
+        std::vector<glm::vec3>
+            m_CPUPositions;  ///< Vertex positions kept for Raycast()
+        std::vector<unsigned int>
+            m_CPUIndices;  ///< Indices kept for Raycast()
 
         uint32_t m_MeshID = -1;  ///< Unique identifier for this mesh instance
         static uint32_t
@@ -97,13 +104,16 @@ class OBELISK_API Mesh {
          * @param vertices Vector of vertex data to upload to the GPU
          * @param indices Vector of indices for indexed rendering (reduces
          * memory usage)
+         * @param keepCPUGeometry Also keep a CPU copy of the positions and
+         * indices so Raycast() can test triangles
          *
          * @note The mesh takes ownership of the data and uploads it to GPU
          * memory
          * @note Indices should reference valid vertex array positions
          */
         Mesh(std::vector<Vertex> const& vertices,
-             std::vector<unsigned int> const& indices);
+             std::vector<unsigned int> const& indices,
+             bool keepCPUGeometry = false);
 
         /**
          * @brief Destructor that cleans up OpenGL resources.
@@ -113,6 +123,28 @@ class OBELISK_API Mesh {
          */
         ~Mesh();
 
+        /**
+         * @brief Load a mesh cooked by ObeliskCook.
+         *
+         * Reads the blob written for a source model (the path plus ".omesh")
+         * and uploads it without any parsing. Cooked vertices are already
+         * deduplicated and ordered for the post-transform vertex cache.
+         *
+         * @param path Source model path relative to the meshes directory
+         * (e.g. "rock.obj")
+         * @param keepCPUGeometry Keep the positions and indices for
+         * Raycast(), e.g. for meshes that Scene::Pick() should hit
+         * @return The mesh, or nullptr if no valid cooked blob exists
+         *
+         * @example
+         * ```cpp
+         * std::shared_ptr<Mesh> rock = Mesh::Load("rock.obj");
+         * std::shared_ptr<Mesh> door = Mesh::Load("door.obj", true);
+         * ```
+         */
+        static std::shared_ptr<Mesh> Load(const std::string& path,
+                                          bool keepCPUGeometry = false);
+
         /**
          * @brief Bind this mesh's VAO for rendering.
          *
@@ -146,6 +178,84 @@ class OBELISK_API Mesh {
          * glDrawElements calls
          */
         [[nodiscard]] int GetNumberOfIndices() const { return m_NumIndices; };
+
+        /**
+         * @brief Get the object-space bounds of this mesh.
+         *
+         * @return Box enclosing every vertex position
+         */
+        [[nodiscard]] const AABB& GetBounds() const { return m_Bounds; }
+
+        /**
+         * @brief Read the vertex and index data back from GPU memory.
+         *
+         * Meant for load-time processing such as static batching; this
+         * stalls until the GPU has the buffers ready.
+         *
+         * @param vertices Receives the vertices
+         * @param indices Receives the indices
+         */
+        void ReadBack(std::vector<Vertex>& vertices,
+                      std::vector<unsigned int>& indices) const;
+
+        /**
+         * @brief Intersect an object-space ray with the mesh's triangles.
+         *
+         * Only reads the CPU copy of the geometry, so it makes no OpenGL
+         * calls and may run on any thread. Meshes created without
+         * keepCPUGeometry have no copy and are never hit. Rays missing the
+         * bounds return at once.
+         *
+         * @param ray Ray in the mesh's object space; distances are in units
+         * of its direction's length
+         * @param maxDistance Ignore hits beyond this distance
+         * @param distance Receives the distance to the closest triangle hit
+         * @return true if a triangle is hit within maxDistance
+         */
+        bool Raycast(const Ray& ray, float maxDistance, float& distance) const;
+
+        /**
+         * @brief Check whether a CPU copy of the geometry is kept.
+         *
+         * @return true if Raycast() can test triangles
+         */
+        [[nodiscard]] bool HasCPUGeometry() const {
+            return !m_CPUIndices.empty();
+        }
+
+        /**
+         * @brief Free the CPU copy of the geometry kept for Raycast().
+         *
+         * Raycast() then never hits this mesh. Not safe while another thread
+         * may be picking.
+         */
+        void ReleaseCPUGeometry();
+
+        /**
+         * @brief Get the unique identifier of this mesh.
+         *
+         * @return Mesh ID, stable for the lifetime of the mesh
+         */
+        [[nodiscard]] uint32_t GetMeshID() const { return m_MeshID; }
+
+        /**
+         * @brief Mark this mesh for billboard impostors.
+         *
+         * Scene::Finalize() bakes entities using a marked mesh into the
+         * ImpostorAtlas, and distant ones are then drawn as impostors.
+         *
+         * @param enabled Whether to use impostors for this mesh
+         */
+        void SetImpostorEnabled(bool enabled) { m_ImpostorEnabled = enabled; }
+
+        /**
+         * @brief Check whether this mesh is marked for impostors.
+         *
+         * @return true if SetImpostorEnabled(true) was called
+         */
+        [[nodiscard]] bool IsImpostorEnabled() const {
+            return m_ImpostorEnabled;
+        }
 };
 
 }  // namespace Obelisk
\ No newline at end of file
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include "Obelisk/Core/Camera.h"
+#include "Obelisk/Renderer/ImpostorAtlas.h"
+#include "Obelisk/Scene/Light.h"
+
+namespace Obelisk {
+
+class Material;
+class Mesh;
+
+/**
+ * @brief Everything needed to render one frame, captured on the update
+ * thread.
+ *
+ * A snapshot is a self-contained copy of the frame's view: the camera, the
+ * lights and the list of visible draws with their model matrices. Once
+ * captured it is never modified, so the render thread can draw it while the
+ * update thread already simulates the next frame (see RenderThread).
+ *
+ * Meshes and materials are referenced, not copied; they must stay alive
+ * until the frame has been rendered.
+ *
+ * @example
+ * ```cpp
+ * RenderSnapshot snapshot;
+ * scene.Capture(snapshot);
+ *
+ * Renderer::BeginFrame(snapshot.ViewCamera, snapshot.TotalTime,
+ *                      snapshot.DeltaTime);
+ * snapshot.Submit();
+ * Renderer::EndFrame();
+ * ```
+ */
+struct OBELISK_API RenderSnapshot {
+        /**
+         * @brief A visible draw.
+         */
+        struct DrawRecord {
+                const Mesh* DrawMesh;          ///< Geometry
+                const Material* DrawMaterial;  ///< Shader, textures, params
+                glm::mat4 Model;               ///< Object-to-world matrix
+        };
+
+        Camera ViewCamera;               ///< Copy of the scene camera
+        bool HasCamera = false;          ///< Whether ViewCamera is valid
+        std::vector<PointLight> Lights;  ///< Copy of the scene lights
+        std::vector<DrawRecord> Draws;   ///< Draws that survived culling
+        std::vector<ImpostorInstance>
+            Impostors;               ///< Distant draws replaced by impostors
+        bool UseGPUCulling = false;  ///< Cull and draw GPUCulling's objects
+        std::vector<glm::mat4>
+            GPUTransforms;  ///< Models of GPUCulling's dynamic objects
+
+        size_t BatchesTested = 0;   ///< Static batches frustum-tested
+        size_t BatchesCulled = 0;   ///< Static batches rejected
+        size_t EntitiesTested = 0;  ///< Dynamic entities frustum-tested
+        size_t EntitiesCulled = 0;  ///< Dynamic entities rejected
+
+        int Width = 0;           ///< Framebuffer width at capture time
+        int Height = 0;          ///< Framebuffer height at capture time
+        float TotalTime = 0.0f;  ///< Time::GetTotalTime() at capture time
+        float DeltaTime = 0.0f;  ///< Time::GetDeltaTime() at capture time
+        float FrameTimeMS =
+            0.0f;  ///< Time::GetFrameTimeMS() at capture time
+
+        /**
+         * @brief Reset the snapshot for reuse, keeping its allocations.
+         */
+        void Clear() {
+            HasCamera = false;
+            Lights.clear();
+            Draws.clear();
+            Impostors.clear();
+            UseGPUCulling = false;
+            GPUTransforms.clear();
+            BatchesTested = 0;
+            BatchesCulled = 0;
+            EntitiesTested = 0;
+            EntitiesCulled = 0;
+        }
+
+        /**
+         * @brief Record a visible draw.
+         *
+         * @param mesh Geometry to draw
+         * @param material Material to draw with
+         * @param model Object-to-world matrix
+         */
+        void Add(const Mesh& mesh, const Material& material,
+                 const glm::mat4& model) {
+            Draws.push_back({&mesh, &material, model});
+        }
+
+        /**
+         * @brief Record a distant draw as an impostor.
+         *
+         * @param impostor Baked impostor of the draw's mesh and material
+         * @param model Object-to-world matrix
+         */
+        void AddImpostor(const Impostor& impostor, const glm::mat4& model) {
+            Impostors.push_back(ImpostorAtlas::MakeInstance(impostor, model));
+        }
+
+        /**
+         * @brief Submit every recorded draw to the Renderer.
+         *
+         * Must be called between Renderer::BeginFrame() and
+         * Renderer::EndFrame().
+         */
+        void Submit() const;
+};
+
+}  // namespace Obelisk
@@ -0,0 +1,185 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <mutex>
+
+namespace Obelisk {
+
+/**
+ * @brief Counters describing the work of one rendered frame.
+ *
+ * Counts cover everything submitted between RenderStatistics::BeginFrame()
+ * and RenderStatistics::EndFrame(): the Renderer, SpriteBatch, DebugDraw and
+ * the lighting upload.
+ */
+struct OBELISK_API RenderStats {
+        size_t Frame = 0;  ///< Frame number, counted from the first frame
+
+        size_t DrawCalls = 0;  ///< glDraw* calls issued
+        size_t Instances = 0;  ///< Objects drawn (sprites count one each)
+        size_t Triangles = 0;  ///< Triangles submitted to the GPU
+
+        size_t ProgramBinds = 0;      ///< glUseProgram calls that switched
+        size_t VertexArrayBinds = 0;  ///< glBindVertexArray calls
+        size_t TextureBinds = 0;      ///< glBindTexture calls
+        size_t UniformUploads = 0;    ///< glUniform* and uniform buffer writes
+        size_t BytesStreamed = 0;     ///< Bytes written to GPU buffers
+
+        size_t BatchesTested = 0;   ///< Static batches frustum-tested
+        size_t BatchesCulled = 0;   ///< Static batches rejected
+        size_t EntitiesTested = 0;  ///< Dynamic entities frustum-tested
+        size_t EntitiesCulled = 0;  ///< Dynamic entities rejected
+
+        float CPUFrameTimeMS = 0.0f;  ///< Time::GetFrameTimeMS() of the frame
+        float RenderTimeMS = 0.0f;    ///< CPU time spent rendering the frame
+        float GPUFrameTimeMS = 0.0f;  ///< Latest resolved GPU frame time
+};
+
+/**
+ * @brief Collects RenderStats every frame and keeps a history of them.
+ *
+ * Rendering code reports its work through the Record*() functions; the
+ * counters of the frame in progress are reset by BeginFrame() and moved into
+ * a ring of the last HISTORY_SIZE frames by EndFrame(). The history can be
+ * queried at any time, also from another thread than the one rendering, and
+ * written out as CSV for offline analysis.
+ *
+ * GPU times come from GPUProfiler, which resolves them a few frames late;
+ * each row carries the latest GPU time available when the frame ended.
+ *
+ * @example
+ * ```cpp
+ * RenderStats last = RenderStatistics::GetLast();
+ * LOG_INFO("{} draws, {} triangles", last.DrawCalls, last.Triangles);
+ *
+ * RenderStatistics::WriteCSV("render_stats.csv");
+ * ```
+ */
+class OBELISK_API RenderStatistics {
+    public:
+        static constexpr size_t HISTORY_SIZE =
+            600;  ///< Frames kept in the history
+
+    private:
+        static RenderStats s_Current;  ///< Frame in progress
+        static std::array<RenderStats, HISTORY_SIZE>
+            s_History;                 ///< Ring of finished frames
+        static size_t s_HistoryIndex;  ///< Next ring slot to write
+        static size_t s_HistoryCount;  ///< Valid ring entries
+        static size_t s_FrameCount;    ///< Frames finished so far
+        static std::chrono::high_resolution_clock::time_point
+            s_FrameStart;           ///< When BeginFrame() was called
+        static std::mutex s_Mutex;  ///< Guards the history
+
+    public:
+        /**
+         * @brief Reset the counters for a new frame.
+         */
+        static void BeginFrame();
+
+        /**
+         * @brief Finish the frame and append it to the history.
+         *
+         * @param cpuFrameTimeMS Time::GetFrameTimeMS() of the frame, as
+         * captured in its RenderSnapshot
+         */
+        static void EndFrame(float cpuFrameTimeMS);
+
+        /**
+         * @brief Record a draw call.
+         *
+         * @param triangles Triangles drawn (0 for lines and points)
+         * @param instances Objects drawn by the call
+         */
+        static void RecordDraw(size_t triangles, size_t instances = 1) {
+            s_Current.DrawCalls++;
+            s_Current.Instances += instances;
+            s_Current.Triangles += triangles;
+        }
+
+        /**
+         * @brief Record a program switch.
+         */
+        static void RecordProgramBind() { s_Current.ProgramBinds++; }
+
+        /**
+         * @brief Record a vertex array bind.
+         */
+        static void RecordVertexArrayBind() { s_Current.VertexArrayBinds++; }
+
+        /**
+         * @brief Record a texture bind.
+         */
+        static void RecordTextureBind() { s_Current.TextureBinds++; }
+
+        /**
+         * @brief Record a uniform or uniform buffer write.
+         *
+         * @param bytes Bytes sent to the GPU
+         */
+        static void RecordUniformUpload(size_t bytes) {
+            s_Current.UniformUploads++;
+            s_Current.BytesStreamed += bytes;
+        }
+
+        /**
+         * @brief Record a vertex, index or texture buffer upload.
+         *
+         * @param bytes Bytes sent to the GPU
+         */
+        static void RecordBufferUpload(size_t bytes) {
+            s_Current.BytesStreamed += bytes;
+        }
+
+        /**
+         * @brief Record the culling results of the frame's scene capture.
+         *
+         * @param batchesTested Static batches tested against the frustum
+         * @param batchesCulled Static batches rejected
+         * @param entitiesTested Dynamic entities tested against the frustum
+         * @param entitiesCulled Dynamic entities rejected
+         */
+        static void RecordCulling(size_t batchesTested, size_t batchesCulled,
+                                  size_t entitiesTested,
+                                  size_t entitiesCulled);
+
+        /**
+         * @brief Get the most recently finished frame.
+         *
+         * @return Stats of the last frame, or zeroes before the first one
+         */
+        static RenderStats GetLast();
+
+        /**
+         * @brief Get the finished frames still in the history.
+         *
+         * @return Stats ordered from oldest to newest
+         */
+        static std::vector<RenderStats> GetHistory();
+
+        /**
+         * @brief Average the counters over the most recent frames.
+         *
+         * @param frames Number of frames to average (clamped to the history)
+         * @return Averaged stats; Frame is that of the newest frame
+         */
+        static RenderStats GetAverage(size_t frames = HISTORY_SIZE);
+
+        /**
+         * @brief Write the history as CSV, one row per frame.
+         *
+         * @param path File to write; overwritten if it exists
+         * @return true if the file was written
+         */
+        static bool WriteCSV(const std::filesystem::path& path);
+
+        /**
+         * @brief Discard the history and the frame in progress.
+         */
+        static void Reset();
+};
+
+}  // namespace Obelisk
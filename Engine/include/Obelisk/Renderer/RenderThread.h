@@ -0,0 +1,143 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include "Obelisk/Renderer/RenderSnapshot.h"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Obelisk {
+
+class Window;
+
+/**
+ * @brief Renders frames on a dedicated thread that owns the GL context.
+ *
+ * Normally simulation and GL submission run back to back on one thread, so
+ * neither ever overlaps the other. With a RenderThread, the update thread
+ * only captures each frame into a RenderSnapshot and hands it over; the
+ * render thread draws and presents it while the update thread already works
+ * on the next frame. When both halves are heavy this approaches twice the
+ * throughput.
+ *
+ * There are two snapshots. Submit() waits until the render thread has
+ * finished the previous frame before handing over the new one, so the
+ * update thread is never more than one frame ahead (bounded latency), and
+ * the handover is the only point where both threads synchronize. Engine
+ * state the render thread consumes (DebugDraw shapes) is latched there, and
+ * state it produces (GPU timings) is handed back to Time. The snapshot
+ * carries the frame's timing, so rendering never reads Time.
+ *
+ * While the thread runs, the GL context is current on it and nowhere else.
+ * Work that needs GL, such as creating textures or meshes, must be passed to
+ * Enqueue(). The window's render callback runs on the render thread.
+ *
+ * @example
+ * ```cpp
+ * RenderThread renderThread(window);
+ * renderThread.Start();
+ *
+ * while (!window.ShouldClose()) {
+ *     window.PollEvents();
+ *     Update();
+ *     window.Capture(renderThread.GetSnapshot());
+ *     renderThread.Submit();
+ * }
+ *
+ * renderThread.Stop();
+ * ```
+ */
+class OBELISK_API RenderThread {
+    private:
+        Window& m_Window;      ///< Window whose context the thread owns
+        std::thread m_Thread;  ///< The render thread
+        std::mutex m_Mutex;    ///< Guards the hand-over state below
+        std::condition_variable
+            m_WorkAvailable;  ///< Wakes the render thread
+        std::condition_variable
+            m_Idle;  ///< Wakes the update thread when a frame is done
+
+        RenderSnapshot m_Snapshots[2];  ///< Written and rendered in turn
+        int m_WriteIndex = 0;  ///< Snapshot the update thread writes
+        const RenderSnapshot* m_Pending =
+            nullptr;  ///< Handed over, not yet picked up
+        std::vector<std::function<void()>>
+            m_Commands;          ///< GL work queued with Enqueue()
+        bool m_Busy = false;     ///< Render thread is working on a frame
+        bool m_Running = false;  ///< Cleared by Stop()
+
+        double m_WaitTimeMS = 0.0;  ///< Update thread wait in last Submit()
+
+    public:
+        /**
+         * @brief Create a render thread for a window; see Start().
+         *
+         * @param window Window whose context and scene are rendered
+         */
+        explicit RenderThread(Window& window);
+
+        /**
+         * @brief Stop the thread if it is still running.
+         */
+        ~RenderThread();
+
+        RenderThread(const RenderThread&) = delete;
+        RenderThread& operator=(const RenderThread&) = delete;
+
+        /**
+         * @brief Move the GL context from the calling thread to a new render
+         * thread.
+         */
+        void Start();
+
+        /**
+         * @brief Render everything still pending, stop the thread and make
+         * the GL context current on the calling thread again.
+         */
+        void Stop();
+
+        /**
+         * @brief Get the snapshot to capture the next frame into.
+         *
+         * @return Snapshot the render thread is not reading
+         */
+        RenderSnapshot& GetSnapshot() { return m_Snapshots[m_WriteIndex]; }
+
+        /**
+         * @brief Hand the captured snapshot to the render thread.
+         *
+         * Blocks until the previous frame has been rendered.
+         */
+        void Submit();
+
+        /**
+         * @brief Run GL work on the render thread before the next frame.
+         *
+         * @param command Function to run with the GL context current
+         */
+        void Enqueue(std::function<void()> command);
+
+        /**
+         * @brief Block until every submitted frame and queued command is
+         * done.
+         */
+        void Flush();
+
+        /**
+         * @brief Get the time the last Submit() waited for the render thread.
+         *
+         * Close to zero when updating is the bottleneck; close to the frame
+         * time when rendering is.
+         *
+         * @return Wait time in milliseconds
+         */
+        double GetWaitTimeMS() const { return m_WaitTimeMS; }
+
+    private:
+        /**
+         * @brief Render thread loop: run commands, render and present frames.
+         */
+        void ThreadMain();
+};
+
+}  // namespace Obelisk
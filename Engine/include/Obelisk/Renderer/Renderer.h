@@ -0,0 +1,219 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include "Obelisk/Renderer/UniformRingBuffer.h"
+
+namespace Obelisk {
+
+class Camera;
+class Material;
+class Mesh;
+class Shader;
+
+/**
+ * @brief Uniform block binding points shared by all shaders.
+ *
+ * GLSL 3.30 has no layout(binding) for uniform blocks, so Shader assigns
+ * these with glUniformBlockBinding once a program is linked.
+ */
+enum class UniformBinding : unsigned int {
+    PerFrame = 0,  ///< `uniform PerFrame`, see PerFrameBlock
+    PerDraw = 1,   ///< `uniform PerDraw`, see PerDrawBlock
+    Material = 2,  ///< `uniform Material`, see MaterialBlock
+};
+
+/**
+ * @brief std140 layout of the `PerFrame` uniform block.
+ */
+struct PerFrameBlock {
+        glm::mat4 View;            ///< World to view space
+        glm::mat4 Projection;      ///< View to clip space
+        glm::mat4 ViewProjection;  ///< World to clip space
+        glm::vec4 CameraPosition;  ///< World-space camera position (w = 1)
+        glm::vec4 Time;  ///< x: total time, y: delta time, zw: unused
+};
+
+/**
+ * @brief std140 layout of the `PerDraw` uniform block.
+ */
+struct PerDrawBlock {
+        glm::mat4 Model;  ///< Object to world space
+        glm::mat4
+            NormalMatrix;  ///< Inverse transpose of Model (upper 3x3 used)
+        glm::vec4 Params;  ///< Free per-draw parameters
+};
+
+static_assert(sizeof(PerFrameBlock) % 16 == 0, "std140 blocks are vec4-sized");
+static_assert(sizeof(PerDrawBlock) % 16 == 0, "std140 blocks are vec4-sized");
+
+/**
+ * @brief Records the frame's draws and feeds their data through uniform
+ * blocks.
+ *
+ * Setting matrices with glUniform* per draw is one of the slowest ways to
+ * feed a driver. Instead, Submit() only records the draw and writes its
+ * PerDrawBlock into a UniformRingBuffer (plain CPU memory, so recording does
+ * not need the GL context). EndFrame() uploads the whole frame's blocks at
+ * once and issues the draws, selecting each draw's block with
+ * glBindBufferRange.
+ *
+ * Draws are sorted by their material's precomputed sort key (program, then
+ * material) and mesh before they are issued, and program, material and
+ * vertex array bindings are only changed when they differ from the previous
+ * draw. Material textures occupy units 0 to Material::MAX_TEXTURES - 1.
+ *
+ * Shaders declare the blocks as:
+ * ```glsl
+ * layout(std140) uniform PerFrame {
+ *     mat4 view; mat4 projection; mat4 viewProjection;
+ *     vec4 cameraPosition; vec4 time;
+ * };
+ * layout(std140) uniform PerDraw {
+ *     mat4 model; mat4 normalMatrix; vec4 drawParams;
+ * };
+ * layout(std140) uniform Material {
+ *     vec4 baseColor; vec4 uvTransform; vec4 materialParams;
+ * };
+ * ```
+ *
+ * @example
+ * ```cpp
+ * Renderer::BeginFrame(camera);
+ * scene.GetRegistry().GetView<Transform, MeshRef, MaterialRef>().Each(
+ *     [](EntityID, TransformRef transform, MeshRef& mesh,
+ *        MaterialRef& material) {
+ *         Renderer::Submit(*ResourceRegistry::Get(mesh.Handle),
+ *                          *ResourceRegistry::Get(material.Handle),
+ *                          transform.GetModelMatrix());
+ *     });
+ * Renderer::EndFrame();
+ * ```
+ */
+class OBELISK_API Renderer {
+    public:
+        static constexpr size_t INITIAL_RING_SIZE =
+            1 << 20;  ///< Initial uniform bytes per frame
+
+    private:
+        /**
+         * @brief A recorded draw.
+         */
+        struct DrawItem {
+                uint64_t SortKey;              ///< Material key | mesh ID
+                const Mesh* DrawMesh;          ///< Geometry
+                Shader* DrawShader;            ///< Program (ready)
+                const Material* DrawMaterial;  ///< Textures and parameters
+                size_t BlockOffset;            ///< PerDrawBlock ring offset
+        };
+
+        static std::unique_ptr<UniformRingBuffer>
+            s_Uniforms;  ///< Per-frame and per-draw blocks
+        static std::vector<DrawItem> s_Draws;  ///< Draws recorded this frame
+        static size_t s_FrameBlockOffset;  ///< PerFrameBlock ring offset
+        static size_t s_DrawCount;   ///< Draws issued by the last frame
+        static size_t
+            s_StateChanges;  ///< Program/material/VAO binds last frame
+        static bool s_InFrame;       ///< Between BeginFrame() and EndFrame()
+
+    public:
+        /**
+         * @brief Create the uniform ring buffer.
+         *
+         * Must be called once after the OpenGL context has been created.
+         */
+        static void Initialize();
+
+        /**
+         * @brief Release the uniform ring buffer.
+         */
+        static void Shutdown();
+
+        /**
+         * @brief Start recording a frame.
+         *
+         * @param camera Camera the frame is rendered from
+         */
+        static void BeginFrame(const Camera& camera);
+
+        /**
+         * @brief Start recording a frame with explicit frame times.
+         *
+         * Used by the render thread, which renders a frame while Time has
+         * already moved on to the next one.
+         *
+         * @param camera Camera the frame is rendered from
+         * @param totalTime Seconds since startup (PerFrame.time.x)
+         * @param deltaTime Seconds since the previous frame (PerFrame.time.y)
+         */
+        static void BeginFrame(const Camera& camera, float totalTime,
+                               float deltaTime);
+
+        /**
+         * @brief Record a draw of an indexed mesh.
+         *
+         * Materials whose shader is still compiling draw with
+         * Shader::GetFallback(), or are skipped when no fallback is set.
+         *
+         * @param mesh Geometry to draw; must outlive EndFrame()
+         * @param material Shader, textures and parameters; must outlive
+         * EndFrame()
+         * @param model Object-to-world matrix
+         * @param params Free per-draw parameters (PerDraw.drawParams)
+         */
+        static void Submit(const Mesh& mesh, const Material& material,
+                           const glm::mat4& model,
+                           const glm::vec4& params = glm::vec4(0.0f));
+
+        /**
+         * @brief Upload the frame's uniform blocks and issue its draws.
+         */
+        static void EndFrame();
+
+        /**
+         * @brief Get the number of draws issued by the last frame.
+         * @return Draw count
+         */
+        static size_t GetDrawCount() { return s_DrawCount; }
+
+        /**
+         * @brief Get the number of program, material and vertex array binds
+         * the last frame needed.
+         * @return State change count
+         */
+        static size_t GetStateChangeCount() { return s_StateChanges; }
+
+        /**
+         * @brief Make a program current and apply the clustered lighting
+         * inputs.
+         *
+         * The material samplers already point at their units (see
+         * BindSamplers()). Used by every pass that draws materials (see also
+         * GPUCulling).
+         *
+         * @param shader Ready program to bind
+         */
+        static void BindProgram(const Shader& shader);
+
+        /**
+         * @brief Assign the engine's uniform block binding points.
+         *
+         * Called by Shader whenever a program becomes ready. Blocks the
+         * program does not declare are skipped.
+         *
+         * @param program Linked GL program
+         */
+        static void BindUniformBlocks(unsigned int program);
+
+        /**
+         * @brief Point the material samplers at their texture units.
+         *
+         * Called by Shader whenever a program becomes ready, so binding the
+         * program later sets no uniforms for them. Sets units 0 to
+         * Material::MAX_TEXTURES - 1 and keeps the current program.
+         *
+         * @param program Linked GL program
+         */
+        static void BindSamplers(unsigned int program);
+};
+
+}  // namespace Obelisk
@@ -0,0 +1,504 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include <type_traits>
+#include <unordered_map>
+
+namespace Obelisk {
+
+class Material;
+class Mesh;
+class Shader;
+class Texture;
+
+/**
+ * @brief Typed 32-bit reference to a resource in the ResourceRegistry.
+ *
+ * The low bits index the resource's slot and the high bits hold the slot's
+ * generation when the handle was issued. Releasing a resource bumps the
+ * generation, so handles kept past the release resolve to nullptr instead
+ * of a resource that later reuses the slot. A value of 0 is the null
+ * handle; generations start at 1.
+ */
+template <typename T>
+class ResourceHandle {
+    public:
+        static constexpr uint32_t INDEX_BITS = 20;  ///< Up to ~1M slots
+        static constexpr uint32_t INDEX_MASK = (1u << INDEX_BITS) - 1;
+        static constexpr uint32_t GENERATION_MASK =
+            (1u << (32 - INDEX_BITS)) - 1;  ///< Generations wrap here
+
+    private:
+        uint32_t m_Value = 0;  ///< Generation and index, 0 when null
+
+    public:
+        ResourceHandle() = default;
+
+        /**
+         * @brief Create a handle to a slot.
+         *
+         * @param index Slot index, below 2^INDEX_BITS
+         * @param generation Slot generation, non-zero
+         */
+        ResourceHandle(uint32_t index, uint32_t generation)
+            : m_Value((generation << INDEX_BITS) | index) {}
+
+        uint32_t GetIndex() const { return m_Value & INDEX_MASK; }
+        uint32_t GetGeneration() const { return m_Value >> INDEX_BITS; }
+        uint32_t GetValue() const { return m_Value; }
+        bool IsNull() const { return m_Value == 0; }
+
+        bool operator==(const ResourceHandle&) const = default;
+};
+
+using MeshHandle = ResourceHandle<Mesh>;          ///< Handle to a Mesh
+using MaterialHandle = ResourceHandle<Material>;  ///< Handle to a Material
+using ShaderHandle = ResourceHandle<Shader>;      ///< Handle to a Shader
+using TextureHandle = ResourceHandle<Texture>;    ///< Handle to a Texture
+
+/**
+ * @brief Dense slots of one resource type; see ResourceRegistry.
+ *
+ * Resolving a handle reads one slot, holding the raw pointer next to the
+ * generation. The owning references are kept apart and only touched when
+ * resources are added or released.
+ */
+template <typename T>
+class ResourcePool {
+    private:
+        /**
+         * @brief What a handle resolves through.
+         */
+        struct Slot {
+                T* Resource = nullptr;    ///< nullptr while the slot is free
+                uint32_t Generation = 1;  ///< Generation of live handles
+        };
+
+        /**
+         * @brief Components using a slot's resource.
+         */
+        struct Usage {
+                uint32_t Users = 0;  ///< MeshRef or MaterialRef components
+                bool ReleaseWhenUnused =
+                    false;  ///< Released when Users drops back to 0
+        };
+
+        /**
+         * @brief A released resource waiting for its frame.
+         */
+        struct PendingRelease {
+                std::shared_ptr<T> Resource;  ///< Last registry reference
+                uint64_t Frame;               ///< Frame it was released in
+        };
+
+        std::vector<Slot> m_Slots;                 ///< By handle index
+        std::vector<std::shared_ptr<T>> m_Owners;  ///< By handle index
+        std::vector<Usage> m_Usage;                ///< By handle index
+        std::vector<uint32_t> m_FreeIndices;       ///< Reusable slots
+        std::unordered_map<const T*, uint32_t>
+            m_Indices;  ///< Slot of each added resource
+        std::vector<PendingRelease>
+            m_Pending;  ///< Deferred releases, oldest first
+
+    public:
+        /**
+         * @brief Add a resource, or find the handle it was added with.
+         *
+         * @param resource Resource to keep alive until released
+         * @param releaseWhenUnused Release it once its last user is
+         * removed; adding it again without this makes it explicit
+         * @return Its handle, or a null handle for nullptr or a full pool
+         */
+        ResourceHandle<T> Add(std::shared_ptr<T> resource,
+                              bool releaseWhenUnused = false) {
+            if (!resource) {
+                return {};
+            }
+            if (auto it = m_Indices.find(resource.get());
+                it != m_Indices.end()) {
+                m_Usage[it->second].ReleaseWhenUnused &= releaseWhenUnused;
+                return {it->second, m_Slots[it->second].Generation};
+            }
+
+            uint32_t index;
+            if (!m_FreeIndices.empty()) {
+                index = m_FreeIndices.back();
+                m_FreeIndices.pop_back();
+            } else if (m_Slots.size() <= ResourceHandle<T>::INDEX_MASK) {
+                index = static_cast<uint32_t>(m_Slots.size());
+                m_Slots.emplace_back();
+                m_Owners.emplace_back();
+                m_Usage.emplace_back();
+            } else {
+                LOG_ERROR("Resource pool is full!");
+                return {};
+            }
+
+            m_Slots[index].Resource = resource.get();
+            m_Usage[index].ReleaseWhenUnused = releaseWhenUnused;
+            m_Indices.emplace(resource.get(), index);
+            m_Owners[index] = std::move(resource);
+            return {index, m_Slots[index].Generation};
+        }
+
+        /**
+         * @brief Resolve a handle.
+         *
+         * @param handle Handle from Add()
+         * @return The resource, or nullptr for null and released handles
+         */
+        T* Get(ResourceHandle<T> handle) const {
+            uint32_t index = handle.GetIndex();
+            if (index >= m_Slots.size()) {
+                return nullptr;
+            }
+            const Slot& slot = m_Slots[index];
+            return slot.Generation == handle.GetGeneration() ? slot.Resource
+                                                             : nullptr;
+        }
+
+        /**
+         * @brief Get an owning reference for code that must keep a
+         * resource alive on its own.
+         *
+         * @param handle Handle from Add()
+         * @return The resource, or nullptr for null and released handles
+         */
+        std::shared_ptr<T> GetShared(ResourceHandle<T> handle) const {
+            return Get(handle) ? m_Owners[handle.GetIndex()] : nullptr;
+        }
+
+        /**
+         * @brief Invalidate a handle and drop the pool's reference.
+         *
+         * @param handle Handle from Add(); stale handles are ignored
+         * @return The dropped reference, or nullptr for stale handles
+         */
+        std::shared_ptr<T> Release(ResourceHandle<T> handle) {
+            if (!Get(handle)) {
+                return nullptr;
+            }
+
+            uint32_t index = handle.GetIndex();
+            Slot& slot = m_Slots[index];
+            m_Indices.erase(slot.Resource);
+            slot.Resource = nullptr;
+            if (++slot.Generation > ResourceHandle<T>::GENERATION_MASK) {
+                slot.Generation = 1;
+            }
+            m_Usage[index] = Usage();
+            m_FreeIndices.push_back(index);
+            return std::move(m_Owners[index]);
+        }
+
+        /**
+         * @brief Count a component that uses a resource.
+         *
+         * @param handle Handle from Add(); null and stale handles are
+         * ignored
+         */
+        void AddUser(ResourceHandle<T> handle) {
+            if (Get(handle)) {
+                m_Usage[handle.GetIndex()].Users++;
+            }
+        }
+
+        /**
+         * @brief Stop counting a component, releasing the resource if it
+         * was the last user of one added with releaseWhenUnused.
+         *
+         * @param handle Handle from Add(); null and stale handles are
+         * ignored
+         * @param frame Current frame number
+         */
+        void RemoveUser(ResourceHandle<T> handle, uint64_t frame) {
+            if (!Get(handle)) {
+                return;
+            }
+            Usage& usage = m_Usage[handle.GetIndex()];
+            if (usage.Users > 0 && --usage.Users == 0 &&
+                usage.ReleaseWhenUnused) {
+                ReleaseDeferred(handle, frame);
+            }
+        }
+
+        /**
+         * @brief Get the number of components using a resource.
+         *
+         * @param handle Handle from Add()
+         * @return User count, 0 for null and stale handles
+         */
+        uint32_t GetUserCount(ResourceHandle<T> handle) const {
+            return Get(handle) ? m_Usage[handle.GetIndex()].Users : 0;
+        }
+
+        /**
+         * @brief Invalidate a handle now and drop the reference later.
+         *
+         * @param handle Handle from Add(); stale handles are ignored
+         * @param frame Current frame number
+         */
+        void ReleaseDeferred(ResourceHandle<T> handle, uint64_t frame) {
+            if (std::shared_ptr<T> resource = Release(handle)) {
+                m_Pending.push_back({std::move(resource), frame});
+            }
+        }
+
+        /**
+         * @brief Hand over deferred releases made up to a frame.
+         *
+         * @param lastFrame Newest release frame to collect
+         * @param collected Receives the references
+         */
+        void Collect(uint64_t lastFrame,
+                     std::vector<std::shared_ptr<void>>& collected) {
+            size_t count = 0;
+            while (count < m_Pending.size() &&
+                   m_Pending[count].Frame <= lastFrame) {
+                collected.push_back(std::move(m_Pending[count].Resource));
+                count++;
+            }
+            m_Pending.erase(m_Pending.begin(), m_Pending.begin() + count);
+        }
+
+        /**
+         * @brief Release every resource, including deferred ones.
+         */
+        void Clear() {
+            for (uint32_t i = 0; i < m_Slots.size(); i++) {
+                Release({i, m_Slots[i].Generation});
+            }
+            m_Pending.clear();
+        }
+
+        /**
+         * @brief Get the number of live resources.
+         * @return Added minus released resources
+         */
+        size_t GetCount() const {
+            return m_Slots.size() - m_FreeIndices.size();
+        }
+};
+
+/**
+ * @brief Owns meshes, materials, shaders and textures behind generational
+ * handles.
+ *
+ * Entities store handles instead of shared pointers, so per-frame code
+ * resolves a resource with an array index and a generation compare, with
+ * no reference count traffic. Each type has its own dense pool.
+ *
+ * Resources stay alive until released. Release() drops the registry's
+ * reference at once and must only be used when no captured RenderSnapshot
+ * still draws the resource. ReleaseDeferred() invalidates the handle at
+ * once but keeps the resource until EndFrame() has been called
+ * RELEASE_DELAY times, by which point no snapshot in flight uses it.
+ *
+ * The MeshRef and MaterialRef pools count the components using each
+ * resource. Resources added with AddReleasedWhenUnused(), as the Entity
+ * overloads taking shared pointers do, are released deferred once that
+ * count drops back to zero, so a material an entity switches away from is
+ * not kept forever.
+ *
+ * Used from the update thread only.
+ *
+ * @example
+ * ```cpp
+ * MeshHandle rock = ResourceRegistry::Add(Mesh::Load("rock.obj"));
+ * Entity entity = scene.CreateEntity(rock, material);
+ *
+ * // Per frame, in hot loops
+ * if (const Mesh* mesh = ResourceRegistry::Get(rock)) {
+ *     ...
+ * }
+ *
+ * // Entities still using the handle stop drawing it
+ * ResourceRegistry::ReleaseDeferred(rock);
+ * ```
+ */
+class OBELISK_API ResourceRegistry {
+    public:
+        static constexpr uint64_t RELEASE_DELAY =
+            2;  ///< EndFrame() calls before a deferred release is destroyed
+
+    private:
+        static ResourcePool<Mesh> s_Meshes;         ///< Mesh pool
+        static ResourcePool<Material> s_Materials;  ///< Material pool
+        static ResourcePool<Shader> s_Shaders;      ///< Shader pool
+        static ResourcePool<Texture> s_Textures;    ///< Texture pool
+        static uint64_t s_Frame;                    ///< EndFrame() calls so far
+
+        /**
+         * @brief Get the pool of a resource type.
+         */
+        template <typename T>
+        static ResourcePool<T>& Pool() {
+            if constexpr (std::is_same_v<T, Mesh>) {
+                return s_Meshes;
+            } else if constexpr (std::is_same_v<T, Material>) {
+                return s_Materials;
+            } else if constexpr (std::is_same_v<T, Shader>) {
+                return s_Shaders;
+            } else {
+                static_assert(std::is_same_v<T, Texture>,
+                              "Unsupported resource type");
+                return s_Textures;
+            }
+        }
+
+    public:
+        /**
+         * @brief Add a resource, or find the handle it was added with.
+         *
+         * @param resource Resource to keep alive until released
+         * @return Its handle, or a null handle for nullptr
+         */
+        template <typename T>
+        static ResourceHandle<T> Add(std::shared_ptr<T> resource) {
+            return Pool<T>().Add(std::move(resource));
+        }
+
+        /**
+         * @brief Add a resource that is released deferred once no
+         * component uses it any more.
+         *
+         * A resource that was already added with Add() stays until
+         * released explicitly.
+         *
+         * @param resource Resource to keep alive while it has users
+         * @return Its handle, or a null handle for nullptr
+         */
+        template <typename T>
+        static ResourceHandle<T> AddReleasedWhenUnused(
+            std::shared_ptr<T> resource) {
+            return Pool<T>().Add(std::move(resource), true);
+        }
+
+        /**
+         * @brief Count a component that uses a resource.
+         *
+         * Called by the MeshRef and MaterialRef pools as components are
+         * added.
+         *
+         * @param handle Handle from Add(); null and stale handles are
+         * ignored
+         */
+        template <typename T>
+        static void AddUser(ResourceHandle<T> handle) {
+            Pool<T>().AddUser(handle);
+        }
+
+        /**
+         * @brief Stop counting a component that used a resource.
+         *
+         * Called by the MeshRef and MaterialRef pools as components are
+         * replaced or removed. The last user of a resource added with
+         * AddReleasedWhenUnused() releases it deferred.
+         *
+         * @param handle Handle from Add(); null and stale handles are
+         * ignored
+         */
+        template <typename T>
+        static void RemoveUser(ResourceHandle<T> handle) {
+            Pool<T>().RemoveUser(handle, s_Frame);
+        }
+
+        /**
+         * @brief Get the number of components using a resource.
+         *
+         * @param handle Handle from Add()
+         * @return User count, 0 for null and stale handles
+         */
+        template <typename T>
+        static uint32_t GetUserCount(ResourceHandle<T> handle) {
+            return Pool<T>().GetUserCount(handle);
+        }
+
+        /**
+         * @brief Resolve a handle.
+         *
+         * @param handle Handle from Add()
+         * @return The resource, or nullptr for null and released handles
+         */
+        template <typename T>
+        static T* Get(ResourceHandle<T> handle) {
+            return Pool<T>().Get(handle);
+        }
+
+        /**
+         * @brief Get an owning reference, for code that must keep a
+         * resource alive past its release.
+         *
+         * @param handle Handle from Add()
+         * @return The resource, or nullptr for null and released handles
+         */
+        template <typename T>
+        static std::shared_ptr<T> GetShared(ResourceHandle<T> handle) {
+            return Pool<T>().GetShared(handle);
+        }
+
+        /**
+         * @brief Check whether a handle still refers to a resource.
+         *
+         * @param handle Handle to check
+         * @return false for null and released handles
+         */
+        template <typename T>
+        static bool IsValid(ResourceHandle<T> handle) {
+            return Get(handle) != nullptr;
+        }
+
+        /**
+         * @brief Release a resource now.
+         *
+         * It is destroyed here unless other owners remain.
+         *
+         * @param handle Handle from Add(); stale handles are ignored
+         */
+        template <typename T>
+        static void Release(ResourceHandle<T> handle) {
+            Pool<T>().Release(handle);
+        }
+
+        /**
+         * @brief Invalidate a handle now and destroy the resource once no
+         * snapshot in flight can use it.
+         *
+         * @param handle Handle from Add(); stale handles are ignored
+         */
+        template <typename T>
+        static void ReleaseDeferred(ResourceHandle<T> handle) {
+            Pool<T>().ReleaseDeferred(handle, s_Frame);
+        }
+
+        /**
+         * @brief Advance the frame count and collect expired deferred
+         * releases.
+         *
+         * Called by ObeliskAPI once per frame.
+         *
+         * @return References to the expired resources. They hold GL
+         * objects, so the vector must be destroyed on the thread that owns
+         * the GL context.
+         */
+        static std::vector<std::shared_ptr<void>> EndFrame();
+
+        /**
+         * @brief Release every resource.
+         *
+         * Must be called while the GL context still exists; all handles
+         * become stale.
+         */
+        static void Shutdown();
+
+        /**
+         * @brief Get the number of live resources of a type.
+         * @return Added minus released resources
+         */
+        template <typename T>
+        static size_t GetCount() {
+            return Pool<T>().GetCount();
+        }
+};
+
+}  // namespace Obelisk
@@ -5,16 +5,36 @@
 
 namespace Obelisk {
 
+/**
+ * @brief Compilation state of a shader program.
+ */
+enum class ShaderState {
+    Pending,  ///< Submitted to the driver, compilation not yet confirmed
+    Ready,    ///< Compiled and linked, usable for rendering
+    Failed    ///< Compilation or linking failed, or no program was created
+};
+
+/**
+ * @brief How a Shader constructor waits for the driver.
+ */
+enum class ShaderCompileMode {
+    Immediate,  ///< Block until compiled and linked (default)
+    Deferred    ///< Submit only; check completion later through IsReady()
+};
+
 /**
  * @brief OpenGL shader program wrapper for vertex and fragment shaders.
  *
  * The Shader class encapsulates OpenGL shader compilation, linking, and usage.
  * It automatically loads shader source code from files using the AssetManager,
- * compiles vertex and fragment shaders, links them into a program, and provides
- * convenient methods for setting uniform variables.
+ * expands #include directives and injected #defines through the
+ * ShaderPreprocessor, compiles vertex and fragment shaders, links them into a
+ * program, and provides convenient methods for setting uniform variables.
  *
  * Key features:
  * - Automatic shader loading from asset files
+ * - On-disk program binary caching through the ShaderCache
+ * - Optional deferred compilation that does not stall on the driver
  * - Comprehensive error checking and logging
  * - Type-safe uniform variable setting
  * - RAII resource management
@@ -35,26 +55,26 @@ namespace Obelisk {
  */
 class OBELISK_API Shader {
     private:
-        unsigned int m_ProgramID;  ///< OpenGL shader program ID
+        static std::shared_ptr<Shader>
+            s_Fallback;  ///< Stand-in for programs that are not ready yet
+
+        unsigned int m_ProgramID = 0;      ///< OpenGL shader program ID
+        unsigned int m_VertexStage = 0;    ///< Vertex shader while pending
+        unsigned int m_FragmentStage = 0;  ///< Fragment shader while pending
+
+        ShaderState m_State = ShaderState::Failed;  ///< Compilation state
+        uint64_t m_CacheKey = 0;     ///< ShaderCache key of this program
+        double m_BuildTimeMS = 0.0;  ///< Main-thread time spent building
+        std::string m_Name;          ///< "vertex, fragment" paths for logging
+        std::string m_VertexPath;    ///< Vertex shader source path
+        std::string m_FragmentPath;  ///< Fragment shader source path
+        std::vector<std::string>
+            m_Defines;  ///< Preprocessor defines this program was built with
 
         int m_Success = -1;  ///< Compilation/linking success flag
         char m_InfoLog[512] =
             {};  ///< OpenGL info log buffer for error messages
 
-        /**
-         * @brief Load shader source code from a file.
-         *
-         * Uses the AssetManager to resolve the file path and loads the complete
-         * shader source code as a string. Handles file reading errors
-         * gracefully with appropriate logging.
-         *
-         * @param filepath Relative path to the shader file (e.g.,
-         * "shaders/basic.vert")
-         * @return Complete shader source code as a string, or empty string on
-         * error
-         */
-        static std::string LoadShaderSource(const std::string& filepath);
-
         /**
          * @brief Get the OpenGL location of a uniform variable.
          *
@@ -80,6 +100,28 @@ class OBELISK_API Shader {
          */
         void CheckCompileErrors(unsigned int shader, const std::string& type);
 
+        /**
+         * @brief Load the sources and hand the program to the driver.
+         *
+         * Uses a cached program binary when available. Otherwise compiles both
+         * stages and links the program without querying any status, so the
+         * driver is free to compile in the background.
+         *
+         * @param vertexPath Relative path to the vertex shader file
+         * @param fragmentPath Relative path to the fragment shader file
+         */
+        void Submit(const std::string& vertexPath,
+                    const std::string& fragmentPath);
+
+        /**
+         * @brief Query the link result of a submitted program.
+         *
+         * Blocks until the driver has finished compiling, reports errors via
+         * CheckCompileErrors(), stores successful programs in the ShaderCache
+         * and releases the individual shader stages.
+         */
+        void Finalize();
+
     public:
         /**
          * @brief Default constructor creating an invalid shader.
@@ -95,17 +137,39 @@ class OBELISK_API Shader {
          * shader files.
          *
          * Loads shader source code from the specified files, compiles both
-         * shaders, links them into a program, and performs error checking. The
-         * shader is ready to use immediately after construction if compilation
-         * succeeds.
+         * shaders, links them into a program, and performs error checking. If
+         * the ShaderCache holds a binary for the same sources and driver, it is
+         * loaded instead of compiling. The shader is ready to use immediately
+         * after construction if compilation succeeds.
          *
          * @param vertexPath Relative path to the vertex shader file
          * @param fragmentPath Relative path to the fragment shader file
+         * @param mode Whether to wait for the driver (Immediate) or return as
+         * soon as the program is submitted (Deferred)
          *
          * @note Logs detailed error information if compilation or linking fails
          * @note Uses AssetManager for reliable file path resolution
+         * @note Deferred shaders are normally created through a ShaderBatch
+         */
+        Shader(const std::string& vertexPath, const std::string& fragmentPath,
+               ShaderCompileMode mode = ShaderCompileMode::Immediate);
+
+        /**
+         * @brief Create a shader program with preprocessor defines.
+         *
+         * Behaves like the two-path constructor, but injects the given
+         * `#define`s after the `#version` line of both stages. This is how
+         * feature permutations of a single source are built; see
+         * ShaderVariantSet for lazily compiled, memoized permutations.
+         *
+         * @param vertexPath Relative path to the vertex shader file
+         * @param fragmentPath Relative path to the fragment shader file
+         * @param defines Symbols to define (e.g. "TEXTURED", "MAX_LIGHTS 64")
+         * @param mode Immediate or deferred compilation
          */
-        Shader(const std::string& vertexPath, const std::string& fragmentPath);
+        Shader(const std::string& vertexPath, const std::string& fragmentPath,
+               const std::vector<std::string>& defines,
+               ShaderCompileMode mode = ShaderCompileMode::Immediate);
 
         /**
          * @brief Destructor that cleans up OpenGL resources.
@@ -124,6 +188,97 @@ class OBELISK_API Shader {
          */
         void Use() const;
 
+        /**
+         * @brief Check whether the program can be used for rendering.
+         *
+         * For pending programs this polls GL_COMPLETION_STATUS when
+         * KHR_parallel_shader_compile is available and only finalizes once the
+         * driver reports completion. Without the extension the program is
+         * finalized immediately, which may block.
+         *
+         * @return true if the program compiled and linked successfully
+         */
+        bool IsReady();
+
+        /**
+         * @brief Check whether the program is still being compiled.
+         *
+         * @return true if the program has been submitted but not finalized
+         */
+        bool IsPending() const { return m_State == ShaderState::Pending; }
+
+        /**
+         * @brief Block until a pending program has finished compiling.
+         *
+         * @return true if the program compiled and linked successfully
+         */
+        bool WaitUntilReady();
+
+        /**
+         * @brief Get the preprocessor defines this program was built with.
+         *
+         * @return List of injected defines
+         */
+        const std::vector<std::string>& GetDefines() const { return m_Defines; }
+
+        /**
+         * @brief Get the vertex shader source this program was built from.
+         *
+         * Together with GetFragmentPath() and GetDefines(), enough to build
+         * another permutation of the same program.
+         *
+         * @return Path relative to the shaders asset directory
+         */
+        const std::string& GetVertexPath() const { return m_VertexPath; }
+
+        /**
+         * @brief Get the fragment shader source this program was built from.
+         *
+         * @return Path relative to the shaders asset directory
+         */
+        const std::string& GetFragmentPath() const { return m_FragmentPath; }
+
+        /**
+         * @brief Get the current compilation state.
+         *
+         * @return Compilation state (does not poll the driver)
+         */
+        ShaderState GetState() const { return m_State; }
+
+        /**
+         * @brief Get the OpenGL program object.
+         *
+         * @return Program ID, or 0 if the shader was never submitted
+         */
+        unsigned int GetProgramID() const { return m_ProgramID; }
+
+        /**
+         * @brief Get the content hash of this program.
+         *
+         * Two shaders built from the same sources and defines share the key.
+         *
+         * @return ShaderCache key, or 0 if the shader was never submitted
+         */
+        uint64_t GetCacheKey() const { return m_CacheKey; }
+
+        /**
+         * @brief Set a shader used in place of programs that are not ready.
+         *
+         * Renderables whose shader is still pending draw with this shader
+         * instead, if set, rather than being skipped.
+         *
+         * @param shader Fallback shader (must use the same uniform interface)
+         */
+        static void SetFallback(std::shared_ptr<Shader> shader);
+
+        /**
+         * @brief Get the fallback shader for programs that are not ready.
+         *
+         * @return Fallback shader, or nullptr if none is set or it is not
+         * ready itself
+         */
+        static Shader* GetFallback();
+
         // Uniform utility functions
 
         /**
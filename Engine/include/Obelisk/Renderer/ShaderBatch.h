@@ -0,0 +1,85 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include "Obelisk/Renderer/Shader.h"
+
+namespace Obelisk {
+
+/**
+ * @brief Submits many shader programs up front and collects them later.
+ *
+ * Creating shaders one by one with the blocking Shader constructor makes
+ * startup time the sum of every compile and link. A ShaderBatch instead hands
+ * each program to the driver as soon as it is added and only checks the
+ * results afterwards, so drivers that compile in the background (see
+ * KHR_parallel_shader_compile) bring startup down to roughly the slowest
+ * program.
+ *
+ * Shaders returned by Add() are usable immediately: renderables skip them, or
+ * draw with the fallback shader, until IsReady() reports completion.
+ *
+ * @example
+ * ```cpp
+ * ShaderBatch batch;
+ * auto basic = batch.Add("basic.vert", "basic.frag");
+ * auto sprite = batch.Add("sprite.vert", "sprite.frag");
+ *
+ * // Either poll once per frame...
+ * batch.Poll();
+ *
+ * // ...or block until everything is done
+ * batch.Wait();
+ * ```
+ */
+class OBELISK_API ShaderBatch {
+    private:
+        std::vector<std::shared_ptr<Shader>>
+            m_Pending;  ///< Submitted shaders not yet finalized
+
+    public:
+        /**
+         * @brief Submit a shader program for compilation.
+         *
+         * The program is handed to the driver immediately; no compile or link
+         * status is queried.
+         *
+         * @param vertexPath Relative path to the vertex shader file
+         * @param fragmentPath Relative path to the fragment shader file
+         * @return Shared pointer to the (possibly still pending) shader
+         */
+        std::shared_ptr<Shader> Add(const std::string& vertexPath,
+                                    const std::string& fragmentPath);
+
+        /**
+         * @brief Finalize every program the driver reports as complete.
+         *
+         * Never blocks when parallel shader compilation is supported. Without
+         * it, every pending program is finalized, which may block.
+         *
+         * @return Number of programs still pending
+         */
+        size_t Poll();
+
+        /**
+         * @brief Block until every submitted program is finalized.
+         *
+         * @return Number of programs that failed to compile or link
+         */
+        size_t Wait();
+
+        /**
+         * @brief Check whether all submitted programs are finalized.
+         *
+         * @return true if no program is pending
+         */
+        bool IsComplete() const { return m_Pending.empty(); }
+
+        /**
+         * @brief Get the number of programs still pending.
+         *
+         * @return Pending program count
+         */
+        size_t GetPendingCount() const { return m_Pending.size(); }
+};
+
+}  // namespace Obelisk
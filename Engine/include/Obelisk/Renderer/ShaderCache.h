@@ -0,0 +1,141 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include <filesystem>
+
+namespace Obelisk {
+
+/**
+ * @brief On-disk cache of linked shader program binaries.
+ *
+ * Compiling and linking GLSL from source is expensive, especially on software
+ * rasterizers. After a program has been linked from source, the ShaderCache
+ * stores the driver's program binary on disk under a key hashed from the
+ * shader sources, preprocessor defines and the driver identity
+ * (vendor/renderer/version). On later launches the binary is loaded directly
+ * with glProgramBinary; if the driver rejects it (e.g. after a driver update),
+ * the caller falls back to compiling from source and the stale entry is
+ * replaced.
+ *
+ * The cache silently disables itself when the context does not support
+ * program binaries.
+ *
+ * @example
+ * ```cpp
+ * uint64_t key = ShaderCache::ComputeKey(vertexSource, fragmentSource, "");
+ * if (!ShaderCache::Load(key, program)) {
+ *     // ... compile and link from source ...
+ *     ShaderCache::Store(key, program);
+ * }
+ * ```
+ */
+class OBELISK_API ShaderCache {
+    private:
+        static std::filesystem::path s_CacheDirectory;  ///< Binary directory
+        static uint64_t
+            s_DriverHash;  ///< Hash of vendor, renderer and version strings
+        static bool s_Enabled;  ///< Whether binaries can be used at all
+
+        // Startup metrics
+        static size_t s_Hits;      ///< Programs loaded from the cache
+        static size_t s_Misses;    ///< Programs with no usable cache entry
+        static size_t s_Rejected;  ///< Cache entries rejected by the driver
+        static double s_HitTimeMS;   ///< Time spent creating cached programs
+        static double s_MissTimeMS;  ///< Time spent compiling from source
+
+    public:
+        /**
+         * @brief Initialize the cache for the current OpenGL context.
+         *
+         * Must be called after the OpenGL context and GLExtensions have been
+         * initialized. Creates the cache directory if needed.
+         *
+         * @param directory Directory in which program binaries are stored
+         */
+        static void Initialize(const std::filesystem::path& directory);
+
+        /**
+         * @brief Compute the cache key for a program.
+         *
+         * @param vertexSource Complete vertex shader source
+         * @param fragmentSource Complete fragment shader source
+         * @param defines Preprocessor defines the sources were built with
+         * @return 64-bit key identifying the program on this driver
+         */
+        static uint64_t ComputeKey(const std::string& vertexSource,
+                                   const std::string& fragmentSource,
+                                   const std::string& defines);
+
+        /**
+         * @brief Try to load a cached binary into a program object.
+         *
+         * @param key Cache key from ComputeKey()
+         * @param program Freshly created program object to load into
+         * @return True if the program was loaded and linked successfully
+         */
+        static bool Load(uint64_t key, unsigned int program);
+
+        /**
+         * @brief Mark a program as about to be linked for caching.
+         *
+         * Sets GL_PROGRAM_BINARY_RETRIEVABLE_HINT so the driver keeps the
+         * binary around. Must be called before glLinkProgram.
+         *
+         * @param program Program object that will be linked
+         */
+        static void PrepareForLink(unsigned int program);
+
+        /**
+         * @brief Store the binary of a successfully linked program.
+         *
+         * @param key Cache key from ComputeKey()
+         * @param program Linked program object
+         */
+        static void Store(uint64_t key, unsigned int program);
+
+        /**
+         * @brief Record how long a program took to become usable.
+         *
+         * @param milliseconds Time spent creating the program
+         * @param cacheHit Whether the program came from the cache
+         */
+        static void RecordBuildTime(double milliseconds, bool cacheHit);
+
+        /**
+         * @brief Log cache hit/miss counts and time spent as startup metrics.
+         */
+        static void LogStatistics();
+
+        /**
+         * @brief Check whether the cache is active.
+         *
+         * @return True if program binaries are supported and the cache is
+         * initialized
+         */
+        static bool IsEnabled() { return s_Enabled; }
+
+        /**
+         * @brief Get the number of programs loaded from the cache.
+         *
+         * @return Cache hit count
+         */
+        static size_t GetHitCount() { return s_Hits; }
+
+        /**
+         * @brief Get the number of programs compiled from source.
+         *
+         * @return Cache miss count
+         */
+        static size_t GetMissCount() { return s_Misses; }
+
+    private:
+        /**
+         * @brief Get the on-disk path for a cache key.
+         *
+         * @param key Cache key
+         * @return Path to the binary file
+         */
+        static std::filesystem::path GetEntryPath(uint64_t key);
+};
+
+}  // namespace Obelisk
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include <unordered_set>
+
+namespace Obelisk {
+
+/**
+ * @brief Resolves #include directives and injects #defines into GLSL sources.
+ *
+ * GLSL has no include mechanism, so shared code would otherwise have to be
+ * copied between shader files. The preprocessor expands
+ * `#include "file.glsl"` directives (resolved relative to the shaders asset
+ * directory), injects a list of `#define`s right after the `#version` line and
+ * keeps driver error messages meaningful by emitting `#line` directives. Each
+ * included file is expanded at most once per shader.
+ *
+ * Raw file contents are kept in a source cache, so building many variants of
+ * the same shader only reads each file from disk once.
+ *
+ * Source string numbers in `#line` directives identify files; use
+ * GetFileName() to map them back when reading a driver's error log.
+ *
+ * @example
+ * ```cpp
+ * std::string source =
+ *     ShaderPreprocessor::Process("basic.frag", {"TEXTURED", "INSTANCED"});
+ * ```
+ */
+class OBELISK_API ShaderPreprocessor {
+    private:
+        static std::unordered_map<std::string, std::string>
+            s_SourceCache;  ///< Raw file contents by shader path
+        static std::vector<std::string>
+            s_FileNames;  ///< Shader paths by source string number
+
+    public:
+        /**
+         * @brief Load a shader file and expand it for compilation.
+         *
+         * @param filepath Path relative to the shaders asset directory
+         * @param defines Preprocessor symbols to define (e.g. "TEXTURED" or
+         * "MAX_LIGHTS 64")
+         * @return Expanded source, or an empty string if a file could not be
+         * read
+         */
+        static std::string Process(const std::string& filepath,
+                                   const std::vector<std::string>& defines);
+
+        /**
+         * @brief Get the file a `#line` source string number refers to.
+         *
+         * @param sourceIndex Source string number from a driver error message
+         * @return Shader path, or an empty string if unknown
+         */
+        static std::string GetFileName(int sourceIndex);
+
+        /**
+         * @brief Drop all cached file contents.
+         *
+         * Call after shader files changed on disk (e.g. for hot reloading).
+         */
+        static void ClearCache();
+
+    private:
+        /**
+         * @brief Get the raw contents of a shader file through the cache.
+         *
+         * @param filepath Path relative to the shaders asset directory
+         * @return Pointer to the cached contents, or nullptr if unreadable
+         */
+        static const std::string* GetSource(const std::string& filepath);
+
+        /**
+         * @brief Get the source string number assigned to a file.
+         *
+         * @param filepath Path relative to the shaders asset directory
+         * @return Stable index for use in `#line` directives
+         */
+        static int GetFileIndex(const std::string& filepath);
+
+        /**
+         * @brief Recursively expand one file into the output.
+         *
+         * @param filepath File to expand
+         * @param defines Defines to inject (only used for the root file)
+         * @param included Files already expanded into this shader
+         * @param output Expanded source being built
+         * @param depth Include depth (0 for the root file)
+         * @return true on success, false if any file could not be read
+         */
+        static bool Expand(const std::string& filepath,
+                           const std::vector<std::string>& defines,
+                           std::unordered_set<std::string>& included,
+                           std::string& output, int depth);
+};
+
+}  // namespace Obelisk
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include "Obelisk/Renderer/Shader.h"
+
+namespace Obelisk {
+
+/**
+ * @brief Bitmask identifying one permutation of a ShaderVariantSet.
+ *
+ * Bit i set means the set's i-th feature is defined for that variant.
+ */
+using ShaderVariantKey = uint32_t;
+
+/**
+ * @brief Lazily compiled feature permutations of a single shader source.
+ *
+ * Instead of maintaining a file pair per feature combination, or branching at
+ * runtime in GLSL, one source is written with `#ifdef` blocks and a
+ * ShaderVariantSet declares which symbols may be toggled. Each combination is
+ * identified by a bitmask key and only compiled the first time it is
+ * requested; the result is memoized, so permutations that are never used cost
+ * nothing.
+ *
+ * Variants share the ShaderPreprocessor source cache and the on-disk
+ * ShaderCache, so compiling another permutation never re-reads the files and
+ * previously seen permutations load from program binaries.
+ *
+ * @example
+ * ```cpp
+ * ShaderVariantSet basic("basic.vert", "basic.frag",
+ *                        {"TEXTURED", "INSTANCED", "SKINNED"});
+ *
+ * ShaderVariantKey key = basic.MakeKey({"TEXTURED", "INSTANCED"});
+ * std::shared_ptr<Shader> shader = basic.Get(key);  // Compiled on first use
+ * ```
+ */
+class OBELISK_API ShaderVariantSet {
+    public:
+        static constexpr size_t MAX_FEATURES =
+            32;  ///< Features that fit into a ShaderVariantKey
+
+    private:
+        std::string m_VertexPath;    ///< Vertex shader source
+        std::string m_FragmentPath;  ///< Fragment shader source
+        std::vector<std::string>
+            m_Features;  ///< Define names, indexed by key bit
+        std::unordered_map<ShaderVariantKey, std::shared_ptr<Shader>>
+            m_Variants;  ///< Compiled permutations
+
+    public:
+        /**
+         * @brief Declare a variant set over a shader source pair.
+         *
+         * No shader is compiled until Get() is called.
+         *
+         * @param vertexPath Relative path to the vertex shader file
+         * @param fragmentPath Relative path to the fragment shader file
+         * @param features Define names that can be toggled (at most
+         * MAX_FEATURES)
+         */
+        ShaderVariantSet(std::string vertexPath, std::string fragmentPath,
+                         std::vector<std::string> features);
+
+        /**
+         * @brief Get the key bit for a feature.
+         *
+         * @param feature Define name as passed to the constructor
+         * @return Key with only that feature's bit set, or 0 if unknown
+         */
+        ShaderVariantKey GetFeatureBit(std::string_view feature) const;
+
+        /**
+         * @brief Build a key from a list of feature names.
+         *
+         * @param features Define names to enable
+         * @return Key with all listed features set (unknown names are logged
+         * and ignored)
+         */
+        ShaderVariantKey MakeKey(
+            std::initializer_list<std::string_view> features) const;
+
+        /**
+         * @brief Get a permutation, compiling it on first use.
+         *
+         * @param key Bitmask of features to enable
+         * @param mode Immediate or deferred compilation for a new variant
+         * @return Shader for the permutation
+         */
+        std::shared_ptr<Shader> Get(
+            ShaderVariantKey key,
+            ShaderCompileMode mode = ShaderCompileMode::Immediate);
+
+        /**
+         * @brief Check whether a permutation has already been compiled.
+         *
+         * @param key Bitmask of features
+         * @return true if Get() would return a memoized shader
+         */
+        bool IsCompiled(ShaderVariantKey key) const {
+            return m_Variants.contains(key);
+        }
+
+        /**
+         * @brief Get the number of permutations compiled so far.
+         *
+         * @return Compiled variant count
+         */
+        size_t GetCompiledCount() const { return m_Variants.size(); }
+
+        /**
+         * @brief Get the define names of this set.
+         *
+         * @return Feature names, indexed by key bit
+         */
+        const std::vector<std::string>& GetFeatures() const {
+            return m_Features;
+        }
+
+        /**
+         * @brief Drop every compiled permutation.
+         *
+         * Shaders still referenced elsewhere stay alive; subsequent Get()
+         * calls recompile.
+         */
+        void Clear() { m_Variants.clear(); }
+};
+
+}  // namespace Obelisk
@@ -0,0 +1,200 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+
+namespace Obelisk {
+
+class Camera;
+class Shader;
+class Texture;
+
+/**
+ * @brief Description of a single sprite for SpriteBatch::Draw().
+ */
+struct Sprite {
+        glm::vec2 Position = glm::vec2(0.0f);  ///< World-space center
+        glm::vec2 Size = glm::vec2(1.0f);      ///< Width and height
+        float Rotation = 0.0f;  ///< Counter-clockwise rotation in degrees
+        glm::vec4 UVRect =
+            glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);  ///< (u0, v0, u1, v1)
+        glm::vec4 Tint = glm::vec4(1.0f);       ///< Color multiplier
+        int Layer = 0;  ///< Draw order; higher layers are drawn on top
+};
+
+/**
+ * @brief Batched renderer for large numbers of textured 2D quads.
+ *
+ * Drawing sprites as Entities costs one Mesh and one draw call per quad.
+ * SpriteBatch instead queues sprites between Begin() and End(), sorts them by
+ * layer and texture, builds their vertices on the JobSystem and streams them
+ * into one vertex buffer, then draws them with as few calls as possible:
+ * every draw binds up to MAX_TEXTURE_SLOTS textures and the fragment shader
+ * picks one per sprite, so a draw is only split when it runs out of texture
+ * slots or reaches MAX_SPRITES_PER_DRAW.
+ *
+ * Sprites lie in the z = 0 plane and are meant for a Camera in orthographic
+ * mode. Within a layer, sprites sharing a texture keep submission order.
+ * Textures must stay alive until End() returns.
+ *
+ * @example
+ * ```cpp
+ * SpriteBatch batch;
+ *
+ * batch.Begin(uiCamera);
+ * batch.Draw(playerTexture, glm::vec2(0.0f), glm::vec2(1.0f));
+ *
+ * Sprite icon;
+ * icon.Position = glm::vec2(4.0f, 3.0f);
+ * icon.Layer = 10;
+ * batch.Draw(iconTexture, icon);
+ * batch.End();
+ * ```
+ */
+class OBELISK_API SpriteBatch {
+    public:
+        static constexpr uint32_t MAX_TEXTURE_SLOTS =
+            16;  ///< Textures per draw (the GL 3.3 fragment minimum)
+        static constexpr uint32_t MAX_SPRITES_PER_DRAW =
+            16384;  ///< Keeps vertex indices within 16 bits
+        static constexpr uint32_t MAX_TEXTURES =
+            65536;  ///< Distinct textures per flush
+
+    private:
+        /**
+         * @brief Vertex layout streamed to the GPU.
+         */
+        struct SpriteVertex {
+                glm::vec2 Position;  ///< World-space position
+                glm::vec2 TexCoord;  ///< Texture coordinate
+                uint32_t Color;      ///< Tint as packed RGBA8
+                float TextureSlot;   ///< Index into the bound texture slots
+        };
+
+        /**
+         * @brief A sprite waiting for the next flush.
+         */
+        struct QueuedSprite {
+                glm::vec2 Position;  ///< World-space center
+                glm::vec2 Size;      ///< Width and height
+                glm::vec4 UVRect;    ///< (u0, v0, u1, v1)
+                float Rotation;      ///< Rotation in radians
+                uint32_t Color;      ///< Tint as packed RGBA8
+        };
+
+        /**
+         * @brief One draw call over a run of sorted sprites.
+         */
+        struct DrawCommand {
+                uint32_t First;  ///< First sprite in sorted order
+                uint32_t Count;  ///< Number of sprites
+                uint32_t TextureCount;  ///< Used entries in Textures
+                unsigned int
+                    Textures[MAX_TEXTURE_SLOTS];  ///< GL textures per slot
+        };
+
+        unsigned int m_VAO = 0;  ///< Vertex array object
+        unsigned int m_VBO = 0;  ///< Streamed vertex buffer
+        unsigned int m_EBO = 0;  ///< Static quad index buffer
+        std::unique_ptr<Shader> m_Shader;  ///< Sprite shader
+        bool m_SamplersBound = false;  ///< Whether sampler uniforms are set
+
+        const Camera* m_Camera = nullptr;  ///< Camera of the current batch
+        bool m_Active = false;             ///< Between Begin() and End()
+
+        std::vector<QueuedSprite> m_Sprites;  ///< Sprites in submission order
+        std::vector<uint64_t> m_Keys;  ///< Layer | texture | sprite index
+        std::vector<uint64_t> m_SortScratch;  ///< Radix sort buffer
+        std::vector<unsigned int>
+            m_Textures;  ///< GL texture per texture index
+        std::unordered_map<unsigned int, uint32_t>
+            m_TextureIndices;  ///< GL texture to texture index
+        std::vector<uint8_t> m_Slots;  ///< Texture slot per sorted sprite
+        std::vector<DrawCommand> m_Draws;       ///< Draws of the current flush
+        std::vector<SpriteVertex> m_Vertices;  ///< Vertices in sorted order
+
+        size_t m_SpriteCount = 0;    ///< Sprites drawn by the last End()
+        size_t m_DrawCallCount = 0;  ///< Draw calls issued by the last End()
+
+    public:
+        /**
+         * @brief Create the GPU buffers and load the sprite shader.
+         *
+         * Requires a current OpenGL context.
+         */
+        SpriteBatch();
+
+        /**
+         * @brief Release the GPU buffers.
+         */
+        ~SpriteBatch();
+
+        SpriteBatch(const SpriteBatch&) = delete;
+        SpriteBatch& operator=(const SpriteBatch&) = delete;
+
+        /**
+         * @brief Start collecting sprites.
+         *
+         * @param camera Camera the sprites are rendered with
+         */
+        void Begin(const Camera& camera);
+
+        /**
+         * @brief Queue a sprite.
+         *
+         * @param texture Texture to draw; must outlive End()
+         * @param sprite Placement, UVs, tint and layer
+         */
+        void Draw(const Texture& texture, const Sprite& sprite);
+
+        /**
+         * @brief Queue an untinted sprite showing the whole texture.
+         *
+         * @param texture Texture to draw; must outlive End()
+         * @param position World-space center
+         * @param size Width and height
+         * @param rotation Counter-clockwise rotation in degrees
+         * @param layer Draw order; higher layers are drawn on top
+         */
+        void Draw(const Texture& texture, const glm::vec2& position,
+                  const glm::vec2& size, float rotation = 0.0f,
+                  int layer = 0);
+
+        /**
+         * @brief Sort and draw all queued sprites.
+         */
+        void End();
+
+        /**
+         * @brief Get the number of sprites drawn by the last End().
+         * @return Sprite count
+         */
+        size_t GetSpriteCount() const { return m_SpriteCount; }
+
+        /**
+         * @brief Get the number of draw calls issued by the last End().
+         * @return Draw call count
+         */
+        size_t GetDrawCallCount() const { return m_DrawCallCount; }
+
+    private:
+        /**
+         * @brief Draw and clear everything queued so far.
+         */
+        void Flush();
+
+        /**
+         * @brief Split the sorted sprites into draws and assign texture
+         * slots.
+         */
+        void BuildDrawCommands();
+
+        /**
+         * @brief Write the four vertices of a range of sorted sprites.
+         *
+         * @param begin First sorted sprite
+         * @param end One past the last sorted sprite
+         */
+        void BuildVertices(size_t begin, size_t end);
+};
+
+}  // namespace Obelisk
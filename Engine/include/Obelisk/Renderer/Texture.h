@@ -60,6 +60,10 @@ class OBELISK_API Texture {
          * and configures appropriate texture parameters. Supports common
          * image formats including PNG, JPG, BMP, and TGA.
          *
+         * If ObeliskCook has written a cooked blob next to the image (the path
+         * plus ".otex"), its pre-built mip chain is uploaded as is instead,
+         * skipping image decoding and mipmap generation.
+         *
          * The texture is created with the following OpenGL parameters:
          * - Wrap mode: GL_REPEAT for both S and T coordinates
          * - Filtering: GL_LINEAR for both minification and magnification
@@ -124,6 +128,15 @@ class OBELISK_API Texture {
          * @return The OpenGL texture ID, or 0 if the texture is invalid
          */
         unsigned int GetID() const { return m_TextureID; }
+
+    private:
+        /**
+         * @brief Upload the cooked blob of an image into the bound texture.
+         *
+         * @param path Image path relative to the textures directory
+         * @return true if a valid, usable blob was uploaded
+         */
+        bool LoadCooked(const std::string& path);
 };
 
 }  // namespace Obelisk
\ No newline at end of file
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+
+namespace Obelisk {
+
+/**
+ * @brief A large uniform buffer streamed through once per frame.
+ *
+ * The buffer is split into FRAMES_IN_FLIGHT regions. Each frame writes its
+ * uniform blocks into a CPU staging area at GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+ * aligned offsets, uploads them into its own region with a single
+ * glBufferSubData, and shaders select a block with glBindBufferRange. A fence
+ * per region guarantees the GPU has finished reading a region before it is
+ * overwritten, so the upload never forces the driver to stall or make a
+ * shadow copy.
+ *
+ * Writing blocks only touches CPU memory, which keeps recording independent
+ * of the GL context.
+ *
+ * @example
+ * ```cpp
+ * UniformRingBuffer ring(1 << 20);
+ *
+ * ring.BeginFrame();
+ * size_t offset = ring.Push(perDrawBlock);
+ * ring.Upload();
+ * ring.BindRange(1, offset, sizeof(perDrawBlock));
+ * // ... draw ...
+ * ring.EndFrame();
+ * ```
+ */
+class OBELISK_API UniformRingBuffer {
+    public:
+        static constexpr int FRAMES_IN_FLIGHT =
+            3;  ///< Regions the buffer is split into
+
+    private:
+        unsigned int m_Buffer = 0;  ///< GL buffer object
+        size_t m_RegionSize = 0;    ///< Bytes per frame region
+        size_t m_Alignment = 256;   ///< Offset alignment for ranges
+        int m_Region = 0;           ///< Region used by the current frame
+        GLsync m_Fences[FRAMES_IN_FLIGHT] = {};  ///< Per-region GPU fences
+
+        std::vector<uint8_t> m_Staging;  ///< Blocks written this frame
+        size_t m_Uploaded = 0;  ///< Bytes of m_Staging already uploaded
+        size_t m_WaitCount = 0;  ///< Frames that had to wait on a fence
+
+    public:
+        /**
+         * @brief Create the buffer.
+         *
+         * Requires a current OpenGL context.
+         *
+         * @param regionSize Initial bytes per frame; grows when exceeded
+         */
+        explicit UniformRingBuffer(size_t regionSize);
+
+        /**
+         * @brief Release the buffer and fences.
+         */
+        ~UniformRingBuffer();
+
+        UniformRingBuffer(const UniformRingBuffer&) = delete;
+        UniformRingBuffer& operator=(const UniformRingBuffer&) = delete;
+
+        /**
+         * @brief Move to the next region, waiting for the GPU if it is still
+         * reading it.
+         */
+        void BeginFrame();
+
+        /**
+         * @brief Fence the current region once all of its draws are issued.
+         */
+        void EndFrame();
+
+        /**
+         * @brief Copy a block into the staging area.
+         *
+         * @param data Block contents
+         * @param size Block size in bytes
+         * @return Aligned offset of the block within this frame's region
+         */
+        size_t Allocate(const void* data, size_t size);
+
+        /**
+         * @brief Copy a block into the staging area.
+         *
+         * @tparam T std140-compatible block type
+         * @param block Block contents
+         * @return Aligned offset of the block within this frame's region
+         */
+        template <typename T>
+        size_t Push(const T& block) {
+            return Allocate(&block, sizeof(T));
+        }
+
+        /**
+         * @brief Upload every block written since the last upload.
+         *
+         * Must be called before drawing with ranges allocated this frame.
+         */
+        void Upload();
+
+        /**
+         * @brief Bind a block to a uniform buffer binding point.
+         *
+         * @param binding Uniform block binding point
+         * @param offset Offset returned by Allocate() or Push()
+         * @param size Block size in bytes
+         */
+        void BindRange(unsigned int binding, size_t offset, size_t size) const;
+
+        /**
+         * @brief Get the number of bytes written this frame.
+         * @return Used bytes, including alignment padding
+         */
+        size_t GetUsedBytes() const { return m_Staging.size(); }
+
+        /**
+         * @brief Get the number of frames that waited on the GPU.
+         *
+         * A growing count means the CPU runs more than FRAMES_IN_FLIGHT
+         * frames ahead.
+         *
+         * @return Wait count since creation
+         */
+        size_t GetWaitCount() const { return m_WaitCount; }
+
+    private:
+        /**
+         * @brief Reallocate the buffer with larger regions.
+         *
+         * @param regionSize New bytes per frame region
+         */
+        void Grow(size_t regionSize);
+};
+
+}  // namespace Obelisk
@@ -1,10 +1,20 @@
 #pragma once
 
 #include "ObeliskPCH.h"
+#include <atomic>
+#include "Obelisk/Renderer/RenderSnapshot.h"
 #include "Obelisk/Scene/Scene.h"
 
 namespace Obelisk {
 
+/**
+ * @brief Selects how a Window obtains its OpenGL context.
+ */
+enum class WindowBackend {
+    Windowed,  ///< GLFW window on the desktop (requires a display)
+    Headless   ///< Offscreen EGL context rendering into a framebuffer object
+};
+
 /**
  * @brief Main application window class managing GLFW window and rendering
  * context.
@@ -14,6 +24,13 @@ namespace Obelisk {
  * between the engine and the windowing system, handling window events, scene
  * rendering, and frame timing.
  *
+ * With WindowBackend::Headless no display is needed: the context is created
+ * through EGL (preferring Mesa's surfaceless platform, falling back to a
+ * pbuffer) and every frame is rendered into an offscreen framebuffer object.
+ * This allows scenes to be rendered and profiled on display-less machines,
+ * e.g. CI runners using llvmpipe. Headless support requires the engine to be
+ * built with OBELISK_HEADLESS_EGL.
+ *
  * Key responsibilities:
  * - GLFW window lifecycle management
  * - OpenGL context creation and management
@@ -38,6 +55,27 @@ class OBELISK_API Window {
             nullptr;  ///< GLFW window handle (managed by GLFW)
         Scene* m_Scene =
             nullptr;  ///< Currently active scene to render (not owned)
+        std::function<void(const RenderSnapshot&)>
+            m_RenderCallback;  ///< Draws on top of the scene each frame
+        RenderSnapshot m_Snapshot;  ///< Frame captured by Tick()
+
+        WindowBackend m_Backend =
+            WindowBackend::Windowed;  ///< Backend the context was created with
+        int m_Width = 0;              ///< Framebuffer width in pixels
+        int m_Height = 0;             ///< Framebuffer height in pixels
+        int m_ViewportWidth = -1;     ///< Width glViewport was last set to
+        int m_ViewportHeight = -1;    ///< Height glViewport was last set to
+        std::atomic<size_t> m_FrameCount = 0;  ///< Frames rendered so far
+        size_t m_FrameLimit = 0;  ///< Close after this many frames (0 = never)
+        bool m_CloseRequested = false;  ///< Set by RequestClose()
+
+        // Headless backend state (EGL handles are opaque pointers)
+        void* m_EGLDisplay = nullptr;  ///< EGLDisplay
+        void* m_EGLSurface = nullptr;  ///< EGLSurface (null if surfaceless)
+        void* m_EGLContext = nullptr;  ///< EGLContext
+        unsigned int m_Framebuffer = 0;   ///< Offscreen render target
+        unsigned int m_ColorBuffer = 0;   ///< RGBA8 color attachment
+        unsigned int m_DepthBuffer = 0;   ///< Depth/stencil attachment
 
     public:
         /**
@@ -67,31 +105,92 @@ class OBELISK_API Window {
          * @param width Window width in pixels
          * @param height Window height in pixels
          * @param title Window title displayed in the title bar
-         * @return 0 on success, non-zero error code on failure
+         * @param backend Context backend; Headless ignores the title and
+         * creates no window
+         * @return 1 on success, -1 on failure
          *
          * @note This method must be called before using any other window
          * functions
          * @note Automatically sets up input callbacks for the engine's input
          * system
          */
-        int Create(int width, int height, const std::string& title);
+        int Create(int width, int height, const std::string& title,
+                   WindowBackend backend = WindowBackend::Windowed);
 
         /**
          * @brief Process one frame of the render loop.
          *
-         * Performs a complete frame cycle including:
-         * - Processing window and input events via glfwPollEvents()
-         * - Clearing the framebuffer
-         * - Rendering the current scene (if set)
-         * - Swapping front and back buffers for display
+         * Performs a complete frame cycle on the calling thread:
+         * - Capturing the current scene (if set) via Capture()
+         * - Clearing the framebuffer and rendering the frame via Render()
+         * - Processing window and input events via PollEvents()
+         * - Swapping front and back buffers via Present()
          *
          * This method should be called once per frame in the main game loop.
+         * A RenderThread runs the same steps split across two threads.
          *
          * @note Does nothing if no scene is set
          * @note Automatically handles OpenGL state management
+         * @note The headless backend polls no events and presents nothing;
+         * the frame is left in the offscreen framebuffer
          */
         void Tick();
 
+        /**
+         * @brief Capture the current scene into a snapshot.
+         *
+         * Update-thread half of Tick(); see RenderThread.
+         *
+         * @param snapshot Snapshot to fill
+         */
+        void Capture(RenderSnapshot& snapshot);
+
+        /**
+         * @brief Hand the DebugDraw shapes recorded so far to a snapshot's
+         * frame.
+         *
+         * Must not overlap Render().
+         *
+         * @param snapshot Snapshot the shapes are drawn with
+         */
+        void Latch(const RenderSnapshot& snapshot);
+
+        /**
+         * @brief Render a captured frame into the back buffer.
+         *
+         * Render-thread half of Tick(): clears the framebuffer, draws the
+         * snapshot, then runs the render callback and DebugDraw. Requires
+         * the GL context to be current on the calling thread.
+         *
+         * @param snapshot Frame to render
+         */
+        void Render(const RenderSnapshot& snapshot);
+
+        /**
+         * @brief Present the rendered frame.
+         *
+         * Swaps buffers, or just flushes on the headless backend.
+         */
+        void Present();
+
+        /**
+         * @brief Process pending window and input events.
+         *
+         * Must be called on the thread that created the window. Does
+         * nothing on the headless backend.
+         */
+        void PollEvents();
+
+        /**
+         * @brief Make the GL context current on the calling thread.
+         */
+        void MakeContextCurrent();
+
+        /**
+         * @brief Detach the GL context from the calling thread.
+         */
+        void ReleaseContext();
+
         /**
          * @brief Set the scene to be rendered by this window.
          *
@@ -107,6 +206,22 @@ class OBELISK_API Window {
          */
         void SetScene(Scene* scene) { m_Scene = scene; };
 
+        /**
+         * @brief Set a function that renders on top of the scene.
+         *
+         * Called every frame after the scene has been drawn and before the
+         * frame is presented, e.g. to flush a SpriteBatch for UI or 2D
+         * content. The callback receives the frame being drawn; animations
+         * should use its TotalTime rather than Time, which may already be a
+         * frame ahead on another thread (see RenderThread).
+         *
+         * @param callback Function to call each frame (empty to disable)
+         */
+        void SetRenderCallback(
+            std::function<void(const RenderSnapshot&)> callback) {
+            m_RenderCallback = std::move(callback);
+        }
+
         /**
          * @brief Check if the window should be closed.
          *
@@ -117,8 +232,83 @@ class OBELISK_API Window {
          * @return true if the window should be closed, false otherwise
          *
          * @note This is typically used as the condition for the main game loop
+         * @note Also true once the frame limit is reached or RequestClose()
+         * was called, which is the only way a headless window closes
          */
         [[nodiscard]] bool ShouldClose() const;
+
+        /**
+         * @brief Ask the window to close after the current frame.
+         */
+        void RequestClose() { m_CloseRequested = true; }
+
+        /**
+         * @brief Close the window automatically after a number of frames.
+         *
+         * Intended for benchmarks and automated runs.
+         *
+         * @param frames Frames to render before ShouldClose() returns true
+         * (0 disables the limit)
+         */
+        void SetFrameLimit(size_t frames) { m_FrameLimit = frames; }
+
+        /**
+         * @brief Read back the most recently rendered frame.
+         *
+         * Pixels are tightly packed RGBA8, bottom row first (OpenGL order).
+         * On the headless backend the offscreen framebuffer keeps its
+         * contents after Tick(); on the windowed backend the back buffer is
+         * undefined after a swap, so this is only meaningful when called from
+         * within the frame.
+         *
+         * @param pixels Receives width * height * 4 bytes
+         */
+        void ReadPixels(std::vector<uint8_t>& pixels) const;
+
+        /**
+         * @brief Get the backend this window was created with.
+         * @return Context backend
+         */
+        WindowBackend GetBackend() const { return m_Backend; }
+
+        /**
+         * @brief Check whether this window renders offscreen.
+         * @return true for the headless backend
+         */
+        bool IsHeadless() const { return m_Backend == WindowBackend::Headless; }
+
+        /**
+         * @brief Get the framebuffer width.
+         * @return Width in pixels
+         */
+        int GetWidth() const { return m_Width; }
+
+        /**
+         * @brief Get the framebuffer height.
+         * @return Height in pixels
+         */
+        int GetHeight() const { return m_Height; }
+
+        /**
+         * @brief Get the number of frames rendered so far.
+         * @return Frame count
+         */
+        size_t GetFrameCount() const { return m_FrameCount; }
+
+    private:
+        /**
+         * @brief Create an offscreen EGL context and framebuffer object.
+         *
+         * @param width Framebuffer width in pixels
+         * @param height Framebuffer height in pixels
+         * @return 1 on success, -1 on failure
+         */
+        int CreateHeadless(int width, int height);
+
+        /**
+         * @brief Release the EGL context and offscreen framebuffer.
+         */
+        void DestroyHeadless();
 };
 
 }  // namespace Obelisk
\ No newline at end of file
@@ -0,0 +1,380 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include "SparseSet.h"
+#include "Obelisk/Core/Bounds.h"
+#include "Obelisk/Core/Frustum.h"
+
+namespace Obelisk {
+
+/**
+ * @brief Dynamic bounding volume hierarchy over entity bounds.
+ *
+ * Each entity is a leaf holding a fat box: its bounds grown by a margin.
+ * Move() only re-inserts a leaf once the bounds leave the fat box, so
+ * entities that jitter or rotate in place cost nothing. Insertion picks the
+ * sibling with the lowest surface area cost (SAH), and AVL-style rotations
+ * keep the tree balanced, so queries visit O(log n) nodes plus the results.
+ *
+ * Nodes live in one array with a free list; proxies returned by Insert()
+ * are node indices and stay valid until Remove().
+ *
+ * Queries call a function for every leaf whose fat box passes the test, so
+ * callers test the exact bounds themselves where it matters. Returning
+ * false from the function stops the query.
+ *
+ * @example
+ * ```cpp
+ * AABBTree tree;
+ * uint32_t proxy = tree.Insert(entityID, entity.GetBounds());
+ *
+ * // When the entity moved
+ * tree.Move(proxy, entity.GetBounds());
+ *
+ * tree.QuerySphere(center, 5.0f, [&](EntityID id) {
+ *     nearby.push_back(id);
+ *     return true;
+ * });
+ * ```
+ */
+class OBELISK_API AABBTree {
+    public:
+        static constexpr uint32_t NULL_NODE = ~0u;  ///< No node
+        static constexpr float DEFAULT_MARGIN =
+            0.2f;  ///< Default fat box margin in world units
+
+    private:
+        /**
+         * @brief A leaf holding an entity or an inner node with two
+         * children.
+         */
+        struct Node {
+                AABB Box;                     ///< Fat box, or union of children
+                EntityID Entity;              ///< Leaf payload
+                uint32_t Parent = NULL_NODE;  ///< Next free node when free
+                uint32_t Child1 = NULL_NODE;  ///< NULL_NODE for leaves
+                uint32_t Child2 = NULL_NODE;  ///< NULL_NODE for leaves
+                int32_t Height = -1;          ///< 0 for leaves, -1 when free
+
+                bool IsLeaf() const { return Child1 == NULL_NODE; }
+        };
+
+        /**
+         * @brief Traversal stack kept in the query's stack frame.
+         *
+         * The balanced tree keeps it far below INLINE_SIZE entries, so
+         * queries do not allocate; deeper stacks spill to the heap rather
+         * than fail.
+         */
+        class NodeStack {
+            private:
+                static constexpr size_t INLINE_SIZE =
+                    64;  ///< Entries held without allocating
+
+                uint32_t m_Inline[INLINE_SIZE];  ///< First INLINE_SIZE entries
+                std::vector<uint32_t> m_Spill;   ///< Entries past those
+                size_t m_Size = 0;               ///< Entries in total
+
+            public:
+                bool IsEmpty() const { return m_Size == 0; }
+
+                void Push(uint32_t node) {
+                    if (m_Size < INLINE_SIZE) {
+                        m_Inline[m_Size] = node;
+                    } else {
+                        m_Spill.push_back(node);
+                    }
+                    m_Size++;
+                }
+
+                uint32_t Pop() {
+                    m_Size--;
+                    if (m_Size < INLINE_SIZE) {
+                        return m_Inline[m_Size];
+                    }
+                    uint32_t node = m_Spill.back();
+                    m_Spill.pop_back();
+                    return node;
+                }
+        };
+
+        std::vector<Node> m_Nodes;        ///< All nodes, free ones included
+        uint32_t m_Root = NULL_NODE;      ///< Root node
+        uint32_t m_FreeList = NULL_NODE;  ///< First free node
+        uint32_t m_LeafCount = 0;         ///< Inserted proxies
+        float m_Margin = DEFAULT_MARGIN;  ///< Fat box margin
+
+    public:
+        /**
+         * @brief Create an empty tree.
+         *
+         * @param margin Fat box margin; larger margins re-insert moving
+         * entities less often but make queries less tight
+         */
+        explicit AABBTree(float margin = DEFAULT_MARGIN) : m_Margin(margin) {}
+
+        /**
+         * @brief Add an entity.
+         *
+         * @param entity Entity reported by queries
+         * @param box World-space bounds; must not be empty
+         * @return Proxy for Move() and Remove()
+         */
+        uint32_t Insert(EntityID entity, const AABB& box);
+
+        /**
+         * @brief Remove an entity.
+         *
+         * @param proxy Proxy from Insert()
+         */
+        void Remove(uint32_t proxy);
+
+        /**
+         * @brief Update an entity's bounds.
+         *
+         * @param proxy Proxy from Insert()
+         * @param box New world-space bounds
+         * @return true if the leaf was re-inserted, false if the bounds still
+         * fit its fat box
+         */
+        bool Move(uint32_t proxy, const AABB& box);
+
+        /**
+         * @brief Remove every entity.
+         */
+        void Clear();
+
+        /**
+         * @brief Get the fat box of a leaf.
+         *
+         * @param proxy Proxy from Insert()
+         * @return Bounds grown by the margin
+         */
+        const AABB& GetFatBox(uint32_t proxy) const {
+            return m_Nodes[proxy].Box;
+        }
+
+        /**
+         * @brief Get the number of entities in the tree.
+         * @return Inserted minus removed proxies
+         */
+        uint32_t GetCount() const { return m_LeafCount; }
+
+        /**
+         * @brief Get the height of the tree.
+         * @return 0 for a single leaf, -1 when empty
+         */
+        int32_t GetHeight() const {
+            return m_Root == NULL_NODE ? -1 : m_Nodes[m_Root].Height;
+        }
+
+        /**
+         * @brief Find the entities whose fat boxes overlap a box.
+         *
+         * @param box Box to test
+         * @param func Called as bool func(EntityID)
+         */
+        template <typename Func>
+        void QueryAABB(const AABB& box, Func&& func) const {
+            if (m_Root != NULL_NODE) {
+                Traverse(
+                    m_Root,
+                    [&](const AABB& node) { return node.Intersects(box); },
+                    func);
+            }
+        }
+
+        /**
+         * @brief Find the entities whose fat boxes overlap a sphere.
+         *
+         * @param center Center of the sphere
+         * @param radius Radius of the sphere
+         * @param func Called as bool func(EntityID)
+         */
+        template <typename Func>
+        void QuerySphere(const glm::vec3& center, float radius,
+                         Func&& func) const {
+            if (m_Root == NULL_NODE) {
+                return;
+            }
+
+            float radiusSquared = radius * radius;
+            Traverse(
+                m_Root,
+                [&](const AABB& node) {
+                    glm::vec3 offset =
+                        center - glm::clamp(center, node.Min, node.Max);
+                    return glm::dot(offset, offset) <= radiusSquared;
+                },
+                func);
+        }
+
+        /**
+         * @brief Find the entities whose fat boxes overlap a frustum.
+         *
+         * Subtrees entirely inside the frustum are reported without further
+         * plane tests.
+         *
+         * @param frustum Frustum to test
+         * @param func Called as bool func(EntityID)
+         */
+        template <typename Func>
+        void QueryFrustum(const Frustum& frustum, Func&& func) const;
+
+        /**
+         * @brief Find the entities whose fat boxes a ray enters.
+         *
+         * Leaves are visited roughly front to back. The function returns the
+         * distance to clip the ray to: the hit distance to look for closer
+         * hits only, the given distance to keep going, or a negative value
+         * to stop.
+         *
+         * @param ray Ray to cast
+         * @param maxDistance Length of the ray
+         * @param func Called as float func(EntityID, float maxDistance)
+         */
+        template <typename Func>
+        void Raycast(const Ray& ray, float maxDistance, Func&& func) const;
+
+    private:
+        /**
+         * @brief Take a node from the free list, growing the array if empty.
+         * @return Node index
+         */
+        uint32_t AllocateNode();
+
+        /**
+         * @brief Return a node to the free list.
+         * @param node Node index
+         */
+        void FreeNode(uint32_t node);
+
+        /**
+         * @brief Link a leaf next to the sibling with the lowest SAH cost.
+         * @param leaf Leaf with its fat box set
+         */
+        void InsertLeaf(uint32_t leaf);
+
+        /**
+         * @brief Unlink a leaf, removing its parent.
+         * @param leaf Linked leaf
+         */
+        void RemoveLeaf(uint32_t leaf);
+
+        /**
+         * @brief Refit boxes and heights from a node to the root, rotating
+         * unbalanced nodes on the way.
+         * @param node First node to refit
+         */
+        void Refit(uint32_t node);
+
+        /**
+         * @brief Rotate a node if its children's heights differ by more than
+         * one.
+         * @param node Inner node
+         * @return The node now in its place
+         */
+        uint32_t Balance(uint32_t node);
+
+        /**
+         * @brief Depth-first walk over the nodes passing a test.
+         *
+         * @param root First node
+         * @param test Called as bool test(const AABB&) for every node
+         * @param func Called for every leaf that passes
+         * @return false if func stopped the walk
+         */
+        template <typename Test, typename Func>
+        bool Traverse(uint32_t root, Test&& test, Func& func) const {
+            NodeStack stack;
+            stack.Push(root);
+            while (!stack.IsEmpty()) {
+                const Node& node = m_Nodes[stack.Pop()];
+                if (!test(node.Box)) {
+                    continue;
+                }
+                if (node.IsLeaf()) {
+                    if (!func(node.Entity)) {
+                        return false;
+                    }
+                } else {
+                    stack.Push(node.Child1);
+                    stack.Push(node.Child2);
+                }
+            }
+            return true;
+        }
+};
+
+template <typename Func>
+void AABBTree::QueryFrustum(const Frustum& frustum, Func&& func) const {
+    if (m_Root == NULL_NODE) {
+        return;
+    }
+
+    NodeStack stack;
+    stack.Push(m_Root);
+    while (!stack.IsEmpty()) {
+        uint32_t index = stack.Pop();
+        const Node& node = m_Nodes[index];
+        if (!frustum.Intersects(node.Box)) {
+            continue;
+        }
+        if (node.IsLeaf()) {
+            if (!func(node.Entity)) {
+                return;
+            }
+        } else if (frustum.Contains(node.Box)) {
+            if (!Traverse(index, [](const AABB&) { return true; }, func)) {
+                return;
+            }
+        } else {
+            stack.Push(node.Child1);
+            stack.Push(node.Child2);
+        }
+    }
+}
+
+template <typename Func>
+void AABBTree::Raycast(const Ray& ray, float maxDistance, Func&& func) const {
+    if (m_Root == NULL_NODE) {
+        return;
+    }
+
+    NodeStack stack;
+    stack.Push(m_Root);
+    while (!stack.IsEmpty()) {
+        const Node& node = m_Nodes[stack.Pop()];
+        float distance;
+        if (!ray.Intersects(node.Box, maxDistance, distance)) {
+            continue;
+        }
+        if (node.IsLeaf()) {
+            float clipped = func(node.Entity, maxDistance);
+            if (clipped < 0.0f) {
+                return;
+            }
+            maxDistance = std::min(maxDistance, clipped);
+            continue;
+        }
+
+        // Visit the nearer child first, so hits clip the farther one
+        float distance1 = std::numeric_limits<float>::max();
+        float distance2 = std::numeric_limits<float>::max();
+        bool hit1 = ray.Intersects(m_Nodes[node.Child1].Box, maxDistance,
+                                   distance1);
+        bool hit2 = ray.Intersects(m_Nodes[node.Child2].Box, maxDistance,
+                                   distance2);
+        if (hit1 && hit2) {
+            bool firstNearer = distance1 <= distance2;
+            stack.Push(firstNearer ? node.Child2 : node.Child1);
+            stack.Push(firstNearer ? node.Child1 : node.Child2);
+        } else if (hit1) {
+            stack.Push(node.Child1);
+        } else if (hit2) {
+            stack.Push(node.Child2);
+        }
+    }
+}
+
+}  // namespace Obelisk
@@ -1,37 +1,38 @@
 #pragma once
 
 #include "ObeliskPCH.h"
+#include "Registry.h"
+#include "Obelisk/Components/Renderable.h"
 #include "Obelisk/Components/Transform.h"
+#include "Obelisk/Core/Bounds.h"
+#include "Obelisk/Renderer/Material.h"
 #include "Obelisk/Renderer/Mesh.h"
+#include "Obelisk/Renderer/ResourceRegistry.h"
 #include "Obelisk/Renderer/Shader.h"
 #include "Obelisk/Renderer/Texture.h"
 
-// Forward declaration to avoid circular includes
 namespace Obelisk {
-class Camera;
-}
 
-namespace Obelisk {
+class Scene;
 
 /**
- * @brief Represents a renderable game object with transform, mesh, shader, and
- * texture.
+ * @brief Handle to a renderable game object stored in a Scene.
  *
- * The Entity class is a fundamental building block of the engine's scene
- * system. It combines the essential components needed for rendering: a 3D
- * transformation, geometric mesh data, shader program, and texture. This design
- * provides a simple but flexible foundation for game objects that can be
- * positioned, rendered, and manipulated in 3D space.
+ * Entities are created by Scene::CreateEntity(), which gives them a
+ * Transform. Their components live in the scene's Registry, packed per
+ * component type, and the Entity itself is only the scene and an EntityID:
+ * it is cheap to copy, and every copy refers to the same object.
  *
- * Key components:
- * - Transform: Position, rotation, and scale in 3D space
- * - Mesh: Vertex data and geometry information
- * - Shader: GPU program for rendering the entity
- * - Texture: Surface appearance and material properties
+ * Components used by the renderer:
+ * - Transform: Position, rotation, and scale in 3D space, stored in a
+ *   TransformStorage
+ * - MeshRef: Vertex data and geometry information
+ * - MaterialRef: GPU program, textures and parameters, shared through the
+ *   MaterialLibrary by every entity that renders identically
+ * - LocalBounds: Mesh bounds, kept next to the transforms for culling
  *
- * @note This is a simplified entity design focused on rendering. More complex
- *       entity-component systems would separate these concerns into individual
- * components.
+ * Once the entity is destroyed with Scene::DestroyEntity(), IsValid()
+ * returns false and every other method must no longer be called.
  *
  * @example
  * ```cpp
@@ -41,73 +42,127 @@ namespace Obelisk {
  * auto brickTexture = std::make_shared<Texture>("textures/brick.jpg");
  *
  * // Create entity with all components
- * Entity cube(cubeMesh, basicShader, brickTexture);
+ * Entity cube = scene.CreateEntity(cubeMesh, basicShader, brickTexture);
  *
  * // Transform the entity
  * cube.GetTransform().SetPosition(glm::vec3(2.0f, 0.0f, -5.0f));
  * cube.GetTransform().SetRotation(glm::vec3(0.0f, 45.0f, 0.0f));
  *
- * // Render the entity
- * cube.Draw();
+ * // Remove it again; cube.IsValid() is now false
+ * scene.DestroyEntity(cube);
  * ```
  */
 class OBELISK_API Entity {
     private:
-        std::shared_ptr<Mesh>
-            m_Mesh;  ///< Geometric mesh data (shared resource)
-        std::shared_ptr<Shader>
-            m_Shader;  ///< GPU shader program (shared resource)
-        std::shared_ptr<Texture>
-            m_Texture;  ///< Surface texture (shared resource)
-
-        Transform
-            m_Transform;  ///< 3D transformation (position, rotation, scale)
+        Scene* m_Scene = nullptr;  ///< Scene storing the components
+        EntityID m_ID;             ///< Identifier in the scene's registry
 
     public:
         /**
-         * @brief Default constructor creating an entity with no components.
+         * @brief Create a null handle.
+         *
+         * Assign the result of Scene::CreateEntity() before use.
+         */
+        Entity() = default;
+
+        /**
+         * @brief Wrap an existing entity of a scene.
+         *
+         * @param scene Scene whose registry holds the entity
+         * @param id Entity in that registry
+         */
+        Entity(Scene* scene, EntityID id) : m_Scene(scene), m_ID(id) {}
+
+        /**
+         * @brief Check whether the handle refers to a live entity.
          *
-         * Creates an entity with an identity transform but no mesh, shader, or
-         * texture. Components must be set individually using the setter methods
-         * before the entity can be rendered.
+         * @return false for null handles and destroyed entities
          */
-        Entity();
+        bool IsValid() const;
 
         /**
-         * @brief Create an entity with all rendering components.
+         * @brief Get the entity's identifier in its scene's registry.
          *
-         * Constructs a complete entity ready for rendering with the specified
-         * mesh, shader, and texture. The transform is initialized to identity
-         * (position at origin, no rotation, unit scale).
+         * @return The ID, null for null handles
+         */
+        EntityID GetID() const { return m_ID; }
+
+        /**
+         * @brief Get the scene storing the entity.
          *
-         * @param mesh Shared pointer to the mesh geometry
-         * @param shader Shared pointer to the shader program
-         * @param texture Shared pointer to the surface texture
+         * @return The scene, or nullptr for null handles
+         */
+        Scene* GetScene() const { return m_Scene; }
+
+        /**
+         * @brief Set the mesh component for this entity.
          *
-         * @note Using shared pointers allows multiple entities to share the
-         * same resources, reducing memory usage and improving performance
+         * @param mesh Handle to the new mesh geometry; a null or released
+         * handle removes the mesh
          */
-        Entity(std::shared_ptr<Mesh> mesh, std::shared_ptr<Shader> shader,
-               std::shared_ptr<Texture> texture);
+        void SetMesh(MeshHandle mesh);
 
         /**
          * @brief Set the mesh component for this entity.
          *
-         * @param mesh Shared pointer to the new mesh geometry
+         * @param mesh New mesh geometry, added to the ResourceRegistry
+         * until no entity uses it (see
+         * ResourceRegistry::AddReleasedWhenUnused())
          */
         void SetMesh(std::shared_ptr<Mesh> mesh);
 
+        /**
+         * @brief Set the material for this entity.
+         *
+         * @param material Handle to the material; a null or released handle
+         * removes the material
+         */
+        void SetMaterial(MaterialHandle material);
+
+        /**
+         * @brief Set the material for this entity.
+         *
+         * @param material Material from MaterialLibrary::Create(), added to
+         * the ResourceRegistry until no entity uses it (see
+         * ResourceRegistry::AddReleasedWhenUnused())
+         */
+        void SetMaterial(std::shared_ptr<Material> material);
+
+        /**
+         * @brief Set the shader component for this entity.
+         *
+         * Switches to the material with the new shader and the current
+         * textures and parameters. The previous material is released once
+         * no entity uses it, unless it was added with
+         * ResourceRegistry::Add().
+         *
+         * @param shader Handle to the new shader program
+         */
+        void SetShader(ShaderHandle shader);
+
         /**
          * @brief Set the shader component for this entity.
          *
-         * @param shader Shared pointer to the new shader program
+         * @param shader New shader program; see SetShader(ShaderHandle)
          */
         void SetShader(std::shared_ptr<Shader> shader);
 
         /**
          * @brief Set the texture component for this entity.
          *
-         * @param texture Shared pointer to the new surface texture
+         * Switches to the material with the new texture on unit 0 and the
+         * current shader and parameters. The previous material is released
+         * once no entity uses it, unless it was added with
+         * ResourceRegistry::Add().
+         *
+         * @param texture Handle to the new surface texture
+         */
+        void SetTexture(TextureHandle texture);
+
+        /**
+         * @brief Set the texture component for this entity.
+         *
+         * @param texture New surface texture; see SetTexture(TextureHandle)
          */
         void SetTexture(std::shared_ptr<Texture> texture);
 
@@ -115,59 +170,126 @@ class OBELISK_API Entity {
          * @brief Get a reference to the entity's transform component.
          *
          * Provides direct access to the transform for modifying position,
-         * rotation, and scale. The returned reference allows both reading
-         * and writing of transform properties.
+         * rotation, and scale. The transform lives in the scene's
+         * TransformStorage, so the reference is only valid until an entity
+         * is destroyed.
+         *
+         * @return Reference to the entity's transform
+         */
+        TransformRef GetTransform() const;
+
+        /**
+         * @brief Attach the entity to a parent, or detach it.
+         *
+         * The entity's transform becomes relative to the parent's and it is
+         * destroyed along with the parent. Fails if the parent is the entity
+         * itself or one of its descendants.
+         *
+         * @param parent Entity of the same scene, or a null handle to make
+         * the entity a root again
+         * @return true if the parent was set
+         */
+        bool SetParent(Entity parent);
+
+        /**
+         * @brief Get the entity's parent.
          *
-         * @return Reference to the entity's Transform component
+         * @return The parent, or a null handle for root entities
          */
-        Transform& GetTransform() { return m_Transform; }
+        Entity GetParent() const;
+
+        /**
+         * @brief Mark the entity as never moving after the scene is
+         * finalized.
+         *
+         * Static entities are merged into StaticBatches by Scene::Finalize()
+         * and no longer drawn individually, so transform changes made after
+         * that have no visible effect.
+         *
+         * @param isStatic Whether the entity is static
+         */
+        void SetStatic(bool isStatic);
+
+        /**
+         * @brief Check whether the entity is marked static.
+         *
+         * @return true if SetStatic(true) was called
+         */
+        bool IsStatic() const;
+
+        /**
+         * @brief Get the world-space bounds of the entity.
+         *
+         * @return Mesh bounds under the current transform, or an empty box
+         * if no mesh is set
+         */
+        AABB GetBounds() const;
+
+        /**
+         * @brief Get the handle of the entity's mesh.
+         *
+         * @return The handle, or a null handle if no mesh is set
+         */
+        MeshHandle GetMeshHandle() const;
+
+        /**
+         * @brief Get the handle of the entity's material.
+         *
+         * @return The handle, or a null handle if no material is set
+         */
+        MaterialHandle GetMaterialHandle() const;
 
         /**
          * @brief Get the entity's mesh component.
          *
-         * @return Shared pointer to the mesh, or nullptr if no mesh is set
+         * @return The mesh, or nullptr if no mesh is set or it was released
+         */
+        Mesh* GetMesh() const;
+
+        /**
+         * @brief Get the entity's material.
+         *
+         * @return The material, or nullptr if none is set or it was released
          */
-        std::shared_ptr<Mesh> GetMesh() const;
+        Material* GetMaterial() const;
 
         /**
          * @brief Get the entity's shader component.
          *
-         * @return Shared pointer to the shader, or nullptr if no shader is set
+         * @return The shader, or nullptr if no shader is set
          */
-        std::shared_ptr<Shader> GetShader() const;
+        Shader* GetShader() const;
 
         /**
          * @brief Get the entity's texture component.
          *
-         * @return Shared pointer to the texture, or nullptr if no texture is
-         * set
+         * @return The material's texture on unit 0, or nullptr if no texture
+         * is set
          */
-        std::shared_ptr<Texture> GetTexture() const;
+        Texture* GetTexture() const;
 
         /**
-         * @brief Render this entity to the current framebuffer.
+         * @brief Queue this entity on the Renderer for the current frame.
          *
-         * Performs a complete rendering operation for this entity:
-         * 1. Binds the shader program
-         * 2. Sets model, view, and projection matrices as uniforms
-         * 3. Binds the texture to texture unit 0
-         * 4. Draws the mesh geometry
+         * Records a draw of the mesh with the material, passing the model
+         * matrix through the PerDraw uniform block. Must be called
+         * between Renderer::BeginFrame() and Renderer::EndFrame(); the
+         * camera given to BeginFrame() provides view and projection.
          *
-         * The entity must have valid mesh, shader, and texture components
-         * for rendering to succeed.
+         * The entity must have a valid mesh and a material with a shader for
+         * rendering to succeed.
          *
-         * @param camera The camera to use for view and projection matrices
-         * @note Assumes appropriate OpenGL state has been set up (viewport,
-         * etc.)
+         * @note If the shader is still compiling, the entity is drawn with
+         * Shader::GetFallback() or skipped when no fallback is set
          */
-        void Draw(const Camera& camera) const;
+        void Submit() const;
 
         /**
          * @brief Legacy render method using transform matrix only.
          *
          * This is a fallback rendering method that uses only the entity's
          * transform matrix without camera view/projection matrices.
-         * Use Draw(const Camera&) for proper 3D rendering instead.
+         * Use Submit() for proper 3D rendering instead.
          *
          * @deprecated This method is deprecated and should be avoided in new
          * code
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+
+namespace Obelisk {
+
+/**
+ * @brief An omnidirectional light with a finite range.
+ *
+ * Lights only affect geometry within Radius of their position; the falloff
+ * reaches zero at the radius, which is what lets the clustered lighting
+ * system assign each light to a bounded set of clusters.
+ *
+ * @example
+ * ```cpp
+ * PointLight light;
+ * light.Position = glm::vec3(0.0f, 2.0f, 0.0f);
+ * light.Color = glm::vec3(1.0f, 0.8f, 0.6f);
+ * light.Radius = 5.0f;
+ * scene.AddLight(light);
+ * ```
+ */
+struct PointLight {
+        glm::vec3 Position = glm::vec3(0.0f);  ///< World-space position
+        float Radius = 5.0f;                   ///< Range of influence
+        glm::vec3 Color = glm::vec3(1.0f);     ///< Linear RGB color
+        float Intensity = 1.0f;                ///< Color multiplier
+};
+
+}  // namespace Obelisk
@@ -0,0 +1,238 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include <span>
+#include <tuple>
+#include <typeindex>
+#include "SparseSet.h"
+#include "Obelisk/Components/TransformStorage.h"
+
+namespace Obelisk {
+
+/**
+ * @brief Pool class storing a component type; see ComponentStorage.
+ */
+template <typename T>
+using StorageOf = typename ComponentStorage<T>::Type;
+
+/**
+ * @brief Iterates the entities that have every one of a list of components.
+ *
+ * The smallest pool drives the iteration, so a view over a rare component
+ * only visits its few owners. Components of the other pools are looked up
+ * through their sparse arrays, which stays linear while pools hold their
+ * entities in the same order, as pools filled together do.
+ *
+ * Entities and components must not be added or removed during Each(); the
+ * components themselves may be modified.
+ */
+template <typename... Ts>
+class View {
+    private:
+        std::tuple<StorageOf<Ts>*...> m_Pools;  ///< One pool per type
+
+    public:
+        /**
+         * @brief Create a view over existing pools; see Registry::GetView().
+         */
+        explicit View(StorageOf<Ts>&... pools) : m_Pools(&pools...) {}
+
+        /**
+         * @brief Call a function for every matching entity.
+         *
+         * @param func Called as func(EntityID, Ts&...), or with whatever
+         * the pool's Get() returns for custom storage (TransformRef for
+         * Transform)
+         */
+        template <typename Func>
+        void Each(Func&& func) {
+            const SparseSet* driver = nullptr;
+            ((driver = !driver || Pool<Ts>().Size() < driver->Size()
+                           ? static_cast<const SparseSet*>(&Pool<Ts>())
+                           : driver),
+             ...);
+
+            for (EntityID id : driver->GetEntities()) {
+                if ((Pool<Ts>().Has(id) && ...)) {
+                    func(id, Pool<Ts>().Get(id)...);
+                }
+            }
+        }
+
+    private:
+        template <typename T>
+        StorageOf<T>& Pool() {
+            return *std::get<StorageOf<T>*>(m_Pools);
+        }
+};
+
+/**
+ * @brief Owns entity IDs and one pool per component type.
+ *
+ * Any copyable or movable type can be a component; its pool is created the
+ * first time the type is used. Pools are ComponentPools unless the type
+ * specializes ComponentStorage, as Transform does with TransformStorage.
+ * Destroying an entity removes all of its components and retires its ID.
+ *
+ * @example
+ * ```cpp
+ * Registry registry;
+ * EntityID id = registry.Create();
+ * registry.Add<Transform>(id).SetPosition(1.0f, 0.0f, 0.0f);
+ * registry.Add<MeshRef>(id, mesh);
+ *
+ * registry.GetView<Transform, MeshRef>().Each(
+ *     [](EntityID id, TransformRef transform, MeshRef& mesh) {
+ *         transform.Rotate(glm::vec3(0.0f, 1.0f, 0.0f));
+ *     });
+ *
+ * registry.Destroy(id);  // IsAlive(id) is now false
+ * ```
+ */
+class OBELISK_API Registry {
+    private:
+        std::vector<uint32_t> m_Generations;  ///< Current generation per slot
+        std::vector<uint32_t> m_FreeIndices;  ///< Slots of destroyed entities
+        std::unordered_map<std::type_index, std::unique_ptr<SparseSet>>
+            m_Pools;  ///< Component pools by type
+
+    public:
+        Registry() = default;
+        Registry(const Registry&) = delete;
+        Registry& operator=(const Registry&) = delete;
+        Registry(Registry&&) = default;
+        Registry& operator=(Registry&&) = default;
+
+        /**
+         * @brief Create an entity without components.
+         *
+         * @return Its ID, reusing the slot of a destroyed entity if any
+         */
+        EntityID Create();
+
+        /**
+         * @brief Create many entities without components at once.
+         *
+         * @param ids Receives the new IDs, reusing the slots of destroyed
+         * entities first
+         */
+        void Create(std::span<EntityID> ids);
+
+        /**
+         * @brief Destroy an entity and remove its components.
+         *
+         * Does nothing if the entity is not alive.
+         *
+         * @param id Entity to destroy
+         */
+        void Destroy(EntityID id);
+
+        /**
+         * @brief Check whether an ID refers to a live entity.
+         *
+         * @param id Entity to check
+         * @return false for null IDs and destroyed entities
+         */
+        bool IsAlive(EntityID id) const;
+
+        /**
+         * @brief Get the number of live entities.
+         * @return Created minus destroyed entities
+         */
+        size_t GetAliveCount() const {
+            return m_Generations.size() - m_FreeIndices.size();
+        }
+
+        /**
+         * @brief Get the pool of a component type, creating it if needed.
+         *
+         * Looking the pool up once and keeping the reference avoids a hash
+         * lookup per access in hot loops.
+         *
+         * @return The pool, valid for the lifetime of the registry
+         */
+        template <typename T>
+        StorageOf<T>& GetPool() {
+            std::unique_ptr<SparseSet>& pool = m_Pools[typeid(T)];
+            if (!pool) {
+                pool = std::make_unique<StorageOf<T>>();
+            }
+            return static_cast<StorageOf<T>&>(*pool);
+        }
+
+        /**
+         * @brief Add a component to an entity, or replace its existing one.
+         *
+         * @param id Live entity
+         * @param args Arguments for the component's brace initializer
+         * @return The stored component
+         */
+        template <typename T, typename... Args>
+        decltype(auto) Add(EntityID id, Args&&... args) {
+            return GetPool<T>().Emplace(id, std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Remove a component from an entity, if it has one.
+         *
+         * @param id Entity to remove the component from
+         */
+        template <typename T>
+        void Remove(EntityID id) {
+            GetPool<T>().Remove(id);
+        }
+
+        /**
+         * @brief Check whether an entity has a component.
+         *
+         * @param id Entity to check
+         * @return true if the component was added and not removed since
+         */
+        template <typename T>
+        bool Has(EntityID id) const {
+            auto it = m_Pools.find(typeid(T));
+            return it != m_Pools.end() && it->second->Has(id);
+        }
+
+        /**
+         * @brief Get a component the entity is known to have.
+         *
+         * @param id Entity with the component
+         * @return The component
+         */
+        template <typename T>
+        decltype(auto) Get(EntityID id) {
+            return GetPool<T>().Get(id);
+        }
+
+        /**
+         * @brief Get a component, if the entity has it.
+         *
+         * @param id Entity to look up
+         * @return The component, or nullptr
+         */
+        template <typename T>
+        auto TryGet(EntityID id) {
+            return GetPool<T>().TryGet(id);
+        }
+
+        /**
+         * @brief Remove a component type from every entity.
+         */
+        template <typename T>
+        void Clear() {
+            GetPool<T>().Clear();
+        }
+
+        /**
+         * @brief Get a view of the entities that have all of some components.
+         *
+         * @return View over the pools of the given types
+         */
+        template <typename... Ts>
+        View<Ts...> GetView() {
+            return View<Ts...>(GetPool<Ts>()...);
+        }
+};
+
+}  // namespace Obelisk
@@ -1,86 +1,411 @@
 #pragma once
 
 #include "ObeliskPCH.h"
+#include "AABBTree.h"
 #include "Entity.h"
+#include "Light.h"
+#include "SpatialHashGrid.h"
+#include "StaticBatch.h"
+#include "Obelisk/Core/AABBArray.h"
+#include "Obelisk/Renderer/RenderSnapshot.h"
 
-// Forward declaration for Camera
+// Forward declarations
 namespace Obelisk {
 class Camera;
+struct Frustum;
 }
 
 namespace Obelisk {
 
+/**
+ * @brief Structure a Scene keeps its entities' world bounds in.
+ */
+enum class SpatialIndexType {
+    Tree,     ///< AABBTree updated per moved entity (default)
+    HashGrid  ///< SpatialHashGrid rebuilt whenever anything moved
+};
+
+/**
+ * @brief Closest entity hit by Scene::Raycast().
+ */
+struct RaycastHit {
+        Entity HitEntity;       ///< Entity whose bounds the ray entered
+        float Distance = 0.0f;  ///< Distance along the ray to its bounds
+};
+
 /**
  * @brief Container for managing entities and scene state.
  *
  * The Scene class represents a collection of entities that make up a particular
- * game state or level. It provides methods for adding entities and accessing
- * the complete entity list for systems that need to iterate over all entities
- * (such as rendering, physics, or game logic systems).
+ * game state or level. It owns the entities: their components are stored in a
+ * Registry, one packed array per component type, and Entity is a handle into
+ * it. Systems that process many entities (rendering, physics, game logic)
+ * iterate the packed arrays through registry views rather than entity by
+ * entity.
+ *
+ * The world bounds of every entity with a mesh are kept in an AABBTree,
+ * updated incrementally from the transforms that changed. Capture() culls
+ * through it and the Query*() and Raycast() functions answer spatial
+ * queries in time logarithmic in the entity count.
+ *
+ * Scenes where most entities move every frame can switch to a
+ * SpatialHashGrid instead (see SetSpatialIndexType()), which is rebuilt
+ * from scratch in linear time rather than updated entity by entity.
  *
  * Key responsibilities:
  * - Entity lifecycle management within the scene
  * - Providing access to entities for various game systems
  * - Serving as the organizational unit for different game states
  *
- * @note The Scene class does not own the Entity objects - it maintains pointers
- *       to entities that should be managed elsewhere (typically by an
- * EntityManager)
- *
  * @example
  * ```cpp
  * Scene gameScene;
  *
- * // Add entities to the scene
- * gameScene.AddEntity(player);
- * gameScene.AddEntity(enemy1);
- * gameScene.AddEntity(terrain);
+ * // Create entities in the scene
+ * Entity player = gameScene.CreateEntity(playerMesh, playerMaterial);
+ * Entity terrain = gameScene.CreateEntity(terrainMesh, terrainMaterial);
+ *
+ * // Systems iterate the components they need
+ * gameScene.GetRegistry().GetView<Transform, MeshRef>().Each(
+ *     [](EntityID id, TransformRef transform, MeshRef& mesh) {
+ *         // Process entity (update, render, etc.)
+ *     });
  *
- * // Systems can iterate over all entities
- * for (Entity* entity : gameScene.GetEntities()) {
- *     // Process entity (update, render, etc.)
- * }
+ * // Merge static entities once everything is loaded
+ * terrain.SetStatic(true);
+ * gameScene.Finalize();
  * ```
  */
 class OBELISK_API Scene {
     private:
-        std::vector<Entity*>
-            m_Entities;  ///< Collection of entities in this scene (not owned)
+        /**
+         * @brief Marks entities merged into a static batch by Finalize().
+         */
+        struct BatchedTag {};
+
+        /**
+         * @brief Marks entities handed to GPUCulling by Finalize().
+         */
+        struct GPUCulledTag {};
+
+        /**
+         * @brief An entity's leaf in the spatial index.
+         */
+        struct SpatialProxy {
+                uint32_t Proxy;  ///< Leaf from AABBTree::Insert()
+                AABB Bounds;     ///< World bounds when last updated
+        };
+
+        Registry m_Registry;  ///< Entities and their components
         Camera* m_Camera =
             nullptr;  ///< Active camera for this scene (not owned)
+        std::vector<PointLight> m_Lights;  ///< Dynamic lights in this scene
+
+        std::vector<StaticBatch>
+            m_StaticBatches;  ///< Merged static entities, built by Finalize()
+        std::vector<EntityID>
+            m_GPUEntities;  ///< Moving entities, in GPUCulling's order
+        bool m_GPUCulled = false;  ///< Whether Finalize() used GPUCulling
+        size_t m_CulledCount = 0;  ///< Draws culled by the last Capture()
+        float m_ImpostorDistance =
+            50.0f;  ///< Distance beyond which impostors replace meshes
+        AABBTree m_SpatialIndex;  ///< World bounds of entities with a mesh
+        std::vector<EntityID>
+            m_MovedEntities;  ///< Scratch list for UpdateSpatialIndex()
+        SpatialIndexType m_SpatialIndexType =
+            SpatialIndexType::Tree;  ///< Structure in use
+        SpatialHashGrid m_SpatialGrid;  ///< Bounds centers, in HashGrid mode
+        std::vector<EntityID>
+            m_GridEntities;  ///< Entity of each m_SpatialGrid item
+        AABBArray m_GridBounds;                ///< World bounds, by grid item
+        std::vector<glm::vec3> m_GridCenters;  ///< Centers, by grid item
+        glm::vec3 m_GridMaxExtents =
+            glm::vec3(0.0f);  ///< Largest half size among m_SpatialGrid items
+        size_t m_GridSmallCount =
+            0;  ///< Items in m_SpatialGrid; later ones span several cells
+        bool m_GridStale = false;  ///< Whether an entity left the grid
 
     public:
         /**
-         * @brief Add an entity to the scene.
+         * @brief Create an entity with an identity transform and no mesh or
+         * material.
+         *
+         * @return Handle to the new entity
+         *
+         * @note Entities created after Finalize() are always drawn
+         * individually, even if static
+         */
+        Entity CreateEntity();
+
+        /**
+         * @brief Create an entity from a mesh and a material.
+         *
+         * @param mesh Handle to the mesh geometry
+         * @param material Handle to the material
+         * @return Handle to the new entity
+         */
+        Entity CreateEntity(MeshHandle mesh, MaterialHandle material);
+
+        /**
+         * @brief Create an entity from a mesh and a material.
+         *
+         * Both are added to the ResourceRegistry.
+         *
+         * @param mesh Shared pointer to the mesh geometry
+         * @param material Material from MaterialLibrary::Create()
+         * @return Handle to the new entity
+         */
+        Entity CreateEntity(std::shared_ptr<Mesh> mesh,
+                            std::shared_ptr<Material> material);
+
+        /**
+         * @brief Create an entity with all rendering components.
+         *
+         * The shader and texture are combined into a Material via the
+         * MaterialLibrary.
+         *
+         * @param mesh Shared pointer to the mesh geometry
+         * @param shader Shared pointer to the shader program
+         * @param texture Shared pointer to the surface texture
+         * @return Handle to the new entity
+         */
+        Entity CreateEntity(std::shared_ptr<Mesh> mesh,
+                            std::shared_ptr<Shader> shader,
+                            std::shared_ptr<Texture> texture);
+
+        /**
+         * @brief Destroy an entity, its children and their components.
+         *
+         * Handles to them become invalid. An entity merged into a static batch
+         * stays visible until the next Finalize().
+         *
+         * @param entity Entity of this scene; destroyed or null handles are
+         * ignored
+         */
+        void DestroyEntity(Entity entity);
+
+        /**
+         * @brief Get the number of entities in the scene.
+         *
+         * @return Live entities
+         */
+        size_t GetEntityCount() const { return m_Registry.GetAliveCount(); }
+
+        /**
+         * @brief Get the registry storing the scene's entities.
+         *
+         * Every entity has a Transform and LocalBounds; MeshRef, MaterialRef
+         * and StaticTag are present once set through Entity. Systems may add
+         * components of their own.
+         *
+         * @return Reference to the registry
+         */
+        Registry& GetRegistry() { return m_Registry; }
+
+        /**
+         * @brief Merge static entities into static batches.
+         *
+         * Call once the scene is loaded. Static entities (see
+         * Entity::SetStatic()) sharing a material are merged per spatial
+         * chunk; all other entities keep being drawn individually. Calling
+         * it again rebuilds the batches from the current entities.
+         *
+         * Entities whose mesh is marked with Mesh::SetImpostorEnabled() are
+         * baked into the ImpostorAtlas and never merged, since far away they
+         * are drawn as impostors instead.
+         *
+         * When GPUCulling is enabled and supported, the static batches and
+         * every other drawable entity are then handed to it, and Capture()
+         * no longer culls them on the CPU.
+         *
+         * Requires a current OpenGL context.
+         *
+         * @param chunkSize Edge length of the batching chunks in world units
+         */
+        void Finalize(float chunkSize = StaticBatch::DEFAULT_CHUNK_SIZE);
+
+        /**
+         * @brief Capture the visible part of the scene for rendering.
+         *
+         * Copies the camera and lights into the snapshot, culls static
+         * batches and individual entities against the camera frustum by
+         * their bounds and records the survivors. In Tree mode only
+         * entities the spatial index finds near the frustum are tested.
+         * Entities with a baked impostor beyond the impostor distance are
+         * recorded as impostors.
+         * Entities culled on the GPU are not tested; only the model matrices
+         * of the moving ones are copied. Nothing is recorded when no camera
+         * is set.
+         *
+         * @param snapshot Snapshot to fill; cleared first
+         */
+        void Capture(RenderSnapshot& snapshot);
+
+        /**
+         * @brief Get the static batches built by Finalize().
+         *
+         * @return Static batches, empty before Finalize()
+         */
+        const std::vector<StaticBatch>& GetStaticBatches() const {
+            return m_StaticBatches;
+        }
+
+        /**
+         * @brief Get the number of draws the last Capture() culled.
+         *
+         * @return Culled batches and entities
+         */
+        size_t GetCulledCount() const { return m_CulledCount; }
+
+        /**
+         * @brief Bring the spatial index up to date with the transforms and
+         * meshes that changed.
+         *
+         * Capture() and the queries call this themselves; it returns at once
+         * when nothing moved.
+         */
+        void UpdateSpatialIndex();
+
+        /**
+         * @brief Find the entities whose bounds overlap a box.
+         *
+         * @param box World-space box
+         * @param results Receives the entities; not cleared
+         */
+        void QueryAABB(const AABB& box, std::vector<Entity>& results);
+
+        /**
+         * @brief Find the entities whose bounds overlap a sphere.
+         *
+         * @param center World-space center
+         * @param radius Radius in world units
+         * @param results Receives the entities; not cleared
+         */
+        void QuerySphere(const glm::vec3& center, float radius,
+                         std::vector<Entity>& results);
+
+        /**
+         * @brief Find the entities whose bounds overlap a frustum.
+         *
+         * @param frustum Frustum to test
+         * @param results Receives the entities; not cleared
+         */
+        void QueryFrustum(const Frustum& frustum, std::vector<Entity>& results);
+
+        /**
+         * @brief Find the closest entity whose bounds a ray enters.
+         *
+         * @param ray World-space ray
+         * @param maxDistance Length of the ray
+         * @param hit Receives the entity and distance when something is hit
+         * @return true if an entity was hit
+         */
+        bool Raycast(const Ray& ray, float maxDistance, RaycastHit& hit);
+
+        /**
+         * @brief Find the closest entity whose mesh a ray hits.
+         *
+         * Like Raycast(), but entities whose bounds the ray enters are then
+         * tested triangle by triangle (see Mesh::Raycast()). Only meshes
+         * created with keepCPUGeometry can be hit. Makes no OpenGL calls,
+         * so it may run off the render thread.
+         *
+         * @param ray World-space ray
+         * @param maxDistance Length of the ray
+         * @param hit Receives the entity and the distance to its triangle
+         * @return true if an entity was hit
+         */
+        bool Pick(const Ray& ray, float maxDistance, RaycastHit& hit);
+
+        /**
+         * @brief Find the entity under a screen position.
+         *
+         * @param screenPosition Position in normalized device coordinates
+         * @param hit Receives the entity and the distance from the near
+         * plane
+         * @return true if an entity was hit; false without a camera
+         *
+         * @example
+         * ```cpp
+         * RaycastHit hit;
+         * if (scene.Pick(cursorNDC, hit)) {
+         *     Select(hit.HitEntity);
+         * }
+         * ```
+         */
+        bool Pick(const glm::vec2& screenPosition, RaycastHit& hit);
+
+        /**
+         * @brief Get the spatial index over the scene's entities.
+         *
+         * Leaves hold fat boxes; current after UpdateSpatialIndex(). Empty
+         * in HashGrid mode.
+         *
+         * @return Reference to the tree
+         */
+        const AABBTree& GetSpatialIndex() const { return m_SpatialIndex; }
+
+        /**
+         * @brief Choose the structure the spatial index uses.
          *
-         * Adds the specified entity to this scene's entity list, making it
-         * available for processing by game systems. The scene does not take
-         * ownership of the entity - the caller retains responsibility for
-         * the entity's lifecycle.
+         * The tree suits scenes where most entities stay put, the hash grid
+         * scenes of many small entities that nearly all move every frame.
+         * The new structure is built on the next UpdateSpatialIndex().
          *
-         * @param entity Pointer to the entity to add (must not be nullptr)
+         * @param type Structure to use
+         * @param cellSize Grid cell edge length in world units; around the
+         * usual entity size and query radius works best
+         */
+        void SetSpatialIndexType(
+            SpatialIndexType type,
+            float cellSize = SpatialHashGrid::DEFAULT_CELL_SIZE);
+
+        /**
+         * @brief Get the structure the spatial index uses.
          *
-         * @note Does not check for duplicate entities - the same entity
-         *       can be added multiple times if called repeatedly
-         * @note The entity should remain valid for the lifetime of the scene
+         * @return Current type
          */
-        void AddEntity(Entity* entity) { m_Entities.push_back(entity); }
+        SpatialIndexType GetSpatialIndexType() const {
+            return m_SpatialIndexType;
+        }
 
         /**
-         * @brief Get the list of all entities in the scene.
+         * @brief Get the grid over the entities' bounds centers.
          *
-         * Returns a reference to the internal entity vector, allowing systems
-         * to iterate over all entities for processing. This enables various
-         * game systems (rendering, physics, AI, etc.) to operate on all
-         * entities in the scene.
+         * Current after UpdateSpatialIndex(), empty outside HashGrid mode.
+         * Its items index GetSpatialGridEntities(), so allocation-free
+         * queries can be made directly on it. Entities larger than a cell
+         * are left out and follow its items in GetSpatialGridEntities().
          *
-         * @return Reference to the vector containing all entities in the scene
+         * @return Reference to the grid
+         */
+        const SpatialHashGrid& GetSpatialGrid() const { return m_SpatialGrid; }
+
+        /**
+         * @brief Get the entity of each item in GetSpatialGrid().
          *
-         * @note The returned reference remains valid until entities are added
-         * or removed
-         * @note Callers should not store long-term references to this vector
+         * @return Entities, by grid item, then the entities too large for
+         * the grid
          */
-        std::vector<Entity*>& GetEntities() { return m_Entities; }
+        const std::vector<EntityID>& GetSpatialGridEntities() const {
+            return m_GridEntities;
+        }
+
+        /**
+         * @brief Set the distance beyond which impostors replace meshes.
+         *
+         * @param distance Camera distance in world units
+         */
+        void SetImpostorDistance(float distance) {
+            m_ImpostorDistance = distance;
+        }
+
+        /**
+         * @brief Get the distance beyond which impostors replace meshes.
+         *
+         * @return Camera distance in world units
+         */
+        float GetImpostorDistance() const { return m_ImpostorDistance; }
 
         /**
          * @brief Set the active camera for this scene.
@@ -98,6 +423,78 @@ class OBELISK_API Scene {
          * @return Pointer to the active camera, or nullptr if no camera is set
          */
         Camera* GetCamera() const { return m_Camera; }
+
+        /**
+         * @brief Add a point light to the scene.
+         *
+         * @param light Light to add
+         * @return Index of the light in GetLights()
+         */
+        size_t AddLight(const PointLight& light) {
+            m_Lights.push_back(light);
+            return m_Lights.size() - 1;
+        }
+
+        /**
+         * @brief Get the lights in the scene.
+         *
+         * Lights may be modified in place, e.g. to animate them.
+         *
+         * @return Reference to the vector containing all lights
+         */
+        std::vector<PointLight>& GetLights() { return m_Lights; }
+
+        /**
+         * @brief Remove all lights from the scene.
+         */
+        void ClearLights() { m_Lights.clear(); }
+
+    private:
+        /**
+         * @brief Hand the static batches and eligible dynamic entities to
+         * GPUCulling; on failure everything stays culled on the CPU.
+         */
+        void BuildGPUCulling();
+
+        /**
+         * @brief Rebuild the hash grid from the world bounds of every entity
+         * with a mesh.
+         *
+         * Entities larger than a cell are moved past the grid's items and
+         * tested one by one, so they do not widen every query.
+         */
+        void RebuildSpatialGrid();
+
+        /**
+         * @brief Visit the grid items whose bounds overlap a box.
+         *
+         * Falls back to testing every item when the box touches more cells
+         * than there are items.
+         *
+         * @param box World-space box
+         * @param func Called as func(uint32_t item)
+         */
+        template <typename Func>
+        void ForEachGridItem(const AABB& box, Func&& func) const;
+
+        /**
+         * @brief Intersect a world-space ray with an entity's mesh.
+         *
+         * @return false if it has no mesh or the ray misses it
+         */
+        bool IntersectMesh(EntityID id, const Ray& ray, float maxDistance,
+                           float& distance);
+
+        /**
+         * @brief Frustum-cull the individually drawn entities through the
+         * spatial index and record the survivors.
+         *
+         * @param snapshot Snapshot to record into
+         * @param frustum Camera frustum
+         * @param gpuCulling Whether to skip the entities GPUCulling handles
+         */
+        void CaptureEntities(RenderSnapshot& snapshot, const Frustum& frustum,
+                             bool gpuCulling);
 };
 
 }  // namespace Obelisk
\ No newline at end of file
@@ -0,0 +1,205 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include <filesystem>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+#include "SceneFormat.h"
+#include "SparseSet.h"
+#include "Obelisk/Components/Renderable.h"
+#include "Obelisk/Core/MappedFile.h"
+#include "Obelisk/Scene/Light.h"
+
+namespace Obelisk {
+
+class Scene;
+
+/**
+ * @brief Names of the meshes and materials scene files refer to.
+ *
+ * Scene files store names rather than resources; the application registers
+ * the resources it created under the names its levels use, once, and hands
+ * the same set to SceneFile::Write() and SceneFile::Instantiate().
+ */
+class OBELISK_API SceneResources {
+    private:
+        std::unordered_map<std::string, MeshHandle>
+            m_Meshes;  ///< Meshes by name
+        std::unordered_map<std::string, MaterialHandle>
+            m_Materials;  ///< Materials by name
+        std::unordered_map<uint32_t, std::string>
+            m_MeshNames;  ///< Names by MeshHandle value
+        std::unordered_map<uint32_t, std::string>
+            m_MaterialNames;  ///< Names by MaterialHandle value
+
+    public:
+        /**
+         * @brief Register a mesh, replacing any mesh of the same name.
+         *
+         * @param name Name scene files refer to the mesh by
+         * @param mesh Handle from the ResourceRegistry
+         */
+        void AddMesh(const std::string& name, MeshHandle mesh);
+
+        /**
+         * @brief Register a material, replacing any of the same name.
+         *
+         * @param name Name scene files refer to the material by
+         * @param material Handle from the ResourceRegistry
+         */
+        void AddMaterial(const std::string& name, MaterialHandle material);
+
+        /**
+         * @brief Look up a mesh by name.
+         *
+         * @param name Registered name
+         * @return Its handle, or a null handle if none was registered
+         */
+        MeshHandle FindMesh(const std::string& name) const;
+
+        /**
+         * @brief Look up a material by name.
+         *
+         * @param name Registered name
+         * @return Its handle, or a null handle if none was registered
+         */
+        MaterialHandle FindMaterial(const std::string& name) const;
+
+        /**
+         * @brief Get the name a mesh was registered under.
+         *
+         * @param mesh Handle to look up
+         * @return Its name, or nullptr if it was not registered
+         */
+        const std::string* GetMeshName(MeshHandle mesh) const;
+
+        /**
+         * @brief Get the name a material was registered under.
+         *
+         * @param material Handle to look up
+         * @return Its name, or nullptr if it was not registered
+         */
+        const std::string* GetMaterialName(MaterialHandle material) const;
+};
+
+/**
+ * @brief Memory-mapped binary scene, laid out as described in SceneFormat.h.
+ *
+ * Open() maps the file and turns its section offsets into typed views of
+ * the mapping after checking that they fit; nothing is parsed or copied.
+ * Instantiate() then creates all entities at once and appends each section
+ * to the matching component array with a single copy, so loading a level
+ * costs little more than reading it from disk. Write() saves a Scene in the
+ * same layout.
+ *
+ * The file stays mapped until Close(), so one open file can instantiate a
+ * level several times.
+ *
+ * @example
+ * ```cpp
+ * SceneResources resources;
+ * resources.AddMesh("cube", cube);
+ * resources.AddMaterial("stone", stone);
+ *
+ * SceneFile::Write(scene, "levels/forest.oscene", resources);
+ *
+ * SceneFile file;
+ * if (file.Open("levels/forest.oscene")) {
+ *     file.Instantiate(otherScene, resources);
+ * }
+ * ```
+ */
+class OBELISK_API SceneFile {
+    private:
+        MappedFile m_File;                          ///< Mapped contents
+        const SceneFileHeader* m_Header = nullptr;  ///< Start of the file
+
+        std::span<const float> m_Transforms;    ///< Channel-major transforms
+        std::span<const uint32_t> m_Parents;    ///< Parent of each entity
+        std::span<const LocalBounds> m_Bounds;  ///< Bounds of each entity
+        std::span<const uint32_t> m_Meshes;     ///< Mesh name per entity
+        std::span<const uint32_t> m_Materials;  ///< Material name per entity
+        std::span<const uint8_t> m_Flags;       ///< SceneEntityFlags per entity
+        std::span<const PointLight> m_Lights;   ///< Lights of the scene
+        std::vector<std::string_view>
+            m_MeshNames;  ///< Mesh name table, into the string table
+        std::vector<std::string_view>
+            m_MaterialNames;  ///< Material name table
+
+    public:
+        /**
+         * @brief Map a scene file, closing the current one first.
+         *
+         * @param path File written by Write()
+         * @return false if the file cannot be mapped, has another version or
+         * is malformed
+         */
+        bool Open(const std::filesystem::path& path);
+
+        /**
+         * @brief Unmap the file; views from it become invalid.
+         */
+        void Close();
+
+        /**
+         * @brief Check whether a scene file is open.
+         * @return true between a successful Open() and Close()
+         */
+        bool IsOpen() const { return m_Header != nullptr; }
+
+        /**
+         * @brief Get the number of entities in the file.
+         * @return Entities, 0 when closed
+         */
+        size_t GetEntityCount() const { return m_Parents.size(); }
+
+        /**
+         * @brief Get the mesh names the file refers to.
+         * @return Names, pointing into the mapping
+         */
+        const std::vector<std::string_view>& GetMeshNames() const {
+            return m_MeshNames;
+        }
+
+        /**
+         * @brief Get the material names the file refers to.
+         * @return Names, pointing into the mapping
+         */
+        const std::vector<std::string_view>& GetMaterialNames() const {
+            return m_MaterialNames;
+        }
+
+        /**
+         * @brief Add the file's entities and lights to a scene.
+         *
+         * Entities get their transform, parent, bounds and static flag, and
+         * the mesh and material registered under their names. Names missing
+         * from resources are reported and leave the entities without that
+         * mesh or material.
+         *
+         * @param scene Scene to add to; its existing entities are kept
+         * @param resources Meshes and materials by name
+         * @param entities Receives the new entities in file order, if given
+         * @return false if no file is open
+         */
+        bool Instantiate(Scene& scene, const SceneResources& resources,
+                         std::vector<EntityID>* entities = nullptr) const;
+
+        /**
+         * @brief Save a scene's entities and lights.
+         *
+         * Entities are stored in the order of their transforms. Meshes and
+         * materials are stored by their names in resources; ones that were
+         * not registered are reported and dropped.
+         *
+         * @param scene Scene to save
+         * @param path File to write, replaced if it exists
+         * @param resources Names of the scene's meshes and materials
+         * @return false if the file cannot be written
+         */
+        static bool Write(Scene& scene, const std::filesystem::path& path,
+                          const SceneResources& resources);
+};
+
+}  // namespace Obelisk
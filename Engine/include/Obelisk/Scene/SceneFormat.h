@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Obelisk {
+
+/**
+ * @brief File layout of scenes written by SceneFile::Write().
+ *
+ * A `.oscene` file is a SceneFileHeader followed by sections, each starting
+ * at a multiple of SCENE_FILE_ALIGNMENT. Entities are numbered 0 to
+ * EntityCount - 1 and every per-entity section is an array in that order,
+ * laid out like the Scene's own component storage so that loading is a
+ * block copy:
+ * - Transforms: TransformStorage::ChannelCount arrays of EntityCount
+ *   floats, in TransformStorage::Channel order, relative to the parent.
+ * - Parents: uint32_t entity number of each parent, or SCENE_NO_INDEX.
+ * - Bounds: LocalBounds of each entity.
+ * - Meshes, Materials: uint32_t index into the mesh or material name table,
+ *   or SCENE_NO_INDEX.
+ * - Flags: uint8_t SceneEntityFlags of each entity.
+ * - MeshNames, MaterialNames: uint32_t offset of each name in Strings.
+ * - Lights: LightCount PointLight structs.
+ * - Strings: null-terminated UTF-8 names, the string table.
+ *
+ * Section offsets are relative to the start of the file and are resolved
+ * into pointers when the file is opened, so the mapped file is used in
+ * place. Meshes and materials are referenced by name; the application
+ * resolves the names to its own resources (see SceneResources).
+ *
+ * All values are little-endian. Loaders reject files whose version does not
+ * match, so stale scenes are rewritten rather than misread.
+ */
+constexpr uint32_t SCENE_FILE_MAGIC = 0x4E43534F;  // "OSCN"
+constexpr uint32_t SCENE_FILE_VERSION = 1;
+constexpr uint32_t SCENE_NO_INDEX = ~0u;     ///< No parent, mesh or material
+constexpr size_t SCENE_FILE_ALIGNMENT = 16;  ///< Section offset multiple
+
+constexpr const char* SCENE_FILE_EXTENSION = ".oscene";
+
+/**
+ * @brief Per-entity flag bits.
+ *
+ * Values are part of the file format: append new flags, never reorder.
+ */
+enum SceneEntityFlags : uint8_t {
+    SCENE_ENTITY_STATIC = 1 << 0,  ///< Entity has a StaticTag
+};
+
+/**
+ * @brief Location of one section in a scene file.
+ */
+struct SceneFileSection {
+        uint64_t Offset;  ///< Bytes from the start of the file
+        uint64_t Size;    ///< Bytes in the section
+};
+
+/**
+ * @brief Header at the start of a scene file.
+ */
+struct SceneFileHeader {
+        uint32_t Magic;                  ///< SCENE_FILE_MAGIC
+        uint32_t Version;                ///< SCENE_FILE_VERSION
+        uint32_t EntityCount;            ///< Entities in the scene
+        uint32_t MeshCount;              ///< Entries of the mesh name table
+        uint32_t MaterialCount;          ///< Entries of the material table
+        uint32_t LightCount;             ///< Point lights
+        SceneFileSection Transforms;     ///< Channel-major float arrays
+        SceneFileSection Parents;        ///< Parent entity numbers
+        SceneFileSection Bounds;         ///< LocalBounds of each entity
+        SceneFileSection Meshes;         ///< Mesh name index of each entity
+        SceneFileSection Materials;      ///< Material name index
+        SceneFileSection Flags;          ///< SceneEntityFlags of each entity
+        SceneFileSection MeshNames;      ///< String offset of each mesh name
+        SceneFileSection MaterialNames;  ///< String offset of each material
+        SceneFileSection Lights;         ///< PointLight structs
+        SceneFileSection Strings;        ///< Null-terminated names
+};
+
+}  // namespace Obelisk
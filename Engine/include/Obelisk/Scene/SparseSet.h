@@ -0,0 +1,255 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include <limits>
+#include <span>
+
+namespace Obelisk {
+
+/**
+ * @brief Generational identifier of an entity in a Registry.
+ *
+ * The index addresses the entity's slot in the registry and its component
+ * pools. The generation counts how often that slot has been reused, so an ID
+ * kept after its entity was destroyed never matches the slot's next owner.
+ */
+struct EntityID {
+        static constexpr uint32_t INVALID_INDEX =
+            std::numeric_limits<uint32_t>::max();  ///< Index of null IDs
+
+        uint32_t Index = INVALID_INDEX;  ///< Slot in the registry
+        uint32_t Generation = 0;         ///< Times the slot was reused
+
+        /**
+         * @brief Check whether the ID was never assigned an entity.
+         * @return true for default-constructed IDs
+         */
+        bool IsNull() const { return Index == INVALID_INDEX; }
+
+        bool operator==(const EntityID& other) const = default;
+};
+
+/**
+ * @brief Set of entities, stored densely with an index from entity slots.
+ *
+ * The sparse array maps an entity's index to its position in the dense
+ * array, which lists the members contiguously. Membership tests and lookups
+ * are one array access each, and removal swaps the last member into the
+ * hole, so the dense array never has gaps.
+ */
+class OBELISK_API SparseSet {
+    protected:
+        static constexpr uint32_t NO_SLOT =
+            std::numeric_limits<uint32_t>::max();  ///< Sparse non-member entry
+
+        std::vector<uint32_t> m_Sparse;  ///< Entity index to dense slot
+        std::vector<EntityID> m_Dense;   ///< Member in each dense slot
+
+    public:
+        virtual ~SparseSet() = default;
+
+        /**
+         * @brief Check whether an entity is a member.
+         *
+         * @param id Entity to look up; stale IDs are never members
+         * @return true if the entity is in the set
+         */
+        bool Has(EntityID id) const {
+            return id.Index < m_Sparse.size() &&
+                   m_Sparse[id.Index] != NO_SLOT &&
+                   m_Dense[m_Sparse[id.Index]] == id;
+        }
+
+        /**
+         * @brief Get the number of members.
+         * @return Size of the dense array
+         */
+        size_t Size() const { return m_Dense.size(); }
+
+        /**
+         * @brief Get a member's dense slot.
+         *
+         * @param id Entity that must be a member
+         * @return Its position in GetEntities() and the component arrays
+         */
+        uint32_t GetSlot(EntityID id) const { return m_Sparse[id.Index]; }
+
+        /**
+         * @brief Get the members in dense order.
+         * @return Entities, invalidated by insertion and removal
+         */
+        const std::vector<EntityID>& GetEntities() const { return m_Dense; }
+
+        /**
+         * @brief Remove an entity, if it is a member.
+         *
+         * @param id Entity to remove
+         */
+        virtual void Remove(EntityID id) = 0;
+
+        /**
+         * @brief Remove every member.
+         */
+        virtual void Clear() = 0;
+
+    protected:
+        /**
+         * @brief Append a non-member to the dense array.
+         *
+         * @param id Entity to add
+         * @return Its dense slot
+         */
+        uint32_t Insert(EntityID id) {
+            if (id.Index >= m_Sparse.size()) {
+                m_Sparse.resize(id.Index + 1, NO_SLOT);
+            }
+            m_Sparse[id.Index] = static_cast<uint32_t>(m_Dense.size());
+            m_Dense.push_back(id);
+            return m_Sparse[id.Index];
+        }
+
+        /**
+         * @brief Append many non-members to the dense array at once.
+         *
+         * @param ids Entities to add, none of them members
+         */
+        void InsertRange(std::span<const EntityID> ids) {
+            uint32_t end = 0;
+            for (EntityID id : ids) {
+                end = std::max(end, id.Index + 1);
+            }
+            if (end > m_Sparse.size()) {
+                m_Sparse.resize(end, NO_SLOT);
+            }
+
+            auto slot = static_cast<uint32_t>(m_Dense.size());
+            for (EntityID id : ids) {
+                m_Sparse[id.Index] = slot++;
+            }
+            m_Dense.insert(m_Dense.end(), ids.begin(), ids.end());
+        }
+
+        /**
+         * @brief Remove a member by moving the last member into its slot.
+         *
+         * @param id Member to remove
+         * @return The slot it occupied, which now holds the former last member
+         * (or is gone, if it was the last)
+         */
+        uint32_t Erase(EntityID id) {
+            uint32_t slot = m_Sparse[id.Index];
+            EntityID last = m_Dense.back();
+            m_Dense[slot] = last;
+            m_Sparse[last.Index] = slot;
+            m_Dense.pop_back();
+            m_Sparse[id.Index] = NO_SLOT;
+            return slot;
+        }
+};
+
+/**
+ * @brief Packed array of one component type.
+ *
+ * Components sit in the same order as the dense entity array, so iterating
+ * GetComponents() walks memory linearly. Adding or removing components may
+ * move the others; references from Get() are only valid until then.
+ */
+template <typename T>
+class ComponentPool : public SparseSet {
+    private:
+        std::vector<T> m_Components;  ///< Component of each dense slot
+
+    public:
+        /**
+         * @brief Add a component, or replace the entity's existing one.
+         *
+         * @param id Entity to add the component to
+         * @param args Arguments for the component's brace initializer
+         * @return The stored component
+         */
+        template <typename... Args>
+        T& Emplace(EntityID id, Args&&... args) {
+            if (Has(id)) {
+                T& component = m_Components[m_Sparse[id.Index]];
+                component = T{std::forward<Args>(args)...};
+                return component;
+            }
+            Insert(id);
+            return m_Components.emplace_back(T{std::forward<Args>(args)...});
+        }
+
+        /**
+         * @brief Add components to many entities at once.
+         *
+         * @param ids Entities to add, none of them members
+         * @param components Component of each entity, copied as a block
+         */
+        void Append(std::span<const EntityID> ids,
+                    std::span<const T> components) {
+            InsertRange(ids);
+            m_Components.insert(m_Components.end(), components.begin(),
+                                components.end());
+        }
+
+        void Remove(EntityID id) override {
+            if (!Has(id)) {
+                return;
+            }
+            uint32_t slot = Erase(id);
+            if (slot != m_Components.size() - 1) {
+                m_Components[slot] = std::move(m_Components.back());
+            }
+            m_Components.pop_back();
+        }
+
+        void Clear() override {
+            m_Sparse.clear();
+            m_Dense.clear();
+            m_Components.clear();
+        }
+
+        /**
+         * @brief Get a member's component.
+         *
+         * @param id Entity that must be a member
+         * @return Its component
+         */
+        T& Get(EntityID id) { return m_Components[m_Sparse[id.Index]]; }
+
+        /**
+         * @brief Get a member's component, read-only.
+         *
+         * @param id Entity that must be a member
+         * @return Its component
+         */
+        const T& Get(EntityID id) const {
+            return m_Components[m_Sparse[id.Index]];
+        }
+
+        /**
+         * @brief Get an entity's component, if it has one.
+         *
+         * @param id Entity to look up
+         * @return Its component, or nullptr
+         */
+        T* TryGet(EntityID id) { return Has(id) ? &Get(id) : nullptr; }
+
+        /**
+         * @brief Get the components in dense order, matching GetEntities().
+         * @return Packed components
+         */
+        std::vector<T>& GetComponents() { return m_Components; }
+};
+
+/**
+ * @brief Selects the pool class a Registry stores a component type in.
+ *
+ * Components default to a ComponentPool. Specialize it, next to the storage
+ * class, to give a component a custom layout; see TransformStorage.
+ */
+template <typename T>
+struct ComponentStorage {
+        using Type = ComponentPool<T>;  ///< Pool class for T
+};
+
+}  // namespace Obelisk
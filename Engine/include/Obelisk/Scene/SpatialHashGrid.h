@@ -0,0 +1,293 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include <span>
+#include "Obelisk/Core/Bounds.h"
+
+namespace Obelisk {
+
+/**
+ * @brief Uniform grid over points, rebuilt from scratch every frame.
+ *
+ * Meant for scenes where most things move every frame (bullets, particles,
+ * crowds), where refitting a tree would touch every node anyway. Build()
+ * counting-sorts the points by cell in linear time on the JobSystem:
+ * - each point claims and counts its cell in an open-addressed table,
+ * - a prefix sum over the table gives every cell its range,
+ * - each point is scattered into its cell's range.
+ *
+ * Jobs own slices of the table rather than ranges of points, so they never
+ * write the same cell and need no atomics, which would serialize the cache
+ * misses that dominate the build.
+ *
+ * The points of a cell end up contiguous and in input order, with their
+ * positions copied next to their indices, so queries read short runs of
+ * memory and never allocate. Items are the points' indices in the array
+ * given to Build().
+ *
+ * Queries visit every cell their bounds touch, so they are meant for radii
+ * of a few cells; boxes touching more cells than the table has slots walk
+ * the table instead. Cell coordinates wrap every 2^21 cells per axis and
+ * are clamped to +-2^30.
+ *
+ * @example
+ * ```cpp
+ * SpatialHashGrid grid(2.0f);
+ * grid.Build(positions);  // once per frame
+ *
+ * uint32_t buffer[64];
+ * for (uint32_t index : grid.QueryRadius(position, 1.5f, buffer)) {
+ *     Collide(bullets[index]);
+ * }
+ * ```
+ */
+class OBELISK_API SpatialHashGrid {
+    public:
+        static constexpr float DEFAULT_CELL_SIZE =
+            2.0f;  ///< Default cell edge length in world units
+        static constexpr size_t PARALLEL_BATCH =
+            16384;  ///< Points or table slots per JobSystem batch
+
+    private:
+        static constexpr uint64_t EMPTY_KEY = ~0ull;  ///< Unclaimed slot
+        static constexpr uint32_t KEY_BITS = 21;      ///< Bits per axis
+        static constexpr uint32_t NO_LIMIT = ~0u;     ///< Probe anywhere
+        static constexpr float MAX_CELL =
+            1 << 30;  ///< Largest cell coordinate, so it converts to int
+
+        /**
+         * @brief A slot of the cell table.
+         */
+        struct Cell {
+                uint64_t Key = EMPTY_KEY;  ///< Packed cell coordinates
+                uint32_t Begin = 0;        ///< First item of the cell
+                uint32_t Count = 0;        ///< Items in the cell
+        };
+
+        /**
+         * @brief A point and the table slot of its cell.
+         */
+        struct Placement {
+                uint32_t Point;  ///< Index of the point
+                uint32_t Slot;   ///< Slot of its cell, or its home slot
+        };
+
+        float m_CellSize;                   ///< Cell edge length
+        float m_InverseCellSize;            ///< 1 / m_CellSize
+        std::vector<Cell> m_Cells;          ///< Open-addressed cell table
+        uint32_t m_Shift = 64;              ///< 64 - log2(table size)
+        std::vector<uint32_t> m_Items;      ///< Point indices, by cell
+        std::vector<glm::vec3> m_Points;    ///< Positions, matching m_Items
+        std::vector<uint32_t> m_Homes;      ///< Home slot of each point
+        std::vector<uint32_t> m_BlockSums;  ///< Prefix sum scratch space
+        std::vector<uint32_t>
+            m_SliceCounts;  ///< Points per batch and slice, then cursors
+        std::vector<uint32_t>
+            m_SliceStarts;  ///< First entry of each slice in m_SlicePoints
+        std::vector<uint32_t>
+            m_SlicePoints;  ///< Point indices, by home slot slice
+        std::vector<std::vector<Placement>>
+            m_Placements;  ///< Points placed by each job
+        std::vector<std::vector<Placement>>
+            m_Overflow;  ///< Points probing past their job's slice, by job
+
+    public:
+        /**
+         * @brief Create an empty grid.
+         *
+         * @param cellSize Cell edge length; around the usual query radius
+         * works best
+         */
+        explicit SpatialHashGrid(float cellSize = DEFAULT_CELL_SIZE)
+            : m_CellSize(cellSize), m_InverseCellSize(1.0f / cellSize) {}
+
+        /**
+         * @brief Replace the contents with a set of points.
+         *
+         * @param points Positions; item i is points[i]
+         */
+        void Build(std::span<const glm::vec3> points);
+
+        /**
+         * @brief Remove every point, keeping the memory.
+         */
+        void Clear();
+
+        /**
+         * @brief Get the cell edge length.
+         * @return Edge length in world units
+         */
+        float GetCellSize() const { return m_CellSize; }
+
+        /**
+         * @brief Get the number of points.
+         * @return Points given to the last Build()
+         */
+        size_t GetCount() const { return m_Items.size(); }
+
+        /**
+         * @brief Get the cell containing a position.
+         *
+         * @param position World-space position
+         * @return Integer cell coordinates, clamped to +-2^30
+         */
+        glm::ivec3 GetCell(const glm::vec3& position) const {
+            glm::vec3 cell = glm::floor(position * m_InverseCellSize);
+            return glm::ivec3(glm::clamp(cell, glm::vec3(-MAX_CELL),
+                                         glm::vec3(MAX_CELL)));
+        }
+
+        /**
+         * @brief Get the number of cells a box touches.
+         *
+         * @param box World-space box
+         * @return Cell count, saturating at UINT64_MAX; 0 for an empty box
+         */
+        uint64_t CountCells(const AABB& box) const;
+
+        /**
+         * @brief Get the points in a cell.
+         *
+         * @param cell Cell coordinates
+         * @return Their indices, empty if the cell has none
+         */
+        std::span<const uint32_t> GetCellItems(const glm::ivec3& cell) const {
+            const Cell* found = FindCell(cell);
+            if (!found) {
+                return {};
+            }
+            return {m_Items.data() + found->Begin, found->Count};
+        }
+
+        /**
+         * @brief Visit the non-empty cells a box touches.
+         *
+         * Cells are looked up one by one, or found by walking the table when
+         * the box touches more cells than it has slots.
+         *
+         * @param box World-space box
+         * @param func Called as func(std::span<const uint32_t> items,
+         * std::span<const glm::vec3> positions) once per cell
+         */
+        template <typename Func>
+        void ForEachCell(const AABB& box, Func&& func) const {
+            if (m_Items.empty()) {
+                return;
+            }
+
+            glm::ivec3 first = GetCell(box.Min);
+            glm::ivec3 last = GetCell(box.Max);
+            auto visit = [&](const Cell& cell) {
+                func(std::span<const uint32_t>(m_Items.data() + cell.Begin,
+                                               cell.Count),
+                     std::span<const glm::vec3>(m_Points.data() + cell.Begin,
+                                                cell.Count));
+            };
+
+            if (CountCells(box) > m_Cells.size()) {
+                for (const Cell& cell : m_Cells) {
+                    if (cell.Key != EMPTY_KEY &&
+                        IsKeyInRange(cell.Key, first, last)) {
+                        visit(cell);
+                    }
+                }
+                return;
+            }
+
+            for (int z = first.z; z <= last.z; z++) {
+                for (int y = first.y; y <= last.y; y++) {
+                    for (int x = first.x; x <= last.x; x++) {
+                        const Cell* cell = FindCell(glm::ivec3(x, y, z));
+                        if (cell) {
+                            visit(*cell);
+                        }
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Visit the points within a distance of a position.
+         *
+         * @param center World-space position
+         * @param radius Distance in world units
+         * @param func Called as func(uint32_t index)
+         */
+        template <typename Func>
+        void ForEachInRadius(const glm::vec3& center, float radius,
+                             Func&& func) const {
+            float radiusSquared = radius * radius;
+            ForEachCell(AABB::FromCenterExtents(center, glm::vec3(radius)),
+                        [&](std::span<const uint32_t> items,
+                            std::span<const glm::vec3> positions) {
+                            for (size_t i = 0; i < items.size(); i++) {
+                                glm::vec3 offset = positions[i] - center;
+                                if (glm::dot(offset, offset) <=
+                                    radiusSquared) {
+                                    func(items[i]);
+                                }
+                            }
+                        });
+        }
+
+        /**
+         * @brief Find the points within a distance of a position.
+         *
+         * @param center World-space position
+         * @param radius Distance in world units
+         * @param results Buffer for the indices
+         * @return The filled part of results; points past its size are
+         * dropped
+         */
+        std::span<uint32_t> QueryRadius(const glm::vec3& center,
+                                        float radius,
+                                        std::span<uint32_t> results) const;
+
+    private:
+        /**
+         * @brief Pack cell coordinates into a table key.
+         */
+        static uint64_t MakeKey(const glm::ivec3& cell) {
+            constexpr uint64_t mask = (1ull << KEY_BITS) - 1;
+            return (static_cast<uint64_t>(cell.x) & mask) |
+                   (static_cast<uint64_t>(cell.y) & mask) << KEY_BITS |
+                   (static_cast<uint64_t>(cell.z) & mask) << (2 * KEY_BITS);
+        }
+
+        /**
+         * @brief Check whether a key's cell is in a range of cells.
+         *
+         * Compares the wrapped coordinates, so it matches what looking up
+         * every cell of the range would find.
+         */
+        static bool IsKeyInRange(uint64_t key, const glm::ivec3& first,
+                                 const glm::ivec3& last);
+
+        /**
+         * @brief Get the table slot a key's probe sequence starts at.
+         */
+        uint32_t GetHome(uint64_t key) const {
+            // Fibonacci hashing spreads neighboring cells over the table
+            return static_cast<uint32_t>((key * 0x9E3779B97F4A7C15ull) >>
+                                         m_Shift);
+        }
+
+        /**
+         * @brief Look up a cell in the table.
+         *
+         * @return The cell, or nullptr if no point is in it
+         */
+        const Cell* FindCell(const glm::ivec3& cell) const;
+
+        /**
+         * @brief Find a key's slot, claiming an empty one if it has none.
+         *
+         * @param key Packed cell coordinates
+         * @param home GetHome(key)
+         * @param end Slot to stop probing at, or NO_LIMIT
+         * @return Table slot of the key, or end if the probe reached it
+         */
+        uint32_t ClaimCell(uint64_t key, uint32_t home, uint32_t end);
+};
+
+}  // namespace Obelisk
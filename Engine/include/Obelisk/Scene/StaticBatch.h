@@ -0,0 +1,67 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include "Obelisk/Core/Bounds.h"
+#include "Obelisk/Renderer/Material.h"
+#include "Obelisk/Renderer/Mesh.h"
+
+namespace Obelisk {
+
+class Entity;
+
+/**
+ * @brief Geometry of several static entities merged into one mesh.
+ *
+ * Static batching trades memory for draw calls: entities that never move and
+ * share a material are pre-transformed into world space and concatenated
+ * into a single vertex/index buffer, which is then drawn with an identity
+ * model matrix in one call.
+ *
+ * Merging a whole level into one mesh per material would defeat culling, so
+ * entities are first grouped into cubic chunks of the world by the center of
+ * their bounds. Each (material, chunk) pair becomes one batch with its own
+ * bounds, split further when it exceeds MAX_VERTICES.
+ *
+ * Built by Scene::Finalize(); see Entity::SetStatic().
+ *
+ * @example
+ * ```cpp
+ * std::vector<Entity> entities = {scene.CreateEntity(mesh, material)};
+ * entities[0].SetStatic(true);
+ * auto batches = StaticBatch::Build(entities, 32.0f);
+ * for (const StaticBatch& batch : batches) {
+ *     if (frustum.Intersects(batch.Bounds)) {
+ *         Renderer::Submit(*batch.BatchMesh, *batch.BatchMaterial,
+ *                          glm::mat4(1.0f));
+ *     }
+ * }
+ * ```
+ */
+struct OBELISK_API StaticBatch {
+        static constexpr float DEFAULT_CHUNK_SIZE =
+            32.0f;  ///< World units per chunk edge
+        static constexpr size_t MAX_VERTICES =
+            1 << 16;  ///< Vertices per batch before it is split
+
+        std::unique_ptr<Mesh> BatchMesh;  ///< Merged world-space geometry
+        std::shared_ptr<Material> BatchMaterial;  ///< Shared material
+        AABB Bounds;             ///< World-space bounds of the batch
+        size_t EntityCount = 0;  ///< Entities merged into this batch
+
+        /**
+         * @brief Merge the static entities of a list into batches.
+         *
+         * Entities that are not static, or lack a mesh or material, are
+         * ignored. Their transforms are baked in, so later changes have no
+         * effect on the batches.
+         *
+         * @param entities Entities to consider
+         * @param chunkSize Edge length of the spatial chunks in world units
+         * @return One batch per material and chunk (more for large chunks)
+         */
+        static std::vector<StaticBatch> Build(
+            const std::vector<Entity>& entities,
+            float chunkSize = DEFAULT_CHUNK_SIZE);
+};
+
+}  // namespace Obelisk
@@ -0,0 +1,543 @@
+#include "Obelisk/Components/TransformStorage.h"
+#include <algorithm>
+#include "Obelisk/Core/JobSystem.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define OBELISK_TRANSFORM_AVX2 1
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define OBELISK_TRANSFORM_SSE2 1
+#endif
+
+namespace Obelisk {
+
+namespace {
+#if OBELISK_TRANSFORM_SSE2
+/**
+ * @brief Store one matrix column of four entities.
+ *
+ * Each input holds one row of the column for the four entities; the
+ * transpose turns them into one column per entity.
+ */
+inline void StoreColumn4(__m128 x, __m128 y, __m128 z, __m128 w,
+                         float* const matrices[4], int column) {
+    _MM_TRANSPOSE4_PS(x, y, z, w);
+    _mm_storeu_ps(matrices[0] + column * 4, x);
+    _mm_storeu_ps(matrices[1] + column * 4, y);
+    _mm_storeu_ps(matrices[2] + column * 4, z);
+    _mm_storeu_ps(matrices[3] + column * 4, w);
+}
+#endif
+}  // namespace
+
+TransformRef TransformStorage::Emplace(EntityID id) {
+    return Emplace(id, Transform());
+}
+
+TransformRef TransformStorage::Emplace(EntityID id,
+                                       const Transform& transform) {
+    if (!Has(id)) {
+        Insert(id);
+        for (std::vector<float>& channel : m_Channels) {
+            channel.push_back(0.0f);
+        }
+        m_Matrices.emplace_back(1.0f);
+        m_Dirty.push_back(0);
+        m_Moved.push_back(0);
+    }
+
+    uint32_t slot = GetSlot(id);
+    SetPosition(slot, transform.GetPosition());
+    SetRotation(slot, transform.GetRotationQuat());
+    SetScale(slot, transform.GetScale());
+    return TransformRef(this, slot);
+}
+
+void TransformStorage::Append(std::span<const EntityID> ids,
+                              std::span<const float> channels) {
+    auto first = static_cast<uint32_t>(m_Dense.size());
+    size_t count = ids.size();
+    InsertRange(ids);
+    for (uint32_t channel = 0; channel < ChannelCount; channel++) {
+        const float* values = channels.data() + channel * count;
+        m_Channels[channel].insert(m_Channels[channel].end(), values,
+                                   values + count);
+    }
+    m_Matrices.resize(m_Dense.size(), glm::mat4(1.0f));
+    m_Dirty.resize(m_Dense.size(), 1);
+    m_Moved.resize(m_Dense.size(), 1);
+    for (uint32_t slot = first; slot < m_Dense.size(); slot++) {
+        m_DirtySlots.push_back(slot);
+    }
+    m_MovedIDs.insert(m_MovedIDs.end(), ids.begin(), ids.end());
+}
+
+void TransformStorage::Remove(EntityID id) {
+    if (!Has(id)) {
+        return;
+    }
+
+    if (uint32_t node = GetNode(id); node != NO_SLOT) {
+        RemoveNode(node);
+    }
+
+    uint32_t slot = Erase(id);
+    auto last = static_cast<uint32_t>(m_Dense.size());
+    if (slot != last) {
+        for (std::vector<float>& channel : m_Channels) {
+            channel[slot] = channel[last];
+        }
+        m_Matrices[slot] = m_Matrices[last];
+
+        // The dirty list may still name the old slot; entries past the end
+        // are skipped by UpdateMatrices()
+        bool listed = m_Dirty[slot];
+        m_Dirty[slot] = m_Dirty[last];
+        if (m_Dirty[slot] && !listed) {
+            m_DirtySlots.push_back(slot);
+        }
+        m_Moved[slot] = m_Moved[last];
+    }
+
+    for (std::vector<float>& channel : m_Channels) {
+        channel.pop_back();
+    }
+    m_Matrices.pop_back();
+    m_Dirty.pop_back();
+    m_Moved.pop_back();
+}
+
+void TransformStorage::Clear() {
+    m_Sparse.clear();
+    m_Dense.clear();
+    for (std::vector<float>& channel : m_Channels) {
+        channel.clear();
+    }
+    m_Matrices.clear();
+    m_Dirty.clear();
+    m_DirtySlots.clear();
+    m_Moved.clear();
+    m_MovedIDs.clear();
+    m_Nodes.clear();
+    m_NodeOf.clear();
+}
+
+void TransformStorage::SetPosition(uint32_t slot, const glm::vec3& position) {
+    m_Channels[PositionX][slot] = position.x;
+    m_Channels[PositionY][slot] = position.y;
+    m_Channels[PositionZ][slot] = position.z;
+    MarkDirty(slot);
+}
+
+void TransformStorage::SetRotation(uint32_t slot, const glm::quat& rotation) {
+    m_Channels[RotationX][slot] = rotation.x;
+    m_Channels[RotationY][slot] = rotation.y;
+    m_Channels[RotationZ][slot] = rotation.z;
+    m_Channels[RotationW][slot] = rotation.w;
+    MarkDirty(slot);
+}
+
+void TransformStorage::SetScale(uint32_t slot, const glm::vec3& scale) {
+    m_Channels[ScaleX][slot] = scale.x;
+    m_Channels[ScaleY][slot] = scale.y;
+    m_Channels[ScaleZ][slot] = scale.z;
+    MarkDirty(slot);
+}
+
+const glm::mat4& TransformStorage::GetMatrix(uint32_t slot) {
+    if (!m_DirtySlots.empty() && GetNode(m_Dense[slot]) != NO_SLOT) {
+        // World matrices in the hierarchy depend on every ancestor
+        UpdateMatrices();
+    } else if (m_Dirty[slot]) {
+        // Its dirty list entry goes stale and is skipped later
+        ComposeScalar(slot);
+        m_Dirty[slot] = 0;
+    }
+    return m_Matrices[slot];
+}
+
+size_t TransformStorage::UpdateMatrices() {
+    if (m_DirtySlots.empty()) {
+        return 0;
+    }
+
+    // Drop entries for removed slots and slots GetMatrix() already composed,
+    // along with duplicates. Hierarchy members queue their root.
+    size_t count = 0;
+    for (uint32_t slot : m_DirtySlots) {
+        if (slot >= m_Dense.size() || !m_Dirty[slot]) {
+            continue;
+        }
+        m_Dirty[slot] = 0;
+        m_DirtySlots[count++] = slot;
+
+        if (uint32_t node = GetNode(m_Dense[slot]); node != NO_SLOT) {
+            m_Nodes[node].LocalChanged = true;
+            HierarchyNode& root = m_Nodes[m_Nodes[node].Root];
+            if (!root.Queued) {
+                root.Queued = true;
+                m_DirtyRoots.push_back(m_Nodes[node].Root);
+            }
+        }
+    }
+    m_DirtySlots.resize(count);
+
+    JobSystem::ParallelFor(count, PARALLEL_BATCH,
+                           [this](size_t begin, size_t end) {
+                               ComposeSlots(m_DirtySlots.data() + begin,
+                                            end - begin);
+                           });
+
+    JobSystem::ParallelFor(m_DirtyRoots.size(), SUBTREE_BATCH,
+                           [this](size_t begin, size_t end) {
+                               for (size_t i = begin; i < end; i++) {
+                                   PropagateSubtree(m_DirtyRoots[i]);
+                               }
+                           });
+
+    // Children moved along with their ancestors
+    for (uint32_t root : m_DirtyRoots) {
+        uint32_t end = root + m_Nodes[root].SubtreeSize;
+        for (uint32_t i = root; i < end; i++) {
+            if (m_Nodes[i].WorldChanged) {
+                MarkMoved(GetSlot(m_Nodes[i].Entity));
+            }
+        }
+    }
+
+    m_DirtySlots.clear();
+    m_DirtyRoots.clear();
+    return count;
+}
+
+void TransformStorage::ConsumeMoved(std::vector<EntityID>& moved) {
+    moved.clear();
+    moved.swap(m_MovedIDs);
+    for (EntityID id : moved) {
+        if (Has(id)) {
+            m_Moved[GetSlot(id)] = 0;
+        }
+    }
+}
+
+bool TransformStorage::SetParent(EntityID child, EntityID parent) {
+    if (!Has(child) || (!parent.IsNull() && !Has(parent))) {
+        LOG_ERROR("Can't parent transforms of entities without one!");
+        return false;
+    }
+
+    uint32_t node = AddNode(child);
+    uint32_t parentNode = parent.IsNull() ? NO_SLOT : AddNode(parent);
+    uint32_t size = m_Nodes[node].SubtreeSize;
+    if (parentNode != NO_SLOT && parentNode >= node &&
+        parentNode < node + size) {
+        LOG_ERROR("Can't parent a transform to itself or a descendant!");
+        return false;
+    }
+    if (m_Nodes[node].ParentEntity == parent) {
+        return true;
+    }
+
+    // Subtree sizes travel with the nodes, so fix them before moving
+    for (uint32_t i = m_Nodes[node].Parent; i != NO_SLOT;
+         i = m_Nodes[i].Parent) {
+        m_Nodes[i].SubtreeSize -= size;
+    }
+    for (uint32_t i = parentNode; i != NO_SLOT; i = m_Nodes[i].Parent) {
+        m_Nodes[i].SubtreeSize += size;
+    }
+    m_Nodes[node].ParentEntity = parent;
+
+    // Move the subtree to the end of the parent's subtree, or to the end of
+    // the array for new roots. Positions are counted as if the subtree was
+    // already taken out.
+    auto insert = static_cast<uint32_t>(m_Nodes.size()) - size;
+    if (parentNode != NO_SLOT) {
+        uint32_t parentIndex =
+            parentNode > node ? parentNode - size : parentNode;
+        insert = parentIndex + m_Nodes[parentNode].SubtreeSize - size;
+    }
+    auto first = m_Nodes.begin() + node;
+    auto last = first + size;
+    if (insert > node) {
+        std::rotate(first, last, m_Nodes.begin() + insert + size);
+    } else if (insert < node) {
+        std::rotate(m_Nodes.begin() + insert, first, last);
+    }
+    RebuildHierarchy(std::min(node, insert));
+
+    MarkDirty(GetSlot(child));
+    return true;
+}
+
+EntityID TransformStorage::GetParent(EntityID id) const {
+    uint32_t node = GetNode(id);
+    return node == NO_SLOT ? EntityID() : m_Nodes[node].ParentEntity;
+}
+
+std::vector<EntityID> TransformStorage::GetDescendants(EntityID id) const {
+    std::vector<EntityID> descendants;
+    uint32_t node = GetNode(id);
+    if (node == NO_SLOT) {
+        return descendants;
+    }
+
+    uint32_t end = node + m_Nodes[node].SubtreeSize;
+    for (uint32_t i = node + 1; i < end; i++) {
+        descendants.push_back(m_Nodes[i].Entity);
+    }
+    return descendants;
+}
+
+const char* TransformStorage::GetKernelName() {
+#if OBELISK_TRANSFORM_AVX2
+    return "AVX2";
+#elif OBELISK_TRANSFORM_SSE2
+    return "SSE2";
+#else
+    return "Scalar";
+#endif
+}
+
+void TransformStorage::ComposeSlots(const uint32_t* slots, size_t count) {
+    const float* px = m_Channels[PositionX].data();
+    const float* py = m_Channels[PositionY].data();
+    const float* pz = m_Channels[PositionZ].data();
+    const float* qx = m_Channels[RotationX].data();
+    const float* qy = m_Channels[RotationY].data();
+    const float* qz = m_Channels[RotationZ].data();
+    const float* qw = m_Channels[RotationW].data();
+    const float* sx = m_Channels[ScaleX].data();
+    const float* sy = m_Channels[ScaleY].data();
+    const float* sz = m_Channels[ScaleZ].data();
+    size_t i = 0;
+
+    // Both kernels evaluate the rotation matrix of a unit quaternion with
+    // each column scaled, which is T * R * S without the multiplies:
+    //   | (1 - 2(yy + zz))sx  2(xy - wz)sy        2(xz + wy)sz        tx |
+    //   | 2(xy + wz)sx        (1 - 2(xx + zz))sy  2(yz - wx)sz        ty |
+    //   | 2(xz - wy)sx        2(yz + wx)sy        (1 - 2(xx + yy))sz  tz |
+#if OBELISK_TRANSFORM_AVX2
+    const __m256 one8 = _mm256_set1_ps(1.0f);
+    for (; i + 8 <= count; i += 8) {
+        __m256i index =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(slots + i));
+        __m256 x = _mm256_i32gather_ps(qx, index, 4);
+        __m256 y = _mm256_i32gather_ps(qy, index, 4);
+        __m256 z = _mm256_i32gather_ps(qz, index, 4);
+        __m256 w = _mm256_i32gather_ps(qw, index, 4);
+        __m256 x2 = _mm256_add_ps(x, x);
+        __m256 y2 = _mm256_add_ps(y, y);
+        __m256 z2 = _mm256_add_ps(z, z);
+        __m256 xx = _mm256_mul_ps(x, x2);
+        __m256 yy = _mm256_mul_ps(y, y2);
+        __m256 zz = _mm256_mul_ps(z, z2);
+        __m256 xy = _mm256_mul_ps(x, y2);
+        __m256 xz = _mm256_mul_ps(x, z2);
+        __m256 yz = _mm256_mul_ps(y, z2);
+        __m256 wx = _mm256_mul_ps(w, x2);
+        __m256 wy = _mm256_mul_ps(w, y2);
+        __m256 wz = _mm256_mul_ps(w, z2);
+
+        __m256 scaleX = _mm256_i32gather_ps(sx, index, 4);
+        __m256 scaleY = _mm256_i32gather_ps(sy, index, 4);
+        __m256 scaleZ = _mm256_i32gather_ps(sz, index, 4);
+        __m256 columns[4][3] = {
+            {_mm256_mul_ps(
+                 _mm256_sub_ps(one8, _mm256_add_ps(yy, zz)), scaleX),
+             _mm256_mul_ps(_mm256_add_ps(xy, wz), scaleX),
+             _mm256_mul_ps(_mm256_sub_ps(xz, wy), scaleX)},
+            {_mm256_mul_ps(_mm256_sub_ps(xy, wz), scaleY),
+             _mm256_mul_ps(
+                 _mm256_sub_ps(one8, _mm256_add_ps(xx, zz)), scaleY),
+             _mm256_mul_ps(_mm256_add_ps(yz, wx), scaleY)},
+            {_mm256_mul_ps(_mm256_add_ps(xz, wy), scaleZ),
+             _mm256_mul_ps(_mm256_sub_ps(yz, wx), scaleZ),
+             _mm256_mul_ps(
+                 _mm256_sub_ps(one8, _mm256_add_ps(xx, yy)), scaleZ)},
+            {_mm256_i32gather_ps(px, index, 4),
+             _mm256_i32gather_ps(py, index, 4),
+             _mm256_i32gather_ps(pz, index, 4)}};
+
+        // Each 128-bit half is four entities; store them like the SSE path
+        for (int half = 0; half < 2; half++) {
+            float* matrices[4];
+            for (int lane = 0; lane < 4; lane++) {
+                matrices[lane] = &m_Matrices[slots[i + half * 4 + lane]][0][0];
+            }
+            for (int column = 0; column < 4; column++) {
+                __m128 rows[3];
+                for (int row = 0; row < 3; row++) {
+                    rows[row] = half == 0 ? _mm256_castps256_ps128(
+                                                columns[column][row])
+                                          : _mm256_extractf128_ps(
+                                                columns[column][row], 1);
+                }
+                __m128 last = _mm_set1_ps(column == 3 ? 1.0f : 0.0f);
+                StoreColumn4(rows[0], rows[1], rows[2], last, matrices,
+                             column);
+            }
+        }
+    }
+#elif OBELISK_TRANSFORM_SSE2
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 zero = _mm_setzero_ps();
+    for (; i + 4 <= count; i += 4) {
+        const uint32_t* s = slots + i;
+        auto gather = [s](const float* values) {
+            return _mm_setr_ps(values[s[0]], values[s[1]], values[s[2]],
+                               values[s[3]]);
+        };
+        __m128 x = gather(qx);
+        __m128 y = gather(qy);
+        __m128 z = gather(qz);
+        __m128 w = gather(qw);
+        __m128 x2 = _mm_add_ps(x, x);
+        __m128 y2 = _mm_add_ps(y, y);
+        __m128 z2 = _mm_add_ps(z, z);
+        __m128 xx = _mm_mul_ps(x, x2);
+        __m128 yy = _mm_mul_ps(y, y2);
+        __m128 zz = _mm_mul_ps(z, z2);
+        __m128 xy = _mm_mul_ps(x, y2);
+        __m128 xz = _mm_mul_ps(x, z2);
+        __m128 yz = _mm_mul_ps(y, z2);
+        __m128 wx = _mm_mul_ps(w, x2);
+        __m128 wy = _mm_mul_ps(w, y2);
+        __m128 wz = _mm_mul_ps(w, z2);
+
+        float* matrices[4] = {
+            &m_Matrices[s[0]][0][0], &m_Matrices[s[1]][0][0],
+            &m_Matrices[s[2]][0][0], &m_Matrices[s[3]][0][0]};
+
+        __m128 scaleX = gather(sx);
+        StoreColumn4(
+            _mm_mul_ps(_mm_sub_ps(one, _mm_add_ps(yy, zz)), scaleX),
+            _mm_mul_ps(_mm_add_ps(xy, wz), scaleX),
+            _mm_mul_ps(_mm_sub_ps(xz, wy), scaleX), zero, matrices, 0);
+
+        __m128 scaleY = gather(sy);
+        StoreColumn4(_mm_mul_ps(_mm_sub_ps(xy, wz), scaleY),
+                     _mm_mul_ps(_mm_sub_ps(one, _mm_add_ps(xx, zz)), scaleY),
+                     _mm_mul_ps(_mm_add_ps(yz, wx), scaleY), zero, matrices,
+                     1);
+
+        __m128 scaleZ = gather(sz);
+        StoreColumn4(_mm_mul_ps(_mm_add_ps(xz, wy), scaleZ),
+                     _mm_mul_ps(_mm_sub_ps(yz, wx), scaleZ),
+                     _mm_mul_ps(_mm_sub_ps(one, _mm_add_ps(xx, yy)), scaleZ),
+                     zero, matrices, 2);
+
+        StoreColumn4(gather(px), gather(py), gather(pz), one, matrices, 3);
+    }
+#endif
+
+    for (; i < count; i++) {
+        ComposeScalar(slots[i]);
+    }
+}
+
+uint32_t TransformStorage::AddNode(EntityID id) {
+    if (uint32_t node = GetNode(id); node != NO_SLOT) {
+        return node;
+    }
+
+    auto node = static_cast<uint32_t>(m_Nodes.size());
+    HierarchyNode& added = m_Nodes.emplace_back();
+    added.Entity = id;
+    added.Root = node;
+    if (id.Index >= m_NodeOf.size()) {
+        m_NodeOf.resize(id.Index + 1, NO_SLOT);
+    }
+    m_NodeOf[id.Index] = node;
+
+    // The next update caches its local matrix
+    MarkDirty(GetSlot(id));
+    return node;
+}
+
+void TransformStorage::RemoveNode(uint32_t node) {
+    uint32_t size = m_Nodes[node].SubtreeSize;
+    for (uint32_t i = m_Nodes[node].Parent; i != NO_SLOT;
+         i = m_Nodes[i].Parent) {
+        m_Nodes[i].SubtreeSize -= size;
+    }
+
+    // Children become roots whose local transform now places them in the
+    // world
+    for (uint32_t i = node + 1; i < node + size; i++) {
+        if (m_Nodes[i].Parent == node) {
+            m_Nodes[i].ParentEntity = EntityID();
+            MarkDirty(GetSlot(m_Nodes[i].Entity));
+        }
+    }
+
+    // Move the subtree to the end, where the child subtrees stay contiguous
+    m_NodeOf[m_Nodes[node].Entity.Index] = NO_SLOT;
+    std::rotate(m_Nodes.begin() + node, m_Nodes.begin() + node + size,
+                m_Nodes.end());
+    m_Nodes.erase(m_Nodes.end() - size);
+    RebuildHierarchy(node);
+}
+
+void TransformStorage::RebuildHierarchy(uint32_t first) {
+    // Parents come first, so their indices and roots are already known
+    for (uint32_t i = first; i < m_Nodes.size(); i++) {
+        HierarchyNode& node = m_Nodes[i];
+        m_NodeOf[node.Entity.Index] = i;
+        node.Parent = GetNode(node.ParentEntity);
+        node.Root = node.Parent == NO_SLOT ? i : m_Nodes[node.Parent].Root;
+    }
+}
+
+void TransformStorage::PropagateSubtree(uint32_t root) {
+    uint32_t end = root + m_Nodes[root].SubtreeSize;
+    for (uint32_t i = root; i < end; i++) {
+        HierarchyNode& node = m_Nodes[i];
+        glm::mat4& world = m_Matrices[GetSlot(node.Entity)];
+
+        // Dirty members were just composed from their local values
+        if (node.LocalChanged) {
+            node.Local = world;
+        }
+
+        bool parentChanged =
+            node.Parent != NO_SLOT && m_Nodes[node.Parent].WorldChanged;
+        node.WorldChanged = node.LocalChanged || parentChanged;
+        node.LocalChanged = false;
+        if (node.WorldChanged && node.Parent != NO_SLOT) {
+            world = m_Matrices[GetSlot(m_Nodes[node.Parent].Entity)] *
+                    node.Local;
+        }
+    }
+    m_Nodes[root].Queued = false;
+}
+
+void TransformStorage::ComposeScalar(uint32_t slot) {
+    float x = m_Channels[RotationX][slot];
+    float y = m_Channels[RotationY][slot];
+    float z = m_Channels[RotationZ][slot];
+    float w = m_Channels[RotationW][slot];
+    float xx = 2.0f * x * x, yy = 2.0f * y * y, zz = 2.0f * z * z;
+    float xy = 2.0f * x * y, xz = 2.0f * x * z, yz = 2.0f * y * z;
+    float wx = 2.0f * w * x, wy = 2.0f * w * y, wz = 2.0f * w * z;
+
+    float scaleX = m_Channels[ScaleX][slot];
+    float scaleY = m_Channels[ScaleY][slot];
+    float scaleZ = m_Channels[ScaleZ][slot];
+
+    glm::mat4& matrix = m_Matrices[slot];
+    matrix[0] = glm::vec4((1.0f - yy - zz) * scaleX, (xy + wz) * scaleX,
+                          (xz - wy) * scaleX, 0.0f);
+    matrix[1] = glm::vec4((xy - wz) * scaleY, (1.0f - xx - zz) * scaleY,
+                          (yz + wx) * scaleY, 0.0f);
+    matrix[2] = glm::vec4((xz + wy) * scaleZ, (yz - wx) * scaleZ,
+                          (1.0f - xx - yy) * scaleZ, 0.0f);
+    matrix[3] = glm::vec4(m_Channels[PositionX][slot],
+                          m_Channels[PositionY][slot],
+                          m_Channels[PositionZ][slot], 1.0f);
+}
+
+}  // namespace Obelisk
@@ -0,0 +1,104 @@
+#include "Obelisk/Core/AABBArray.h"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define OBELISK_BOUNDS_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define OBELISK_BOUNDS_SSE2 1
+#endif
+
+namespace Obelisk {
+
+void AABBArray::Resize(size_t size) {
+    // Padding to whole packets lets the kernels load full vectors
+    size_t padded = (size + PACKET_SIZE - 1) / PACKET_SIZE * PACKET_SIZE;
+    const AABB empty;
+    m_MinX.resize(padded, empty.Min.x);
+    m_MinY.resize(padded, empty.Min.y);
+    m_MinZ.resize(padded, empty.Min.z);
+    m_MaxX.resize(padded, empty.Max.x);
+    m_MaxY.resize(padded, empty.Max.y);
+    m_MaxZ.resize(padded, empty.Max.z);
+    for (size_t i = m_Size; i < size; i++) {
+        Set(i, empty);
+    }
+    m_Size = size;
+}
+
+const char* AABBArray::GetKernelName() {
+#if OBELISK_BOUNDS_AVX
+    return "AVX";
+#elif OBELISK_BOUNDS_SSE2
+    return "SSE2";
+#else
+    return "Scalar";
+#endif
+}
+
+uint32_t AABBArray::IntersectPacket(const Ray& ray, size_t first,
+                                    float maxDistance, float* entries) const {
+    // The same slab test as Ray::Intersects(), one box per lane
+#if OBELISK_BOUNDS_AVX
+    auto slab = [&](const std::vector<float>& min,
+                    const std::vector<float>& max, float origin,
+                    float inverse, __m256& entry, __m256& exit) {
+        __m256 o = _mm256_set1_ps(origin);
+        __m256 d = _mm256_set1_ps(inverse);
+        __m256 t1 = _mm256_mul_ps(
+            _mm256_sub_ps(_mm256_loadu_ps(min.data() + first), o), d);
+        __m256 t2 = _mm256_mul_ps(
+            _mm256_sub_ps(_mm256_loadu_ps(max.data() + first), o), d);
+        entry = _mm256_max_ps(entry, _mm256_min_ps(t1, t2));
+        exit = _mm256_min_ps(exit, _mm256_max_ps(t1, t2));
+    };
+    __m256 entry = _mm256_setzero_ps();
+    __m256 exit = _mm256_set1_ps(maxDistance);
+    slab(m_MinX, m_MaxX, ray.Origin.x, ray.InverseDirection.x, entry, exit);
+    slab(m_MinY, m_MaxY, ray.Origin.y, ray.InverseDirection.y, entry, exit);
+    slab(m_MinZ, m_MaxZ, ray.Origin.z, ray.InverseDirection.z, entry, exit);
+    _mm256_storeu_ps(entries, entry);
+    return static_cast<uint32_t>(
+        _mm256_movemask_ps(_mm256_cmp_ps(entry, exit, _CMP_LE_OQ)));
+#elif OBELISK_BOUNDS_SSE2
+    uint32_t hits = 0;
+    for (size_t half = 0; half < PACKET_SIZE; half += 4) {
+        size_t at = first + half;
+        auto slab = [&](const std::vector<float>& min,
+                        const std::vector<float>& max, float origin,
+                        float inverse, __m128& entry, __m128& exit) {
+            __m128 o = _mm_set1_ps(origin);
+            __m128 d = _mm_set1_ps(inverse);
+            __m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(min.data() + at), o),
+                                   d);
+            __m128 t2 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(max.data() + at), o),
+                                   d);
+            entry = _mm_max_ps(entry, _mm_min_ps(t1, t2));
+            exit = _mm_min_ps(exit, _mm_max_ps(t1, t2));
+        };
+        __m128 entry = _mm_setzero_ps();
+        __m128 exit = _mm_set1_ps(maxDistance);
+        slab(m_MinX, m_MaxX, ray.Origin.x, ray.InverseDirection.x, entry, exit);
+        slab(m_MinY, m_MaxY, ray.Origin.y, ray.InverseDirection.y, entry, exit);
+        slab(m_MinZ, m_MaxZ, ray.Origin.z, ray.InverseDirection.z, entry, exit);
+        _mm_storeu_ps(entries + half, entry);
+        hits |= static_cast<uint32_t>(
+                    _mm_movemask_ps(_mm_cmple_ps(entry, exit)))
+                << half;
+    }
+    return hits;
+#else
+    uint32_t hits = 0;
+    for (size_t lane = 0; lane < PACKET_SIZE; lane++) {
+        float distance;
+        if (ray.Intersects(Get(first + lane), maxDistance, distance)) {
+            hits |= 1u << lane;
+        }
+        entries[lane] = distance;
+    }
+    return hits;
+#endif
+}
+
+}  // namespace Obelisk
@@ -121,6 +121,16 @@ glm::mat4 Camera::GetViewProjectionMatrix() const {
     return GetProjectionMatrix() * GetViewMatrix();
 }
 
+const glm::mat4& Camera::GetInverseViewMatrix() const {
+    UpdateViewMatrix();
+    return m_InverseViewMatrix;
+}
+
+const glm::mat4& Camera::GetInverseProjectionMatrix() const {
+    UpdateProjectionMatrix();
+    return m_InverseProjectionMatrix;
+}
+
 // === Utility Methods ===
 
 glm::vec3 Camera::ScreenToWorldRay(const glm::vec2& screenPos) const {
@@ -128,17 +138,32 @@ glm::vec3 Camera::ScreenToWorldRay(const glm::vec2& screenPos) const {
     glm::vec4 clipCoords = glm::vec4(screenPos.x, screenPos.y, -1.0f, 1.0f);
 
     // Convert to eye space
-    glm::mat4 invProjection = glm::inverse(GetProjectionMatrix());
-    glm::vec4 eyeCoords = invProjection * clipCoords;
+    glm::vec4 eyeCoords = GetInverseProjectionMatrix() * clipCoords;
     eyeCoords = glm::vec4(eyeCoords.x, eyeCoords.y, -1.0f, 0.0f);
 
     // Convert to world space
-    glm::mat4 invView = glm::inverse(GetViewMatrix());
-    glm::vec3 worldRay = glm::vec3(invView * eyeCoords);
+    glm::vec3 worldRay = glm::vec3(GetInverseViewMatrix() * eyeCoords);
 
     return glm::normalize(worldRay);
 }
 
+Ray Camera::ScreenPointToRay(const glm::vec2& screenPos) const {
+    float length;
+    return ScreenPointToRay(screenPos, length);
+}
+
+Ray Camera::ScreenPointToRay(const glm::vec2& screenPos, float& length) const {
+    // Unproject the points on the near and far planes under the cursor
+    glm::mat4 inverse = GetInverseViewMatrix() * GetInverseProjectionMatrix();
+    glm::vec4 nearPoint = inverse * glm::vec4(screenPos, -1.0f, 1.0f);
+    glm::vec4 farPoint = inverse * glm::vec4(screenPos, 1.0f, 1.0f);
+    glm::vec3 origin = glm::vec3(nearPoint) / nearPoint.w;
+    glm::vec3 end = glm::vec3(farPoint) / farPoint.w;
+
+    length = glm::length(end - origin);
+    return Ray(origin, (end - origin) / length);
+}
+
 glm::vec2 Camera::WorldToScreen(const glm::vec3& worldPos) const {
     glm::mat4 viewProjection = GetViewProjectionMatrix();
     glm::vec4 clipSpace = viewProjection * glm::vec4(worldPos, 1.0f);
@@ -166,6 +191,7 @@ void Camera::UpdateProjectionMatrix() const {
         m_ProjectionMatrix = glm::ortho(-halfWidth, halfWidth, -halfHeight,
                                         halfHeight, m_NearPlane, m_FarPlane);
     }
+    m_InverseProjectionMatrix = glm::inverse(m_ProjectionMatrix);
 
     m_ProjectionDirty = false;
 }
@@ -179,6 +205,7 @@ void Camera::UpdateViewMatrix() const {
     glm::vec3 up = m_Transform.GetUp();
 
     m_ViewMatrix = glm::lookAt(position, position + forward, up);
+    m_InverseViewMatrix = glm::inverse(m_ViewMatrix);
     m_ViewDirty = false;
 }
 
@@ -0,0 +1,125 @@
+#include "Obelisk/Core/JobSystem.h"
+#include <algorithm>
+
+namespace Obelisk {
+
+// Static member definitions
+std::vector<std::thread> JobSystem::s_Workers;
+std::mutex JobSystem::s_Mutex;
+std::condition_variable JobSystem::s_WorkAvailable;
+std::condition_variable JobSystem::s_WorkFinished;
+std::mutex JobSystem::s_SubmitMutex;
+
+const JobSystem::RangeFunction* JobSystem::s_Function = nullptr;
+size_t JobSystem::s_Count = 0;
+size_t JobSystem::s_BatchSize = 1;
+std::atomic<size_t> JobSystem::s_NextItem = 0;
+size_t JobSystem::s_ActiveWorkers = 0;
+uint64_t JobSystem::s_Generation = 0;
+bool JobSystem::s_Running = false;
+
+void JobSystem::Initialize(size_t workerCount) {
+    if (s_Running) {
+        LOG_WARN("JobSystem already initialized");
+        return;
+    }
+
+    if (workerCount == 0) {
+        unsigned int hardwareThreads = std::thread::hardware_concurrency();
+        workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+    }
+
+    s_Running = true;
+    s_Workers.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; i++) {
+        s_Workers.emplace_back(WorkerLoop);
+    }
+
+    LOG_INFO("JobSystem initialized with {} worker thread(s)", workerCount);
+}
+
+void JobSystem::Shutdown() {
+    {
+        std::lock_guard lock(s_Mutex);
+        s_Running = false;
+    }
+    s_WorkAvailable.notify_all();
+
+    for (auto& worker : s_Workers) {
+        worker.join();
+    }
+    s_Workers.clear();
+}
+
+void JobSystem::ParallelFor(size_t count, size_t batchSize,
+                            const RangeFunction& function) {
+    if (count == 0) {
+        return;
+    }
+
+    batchSize = std::max<size_t>(batchSize, 1);
+
+    // Not worth waking anyone for a single batch
+    if (s_Workers.empty() || count <= batchSize) {
+        function(0, count);
+        return;
+    }
+
+    std::lock_guard submitLock(s_SubmitMutex);
+    {
+        std::lock_guard lock(s_Mutex);
+        s_Function = &function;
+        s_Count = count;
+        s_BatchSize = batchSize;
+        s_NextItem = 0;
+        s_ActiveWorkers = s_Workers.size();
+        s_Generation++;
+    }
+    s_WorkAvailable.notify_all();
+
+    RunBatches();
+
+    std::unique_lock lock(s_Mutex);
+    s_WorkFinished.wait(lock, [] { return s_ActiveWorkers == 0; });
+    s_Function = nullptr;
+}
+
+void JobSystem::RunBatches() {
+    while (true) {
+        size_t begin = s_NextItem.fetch_add(s_BatchSize);
+        if (begin >= s_Count) {
+            return;
+        }
+        (*s_Function)(begin, std::min(begin + s_BatchSize, s_Count));
+    }
+}
+
+void JobSystem::WorkerLoop() {
+    uint64_t lastGeneration = 0;
+
+    while (true) {
+        {
+            std::unique_lock lock(s_Mutex);
+            s_WorkAvailable.wait(lock, [&lastGeneration] {
+                return !s_Running || s_Generation != lastGeneration;
+            });
+            if (!s_Running) {
+                return;
+            }
+            lastGeneration = s_Generation;
+        }
+
+        RunBatches();
+
+        bool lastWorker = false;
+        {
+            std::lock_guard lock(s_Mutex);
+            lastWorker = --s_ActiveWorkers == 0;
+        }
+        if (lastWorker) {
+            s_WorkFinished.notify_one();
+        }
+    }
+}
+
+}  // namespace Obelisk
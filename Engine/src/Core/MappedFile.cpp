@@ -0,0 +1,118 @@
+#include "Obelisk/Core/MappedFile.h"
+
+#ifdef _WIN32
+    #include <windows.h>
+#elif defined(__linux__) || defined(__APPLE__)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace Obelisk {
+
+MappedFile::MappedFile(MappedFile&& other) noexcept {
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        Close();
+        m_Data = std::exchange(other.m_Data, nullptr);
+        m_Size = std::exchange(other.m_Size, 0);
+#ifdef _WIN32
+        m_File = std::exchange(other.m_File, nullptr);
+        m_Mapping = std::exchange(other.m_Mapping, nullptr);
+#endif
+    }
+    return *this;
+}
+
+bool MappedFile::Open(const std::filesystem::path& path) {
+    Close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING,
+                              FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        LOG_ERROR("Failed to open {}", path.string());
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        LOG_ERROR("Failed to map {}: empty or unreadable", path.string());
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping =
+        CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void* data = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0)
+                         : nullptr;
+    if (!data) {
+        LOG_ERROR("Failed to map {}", path.string());
+        if (mapping) {
+            CloseHandle(mapping);
+        }
+        CloseHandle(file);
+        return false;
+    }
+
+    m_File = file;
+    m_Mapping = mapping;
+    m_Data = static_cast<const std::byte*>(data);
+    m_Size = static_cast<size_t>(size.QuadPart);
+    return true;
+#elif defined(__linux__) || defined(__APPLE__)
+    int file = open(path.c_str(), O_RDONLY);
+    if (file < 0) {
+        LOG_ERROR("Failed to open {}", path.string());
+        return false;
+    }
+
+    struct stat status;
+    if (fstat(file, &status) != 0 || status.st_size == 0) {
+        LOG_ERROR("Failed to map {}: empty or unreadable", path.string());
+        close(file);
+        return false;
+    }
+
+    auto size = static_cast<size_t>(status.st_size);
+    void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+    // The mapping keeps the file referenced on its own
+    close(file);
+    if (data == MAP_FAILED) {
+        LOG_ERROR("Failed to map {}", path.string());
+        return false;
+    }
+
+    m_Data = static_cast<const std::byte*>(data);
+    m_Size = size;
+    return true;
+#else
+    LOG_ERROR("Memory-mapped files are not supported on this platform");
+    return false;
+#endif
+}
+
+void MappedFile::Close() {
+    if (!m_Data) {
+        return;
+    }
+
+#ifdef _WIN32
+    UnmapViewOfFile(m_Data);
+    CloseHandle(m_Mapping);
+    CloseHandle(m_File);
+    m_Mapping = nullptr;
+    m_File = nullptr;
+#elif defined(__linux__) || defined(__APPLE__)
+    munmap(const_cast<std::byte*>(m_Data), m_Size);
+#endif
+    m_Data = nullptr;
+    m_Size = 0;
+}
+
+}  // namespace Obelisk
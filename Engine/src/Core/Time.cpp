@@ -33,6 +33,9 @@ bool Time::s_HistoryFilled = false;
 float Time::s_FrameTimeSum = 0.0f;
 Time::TimePoint Time::s_LastFPSUpdate;
 
+float Time::s_GPUFrameTime = 0.0f;
+std::vector<std::pair<std::string, float>> Time::s_GPUPassTimes;
+
 void Time::Initialize() {
     s_StartTime = Clock::now();
     s_LastFrameTime = s_StartTime;
@@ -112,6 +115,27 @@ size_t Time::GetFrameCount() { return s_FrameCount; }
 
 float Time::GetFrameTimeMS() { return s_DeltaTime * 1000.0f; }
 
+void Time::RecordGPUTimings(
+    float frameTimeMS, std::vector<std::pair<std::string, float>> passTimesMS) {
+    s_GPUFrameTime = frameTimeMS;
+    s_GPUPassTimes = std::move(passTimesMS);
+}
+
+float Time::GetGPUFrameTimeMS() { return s_GPUFrameTime; }
+
+float Time::GetGPUPassTimeMS(const std::string& pass) {
+    for (const auto& [name, time] : s_GPUPassTimes) {
+        if (name == pass) {
+            return time;
+        }
+    }
+    return 0.0f;
+}
+
+const std::vector<std::pair<std::string, float>>& Time::GetGPUPassTimes() {
+    return s_GPUPassTimes;
+}
+
 void Time::ResetFPSStats() {
     s_MinFPS = std::numeric_limits<float>::max();
     s_MaxFPS = 0.0f;
@@ -1,5 +1,17 @@
 #include "Obelisk/ObeliskAPI.h"
+#include "Obelisk/Core/JobSystem.h"
 #include "Obelisk/Core/Time.h"
+#include "Obelisk/Renderer/ClusteredLighting.h"
+#include "Obelisk/Renderer/DebugDraw.h"
+#include "Obelisk/Renderer/GLCapture.h"
+#include "Obelisk/Renderer/GPUCulling.h"
+#include "Obelisk/Renderer/GPUProfiler.h"
+#include "Obelisk/Renderer/ImpostorAtlas.h"
+#include "Obelisk/Renderer/MaterialLibrary.h"
+#include "Obelisk/Renderer/Renderer.h"
+#include "Obelisk/Renderer/ResourceRegistry.h"
+#include "Obelisk/Renderer/Shader.h"
+#include "Obelisk/Renderer/ShaderCache.h"
 
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
@@ -19,35 +31,85 @@ void ObeliskAPI::SetUpdateCallback(std::function<void()> callback) {
     m_UpdateCallback = std::move(callback);
 }
 
+void ObeliskAPI::SetRenderCallback(
+    std::function<void(const RenderSnapshot&)> callback) {
+    m_RenderCallback = std::move(callback);
+    if (m_Window) {
+        m_Window->SetRenderCallback(m_RenderCallback);
+    }
+}
+
 void ObeliskAPI::SetShutdownCallback(std::function<void()> callback) {
     m_ShutdownCallback = std::move(callback);
 }
 
-void ObeliskAPI::Init(int width, int height, const char* title) {
+void ObeliskAPI::SetCapture(const std::filesystem::path& path, size_t frames) {
+    m_CapturePath = path;
+    m_CaptureFrames = frames;
+}
+
+bool ObeliskAPI::Init(int width, int height, const char* title,
+                      WindowBackend backend) {
     LOG_INFO("Initializing Obelisk Engine...");
 
     // Initialize Time system first
     Time::Initialize();
 
+    // Worker threads are shared by all engine systems
+    JobSystem::Initialize();
+
     // Initialize AssetManager
     AssetManager::Initialize("assets");
     LOG_INFO(AssetManager::GetDebugInfo());
 
     m_Window = std::make_unique<Window>();
-    if (!m_Window->Create(1280, 720, "Heroes of Colossus")) {
+    if (m_Window->Create(width, height, title, backend) < 0) {
+        // Everything below needs a GL context
         LOG_ERROR("Failed to create window!");
+        m_Window.reset();
+        return false;
+    }
+
+    m_Window->SetRenderCallback(m_RenderCallback);
+
+    if (!m_CapturePath.empty()) {
+        GLCapture::Begin(m_CapturePath, m_CaptureFrames);
     }
 
+    Renderer::Initialize();
+    MaterialLibrary::Initialize();
+    ClusteredLighting::Initialize();
+    DebugDraw::Initialize();
+    ImpostorAtlas::Initialize();
+    GPUCulling::Initialize();
+
+    // Program binaries are cached next to the assets directory
+    ShaderCache::Initialize(AssetManager::GetBasePath().parent_path() /
+                            "cache" / "shaders");
+
     if (m_InitCallback) {
         m_InitCallback();
     }
 
+    ShaderCache::LogStatistics();
+
     LOG_INFO("Finished initializing Obelisk Engine!");
+    return true;
 }
 
 void ObeliskAPI::Run() {
+    if (!m_Window) {
+        LOG_ERROR("Cannot run without a window; did Init() fail?");
+        return;
+    }
+
     LOG_INFO("Running Obelisk Engine...");
 
+    if (m_Pipelined) {
+        RunPipelined();
+        return;
+    }
+
     while (!m_Window->ShouldClose()) {
         // Update time system each frame
         Time::Update();
@@ -57,16 +119,71 @@ void ObeliskAPI::Run() {
         }
 
         m_Window->Tick();
+
+        // The frame has been drawn, so expired resources go right away
+        ResourceRegistry::EndFrame();
     }
 }
 
+void ObeliskAPI::RunPipelined() {
+    m_RenderThread = std::make_unique<RenderThread>(*m_Window);
+    m_RenderThread->Start();
+
+    while (!m_Window->ShouldClose()) {
+        Time::Update();
+        m_Window->PollEvents();
+
+        if (m_UpdateCallback) {
+            m_UpdateCallback();
+        }
+
+        // Blocks only while the previous frame is still being rendered
+        m_Window->Capture(m_RenderThread->GetSnapshot());
+        m_RenderThread->Submit();
+
+        // Expired resources hold GL objects, so the render thread drops the
+        // last references
+        std::vector<std::shared_ptr<void>> expired =
+            ResourceRegistry::EndFrame();
+        if (!expired.empty()) {
+            m_RenderThread->Enqueue([expired = std::move(expired)]() {});
+        }
+    }
+
+    // Shutdown releases GL objects, so the context must come back here
+    m_RenderThread->Stop();
+    m_RenderThread.reset();
+}
+
 void ObeliskAPI::Shutdown() {
     LOG_INFO("Shutting down Obelisk Engine...");
 
+    // Without a window Init() stopped before any GL setup or the init
+    // callback, so there is nothing of theirs to release
+    bool initialized = m_Window != nullptr;
+    if (initialized) {
+        // Flush a capture cut short by closing the window
+        GLCapture::End();
+
+        // Release GL objects owned by the engine while the context still
+        // exists
+        Shader::SetFallback(nullptr);
+        ResourceRegistry::Shutdown();
+        GPUProfiler::Shutdown();
+        Renderer::Shutdown();
+        MaterialLibrary::Shutdown();
+        ClusteredLighting::Shutdown();
+        DebugDraw::Shutdown();
+        ImpostorAtlas::Shutdown();
+        GPUCulling::Shutdown();
+    }
+
     m_Window.reset();  // Automatically calls destructor
     glfwTerminate();
 
-    if (m_ShutdownCallback) {
+    JobSystem::Shutdown();
+
+    if (initialized && m_ShutdownCallback) {
         m_ShutdownCallback();
     }
 }
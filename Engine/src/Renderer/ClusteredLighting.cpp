@@ -0,0 +1,395 @@
+#include "Obelisk/Renderer/ClusteredLighting.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include "Obelisk/Core/Camera.h"
+#include "Obelisk/Core/JobSystem.h"
+#include "Obelisk/Renderer/RenderStats.h"
+#include "Obelisk/Renderer/Shader.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OBELISK_CLUSTER_SSE
+#include <emmintrin.h>
+#endif
+
+namespace Obelisk {
+
+namespace {
+// Indices into the buffer/texture arrays
+constexpr int GRID_BUFFER = 0;
+constexpr int INDEX_BUFFER = 1;
+constexpr int LIGHT_BUFFER = 2;
+
+/**
+ * @brief Lights overlapping one depth slice, padded to a multiple of four.
+ */
+struct SliceCandidates {
+        std::vector<float> X, Y, Z, Radius;
+        std::vector<uint32_t> Index;
+
+        void Clear() {
+            X.clear();
+            Y.clear();
+            Z.clear();
+            Radius.clear();
+            Index.clear();
+        }
+
+        void Add(float x, float y, float z, float radius, uint32_t index) {
+            X.push_back(x);
+            Y.push_back(y);
+            Z.push_back(z);
+            Radius.push_back(radius);
+            Index.push_back(index);
+        }
+
+        // Padding lights sit infinitely far away and never overlap anything
+        void Pad() {
+            while (X.size() % 4 != 0) {
+                Add(1e30f, 1e30f, 1e30f, 0.0f, 0);
+            }
+        }
+};
+
+/**
+ * @brief Test four spheres against an AABB.
+ *
+ * @return Bit i is set if sphere i overlaps the box
+ */
+uint32_t OverlapMask4(const float* x, const float* y, const float* z,
+                      const float* radius, const glm::vec3& boxMin,
+                      const glm::vec3& boxMax) {
+#ifdef OBELISK_CLUSTER_SSE
+    const __m128 zero = _mm_setzero_ps();
+    __m128 cx = _mm_loadu_ps(x);
+    __m128 cy = _mm_loadu_ps(y);
+    __m128 cz = _mm_loadu_ps(z);
+    __m128 r = _mm_loadu_ps(radius);
+
+    // Per-axis distance from the center to the box (0 inside the slab)
+    __m128 dx = _mm_max_ps(_mm_sub_ps(_mm_set1_ps(boxMin.x), cx),
+                           _mm_sub_ps(cx, _mm_set1_ps(boxMax.x)));
+    __m128 dy = _mm_max_ps(_mm_sub_ps(_mm_set1_ps(boxMin.y), cy),
+                           _mm_sub_ps(cy, _mm_set1_ps(boxMax.y)));
+    __m128 dz = _mm_max_ps(_mm_sub_ps(_mm_set1_ps(boxMin.z), cz),
+                           _mm_sub_ps(cz, _mm_set1_ps(boxMax.z)));
+    dx = _mm_max_ps(dx, zero);
+    dy = _mm_max_ps(dy, zero);
+    dz = _mm_max_ps(dz, zero);
+
+    __m128 distanceSq = _mm_add_ps(
+        _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+    return static_cast<uint32_t>(
+        _mm_movemask_ps(_mm_cmple_ps(distanceSq, _mm_mul_ps(r, r))));
+#else
+    uint32_t mask = 0;
+    for (int i = 0; i < 4; i++) {
+        float dx = std::max({boxMin.x - x[i], x[i] - boxMax.x, 0.0f});
+        float dy = std::max({boxMin.y - y[i], y[i] - boxMax.y, 0.0f});
+        float dz = std::max({boxMin.z - z[i], z[i] - boxMax.z, 0.0f});
+        if (dx * dx + dy * dy + dz * dz <= radius[i] * radius[i]) {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+#endif
+}
+
+/**
+ * @brief Point on the line through a and b at view-space depth z.
+ */
+glm::vec3 IntersectDepth(const glm::vec3& a, const glm::vec3& b, float z) {
+    float t = (z - a.z) / (b.z - a.z);
+    return a + (b - a) * t;
+}
+}  // namespace
+
+// Static member definitions
+std::vector<ClusteredLighting::ClusterBounds> ClusteredLighting::s_Clusters;
+glm::mat4 ClusteredLighting::s_ClusterProjection = glm::mat4(0.0f);
+
+std::vector<float> ClusteredLighting::s_LightX;
+std::vector<float> ClusteredLighting::s_LightY;
+std::vector<float> ClusteredLighting::s_LightZ;
+std::vector<float> ClusteredLighting::s_LightRadius;
+std::vector<glm::vec4> ClusteredLighting::s_LightData;
+
+std::vector<std::vector<uint32_t>> ClusteredLighting::s_SliceIndices;
+std::vector<glm::uvec2> ClusteredLighting::s_Grid;
+std::vector<uint32_t> ClusteredLighting::s_Indices;
+
+unsigned int ClusteredLighting::s_Buffers[3] = {};
+unsigned int ClusteredLighting::s_Textures[3] = {};
+int ClusteredLighting::s_MaxTexels = 65536;
+glm::vec2 ClusteredLighting::s_ScreenSize = glm::vec2(1.0f);
+glm::vec2 ClusteredLighting::s_DepthParams = glm::vec2(0.0f);
+glm::vec3 ClusteredLighting::s_AmbientLight = glm::vec3(0.1f);
+size_t ClusteredLighting::s_LightCount = 0;
+bool ClusteredLighting::s_Initialized = false;
+
+void ClusteredLighting::Initialize() {
+    if (s_Initialized) {
+        return;
+    }
+
+    glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &s_MaxTexels);
+
+    glGenBuffers(3, s_Buffers);
+    glGenTextures(3, s_Textures);
+
+    const GLenum formats[3] = {GL_RG32UI, GL_R32UI, GL_RGBA32F};
+    for (int i = 0; i < 3; i++) {
+        glBindBuffer(GL_TEXTURE_BUFFER, s_Buffers[i]);
+        glBufferData(GL_TEXTURE_BUFFER, sizeof(glm::vec4), nullptr,
+                     GL_STREAM_DRAW);
+        glBindTexture(GL_TEXTURE_BUFFER, s_Textures[i]);
+        glTexBuffer(GL_TEXTURE_BUFFER, formats[i], s_Buffers[i]);
+    }
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+    s_Grid.resize(CLUSTER_COUNT);
+    s_SliceIndices.resize(CLUSTERS_Z);
+    s_Initialized = true;
+
+    LOG_INFO("Clustered lighting initialized ({}x{}x{} clusters)", CLUSTERS_X,
+             CLUSTERS_Y, CLUSTERS_Z);
+}
+
+void ClusteredLighting::Shutdown() {
+    if (!s_Initialized) {
+        return;
+    }
+
+    glDeleteTextures(3, s_Textures);
+    glDeleteBuffers(3, s_Buffers);
+    s_ClusterProjection = glm::mat4(0.0f);
+    s_Initialized = false;
+}
+
+void ClusteredLighting::Update(const Camera& camera,
+                               const std::vector<PointLight>& lights,
+                               int width, int height) {
+    if (!s_Initialized || width <= 0 || height <= 0) {
+        return;
+    }
+
+    s_ScreenSize = glm::vec2(width, height);
+
+    const glm::mat4& projection = camera.GetProjectionMatrix();
+    if (projection != s_ClusterProjection) {
+        BuildClusters(projection, camera.GetNearPlane(), camera.GetFarPlane());
+    }
+
+    // Two texels per light in the light buffer
+    size_t lightLimit = std::min<size_t>(MAX_LIGHTS, s_MaxTexels / 2);
+    if (lights.size() > lightLimit) {
+        LOG_WARN("{} lights exceed the limit of {}, extra lights ignored",
+                 lights.size(), lightLimit);
+    }
+    s_LightCount = std::min(lights.size(), lightLimit);
+
+    s_LightX.resize(s_LightCount);
+    s_LightY.resize(s_LightCount);
+    s_LightZ.resize(s_LightCount);
+    s_LightRadius.resize(s_LightCount);
+    s_LightData.resize(std::max<size_t>(s_LightCount * 2, 2));
+
+    const glm::mat4& view = camera.GetViewMatrix();
+    for (size_t i = 0; i < s_LightCount; i++) {
+        const PointLight& light = lights[i];
+        glm::vec3 position = glm::vec3(view * glm::vec4(light.Position, 1.0f));
+
+        s_LightX[i] = position.x;
+        s_LightY[i] = position.y;
+        s_LightZ[i] = position.z;
+        s_LightRadius[i] = light.Radius;
+        s_LightData[i * 2] = glm::vec4(position, light.Radius);
+        s_LightData[i * 2 + 1] = glm::vec4(light.Color * light.Intensity, 0.0f);
+    }
+
+    // Slices are independent, so each job bins one slice
+    JobSystem::ParallelFor(CLUSTERS_Z, 1, [](size_t begin, size_t end) {
+        for (size_t slice = begin; slice < end; slice++) {
+            BinSlice(static_cast<uint32_t>(slice));
+        }
+    });
+
+    // Concatenate the per-slice lists and rebase the cluster offsets
+    s_Indices.clear();
+    const uint32_t clustersPerSlice = CLUSTERS_X * CLUSTERS_Y;
+    for (uint32_t slice = 0; slice < CLUSTERS_Z; slice++) {
+        const auto& sliceIndices = s_SliceIndices[slice];
+        uint32_t base = static_cast<uint32_t>(s_Indices.size());
+
+        // Clusters that no longer fit in the index buffer are emptied
+        bool fits = s_Indices.size() + sliceIndices.size() <=
+                    static_cast<size_t>(s_MaxTexels);
+        for (uint32_t i = 0; i < clustersPerSlice; i++) {
+            glm::uvec2& range = s_Grid[slice * clustersPerSlice + i];
+            range = fits ? glm::uvec2(range.x + base, range.y) : glm::uvec2(0);
+        }
+        if (fits) {
+            s_Indices.insert(s_Indices.end(), sliceIndices.begin(),
+                             sliceIndices.end());
+        }
+    }
+
+    size_t indexCount = s_Indices.size();
+    if (s_Indices.empty()) {
+        s_Indices.push_back(0);  // Texture buffers need a non-empty store
+    }
+
+    glBindBuffer(GL_TEXTURE_BUFFER, s_Buffers[GRID_BUFFER]);
+    glBufferData(GL_TEXTURE_BUFFER, s_Grid.size() * sizeof(glm::uvec2),
+                 s_Grid.data(), GL_STREAM_DRAW);
+    glBindBuffer(GL_TEXTURE_BUFFER, s_Buffers[INDEX_BUFFER]);
+    glBufferData(GL_TEXTURE_BUFFER, s_Indices.size() * sizeof(uint32_t),
+                 s_Indices.data(), GL_STREAM_DRAW);
+    glBindBuffer(GL_TEXTURE_BUFFER, s_Buffers[LIGHT_BUFFER]);
+    glBufferData(GL_TEXTURE_BUFFER, s_LightData.size() * sizeof(glm::vec4),
+                 s_LightData.data(), GL_STREAM_DRAW);
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+    RenderStatistics::RecordBufferUpload(
+        s_Grid.size() * sizeof(glm::uvec2) +
+        s_Indices.size() * sizeof(uint32_t) +
+        s_LightData.size() * sizeof(glm::vec4));
+
+    s_Indices.resize(indexCount);
+
+    for (int i = 0; i < 3; i++) {
+        glActiveTexture(GL_TEXTURE0 + FIRST_TEXTURE_UNIT + i);
+        glBindTexture(GL_TEXTURE_BUFFER, s_Textures[i]);
+        RenderStatistics::RecordTextureBind();
+    }
+    glActiveTexture(GL_TEXTURE0);
+}
+
+void ClusteredLighting::Apply(const Shader& shader) {
+    if (!s_Initialized) {
+        return;
+    }
+
+    shader.SetInt("uClusterGrid", FIRST_TEXTURE_UNIT + GRID_BUFFER);
+    shader.SetInt("uLightIndices", FIRST_TEXTURE_UNIT + INDEX_BUFFER);
+    shader.SetInt("uLightData", FIRST_TEXTURE_UNIT + LIGHT_BUFFER);
+    shader.SetVec3("uClusterDims",
+                   glm::vec3(CLUSTERS_X, CLUSTERS_Y, CLUSTERS_Z));
+    shader.SetVec2("uClusterScreenSize", s_ScreenSize);
+    shader.SetVec2("uClusterDepthParams", s_DepthParams);
+    shader.SetVec3("uAmbientLight", s_AmbientLight);
+}
+
+void ClusteredLighting::BuildClusters(const glm::mat4& projection,
+                                      float nearPlane, float farPlane) {
+    s_ClusterProjection = projection;
+    s_Clusters.resize(CLUSTER_COUNT);
+
+    // Exponential slicing: slice k spans near * (far/near)^(k/Z) onwards
+    float logRatio = std::log(farPlane / nearPlane);
+    s_DepthParams = glm::vec2(CLUSTERS_Z / logRatio,
+                              CLUSTERS_Z * std::log(nearPlane) / logRatio);
+
+    glm::mat4 inverseProjection = glm::inverse(projection);
+    auto unproject = [&inverseProjection](float x, float y, float z) {
+        glm::vec4 point = inverseProjection * glm::vec4(x, y, z, 1.0f);
+        return glm::vec3(point) / point.w;
+    };
+
+    for (uint32_t y = 0; y < CLUSTERS_Y; y++) {
+        for (uint32_t x = 0; x < CLUSTERS_X; x++) {
+            // The four corner rays of this screen tile
+            float x0 = -1.0f + 2.0f * x / CLUSTERS_X;
+            float x1 = -1.0f + 2.0f * (x + 1) / CLUSTERS_X;
+            float y0 = -1.0f + 2.0f * y / CLUSTERS_Y;
+            float y1 = -1.0f + 2.0f * (y + 1) / CLUSTERS_Y;
+            const glm::vec2 corners[4] = {{x0, y0}, {x1, y0}, {x0, y1},
+                                          {x1, y1}};
+
+            glm::vec3 rayNear[4];
+            glm::vec3 rayFar[4];
+            for (int i = 0; i < 4; i++) {
+                rayNear[i] = unproject(corners[i].x, corners[i].y, -1.0f);
+                rayFar[i] = unproject(corners[i].x, corners[i].y, 1.0f);
+            }
+
+            for (uint32_t z = 0; z < CLUSTERS_Z; z++) {
+                float sliceNear = -nearPlane * std::pow(farPlane / nearPlane,
+                                                        float(z) / CLUSTERS_Z);
+                float sliceFar =
+                    -nearPlane *
+                    std::pow(farPlane / nearPlane, float(z + 1) / CLUSTERS_Z);
+
+                constexpr float maxFloat = std::numeric_limits<float>::max();
+                ClusterBounds bounds{glm::vec3(maxFloat), glm::vec3(-maxFloat)};
+                for (int i = 0; i < 4; i++) {
+                    for (float depth : {sliceNear, sliceFar}) {
+                        glm::vec3 point =
+                            IntersectDepth(rayNear[i], rayFar[i], depth);
+                        bounds.Min = glm::min(bounds.Min, point);
+                        bounds.Max = glm::max(bounds.Max, point);
+                    }
+                }
+
+                s_Clusters[x + CLUSTERS_X * (y + CLUSTERS_Y * z)] = bounds;
+            }
+        }
+    }
+}
+
+void ClusteredLighting::BinSlice(uint32_t slice) {
+    // Reused across frames to avoid per-slice allocations
+    thread_local SliceCandidates candidates;
+    candidates.Clear();
+
+    const uint32_t clustersPerSlice = CLUSTERS_X * CLUSTERS_Y;
+    const uint32_t first = slice * clustersPerSlice;
+
+    // Depth is the same for every cluster in the slice, so reject lights by
+    // depth once before testing individual clusters
+    float sliceMinZ = s_Clusters[first].Min.z;
+    float sliceMaxZ = s_Clusters[first].Max.z;
+    for (uint32_t i = 0; i < clustersPerSlice; i++) {
+        sliceMinZ = std::min(sliceMinZ, s_Clusters[first + i].Min.z);
+        sliceMaxZ = std::max(sliceMaxZ, s_Clusters[first + i].Max.z);
+    }
+
+    for (size_t i = 0; i < s_LightCount; i++) {
+        if (s_LightZ[i] + s_LightRadius[i] >= sliceMinZ &&
+            s_LightZ[i] - s_LightRadius[i] <= sliceMaxZ) {
+            candidates.Add(s_LightX[i], s_LightY[i], s_LightZ[i],
+                           s_LightRadius[i], static_cast<uint32_t>(i));
+        }
+    }
+    size_t candidateCount = candidates.Index.size();
+    candidates.Pad();
+
+    auto& indices = s_SliceIndices[slice];
+    indices.clear();
+
+    for (uint32_t i = 0; i < clustersPerSlice; i++) {
+        const ClusterBounds& bounds = s_Clusters[first + i];
+        uint32_t offset = static_cast<uint32_t>(indices.size());
+        uint32_t count = 0;
+
+        for (size_t c = 0; c < candidateCount && count < MAX_LIGHTS_PER_CLUSTER;
+             c += 4) {
+            uint32_t mask = OverlapMask4(
+                &candidates.X[c], &candidates.Y[c], &candidates.Z[c],
+                &candidates.Radius[c], bounds.Min, bounds.Max);
+
+            while (mask != 0 && count < MAX_LIGHTS_PER_CLUSTER) {
+                int lane = std::countr_zero(mask);
+                mask &= mask - 1;
+                indices.push_back(candidates.Index[c + lane]);
+                count++;
+            }
+        }
+
+        s_Grid[first + i] = glm::uvec2(offset, count);
+    }
+}
+
+}  // namespace Obelisk
@@ -0,0 +1,408 @@
+#include "Obelisk/Renderer/DebugDraw.h"
+
+#ifdef OBELISK_DEBUG_DRAW
+
+#include <bit>
+#include <cmath>
+#include <glm/gtc/constants.hpp>
+#include <glm/gtc/packing.hpp>
+#include "Obelisk/Core/Camera.h"
+#include "Obelisk/Renderer/GPUProfiler.h"
+#include "Obelisk/Renderer/RenderStats.h"
+#include "Obelisk/Renderer/Shader.h"
+
+namespace Obelisk {
+
+namespace {
+constexpr int OVERLAY = 0;
+constexpr int DEPTH_TESTED = 1;
+
+// Corner pairs of a box whose corner i has bit 0/1/2 set for max x/y/z
+constexpr int BOX_EDGES[12][2] = {{0, 1}, {2, 3}, {4, 5}, {6, 7},
+                                  {0, 2}, {1, 3}, {4, 6}, {5, 7},
+                                  {0, 4}, {1, 5}, {2, 6}, {3, 7}};
+
+/**
+ * @brief Endpoints of the 16 segments in a 1 x 2 character cell.
+ *
+ * Bit order: top left/right, right upper/lower, bottom right/left, left
+ * lower/upper, middle left/right, then the upper-left diagonal, upper
+ * vertical, upper-right diagonal, lower-left diagonal, lower vertical and
+ * lower-right diagonal.
+ */
+constexpr float SEGMENTS[16][4] = {
+    {0.0f, 2.0f, 0.5f, 2.0f}, {0.5f, 2.0f, 1.0f, 2.0f},
+    {1.0f, 2.0f, 1.0f, 1.0f}, {1.0f, 1.0f, 1.0f, 0.0f},
+    {0.5f, 0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 0.5f, 0.0f},
+    {0.0f, 1.0f, 0.0f, 0.0f}, {0.0f, 2.0f, 0.0f, 1.0f},
+    {0.0f, 1.0f, 0.5f, 1.0f}, {0.5f, 1.0f, 1.0f, 1.0f},
+    {0.0f, 2.0f, 0.5f, 1.0f}, {0.5f, 2.0f, 0.5f, 1.0f},
+    {1.0f, 2.0f, 0.5f, 1.0f}, {0.5f, 1.0f, 0.0f, 0.0f},
+    {0.5f, 1.0f, 0.5f, 0.0f}, {0.5f, 1.0f, 1.0f, 0.0f}};
+
+// Segment masks for ASCII 32 to 95; lowercase maps to uppercase
+constexpr uint16_t GLYPHS[64] = {
+    0x0000, 0x0800, 0x0880, 0x4B3C,  // ' ' '!' '"' '#'
+    0x4BBB, 0x7B99, 0x8D71, 0x0800,  // '$' '%' '&' "'"
+    0x9000, 0x2400, 0xFF00, 0x4B00,  // '(' ')' '*' '+'
+    0x2000, 0x0300, 0x0020, 0x3000,  // ',' '-' '.' '/'
+    0x30FF, 0x100C, 0x0377, 0x023F,  // '0' '1' '2' '3'
+    0x038C, 0x03BB, 0x03FB, 0x000F,  // '4' '5' '6' '7'
+    0x03FF, 0x03BF, 0x4800, 0x2800,  // '8' '9' ':' ';'
+    0x9000, 0x0330, 0x2400, 0x4207,  // '<' '=' '>' '?'
+    0x0AFF, 0x03CF, 0x4A3F, 0x00F3,  // '@' 'A' 'B' 'C'
+    0x483F, 0x01F3, 0x01C3, 0x02FB,  // 'D' 'E' 'F' 'G'
+    0x03CC, 0x4833, 0x007C, 0x91C0,  // 'H' 'I' 'J' 'K'
+    0x00F0, 0x14CC, 0x84CC, 0x00FF,  // 'L' 'M' 'N' 'O'
+    0x03C7, 0x80FF, 0x83C7, 0x063B,  // 'P' 'Q' 'R' 'S'
+    0x4803, 0x00FC, 0x30C0, 0xA0CC,  // 'T' 'U' 'V' 'W'
+    0xB400, 0x5400, 0x3033, 0x4812,  // 'X' 'Y' 'Z' '['
+    0x8400, 0x4821, 0xA000, 0x0030,  // '\\' ']' '^' '_'
+};
+
+constexpr uint16_t UNKNOWN_GLYPH = 0x00FF;  // Box outline
+
+/**
+ * @brief Get the segment mask of a character.
+ */
+uint16_t GetGlyph(char character) {
+    if (character >= 'a' && character <= 'z') {
+        character = static_cast<char>(character - 'a' + 'A');
+    }
+    if (character < ' ' || character > '_') {
+        return UNKNOWN_GLYPH;
+    }
+    return GLYPHS[character - ' '];
+}
+}  // namespace
+
+// Static member definitions
+std::vector<DebugDraw::DebugVertex> DebugDraw::s_Vertices[2];
+std::vector<DebugDraw::DebugText> DebugDraw::s_Text;
+std::vector<char> DebugDraw::s_TextChars;
+std::vector<DebugDraw::DebugVertex> DebugDraw::s_Latched[2];
+std::unique_ptr<Shader> DebugDraw::s_Shader;
+unsigned int DebugDraw::s_VAO = 0;
+unsigned int DebugDraw::s_VBO = 0;
+bool DebugDraw::s_Overflowed = false;
+
+void DebugDraw::Initialize() {
+    if (s_VAO) {
+        return;
+    }
+
+    s_Shader = std::make_unique<Shader>("debug.vert", "debug.frag");
+
+    glGenVertexArrays(1, &s_VAO);
+    glGenBuffers(1, &s_VBO);
+
+    glBindVertexArray(s_VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, s_VBO);
+
+    // Position attribute
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(DebugVertex),
+                          (void*)offsetof(DebugVertex, Position));
+    glEnableVertexAttribArray(0);
+
+    // Color attribute
+    glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(DebugVertex),
+                          (void*)offsetof(DebugVertex, Color));
+    glEnableVertexAttribArray(1);
+
+    // Cleanup
+    glBindVertexArray(0);
+
+    LOG_INFO("DebugDraw initialized");
+}
+
+void DebugDraw::Shutdown() {
+    Clear();
+
+    if (s_VAO) {
+        glDeleteVertexArrays(1, &s_VAO);
+        s_VAO = 0;
+    }
+
+    if (s_VBO) {
+        glDeleteBuffers(1, &s_VBO);
+        s_VBO = 0;
+    }
+
+    s_Shader.reset();
+}
+
+void DebugDraw::Line(const glm::vec3& from, const glm::vec3& to,
+                     const glm::vec4& color, bool depthTest) {
+    DebugVertex* vertices = Append(2, depthTest);
+    if (!vertices) {
+        return;
+    }
+
+    uint32_t packed = glm::packUnorm4x8(color);
+    vertices[0] = {from, packed};
+    vertices[1] = {to, packed};
+}
+
+void DebugDraw::Cross(const glm::vec3& point, float size,
+                      const glm::vec4& color, bool depthTest) {
+    float half = size * 0.5f;
+    Line(point - glm::vec3(half, 0.0f, 0.0f),
+         point + glm::vec3(half, 0.0f, 0.0f), color, depthTest);
+    Line(point - glm::vec3(0.0f, half, 0.0f),
+         point + glm::vec3(0.0f, half, 0.0f), color, depthTest);
+    Line(point - glm::vec3(0.0f, 0.0f, half),
+         point + glm::vec3(0.0f, 0.0f, half), color, depthTest);
+}
+
+void DebugDraw::Box(const AABB& box, const glm::vec4& color, bool depthTest) {
+    DebugVertex* vertices = Append(24, depthTest);
+    if (!vertices) {
+        return;
+    }
+
+    uint32_t packed = glm::packUnorm4x8(color);
+    const glm::vec3* bounds[2] = {&box.Min, &box.Max};
+    for (const auto& edge : BOX_EDGES) {
+        for (int corner : edge) {
+            *vertices++ = {glm::vec3(bounds[corner & 1]->x,
+                                     bounds[(corner >> 1) & 1]->y,
+                                     bounds[(corner >> 2) & 1]->z),
+                           packed};
+        }
+    }
+}
+
+void DebugDraw::Box(const AABB& box, const glm::mat4& transform,
+                    const glm::vec4& color, bool depthTest) {
+    DebugVertex* vertices = Append(24, depthTest);
+    if (!vertices) {
+        return;
+    }
+
+    glm::vec3 corners[8];
+    for (int i = 0; i < 8; i++) {
+        glm::vec3 local((i & 1) ? box.Max.x : box.Min.x,
+                        (i & 2) ? box.Max.y : box.Min.y,
+                        (i & 4) ? box.Max.z : box.Min.z);
+        corners[i] = glm::vec3(transform * glm::vec4(local, 1.0f));
+    }
+
+    uint32_t packed = glm::packUnorm4x8(color);
+    for (const auto& edge : BOX_EDGES) {
+        *vertices++ = {corners[edge[0]], packed};
+        *vertices++ = {corners[edge[1]], packed};
+    }
+}
+
+void DebugDraw::Circle(const glm::vec3& center, const glm::vec3& normal,
+                       float radius, const glm::vec4& color, int segments,
+                       bool depthTest) {
+    if (segments < 3) {
+        return;
+    }
+
+    DebugVertex* vertices = Append(segments * 2, depthTest);
+    if (!vertices) {
+        return;
+    }
+
+    // Any two axes perpendicular to the normal span the circle's plane
+    glm::vec3 axis = glm::normalize(normal);
+    glm::vec3 helper = std::abs(axis.y) < 0.99f ? glm::vec3(0.0f, 1.0f, 0.0f)
+                                                : glm::vec3(1.0f, 0.0f, 0.0f);
+    glm::vec3 u = glm::normalize(glm::cross(axis, helper)) * radius;
+    glm::vec3 v = glm::cross(axis, u);
+
+    uint32_t packed = glm::packUnorm4x8(color);
+    float step = glm::two_pi<float>() / segments;
+    glm::vec3 previous = center + u;
+    for (int i = 1; i <= segments; i++) {
+        float angle = step * i;
+        glm::vec3 next = center + u * std::cos(angle) + v * std::sin(angle);
+        *vertices++ = {previous, packed};
+        *vertices++ = {next, packed};
+        previous = next;
+    }
+}
+
+void DebugDraw::Sphere(const glm::vec3& center, float radius,
+                       const glm::vec4& color, bool depthTest) {
+    Circle(center, glm::vec3(1.0f, 0.0f, 0.0f), radius, color, 24, depthTest);
+    Circle(center, glm::vec3(0.0f, 1.0f, 0.0f), radius, color, 24, depthTest);
+    Circle(center, glm::vec3(0.0f, 0.0f, 1.0f), radius, color, 24, depthTest);
+}
+
+void DebugDraw::Frustum(const glm::mat4& viewProjection,
+                        const glm::vec4& color, bool depthTest) {
+    DebugVertex* vertices = Append(24, depthTest);
+    if (!vertices) {
+        return;
+    }
+
+    // The frustum is the NDC cube mapped back into world space
+    glm::mat4 inverse = glm::inverse(viewProjection);
+    glm::vec3 corners[8];
+    for (int i = 0; i < 8; i++) {
+        glm::vec4 ndc((i & 1) ? 1.0f : -1.0f, (i & 2) ? 1.0f : -1.0f,
+                      (i & 4) ? 1.0f : -1.0f, 1.0f);
+        glm::vec4 world = inverse * ndc;
+        corners[i] = glm::vec3(world) / world.w;
+    }
+
+    uint32_t packed = glm::packUnorm4x8(color);
+    for (const auto& edge : BOX_EDGES) {
+        *vertices++ = {corners[edge[0]], packed};
+        *vertices++ = {corners[edge[1]], packed};
+    }
+}
+
+void DebugDraw::Text(const glm::vec3& position, std::string_view text,
+                     float height, const glm::vec4& color, bool depthTest) {
+    // Laid out in Latch(), once the camera orientation is known. The
+    // characters are copied into one buffer that keeps its capacity, so
+    // long strings do not allocate every frame.
+    auto offset = static_cast<uint32_t>(s_TextChars.size());
+    s_TextChars.insert(s_TextChars.end(), text.begin(), text.end());
+    s_Text.push_back({position, offset, static_cast<uint32_t>(text.size()),
+                      height, glm::packUnorm4x8(color), depthTest});
+}
+
+void DebugDraw::Latch(const Camera& camera) {
+    BuildText(camera);
+
+    // Swapping keeps the capacity of both sets of streams
+    for (int stream : {OVERLAY, DEPTH_TESTED}) {
+        std::swap(s_Vertices[stream], s_Latched[stream]);
+        s_Vertices[stream].clear();
+    }
+    s_Text.clear();
+    s_TextChars.clear();
+    s_Overflowed = false;
+}
+
+void DebugDraw::Flush(const Camera& camera) {
+    auto& overlay = s_Latched[OVERLAY];
+    auto& depthTested = s_Latched[DEPTH_TESTED];
+    if (!s_VAO || (overlay.empty() && depthTested.empty())) {
+        overlay.clear();
+        depthTested.clear();
+        return;
+    }
+
+    GPUProfiler::ScopedPass debugPass("DebugDraw");
+
+    // One upload for both streams, depth-tested lines first
+    size_t depthTestedSize = depthTested.size() * sizeof(DebugVertex);
+    size_t overlaySize = overlay.size() * sizeof(DebugVertex);
+    glBindBuffer(GL_ARRAY_BUFFER, s_VBO);
+    glBufferData(GL_ARRAY_BUFFER, depthTestedSize + overlaySize, nullptr,
+                 GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, depthTestedSize, depthTested.data());
+    glBufferSubData(GL_ARRAY_BUFFER, depthTestedSize, overlaySize,
+                    overlay.data());
+    RenderStatistics::RecordBufferUpload(depthTestedSize + overlaySize);
+
+    s_Shader->Use();
+    s_Shader->SetMat4("viewProjection", camera.GetViewProjectionMatrix());
+    glBindVertexArray(s_VAO);
+    RenderStatistics::RecordProgramBind();
+    RenderStatistics::RecordVertexArrayBind();
+
+    GLboolean depthTest = glIsEnabled(GL_DEPTH_TEST);
+    if (!depthTested.empty()) {
+        glEnable(GL_DEPTH_TEST);
+        glDrawArrays(GL_LINES, 0, static_cast<GLsizei>(depthTested.size()));
+        RenderStatistics::RecordDraw(0, depthTested.size() / 2);
+    }
+    if (!overlay.empty()) {
+        glDisable(GL_DEPTH_TEST);
+        glDrawArrays(GL_LINES, static_cast<GLint>(depthTested.size()),
+                     static_cast<GLsizei>(overlay.size()));
+        RenderStatistics::RecordDraw(0, overlay.size() / 2);
+    }
+
+    if (depthTest) {
+        glEnable(GL_DEPTH_TEST);
+    } else {
+        glDisable(GL_DEPTH_TEST);
+    }
+    glBindVertexArray(0);
+
+    overlay.clear();
+    depthTested.clear();
+}
+
+void DebugDraw::Clear() {
+    // clear() keeps the capacity, so the next frame does not allocate
+    s_Vertices[OVERLAY].clear();
+    s_Vertices[DEPTH_TESTED].clear();
+    s_Latched[OVERLAY].clear();
+    s_Latched[DEPTH_TESTED].clear();
+    s_Text.clear();
+    s_TextChars.clear();
+    s_Overflowed = false;
+}
+
+DebugDraw::DebugVertex* DebugDraw::Append(size_t count, bool depthTest) {
+    size_t total = s_Vertices[OVERLAY].size() + s_Vertices[DEPTH_TESTED].size();
+    if (total + count > MAX_VERTICES) {
+        if (!s_Overflowed) {
+            LOG_WARN("DebugDraw exceeded {} vertices this frame, dropping "
+                     "further shapes",
+                     MAX_VERTICES);
+            s_Overflowed = true;
+        }
+        return nullptr;
+    }
+
+    auto& stream = s_Vertices[depthTest ? DEPTH_TESTED : OVERLAY];
+    size_t first = stream.size();
+    stream.resize(first + count);
+    return &stream[first];
+}
+
+void DebugDraw::BuildText(const Camera& camera) {
+    glm::vec3 right = camera.GetRight();
+    glm::vec3 up = camera.GetUp();
+
+    for (const DebugText& text : s_Text) {
+        // A cell is half as wide as it is high, plus spacing
+        float scale = text.Height * 0.5f;
+        glm::vec3 lineStart = text.Position;
+        glm::vec3 cursor = lineStart;
+
+        std::string_view characters(s_TextChars.data() + text.Offset,
+                                    text.Length);
+        for (char character : characters) {
+            if (character == '\n') {
+                lineStart -= up * (text.Height * 1.5f);
+                cursor = lineStart;
+                continue;
+            }
+
+            uint16_t glyph = GetGlyph(character);
+            DebugVertex* vertices =
+                glyph ? Append(std::popcount(glyph) * 2, text.DepthTest)
+                      : nullptr;
+            if (glyph && !vertices) {
+                return;
+            }
+
+            for (int segment = 0; glyph; segment++, glyph >>= 1) {
+                if (glyph & 1) {
+                    const float* s = SEGMENTS[segment];
+                    *vertices++ = {cursor + (right * s[0] + up * s[1]) * scale,
+                                   text.Color};
+                    *vertices++ = {cursor + (right * s[2] + up * s[3]) * scale,
+                                   text.Color};
+                }
+            }
+
+            cursor += right * (text.Height * 0.75f);
+        }
+    }
+}
+
+}  // namespace Obelisk
+
+#endif
@@ -0,0 +1,753 @@
+#include "Obelisk/Renderer/GLCapture.h"
+#include <cstring>
+#include <fstream>
+#include "Obelisk/Renderer/GLCaptureFormat.h"
+
+namespace Obelisk {
+
+// Every glad entry point the engine calls and the capture records
+#define OBELISK_CAPTURED_FUNCTIONS(X) \
+    X(ActiveTexture)                  \
+    X(AttachShader)                   \
+    X(BindBuffer)                     \
+    X(BindBufferBase)                 \
+    X(BindBufferRange)                \
+    X(BindFramebuffer)                \
+    X(BindRenderbuffer)               \
+    X(BindTexture)                    \
+    X(BindVertexArray)                \
+    X(BlendFunc)                      \
+    X(BlitFramebuffer)                \
+    X(BufferData)                     \
+    X(BufferSubData)                  \
+    X(Clear)                          \
+    X(ClearColor)                     \
+    X(CompileShader)                  \
+    X(CompressedTexImage2D)           \
+    X(CreateProgram)                  \
+    X(CreateShader)                   \
+    X(DeleteBuffers)                  \
+    X(DeleteFramebuffers)             \
+    X(DeleteProgram)                  \
+    X(DeleteRenderbuffers)            \
+    X(DeleteShader)                   \
+    X(DeleteTextures)                 \
+    X(DeleteVertexArrays)             \
+    X(DepthMask)                      \
+    X(DetachShader)                   \
+    X(Disable)                        \
+    X(DrawArrays)                     \
+    X(DrawArraysInstanced)            \
+    X(DrawElements)                   \
+    X(DrawElementsBaseVertex)         \
+    X(Enable)                         \
+    X(EnableVertexAttribArray)        \
+    X(FramebufferRenderbuffer)        \
+    X(FramebufferTexture2D)           \
+    X(GenBuffers)                     \
+    X(GenFramebuffers)                \
+    X(GenRenderbuffers)               \
+    X(GenTextures)                    \
+    X(GenVertexArrays)                \
+    X(GenerateMipmap)                 \
+    X(GetUniformBlockIndex)           \
+    X(GetUniformLocation)             \
+    X(LinkProgram)                    \
+    X(PixelStorei)                    \
+    X(RenderbufferStorage)            \
+    X(ShaderSource)                   \
+    X(TexBuffer)                      \
+    X(TexImage2D)                     \
+    X(TexParameteri)                  \
+    X(Uniform1f)                      \
+    X(Uniform1i)                      \
+    X(Uniform2f)                      \
+    X(Uniform3f)                      \
+    X(Uniform4f)                      \
+    X(UniformBlockBinding)            \
+    X(UniformMatrix4fv)               \
+    X(UseProgram)                     \
+    X(VertexAttribDivisor)            \
+    X(VertexAttribPointer)            \
+    X(Viewport)
+
+namespace {
+/**
+ * @brief The driver entry points that were installed before capturing.
+ */
+struct RealFunctions {
+#define OBELISK_DECLARE_REAL(name) decltype(glad_gl##name) name = nullptr;
+        OBELISK_CAPTURED_FUNCTIONS(OBELISK_DECLARE_REAL)
+#undef OBELISK_DECLARE_REAL
+};
+
+RealFunctions s_Real;
+std::vector<uint8_t> s_Stream;  // Serialized commands
+uint64_t s_CommandCount = 0;
+GLint s_UnpackAlignment = 4;  // Needed to size glTexImage2D payloads
+
+/**
+ * @brief Append a value to the stream.
+ */
+template <typename T>
+void Write(T value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+    s_Stream.insert(s_Stream.end(), bytes, bytes + sizeof(T));
+}
+
+/**
+ * @brief Append a length-prefixed byte payload to the stream.
+ */
+void WriteBytes(const void* data, uint64_t size) {
+    Write<uint64_t>(size);
+    if (data && size > 0) {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        s_Stream.insert(s_Stream.end(), bytes, bytes + size);
+    }
+}
+
+/**
+ * @brief Start a command; returns the offset of its header.
+ */
+size_t BeginCommand(GLCaptureCommand command) {
+    size_t start = s_Stream.size();
+    Write(static_cast<uint16_t>(command));
+    Write<uint32_t>(0);  // Payload size, patched by EndCommand
+    return start;
+}
+
+/**
+ * @brief Finish a command by patching its payload size.
+ */
+void EndCommand(size_t start) {
+    constexpr size_t headerSize = sizeof(uint16_t) + sizeof(uint32_t);
+    auto payloadSize =
+        static_cast<uint32_t>(s_Stream.size() - start - headerSize);
+    std::memcpy(s_Stream.data() + start + sizeof(uint16_t), &payloadSize,
+                sizeof(payloadSize));
+    s_CommandCount++;
+}
+
+/**
+ * @brief Record a command whose payload is a fixed list of values.
+ */
+template <typename... Args>
+void Record(GLCaptureCommand command, Args... args) {
+    size_t start = BeginCommand(command);
+    (Write(args), ...);
+    EndCommand(start);
+}
+
+/**
+ * @brief Record a Gen or Delete call as a count and a list of names.
+ */
+void RecordNames(GLCaptureCommand command, GLsizei n, const GLuint* names) {
+    size_t start = BeginCommand(command);
+    Write<uint32_t>(n);
+    for (GLsizei i = 0; i < n; i++) {
+        Write<uint32_t>(names[i]);
+    }
+    EndCommand(start);
+}
+
+/**
+ * @brief Size in bytes of one pixel of client memory in the given layout.
+ */
+size_t GetPixelSize(GLenum format, GLenum type) {
+    if (type == GL_UNSIGNED_INT_24_8) return 4;
+
+    size_t components = 4;
+    switch (format) {
+        case GL_RED:
+        case GL_DEPTH_COMPONENT:
+            components = 1;
+            break;
+        case GL_RG:
+            components = 2;
+            break;
+        case GL_RGB:
+        case GL_BGR:
+            components = 3;
+            break;
+        default:
+            break;
+    }
+
+    switch (type) {
+        case GL_UNSIGNED_SHORT:
+        case GL_SHORT:
+        case GL_HALF_FLOAT:
+            return components * 2;
+        case GL_UNSIGNED_INT:
+        case GL_INT:
+        case GL_FLOAT:
+            return components * 4;
+        default:
+            return components;
+    }
+}
+
+// === Recording wrappers ===
+
+void APIENTRY CaptureActiveTexture(GLenum texture) {
+    Record(GLCaptureCommand::ActiveTexture, texture);
+    s_Real.ActiveTexture(texture);
+}
+
+void APIENTRY CaptureAttachShader(GLuint program, GLuint shader) {
+    Record(GLCaptureCommand::AttachShader, program, shader);
+    s_Real.AttachShader(program, shader);
+}
+
+void APIENTRY CaptureBindBuffer(GLenum target, GLuint buffer) {
+    Record(GLCaptureCommand::BindBuffer, target, buffer);
+    s_Real.BindBuffer(target, buffer);
+}
+
+void APIENTRY CaptureBindBufferBase(GLenum target, GLuint index,
+                                    GLuint buffer) {
+    Record(GLCaptureCommand::BindBufferBase, target, index, buffer);
+    s_Real.BindBufferBase(target, index, buffer);
+}
+
+void APIENTRY CaptureBindBufferRange(GLenum target, GLuint index,
+                                     GLuint buffer, GLintptr offset,
+                                     GLsizeiptr size) {
+    Record(GLCaptureCommand::BindBufferRange, target, index, buffer,
+           static_cast<uint64_t>(offset), static_cast<uint64_t>(size));
+    s_Real.BindBufferRange(target, index, buffer, offset, size);
+}
+
+void APIENTRY CaptureBindFramebuffer(GLenum target, GLuint framebuffer) {
+    Record(GLCaptureCommand::BindFramebuffer, target, framebuffer);
+    s_Real.BindFramebuffer(target, framebuffer);
+}
+
+void APIENTRY CaptureBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+    Record(GLCaptureCommand::BindRenderbuffer, target, renderbuffer);
+    s_Real.BindRenderbuffer(target, renderbuffer);
+}
+
+void APIENTRY CaptureBindTexture(GLenum target, GLuint texture) {
+    Record(GLCaptureCommand::BindTexture, target, texture);
+    s_Real.BindTexture(target, texture);
+}
+
+void APIENTRY CaptureBindVertexArray(GLuint array) {
+    Record(GLCaptureCommand::BindVertexArray, array);
+    s_Real.BindVertexArray(array);
+}
+
+void APIENTRY CaptureBlendFunc(GLenum sfactor, GLenum dfactor) {
+    Record(GLCaptureCommand::BlendFunc, sfactor, dfactor);
+    s_Real.BlendFunc(sfactor, dfactor);
+}
+
+void APIENTRY CaptureBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1,
+                                     GLint srcY1, GLint dstX0, GLint dstY0,
+                                     GLint dstX1, GLint dstY1, GLbitfield mask,
+                                     GLenum filter) {
+    Record(GLCaptureCommand::BlitFramebuffer, srcX0, srcY0, srcX1, srcY1,
+           dstX0, dstY0, dstX1, dstY1, mask, filter);
+    s_Real.BlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1,
+                           dstY1, mask, filter);
+}
+
+void APIENTRY CaptureBufferData(GLenum target, GLsizeiptr size,
+                                const void* data, GLenum usage) {
+    size_t start = BeginCommand(GLCaptureCommand::BufferData);
+    Write(target);
+    Write(usage);
+    Write<uint64_t>(size);
+    WriteBytes(data, data ? size : 0);
+    EndCommand(start);
+    s_Real.BufferData(target, size, data, usage);
+}
+
+void APIENTRY CaptureBufferSubData(GLenum target, GLintptr offset,
+                                   GLsizeiptr size, const void* data) {
+    size_t start = BeginCommand(GLCaptureCommand::BufferSubData);
+    Write(target);
+    Write<uint64_t>(offset);
+    WriteBytes(data, size);
+    EndCommand(start);
+    s_Real.BufferSubData(target, offset, size, data);
+}
+
+void APIENTRY CaptureClear(GLbitfield mask) {
+    Record(GLCaptureCommand::Clear, mask);
+    s_Real.Clear(mask);
+}
+
+void APIENTRY CaptureClearColor(GLfloat red, GLfloat green, GLfloat blue,
+                                GLfloat alpha) {
+    Record(GLCaptureCommand::ClearColor, red, green, blue, alpha);
+    s_Real.ClearColor(red, green, blue, alpha);
+}
+
+void APIENTRY CaptureCompileShader(GLuint shader) {
+    Record(GLCaptureCommand::CompileShader, shader);
+    s_Real.CompileShader(shader);
+}
+
+void APIENTRY CaptureCompressedTexImage2D(GLenum target, GLint level,
+                                          GLenum internalformat,
+                                          GLsizei width, GLsizei height,
+                                          GLint border, GLsizei imageSize,
+                                          const void* data) {
+    size_t start = BeginCommand(GLCaptureCommand::CompressedTexImage2D);
+    Write(target);
+    Write(level);
+    Write(internalformat);
+    Write(width);
+    Write(height);
+    WriteBytes(data, data ? imageSize : 0);
+    EndCommand(start);
+    s_Real.CompressedTexImage2D(target, level, internalformat, width, height,
+                                border, imageSize, data);
+}
+
+GLuint APIENTRY CaptureCreateProgram() {
+    GLuint program = s_Real.CreateProgram();
+    Record(GLCaptureCommand::CreateProgram, program);
+    return program;
+}
+
+GLuint APIENTRY CaptureCreateShader(GLenum type) {
+    GLuint shader = s_Real.CreateShader(type);
+    Record(GLCaptureCommand::CreateShader, type, shader);
+    return shader;
+}
+
+void APIENTRY CaptureDeleteBuffers(GLsizei n, const GLuint* buffers) {
+    RecordNames(GLCaptureCommand::DeleteBuffers, n, buffers);
+    s_Real.DeleteBuffers(n, buffers);
+}
+
+void APIENTRY CaptureDeleteFramebuffers(GLsizei n, const GLuint* names) {
+    RecordNames(GLCaptureCommand::DeleteFramebuffers, n, names);
+    s_Real.DeleteFramebuffers(n, names);
+}
+
+void APIENTRY CaptureDeleteProgram(GLuint program) {
+    Record(GLCaptureCommand::DeleteProgram, program);
+    s_Real.DeleteProgram(program);
+}
+
+void APIENTRY CaptureDeleteRenderbuffers(GLsizei n, const GLuint* names) {
+    RecordNames(GLCaptureCommand::DeleteRenderbuffers, n, names);
+    s_Real.DeleteRenderbuffers(n, names);
+}
+
+void APIENTRY CaptureDeleteShader(GLuint shader) {
+    Record(GLCaptureCommand::DeleteShader, shader);
+    s_Real.DeleteShader(shader);
+}
+
+void APIENTRY CaptureDeleteTextures(GLsizei n, const GLuint* textures) {
+    RecordNames(GLCaptureCommand::DeleteTextures, n, textures);
+    s_Real.DeleteTextures(n, textures);
+}
+
+void APIENTRY CaptureDeleteVertexArrays(GLsizei n, const GLuint* arrays) {
+    RecordNames(GLCaptureCommand::DeleteVertexArrays, n, arrays);
+    s_Real.DeleteVertexArrays(n, arrays);
+}
+
+void APIENTRY CaptureDepthMask(GLboolean flag) {
+    Record(GLCaptureCommand::DepthMask, static_cast<uint32_t>(flag));
+    s_Real.DepthMask(flag);
+}
+
+void APIENTRY CaptureDetachShader(GLuint program, GLuint shader) {
+    Record(GLCaptureCommand::DetachShader, program, shader);
+    s_Real.DetachShader(program, shader);
+}
+
+void APIENTRY CaptureDisable(GLenum cap) {
+    Record(GLCaptureCommand::Disable, cap);
+    s_Real.Disable(cap);
+}
+
+void APIENTRY CaptureDrawArrays(GLenum mode, GLint first, GLsizei count) {
+    Record(GLCaptureCommand::DrawArrays, mode, first, count);
+    s_Real.DrawArrays(mode, first, count);
+}
+
+void APIENTRY CaptureDrawArraysInstanced(GLenum mode, GLint first,
+                                         GLsizei count, GLsizei instancecount) {
+    Record(GLCaptureCommand::DrawArraysInstanced, mode, first, count,
+           instancecount);
+    s_Real.DrawArraysInstanced(mode, first, count, instancecount);
+}
+
+void APIENTRY CaptureDrawElements(GLenum mode, GLsizei count, GLenum type,
+                                  const void* indices) {
+    // The engine always draws from an element buffer, so this is an offset
+    Record(GLCaptureCommand::DrawElements, mode, count, type,
+           static_cast<uint64_t>(reinterpret_cast<uintptr_t>(indices)));
+    s_Real.DrawElements(mode, count, type, indices);
+}
+
+void APIENTRY CaptureDrawElementsBaseVertex(GLenum mode, GLsizei count,
+                                            GLenum type, const void* indices,
+                                            GLint basevertex) {
+    Record(GLCaptureCommand::DrawElementsBaseVertex, mode, count, type,
+           static_cast<uint64_t>(reinterpret_cast<uintptr_t>(indices)),
+           basevertex);
+    s_Real.DrawElementsBaseVertex(mode, count, type, indices, basevertex);
+}
+
+void APIENTRY CaptureEnable(GLenum cap) {
+    Record(GLCaptureCommand::Enable, cap);
+    s_Real.Enable(cap);
+}
+
+void APIENTRY CaptureEnableVertexAttribArray(GLuint index) {
+    Record(GLCaptureCommand::EnableVertexAttribArray, index);
+    s_Real.EnableVertexAttribArray(index);
+}
+
+void APIENTRY CaptureFramebufferRenderbuffer(GLenum target, GLenum attachment,
+                                             GLenum renderbuffertarget,
+                                             GLuint renderbuffer) {
+    Record(GLCaptureCommand::FramebufferRenderbuffer, target, attachment,
+           renderbuffertarget, renderbuffer);
+    s_Real.FramebufferRenderbuffer(target, attachment, renderbuffertarget,
+                                   renderbuffer);
+}
+
+void APIENTRY CaptureFramebufferTexture2D(GLenum target, GLenum attachment,
+                                          GLenum textarget, GLuint texture,
+                                          GLint level) {
+    Record(GLCaptureCommand::FramebufferTexture2D, target, attachment,
+           textarget, texture, level);
+    s_Real.FramebufferTexture2D(target, attachment, textarget, texture, level);
+}
+
+void APIENTRY CaptureGenBuffers(GLsizei n, GLuint* buffers) {
+    s_Real.GenBuffers(n, buffers);
+    RecordNames(GLCaptureCommand::GenBuffers, n, buffers);
+}
+
+void APIENTRY CaptureGenFramebuffers(GLsizei n, GLuint* framebuffers) {
+    s_Real.GenFramebuffers(n, framebuffers);
+    RecordNames(GLCaptureCommand::GenFramebuffers, n, framebuffers);
+}
+
+void APIENTRY CaptureGenRenderbuffers(GLsizei n, GLuint* renderbuffers) {
+    s_Real.GenRenderbuffers(n, renderbuffers);
+    RecordNames(GLCaptureCommand::GenRenderbuffers, n, renderbuffers);
+}
+
+void APIENTRY CaptureGenTextures(GLsizei n, GLuint* textures) {
+    s_Real.GenTextures(n, textures);
+    RecordNames(GLCaptureCommand::GenTextures, n, textures);
+}
+
+void APIENTRY CaptureGenVertexArrays(GLsizei n, GLuint* arrays) {
+    s_Real.GenVertexArrays(n, arrays);
+    RecordNames(GLCaptureCommand::GenVertexArrays, n, arrays);
+}
+
+void APIENTRY CaptureGenerateMipmap(GLenum target) {
+    Record(GLCaptureCommand::GenerateMipmap, target);
+    s_Real.GenerateMipmap(target);
+}
+
+GLuint APIENTRY CaptureGetUniformBlockIndex(GLuint program,
+                                            const GLchar* name) {
+    GLuint index = s_Real.GetUniformBlockIndex(program, name);
+
+    size_t start = BeginCommand(GLCaptureCommand::GetUniformBlockIndex);
+    Write(program);
+    Write(index);
+    WriteBytes(name, std::strlen(name));
+    EndCommand(start);
+    return index;
+}
+
+GLint APIENTRY CaptureGetUniformLocation(GLuint program, const GLchar* name) {
+    GLint location = s_Real.GetUniformLocation(program, name);
+
+    size_t start = BeginCommand(GLCaptureCommand::GetUniformLocation);
+    Write(program);
+    Write(location);
+    WriteBytes(name, std::strlen(name));
+    EndCommand(start);
+    return location;
+}
+
+void APIENTRY CaptureLinkProgram(GLuint program) {
+    Record(GLCaptureCommand::LinkProgram, program);
+    s_Real.LinkProgram(program);
+}
+
+void APIENTRY CapturePixelStorei(GLenum pname, GLint param) {
+    if (pname == GL_UNPACK_ALIGNMENT) {
+        s_UnpackAlignment = param;
+    }
+    Record(GLCaptureCommand::PixelStorei, pname, param);
+    s_Real.PixelStorei(pname, param);
+}
+
+void APIENTRY CaptureRenderbufferStorage(GLenum target, GLenum internalformat,
+                                         GLsizei width, GLsizei height) {
+    Record(GLCaptureCommand::RenderbufferStorage, target, internalformat,
+           width, height);
+    s_Real.RenderbufferStorage(target, internalformat, width, height);
+}
+
+void APIENTRY CaptureShaderSource(GLuint shader, GLsizei count,
+                                  const GLchar* const* string,
+                                  const GLint* length) {
+    // Multiple strings are joined; the replay passes a single string
+    std::string source;
+    for (GLsizei i = 0; i < count; i++) {
+        if (length && length[i] >= 0) {
+            source.append(string[i], length[i]);
+        } else {
+            source.append(string[i]);
+        }
+    }
+
+    size_t start = BeginCommand(GLCaptureCommand::ShaderSource);
+    Write(shader);
+    WriteBytes(source.data(), source.size());
+    EndCommand(start);
+    s_Real.ShaderSource(shader, count, string, length);
+}
+
+void APIENTRY CaptureTexBuffer(GLenum target, GLenum internalformat,
+                               GLuint buffer) {
+    Record(GLCaptureCommand::TexBuffer, target, internalformat, buffer);
+    s_Real.TexBuffer(target, internalformat, buffer);
+}
+
+void APIENTRY CaptureTexImage2D(GLenum target, GLint level,
+                                GLint internalformat, GLsizei width,
+                                GLsizei height, GLint border, GLenum format,
+                                GLenum type, const void* pixels) {
+    uint64_t size = 0;
+    if (pixels && width > 0 && height > 0) {
+        size_t rowSize = GetPixelSize(format, type) * width;
+        size_t alignment = static_cast<size_t>(s_UnpackAlignment);
+        size_t stride = (rowSize + alignment - 1) / alignment * alignment;
+        size = stride * (height - 1) + rowSize;
+    }
+
+    size_t start = BeginCommand(GLCaptureCommand::TexImage2D);
+    Write(target);
+    Write(level);
+    Write(internalformat);
+    Write(width);
+    Write(height);
+    Write(format);
+    Write(type);
+    WriteBytes(pixels, size);
+    EndCommand(start);
+    s_Real.TexImage2D(target, level, internalformat, width, height, border,
+                      format, type, pixels);
+}
+
+void APIENTRY CaptureTexParameteri(GLenum target, GLenum pname, GLint param) {
+    Record(GLCaptureCommand::TexParameteri, target, pname, param);
+    s_Real.TexParameteri(target, pname, param);
+}
+
+void APIENTRY CaptureUniform1f(GLint location, GLfloat v0) {
+    Record(GLCaptureCommand::Uniform1f, location, v0);
+    s_Real.Uniform1f(location, v0);
+}
+
+void APIENTRY CaptureUniform1i(GLint location, GLint v0) {
+    Record(GLCaptureCommand::Uniform1i, location, v0);
+    s_Real.Uniform1i(location, v0);
+}
+
+void APIENTRY CaptureUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+    Record(GLCaptureCommand::Uniform2f, location, v0, v1);
+    s_Real.Uniform2f(location, v0, v1);
+}
+
+void APIENTRY CaptureUniform3f(GLint location, GLfloat v0, GLfloat v1,
+                               GLfloat v2) {
+    Record(GLCaptureCommand::Uniform3f, location, v0, v1, v2);
+    s_Real.Uniform3f(location, v0, v1, v2);
+}
+
+void APIENTRY CaptureUniform4f(GLint location, GLfloat v0, GLfloat v1,
+                               GLfloat v2, GLfloat v3) {
+    Record(GLCaptureCommand::Uniform4f, location, v0, v1, v2, v3);
+    s_Real.Uniform4f(location, v0, v1, v2, v3);
+}
+
+void APIENTRY CaptureUniformBlockBinding(GLuint program, GLuint index,
+                                         GLuint binding) {
+    Record(GLCaptureCommand::UniformBlockBinding, program, index, binding);
+    s_Real.UniformBlockBinding(program, index, binding);
+}
+
+void APIENTRY CaptureUniformMatrix4fv(GLint location, GLsizei count,
+                                      GLboolean transpose,
+                                      const GLfloat* value) {
+    size_t start = BeginCommand(GLCaptureCommand::UniformMatrix4fv);
+    Write(location);
+    Write(count);
+    Write(static_cast<uint32_t>(transpose));
+    WriteBytes(value, sizeof(GLfloat) * 16 * count);
+    EndCommand(start);
+    s_Real.UniformMatrix4fv(location, count, transpose, value);
+}
+
+void APIENTRY CaptureUseProgram(GLuint program) {
+    Record(GLCaptureCommand::UseProgram, program);
+    s_Real.UseProgram(program);
+}
+
+void APIENTRY CaptureVertexAttribDivisor(GLuint index, GLuint divisor) {
+    Record(GLCaptureCommand::VertexAttribDivisor, index, divisor);
+    s_Real.VertexAttribDivisor(index, divisor);
+}
+
+void APIENTRY CaptureVertexAttribPointer(GLuint index, GLint size, GLenum type,
+                                         GLboolean normalized, GLsizei stride,
+                                         const void* pointer) {
+    // Attributes always source from a bound buffer, so this is an offset
+    Record(GLCaptureCommand::VertexAttribPointer, index, size, type,
+           static_cast<uint32_t>(normalized), stride,
+           static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pointer)));
+    s_Real.VertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+
+void APIENTRY CaptureViewport(GLint x, GLint y, GLsizei width,
+                              GLsizei height) {
+    Record(GLCaptureCommand::Viewport, x, y, width, height);
+    s_Real.Viewport(x, y, width, height);
+}
+}  // namespace
+
+// Static member definitions
+std::filesystem::path GLCapture::s_OutputPath;
+size_t GLCapture::s_FramesRemaining = 0;
+uint32_t GLCapture::s_FrameCount = 0;
+std::atomic<bool> GLCapture::s_Capturing = false;
+
+bool GLCapture::Begin(const std::filesystem::path& path, size_t frames) {
+    if (s_Capturing) {
+        LOG_WARN("GL capture already in progress ({})", s_OutputPath.string());
+        return false;
+    }
+    if (frames == 0) {
+        LOG_WARN("GL capture requested for 0 frames, ignoring");
+        return false;
+    }
+
+    s_OutputPath = path;
+    s_FramesRemaining = frames;
+    s_FrameCount = 0;
+    s_CommandCount = 0;
+    s_Stream.clear();
+    s_Stream.reserve(16 * 1024 * 1024);
+
+    GLint alignment = 4;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignment);
+    s_UnpackAlignment = alignment;
+
+    InstallHooks();
+    RecordPrologue();
+    s_Capturing = true;
+
+    LOG_INFO("GL capture started: {} frame(s) to {}", frames, path.string());
+    return true;
+}
+
+void GLCapture::EndFrame() {
+    if (!s_Capturing) {
+        return;
+    }
+
+    Record(GLCaptureCommand::Frame);
+    s_FrameCount++;
+
+    if (--s_FramesRemaining == 0) {
+        End();
+    }
+}
+
+bool GLCapture::End() {
+    if (!s_Capturing) {
+        return false;
+    }
+
+    RemoveHooks();
+    s_Capturing = false;
+
+    GLint viewport[4] = {};
+    glGetIntegerv(GL_VIEWPORT, viewport);
+
+    GLCaptureHeader header{};
+    header.Magic = GL_CAPTURE_MAGIC;
+    header.Version = GL_CAPTURE_VERSION;
+    header.FrameCount = s_FrameCount;
+    header.Width = static_cast<uint32_t>(viewport[2]);
+    header.Height = static_cast<uint32_t>(viewport[3]);
+    header.CommandCount = s_CommandCount;
+    header.StreamSize = s_Stream.size();
+
+    std::error_code error;
+    if (s_OutputPath.has_parent_path()) {
+        std::filesystem::create_directories(s_OutputPath.parent_path(), error);
+    }
+
+    std::ofstream file(s_OutputPath, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(s_Stream.data()),
+               static_cast<std::streamsize>(s_Stream.size()));
+
+    bool written = static_cast<bool>(file);
+    if (written) {
+        LOG_INFO("GL capture written: {} ({} frame(s), {} commands, {} KiB)",
+                 s_OutputPath.string(), s_FrameCount, s_CommandCount,
+                 s_Stream.size() / 1024);
+    } else {
+        LOG_ERROR("Failed to write GL capture to {}", s_OutputPath.string());
+    }
+
+    s_Stream.clear();
+    s_Stream.shrink_to_fit();
+    return written;
+}
+
+void GLCapture::InstallHooks() {
+#define OBELISK_INSTALL_HOOK(name)    \
+    s_Real.name = glad_gl##name;      \
+    glad_gl##name = Capture##name;
+    OBELISK_CAPTURED_FUNCTIONS(OBELISK_INSTALL_HOOK)
+#undef OBELISK_INSTALL_HOOK
+}
+
+void GLCapture::RemoveHooks() {
+#define OBELISK_REMOVE_HOOK(name) glad_gl##name = s_Real.name;
+    OBELISK_CAPTURED_FUNCTIONS(OBELISK_REMOVE_HOOK)
+#undef OBELISK_REMOVE_HOOK
+}
+
+void GLCapture::RecordPrologue() {
+    GLint viewport[4] = {};
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    Record(GLCaptureCommand::Viewport, viewport[0], viewport[1], viewport[2],
+           viewport[3]);
+
+    for (GLenum capability : {GL_DEPTH_TEST, GL_BLEND, GL_CULL_FACE}) {
+        Record(glIsEnabled(capability) ? GLCaptureCommand::Enable
+                                       : GLCaptureCommand::Disable,
+               capability);
+    }
+
+    Record(GLCaptureCommand::PixelStorei,
+           static_cast<GLenum>(GL_UNPACK_ALIGNMENT), s_UnpackAlignment);
+}
+
+}  // namespace Obelisk
@@ -0,0 +1,118 @@
+#include "Obelisk/Renderer/GLExtensions.h"
+
+namespace Obelisk {
+
+// Static member definitions
+GLExtensions::GetProgramBinaryProc GLExtensions::GetProgramBinary = nullptr;
+GLExtensions::ProgramBinaryProc GLExtensions::ProgramBinary = nullptr;
+GLExtensions::ProgramParameteriProc GLExtensions::ProgramParameteri = nullptr;
+GLExtensions::MaxShaderCompilerThreadsProc
+    GLExtensions::MaxShaderCompilerThreads = nullptr;
+GLExtensions::DispatchComputeProc GLExtensions::DispatchCompute = nullptr;
+GLExtensions::MemoryBarrierProc GLExtensions::GLMemoryBarrier = nullptr;
+GLExtensions::MultiDrawElementsIndirectProc
+    GLExtensions::MultiDrawElementsIndirect = nullptr;
+GLExtensions::BindImageTextureProc GLExtensions::BindImageTexture = nullptr;
+
+int GLExtensions::s_MajorVersion = 0;
+int GLExtensions::s_MinorVersion = 0;
+std::unordered_set<std::string> GLExtensions::s_Extensions;
+
+bool GLExtensions::s_HasProgramBinary = false;
+bool GLExtensions::s_HasParallelShaderCompile = false;
+bool GLExtensions::s_HasCompute = false;
+bool GLExtensions::s_HasS3TC = false;
+
+void GLExtensions::Initialize(GLADloadproc loader) {
+    glGetIntegerv(GL_MAJOR_VERSION, &s_MajorVersion);
+    glGetIntegerv(GL_MINOR_VERSION, &s_MinorVersion);
+
+    s_Extensions.clear();
+    int extensionCount = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+    for (int i = 0; i < extensionCount; ++i) {
+        const auto* name = reinterpret_cast<const char*>(
+            glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i)));
+        if (name) {
+            s_Extensions.emplace(name);
+        }
+    }
+
+    // Program binaries
+    if (IsVersionAtLeast(4, 1) ||
+        IsExtensionSupported("GL_ARB_get_program_binary")) {
+        GetProgramBinary = reinterpret_cast<GetProgramBinaryProc>(
+            loader("glGetProgramBinary"));
+        ProgramBinary =
+            reinterpret_cast<ProgramBinaryProc>(loader("glProgramBinary"));
+        ProgramParameteri = reinterpret_cast<ProgramParameteriProc>(
+            loader("glProgramParameteri"));
+
+        int formatCount = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+
+        s_HasProgramBinary = GetProgramBinary && ProgramBinary &&
+                             ProgramParameteri && formatCount > 0;
+    }
+
+    // Parallel shader compilation
+    if (IsExtensionSupported("GL_KHR_parallel_shader_compile")) {
+        MaxShaderCompilerThreads =
+            reinterpret_cast<MaxShaderCompilerThreadsProc>(
+                loader("glMaxShaderCompilerThreadsKHR"));
+    } else if (IsExtensionSupported("GL_ARB_parallel_shader_compile")) {
+        MaxShaderCompilerThreads =
+            reinterpret_cast<MaxShaderCompilerThreadsProc>(
+                loader("glMaxShaderCompilerThreadsARB"));
+    }
+
+    s_HasParallelShaderCompile = MaxShaderCompilerThreads != nullptr;
+    if (s_HasParallelShaderCompile) {
+        // Let the driver pick as many compiler threads as it sees fit
+        MaxShaderCompilerThreads(0xFFFFFFFF);
+    }
+
+    // Compute shaders and indirect draws
+    if (IsVersionAtLeast(4, 3) ||
+        (IsExtensionSupported("GL_ARB_compute_shader") &&
+         IsExtensionSupported("GL_ARB_shader_storage_buffer_object") &&
+         IsExtensionSupported("GL_ARB_shader_image_load_store") &&
+         IsExtensionSupported("GL_ARB_multi_draw_indirect") &&
+         IsExtensionSupported("GL_ARB_base_instance"))) {
+        DispatchCompute =
+            reinterpret_cast<DispatchComputeProc>(loader("glDispatchCompute"));
+        GLMemoryBarrier =
+            reinterpret_cast<MemoryBarrierProc>(loader("glMemoryBarrier"));
+        MultiDrawElementsIndirect =
+            reinterpret_cast<MultiDrawElementsIndirectProc>(
+                loader("glMultiDrawElementsIndirect"));
+        BindImageTexture = reinterpret_cast<BindImageTextureProc>(
+            loader("glBindImageTexture"));
+
+        s_HasCompute = DispatchCompute && GLMemoryBarrier &&
+                       MultiDrawElementsIndirect && BindImageTexture;
+    }
+
+    // Compressed textures
+    s_HasS3TC = IsExtensionSupported("GL_EXT_texture_compression_s3tc");
+
+    LOG_INFO("> OpenGL context v{}.{}, {} extensions", s_MajorVersion,
+             s_MinorVersion, s_Extensions.size());
+    LOG_TRACE(
+        "> Program binaries: {}, parallel shader compile: {}, compute: {}, "
+        "S3TC: {}",
+        s_HasProgramBinary ? "Yes" : "No",
+        s_HasParallelShaderCompile ? "Yes" : "No", s_HasCompute ? "Yes" : "No",
+        s_HasS3TC ? "Yes" : "No");
+}
+
+bool GLExtensions::IsVersionAtLeast(int major, int minor) {
+    return s_MajorVersion > major ||
+           (s_MajorVersion == major && s_MinorVersion >= minor);
+}
+
+bool GLExtensions::IsExtensionSupported(const std::string& name) {
+    return s_Extensions.contains(name);
+}
+
+}  // namespace Obelisk
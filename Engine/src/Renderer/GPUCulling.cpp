@@ -0,0 +1,636 @@
+#include "Obelisk/Renderer/GPUCulling.h"
+#include <algorithm>
+#include <bit>
+#include <numeric>
+#include "Obelisk/Core/Camera.h"
+#include "Obelisk/Core/Frustum.h"
+#include "Obelisk/Renderer/GLCapture.h"
+#include "Obelisk/Renderer/GLExtensions.h"
+#include "Obelisk/Renderer/GPUProfiler.h"
+#include "Obelisk/Renderer/Material.h"
+#include "Obelisk/Renderer/MaterialLibrary.h"
+#include "Obelisk/Renderer/Mesh.h"
+#include "Obelisk/Renderer/RenderStats.h"
+#include "Obelisk/Renderer/Renderer.h"
+#include "Obelisk/Renderer/Shader.h"
+#include "Obelisk/Renderer/ShaderPreprocessor.h"
+#include "Obelisk/Renderer/Texture.h"
+
+namespace Obelisk {
+
+namespace {
+// Storage buffer bindings, as declared in gpu_cull.comp
+constexpr unsigned int TRANSFORM_BINDING = 0;
+constexpr unsigned int INSTANCE_BINDING = 1;
+constexpr unsigned int COMMAND_BINDING = 2;
+constexpr unsigned int VISIBLE_BINDING = 3;
+
+// First vertex attribute of the instance model matrix (one per column)
+constexpr unsigned int INSTANCE_ATTRIBUTE = 3;
+
+constexpr const char* FRUSTUM_PLANE_UNIFORMS[Frustum::PlaneCount] = {
+    "uFrustumPlanes[0]", "uFrustumPlanes[1]", "uFrustumPlanes[2]",
+    "uFrustumPlanes[3]", "uFrustumPlanes[4]", "uFrustumPlanes[5]"};
+
+/**
+ * @brief Compile and link a compute shader from the shaders asset directory.
+ *
+ * @return Program, or 0 if compiling or linking failed
+ */
+unsigned int CompileCompute(const std::string& path) {
+    std::string source = ShaderPreprocessor::Process(path, {});
+    if (source.empty()) {
+        LOG_ERROR("Failed to read compute shader {}", path);
+        return 0;
+    }
+
+    const char* text = source.c_str();
+    GLuint shader = glCreateShader(GL_COMPUTE_SHADER);
+    glShaderSource(shader, 1, &text, nullptr);
+    glCompileShader(shader);
+
+    char infoLog[512] = {};
+    GLint success = 0;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    if (!success) {
+        glGetShaderInfoLog(shader, sizeof(infoLog), nullptr, infoLog);
+        LOG_ERROR("Compute shader {} failed to compile:\n{}", path, infoLog);
+        glDeleteShader(shader);
+        return 0;
+    }
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, shader);
+    glLinkProgram(program);
+    glDetachShader(program, shader);
+    glDeleteShader(shader);
+
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success) {
+        glGetProgramInfoLog(program, sizeof(infoLog), nullptr, infoLog);
+        LOG_ERROR("Compute shader {} failed to link:\n{}", path, infoLog);
+        glDeleteProgram(program);
+        return 0;
+    }
+
+    return program;
+}
+}  // namespace
+
+// Static member definitions
+bool GPUCulling::s_Enabled = true;
+bool GPUCulling::s_OcclusionCulling = true;
+unsigned int GPUCulling::s_CullProgram = 0;
+unsigned int GPUCulling::s_ReduceProgram = 0;
+
+unsigned int GPUCulling::s_VAO = 0;
+unsigned int GPUCulling::s_VertexBuffer = 0;
+unsigned int GPUCulling::s_IndexBuffer = 0;
+unsigned int GPUCulling::s_TransformBuffer = 0;
+unsigned int GPUCulling::s_InstanceBuffer = 0;
+unsigned int GPUCulling::s_CommandBuffer = 0;
+unsigned int GPUCulling::s_VisibleBuffer = 0;
+unsigned int GPUCulling::s_FrameBuffer = 0;
+
+std::vector<DrawElementsIndirectCommand> GPUCulling::s_Commands;
+std::vector<GPUCulling::DrawGroup> GPUCulling::s_Groups;
+std::unordered_map<const Shader*, std::shared_ptr<Shader>>
+    GPUCulling::s_Variants;
+size_t GPUCulling::s_InstanceCount = 0;
+size_t GPUCulling::s_StaticCount = 0;
+
+unsigned int GPUCulling::s_DepthTexture = 0;
+unsigned int GPUCulling::s_DepthFramebuffer = 0;
+unsigned int GPUCulling::s_Pyramid = 0;
+int GPUCulling::s_PyramidWidth = 0;
+int GPUCulling::s_PyramidHeight = 0;
+int GPUCulling::s_PyramidLevels = 0;
+bool GPUCulling::s_PyramidValid = false;
+glm::mat4 GPUCulling::s_PyramidViewProjection(1.0f);
+glm::mat4 GPUCulling::s_CullViewProjection(1.0f);
+
+void GPUCulling::Initialize() {
+    if (s_CullProgram) {
+        return;
+    }
+
+    if (!GLExtensions::HasCompute()) {
+        LOG_INFO("No compute shader support, culling on the CPU");
+        return;
+    }
+
+    s_CullProgram = CompileCompute("gpu_cull.comp");
+    s_ReduceProgram = CompileCompute("hiz_reduce.comp");
+    if (!s_CullProgram || !s_ReduceProgram) {
+        LOG_WARN("GPU culling shaders failed, culling on the CPU");
+        glDeleteProgram(s_CullProgram);
+        glDeleteProgram(s_ReduceProgram);
+        s_CullProgram = 0;
+        s_ReduceProgram = 0;
+        return;
+    }
+
+    LOG_INFO("GPUCulling initialized");
+}
+
+void GPUCulling::Shutdown() {
+    Clear();
+    DestroyPyramid();
+
+    if (s_CullProgram) {
+        glDeleteProgram(s_CullProgram);
+        glDeleteProgram(s_ReduceProgram);
+        s_CullProgram = 0;
+        s_ReduceProgram = 0;
+    }
+}
+
+bool GPUCulling::IsActive() {
+    // Captures only record OpenGL 3.3 calls, so they could not replay this
+    return s_VAO != 0 && !GLCapture::IsCapturing();
+}
+
+bool GPUCulling::Build(const std::vector<GPUCullingItem>& staticItems,
+                       const std::vector<GPUCullingItem>& dynamicItems) {
+    Clear();
+    if (!IsSupported()) {
+        return false;
+    }
+
+    std::vector<const GPUCullingItem*> items;
+    items.reserve(staticItems.size() + dynamicItems.size());
+    for (const GPUCullingItem& item : staticItems) {
+        items.push_back(&item);
+    }
+    for (const GPUCullingItem& item : dynamicItems) {
+        items.push_back(&item);
+    }
+    if (items.empty()) {
+        return false;
+    }
+
+    for (const GPUCullingItem* item : items) {
+        if (!item->DrawMesh || !item->DrawMaterial ||
+            !item->DrawMaterial->GetShader()) {
+            LOG_ERROR("GPUCulling items need a mesh and a shaded material");
+            return false;
+        }
+    }
+
+    // Group instances by material, then mesh, so each command's instances
+    // and each material's commands are contiguous
+    std::vector<size_t> order(items.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        const GPUCullingItem& left = *items[a];
+        const GPUCullingItem& right = *items[b];
+        uint64_t leftKey = left.DrawMaterial->GetSortKey();
+        uint64_t rightKey = right.DrawMaterial->GetSortKey();
+        if (leftKey != rightKey) {
+            return leftKey < rightKey;
+        }
+        if (left.DrawMaterial != right.DrawMaterial) {
+            return left.DrawMaterial->GetID() < right.DrawMaterial->GetID();
+        }
+        return left.DrawMesh->GetMeshID() < right.DrawMesh->GetMeshID();
+    });
+
+    // Merge every distinct mesh into one vertex and index buffer
+    std::vector<Vertex> vertices;
+    std::vector<unsigned int> indices;
+    std::unordered_map<const Mesh*, DrawElementsIndirectCommand> geometry;
+    std::vector<Vertex> meshVertices;
+    std::vector<unsigned int> meshIndices;
+    for (const GPUCullingItem* item : items) {
+        if (geometry.contains(item->DrawMesh)) {
+            continue;
+        }
+
+        item->DrawMesh->ReadBack(meshVertices, meshIndices);
+        DrawElementsIndirectCommand command{};
+        command.Count = static_cast<uint32_t>(meshIndices.size());
+        command.FirstIndex = static_cast<uint32_t>(indices.size());
+        command.BaseVertex = static_cast<int32_t>(vertices.size());
+        geometry.emplace(item->DrawMesh, command);
+
+        vertices.insert(vertices.end(), meshVertices.begin(),
+                        meshVertices.end());
+        indices.insert(indices.end(), meshIndices.begin(), meshIndices.end());
+    }
+
+    std::vector<Instance> instances(items.size());
+    std::vector<glm::mat4> transforms(items.size());
+    for (size_t i = 0; i < items.size(); i++) {
+        const AABB& bounds = items[i]->DrawMesh->GetBounds();
+        instances[i].Center = glm::vec4(bounds.GetCenter(), 0.0f);
+        instances[i].Extents = glm::vec4(bounds.GetExtents(), 0.0f);
+        transforms[i] = items[i]->Model;
+    }
+
+    // One command per mesh and material; instances of a command take
+    // consecutive visible slots starting at its base instance
+    const GPUCullingItem* previous = nullptr;
+    for (size_t slot = 0; slot < order.size(); slot++) {
+        const GPUCullingItem& item = *items[order[slot]];
+        bool newMaterial =
+            !previous || item.DrawMaterial != previous->DrawMaterial;
+        if (newMaterial || item.DrawMesh != previous->DrawMesh) {
+            DrawElementsIndirectCommand command = geometry[item.DrawMesh];
+            command.BaseInstance = static_cast<uint32_t>(slot);
+            s_Commands.push_back(command);
+        }
+        if (newMaterial) {
+            std::shared_ptr<Shader> variant =
+                GetVariant(*item.DrawMaterial->GetShader());
+            if (!variant) {
+                Clear();
+                return false;
+            }
+            s_Groups.push_back(
+                {variant, item.DrawMaterial, s_Commands.size() - 1, 0});
+        }
+        s_Groups.back().CommandCount =
+            s_Commands.size() - s_Groups.back().FirstCommand;
+
+        instances[order[slot]].Command =
+            static_cast<uint32_t>(s_Commands.size() - 1);
+        previous = &item;
+    }
+
+    s_InstanceCount = items.size();
+    s_StaticCount = staticItems.size();
+
+    glGenVertexArrays(1, &s_VAO);
+    glGenBuffers(1, &s_VertexBuffer);
+    glGenBuffers(1, &s_IndexBuffer);
+    glGenBuffers(1, &s_TransformBuffer);
+    glGenBuffers(1, &s_InstanceBuffer);
+    glGenBuffers(1, &s_CommandBuffer);
+    glGenBuffers(1, &s_VisibleBuffer);
+    glGenBuffers(1, &s_FrameBuffer);
+
+    glBindVertexArray(s_VAO);
+
+    // Same vertex layout as Mesh
+    glBindBuffer(GL_ARRAY_BUFFER, s_VertexBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * vertices.size(),
+                 vertices.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, s_IndexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned int) * indices.size(),
+                 indices.data(), GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), nullptr);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex),
+                          (void*)offsetof(Vertex, Color));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex),
+                          (void*)offsetof(Vertex, TextureCoords));
+    glEnableVertexAttribArray(2);
+
+    // Visible model matrices, one column per attribute, advanced per
+    // instance; the base instance of each command selects its range
+    glBindBuffer(GL_ARRAY_BUFFER, s_VisibleBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(glm::mat4) * s_InstanceCount,
+                 nullptr, GL_DYNAMIC_COPY);
+    for (unsigned int column = 0; column < 4; column++) {
+        unsigned int attribute = INSTANCE_ATTRIBUTE + column;
+        glVertexAttribPointer(attribute, 4, GL_FLOAT, GL_FALSE,
+                              sizeof(glm::mat4),
+                              (void*)(column * sizeof(glm::vec4)));
+        glEnableVertexAttribArray(attribute);
+        glVertexAttribDivisor(attribute, 1);
+    }
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, s_TransformBuffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER,
+                 sizeof(glm::mat4) * transforms.size(), transforms.data(),
+                 GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, s_InstanceBuffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(Instance) * instances.size(),
+                 instances.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, s_CommandBuffer);
+    glBufferData(GL_DRAW_INDIRECT_BUFFER,
+                 sizeof(DrawElementsIndirectCommand) * s_Commands.size(),
+                 s_Commands.data(), GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+
+    glBindBuffer(GL_UNIFORM_BUFFER, s_FrameBuffer);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(PerFrameBlock), nullptr,
+                 GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    LOG_INFO("GPUCulling built: {} instances ({} static), {} meshes, {} "
+             "commands, {} materials",
+             s_InstanceCount, s_StaticCount, geometry.size(),
+             s_Commands.size(), s_Groups.size());
+    return true;
+}
+
+void GPUCulling::Clear() {
+    if (s_VAO) {
+        unsigned int buffers[] = {s_VertexBuffer,  s_IndexBuffer,
+                                  s_TransformBuffer, s_InstanceBuffer,
+                                  s_CommandBuffer, s_VisibleBuffer,
+                                  s_FrameBuffer};
+        glDeleteVertexArrays(1, &s_VAO);
+        glDeleteBuffers(static_cast<GLsizei>(std::size(buffers)), buffers);
+        s_VAO = 0;
+        s_VertexBuffer = 0;
+        s_IndexBuffer = 0;
+        s_TransformBuffer = 0;
+        s_InstanceBuffer = 0;
+        s_CommandBuffer = 0;
+        s_VisibleBuffer = 0;
+        s_FrameBuffer = 0;
+    }
+
+    s_Commands.clear();
+    s_Groups.clear();
+    s_Variants.clear();
+    s_InstanceCount = 0;
+    s_StaticCount = 0;
+}
+
+void GPUCulling::Update(const std::vector<glm::mat4>& transforms) {
+    if (!IsActive() || transforms.empty()) {
+        return;
+    }
+
+    size_t count = std::min(transforms.size(), s_InstanceCount - s_StaticCount);
+    size_t bytes = sizeof(glm::mat4) * count;
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, s_TransformBuffer);
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER,
+                    sizeof(glm::mat4) * s_StaticCount, bytes,
+                    transforms.data());
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+    RenderStatistics::RecordBufferUpload(bytes);
+}
+
+void GPUCulling::Cull(const Camera& camera) {
+    if (!IsActive()) {
+        return;
+    }
+
+    GPUProfiler::ScopedPass cullPass("GPUCulling");
+
+    // Every command starts the frame without instances
+    size_t commandBytes =
+        sizeof(DrawElementsIndirectCommand) * s_Commands.size();
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, s_CommandBuffer);
+    glBufferSubData(GL_DRAW_INDIRECT_BUFFER, 0, commandBytes,
+                    s_Commands.data());
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    RenderStatistics::RecordBufferUpload(commandBytes);
+
+    s_CullViewProjection = camera.GetViewProjectionMatrix();
+    Frustum frustum(s_CullViewProjection);
+    bool occlusion = s_OcclusionCulling && s_PyramidValid;
+
+    glUseProgram(s_CullProgram);
+    glUniform1i(glGetUniformLocation(s_CullProgram, "uInstanceCount"),
+                static_cast<GLint>(s_InstanceCount));
+    for (int i = 0; i < Frustum::PlaneCount; i++) {
+        const glm::vec4& plane = frustum.Planes[i];
+        glUniform4f(glGetUniformLocation(s_CullProgram,
+                                         FRUSTUM_PLANE_UNIFORMS[i]),
+                    plane.x, plane.y, plane.z, plane.w);
+    }
+    glUniform1i(glGetUniformLocation(s_CullProgram, "uOcclusionCulling"),
+                occlusion);
+    if (occlusion) {
+        glUniformMatrix4fv(
+            glGetUniformLocation(s_CullProgram, "uPyramidViewProjection"), 1,
+            GL_FALSE, &s_PyramidViewProjection[0][0]);
+        glUniform2f(glGetUniformLocation(s_CullProgram, "uPyramidSize"),
+                    static_cast<float>(s_PyramidWidth),
+                    static_cast<float>(s_PyramidHeight));
+        glUniform1i(glGetUniformLocation(s_CullProgram, "uPyramidLevels"),
+                    s_PyramidLevels);
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, s_Pyramid);
+        RenderStatistics::RecordTextureBind();
+    }
+    RenderStatistics::RecordProgramBind();
+
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, TRANSFORM_BINDING,
+                     s_TransformBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, INSTANCE_BINDING,
+                     s_InstanceBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, COMMAND_BINDING,
+                     s_CommandBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, VISIBLE_BINDING,
+                     s_VisibleBuffer);
+
+    auto groups = static_cast<GLuint>(
+        (s_InstanceCount + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE);
+    GLExtensions::DispatchCompute(groups, 1, 1);
+
+    // Draws read the commands and the visible matrices as vertex attributes
+    GLExtensions::GLMemoryBarrier(GL_COMMAND_BARRIER_BIT |
+                                  GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT);
+    glUseProgram(0);
+}
+
+void GPUCulling::Draw(const Camera& camera, float totalTime,
+                      float deltaTime) {
+    if (!IsActive()) {
+        return;
+    }
+
+    GPUProfiler::ScopedPass drawPass("GPUDraws");
+
+    PerFrameBlock frame;
+    frame.View = camera.GetViewMatrix();
+    frame.Projection = camera.GetProjectionMatrix();
+    frame.ViewProjection = frame.Projection * frame.View;
+    frame.CameraPosition = glm::vec4(camera.GetPosition(), 1.0f);
+    frame.Time = glm::vec4(totalTime, deltaTime, 0.0f, 0.0f);
+    glBindBuffer(GL_UNIFORM_BUFFER, s_FrameBuffer);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(frame), &frame);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    glBindBufferBase(GL_UNIFORM_BUFFER,
+                     static_cast<unsigned int>(UniformBinding::PerFrame),
+                     s_FrameBuffer);
+    RenderStatistics::RecordUniformUpload(sizeof(frame));
+
+    glBindVertexArray(s_VAO);
+    RenderStatistics::RecordVertexArrayBind();
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, s_CommandBuffer);
+
+    for (const DrawGroup& group : s_Groups) {
+        Renderer::BindProgram(*group.DrawShader);
+        for (int unit = 0; unit < Material::MAX_TEXTURES; unit++) {
+            const Texture* texture = group.DrawMaterial->GetTexture(unit);
+            glActiveTexture(GL_TEXTURE0 + unit);
+            glBindTexture(GL_TEXTURE_2D, texture ? texture->GetID() : 0);
+            RenderStatistics::RecordTextureBind();
+        }
+        MaterialLibrary::Bind(*group.DrawMaterial);
+
+        auto offset = static_cast<uintptr_t>(
+            group.FirstCommand * sizeof(DrawElementsIndirectCommand));
+        GLExtensions::MultiDrawElementsIndirect(
+            GL_TRIANGLES, GL_UNSIGNED_INT, reinterpret_cast<void*>(offset),
+            static_cast<GLsizei>(group.CommandCount), 0);
+
+        // Instance and triangle counts are only known to the GPU
+        RenderStatistics::RecordDraw(0, 0);
+    }
+
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    glBindVertexArray(0);
+}
+
+void GPUCulling::BuildDepthPyramid(int width, int height) {
+    if (!IsActive() || !s_OcclusionCulling || width <= 0 || height <= 0) {
+        return;
+    }
+
+    if ((width != s_PyramidWidth || height != s_PyramidHeight) &&
+        !CreatePyramid(width, height)) {
+        return;
+    }
+
+    GPUProfiler::ScopedPass pyramidPass("DepthPyramid");
+
+    // The default framebuffer's depth can't be sampled, so copy it first
+    GLint drawFramebuffer = 0;
+    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &drawFramebuffer);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, s_DepthFramebuffer);
+    glBlitFramebuffer(0, 0, width, height, 0, 0, width, height,
+                      GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, drawFramebuffer);
+
+    glUseProgram(s_ReduceProgram);
+    RenderStatistics::RecordProgramBind();
+    GLint levelLocation = glGetUniformLocation(s_ReduceProgram, "uLevel");
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, s_DepthTexture);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, s_Pyramid);
+    RenderStatistics::RecordTextureBind();
+    RenderStatistics::RecordTextureBind();
+
+    for (int level = 0; level < s_PyramidLevels; level++) {
+        // Only the level above is sampled while this one is written
+        if (level > 0) {
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, level - 1);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, level - 1);
+        }
+
+        int levelWidth = std::max(1, s_PyramidWidth >> level);
+        int levelHeight = std::max(1, s_PyramidHeight >> level);
+        glUniform1i(levelLocation, level);
+        GLExtensions::BindImageTexture(0, s_Pyramid, level, GL_FALSE, 0,
+                                       GL_WRITE_ONLY, GL_R32F);
+        GLExtensions::DispatchCompute(
+            (levelWidth + REDUCE_GROUP_SIZE - 1) / REDUCE_GROUP_SIZE,
+            (levelHeight + REDUCE_GROUP_SIZE - 1) / REDUCE_GROUP_SIZE, 1);
+        GLExtensions::GLMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT);
+    }
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, s_PyramidLevels - 1);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glActiveTexture(GL_TEXTURE0);
+    glUseProgram(0);
+
+    s_PyramidViewProjection = s_CullViewProjection;
+    s_PyramidValid = true;
+}
+
+bool GPUCulling::CreatePyramid(int width, int height) {
+    DestroyPyramid();
+
+    s_PyramidWidth = width;
+    s_PyramidHeight = height;
+    s_PyramidLevels = static_cast<int>(
+        std::bit_width(static_cast<unsigned int>(std::max(width, height))));
+
+    // Same format as the window's depth buffer, as blits require
+    glGenTextures(1, &s_DepthTexture);
+    glBindTexture(GL_TEXTURE_2D, s_DepthTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH24_STENCIL8, width, height, 0,
+                 GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+    glGenTextures(1, &s_Pyramid);
+    glBindTexture(GL_TEXTURE_2D, s_Pyramid);
+    for (int level = 0; level < s_PyramidLevels; level++) {
+        glTexImage2D(GL_TEXTURE_2D, level, GL_R32F,
+                     std::max(1, width >> level), std::max(1, height >> level),
+                     0, GL_RED, GL_FLOAT, nullptr);
+    }
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+                    GL_NEAREST_MIPMAP_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, s_PyramidLevels - 1);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    GLint previousFramebuffer = 0;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previousFramebuffer);
+    glGenFramebuffers(1, &s_DepthFramebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, s_DepthFramebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT,
+                           GL_TEXTURE_2D, s_DepthTexture, 0);
+    bool complete =
+        glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    glBindFramebuffer(GL_FRAMEBUFFER, previousFramebuffer);
+
+    if (!complete) {
+        LOG_ERROR("Depth pyramid framebuffer is incomplete, occlusion "
+                  "culling disabled");
+        DestroyPyramid();
+        s_OcclusionCulling = false;
+        return false;
+    }
+
+    return true;
+}
+
+void GPUCulling::DestroyPyramid() {
+    if (s_DepthFramebuffer) {
+        glDeleteFramebuffers(1, &s_DepthFramebuffer);
+        s_DepthFramebuffer = 0;
+    }
+    if (s_DepthTexture) {
+        glDeleteTextures(1, &s_DepthTexture);
+        glDeleteTextures(1, &s_Pyramid);
+        s_DepthTexture = 0;
+        s_Pyramid = 0;
+    }
+
+    s_PyramidWidth = 0;
+    s_PyramidHeight = 0;
+    s_PyramidLevels = 0;
+    s_PyramidValid = false;
+}
+
+std::shared_ptr<Shader> GPUCulling::GetVariant(const Shader& shader) {
+    auto it = s_Variants.find(&shader);
+    if (it != s_Variants.end()) {
+        return it->second;
+    }
+
+    std::vector<std::string> defines = shader.GetDefines();
+    defines.push_back("GPU_DRIVEN");
+    auto variant = std::make_shared<Shader>(shader.GetVertexPath(),
+                                            shader.GetFragmentPath(), defines);
+    if (!variant->IsReady()) {
+        LOG_ERROR("GPU_DRIVEN variant of {} failed to build",
+                  shader.GetVertexPath());
+        return nullptr;
+    }
+
+    s_Variants.emplace(&shader, variant);
+    return variant;
+}
+
+}  // namespace Obelisk
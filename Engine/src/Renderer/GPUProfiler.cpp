@@ -0,0 +1,173 @@
+#include "Obelisk/Renderer/GPUProfiler.h"
+#include <algorithm>
+#include "Obelisk/Core/Time.h"
+
+namespace Obelisk {
+
+// Static member definitions
+std::array<GPUProfiler::FrameQueries, GPUProfiler::FRAME_LATENCY>
+    GPUProfiler::s_Frames;
+size_t GPUProfiler::s_FrameIndex = 0;
+std::vector<size_t> GPUProfiler::s_OpenPasses;
+size_t GPUProfiler::s_DroppedFrames = 0;
+bool GPUProfiler::s_Initialized = false;
+bool GPUProfiler::s_InFrame = false;
+float GPUProfiler::s_FrameTimeMS = 0.0f;
+std::vector<std::pair<std::string, float>> GPUProfiler::s_PassTimesMS;
+bool GPUProfiler::s_HasNewTimings = false;
+
+void GPUProfiler::Initialize() {
+    GLint counterBits = 0;
+    glGetQueryiv(GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &counterBits);
+    if (counterBits == 0) {
+        LOG_WARN("GPU timestamp queries unsupported, GPU timing disabled");
+        return;
+    }
+
+    s_FrameIndex = 0;
+    s_DroppedFrames = 0;
+    s_Initialized = true;
+    LOG_INFO("GPU profiler initialized ({}-bit timestamps, {} frame latency)",
+             counterBits, FRAME_LATENCY);
+}
+
+void GPUProfiler::Shutdown() {
+    for (auto& frame : s_Frames) {
+        if (!frame.Pool.empty()) {
+            glDeleteQueries(static_cast<GLsizei>(frame.Pool.size()),
+                            frame.Pool.data());
+        }
+        frame = FrameQueries{};
+    }
+
+    s_OpenPasses.clear();
+    s_Initialized = false;
+    s_InFrame = false;
+    s_HasNewTimings = false;
+}
+
+void GPUProfiler::Publish() {
+    if (!s_HasNewTimings) {
+        return;
+    }
+
+    Time::RecordGPUTimings(s_FrameTimeMS, s_PassTimesMS);
+    s_HasNewTimings = false;
+}
+
+void GPUProfiler::BeginFrame() {
+    if (!s_Initialized) {
+        return;
+    }
+
+    // This slot was last used FRAME_LATENCY frames ago
+    FrameQueries& frame = s_Frames[s_FrameIndex];
+    if (frame.Submitted) {
+        CollectResults(frame);
+    }
+
+    frame.Used = 0;
+    frame.Passes.clear();
+    frame.Submitted = false;
+    frame.FrameStart = IssueTimestamp();
+
+    s_OpenPasses.clear();
+    s_InFrame = true;
+}
+
+void GPUProfiler::EndFrame() {
+    if (!s_InFrame) {
+        return;
+    }
+
+    while (!s_OpenPasses.empty()) {
+        LOG_WARN("GPU pass \"{}\" was not ended",
+                 s_Frames[s_FrameIndex].Passes[s_OpenPasses.back()].Name);
+        EndPass();
+    }
+
+    FrameQueries& frame = s_Frames[s_FrameIndex];
+    frame.FrameEnd = IssueTimestamp();
+    frame.Submitted = true;
+
+    s_FrameIndex = (s_FrameIndex + 1) % FRAME_LATENCY;
+    s_InFrame = false;
+}
+
+void GPUProfiler::BeginPass(const std::string& name) {
+    if (!s_InFrame) {
+        return;
+    }
+
+    FrameQueries& frame = s_Frames[s_FrameIndex];
+    frame.Passes.push_back({name, IssueTimestamp(), 0});
+    s_OpenPasses.push_back(frame.Passes.size() - 1);
+}
+
+void GPUProfiler::EndPass() {
+    if (!s_InFrame || s_OpenPasses.empty()) {
+        return;
+    }
+
+    FrameQueries& frame = s_Frames[s_FrameIndex];
+    frame.Passes[s_OpenPasses.back()].EndQuery = IssueTimestamp();
+    s_OpenPasses.pop_back();
+}
+
+unsigned int GPUProfiler::IssueTimestamp() {
+    FrameQueries& frame = s_Frames[s_FrameIndex];
+
+    // The pool only grows, so steady-state frames allocate nothing
+    if (frame.Used == frame.Pool.size()) {
+        unsigned int query = 0;
+        glGenQueries(1, &query);
+        frame.Pool.push_back(query);
+    }
+
+    unsigned int query = frame.Pool[frame.Used++];
+    glQueryCounter(query, GL_TIMESTAMP);
+    return query;
+}
+
+void GPUProfiler::CollectResults(FrameQueries& frame) {
+    // Timestamps complete in order, so the last one gates all the others
+    GLint available = 0;
+    glGetQueryObjectiv(frame.FrameEnd, GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available) {
+        // Reading now would stall; the slot is about to be reused
+        s_DroppedFrames++;
+        return;
+    }
+
+    GLuint64 frameStart = 0;
+    GLuint64 frameEnd = 0;
+    glGetQueryObjectui64v(frame.FrameStart, GL_QUERY_RESULT, &frameStart);
+    glGetQueryObjectui64v(frame.FrameEnd, GL_QUERY_RESULT, &frameEnd);
+
+    // Cleared rather than replaced, so steady-state frames allocate nothing
+    std::vector<std::pair<std::string, float>>& passTimes = s_PassTimesMS;
+    passTimes.clear();
+
+    for (const auto& pass : frame.Passes) {
+        GLuint64 start = 0;
+        GLuint64 end = 0;
+        glGetQueryObjectui64v(pass.StartQuery, GL_QUERY_RESULT, &start);
+        glGetQueryObjectui64v(pass.EndQuery, GL_QUERY_RESULT, &end);
+        float timeMS = static_cast<float>(end - start) / 1000000.0f;
+
+        // Passes issued more than once per frame are summed
+        auto existing = std::find_if(
+            passTimes.begin(), passTimes.end(),
+            [&pass](const auto& entry) { return entry.first == pass.Name; });
+        if (existing != passTimes.end()) {
+            existing->second += timeMS;
+        } else {
+            passTimes.emplace_back(pass.Name, timeMS);
+        }
+    }
+
+    s_FrameTimeMS = static_cast<float>(frameEnd - frameStart) / 1000000.0f;
+    s_HasNewTimings = true;
+}
+
+}  // namespace Obelisk
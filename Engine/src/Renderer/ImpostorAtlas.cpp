@@ -0,0 +1,301 @@
+#include "Obelisk/Renderer/ImpostorAtlas.h"
+#include <algorithm>
+#include <cmath>
+#include <glm/gtc/constants.hpp>
+#include "Obelisk/Core/Camera.h"
+#include "Obelisk/Renderer/ClusteredLighting.h"
+#include "Obelisk/Renderer/GPUProfiler.h"
+#include "Obelisk/Renderer/Material.h"
+#include "Obelisk/Renderer/Mesh.h"
+#include "Obelisk/Renderer/RenderStats.h"
+#include "Obelisk/Renderer/Renderer.h"
+#include "Obelisk/Renderer/Shader.h"
+
+namespace Obelisk {
+
+namespace {
+constexpr float PITCH_STEP = 0.5235988f;  // 30 degrees, as in impostor.vert
+
+// Triangle strip covering [-1, 1]^2
+constexpr float QUAD_CORNERS[8] = {-1.0f, -1.0f, 1.0f, -1.0f,
+                                   -1.0f, 1.0f,  1.0f, 1.0f};
+}  // namespace
+
+// Static member definitions
+std::unordered_map<uint64_t, Impostor> ImpostorAtlas::s_Impostors;
+uint32_t ImpostorAtlas::s_NextTile = 0;
+unsigned int ImpostorAtlas::s_Texture = 0;
+unsigned int ImpostorAtlas::s_Depth = 0;
+unsigned int ImpostorAtlas::s_Framebuffer = 0;
+unsigned int ImpostorAtlas::s_VAO = 0;
+unsigned int ImpostorAtlas::s_QuadVBO = 0;
+unsigned int ImpostorAtlas::s_InstanceVBO = 0;
+std::unique_ptr<Shader> ImpostorAtlas::s_Shader;
+std::mutex ImpostorAtlas::s_Mutex;
+
+void ImpostorAtlas::Initialize() {
+    if (s_VAO) {
+        return;
+    }
+
+    s_Shader = std::make_unique<Shader>("impostor.vert", "impostor.frag");
+
+    glGenVertexArrays(1, &s_VAO);
+    glGenBuffers(1, &s_QuadVBO);
+    glGenBuffers(1, &s_InstanceVBO);
+
+    glBindVertexArray(s_VAO);
+
+    // Corner attribute, shared by every instance
+    glBindBuffer(GL_ARRAY_BUFFER, s_QuadVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(QUAD_CORNERS), QUAD_CORNERS,
+                 GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float),
+                          nullptr);
+    glEnableVertexAttribArray(0);
+
+    // Instance attributes, advanced once per quad
+    glBindBuffer(GL_ARRAY_BUFFER, s_InstanceVBO);
+    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(ImpostorInstance),
+                          (void*)offsetof(ImpostorInstance, CenterRadius));
+    glEnableVertexAttribArray(1);
+    glVertexAttribDivisor(1, 1);
+    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(ImpostorInstance),
+                          (void*)offsetof(ImpostorInstance, Params));
+    glEnableVertexAttribArray(2);
+    glVertexAttribDivisor(2, 1);
+
+    glBindVertexArray(0);
+
+    LOG_INFO("ImpostorAtlas initialized");
+}
+
+void ImpostorAtlas::Shutdown() {
+    std::lock_guard<std::mutex> lock(s_Mutex);
+    s_Impostors.clear();
+    s_NextTile = 0;
+
+    if (s_Framebuffer) {
+        glDeleteFramebuffers(1, &s_Framebuffer);
+        glDeleteRenderbuffers(1, &s_Depth);
+        glDeleteTextures(1, &s_Texture);
+        s_Framebuffer = 0;
+        s_Depth = 0;
+        s_Texture = 0;
+    }
+
+    if (s_VAO) {
+        glDeleteVertexArrays(1, &s_VAO);
+        glDeleteBuffers(1, &s_QuadVBO);
+        glDeleteBuffers(1, &s_InstanceVBO);
+        s_VAO = 0;
+        s_QuadVBO = 0;
+        s_InstanceVBO = 0;
+    }
+
+    s_Shader.reset();
+}
+
+const Impostor* ImpostorAtlas::Bake(const Mesh& mesh,
+                                    const Material& material) {
+    if (const Impostor* existing = Find(mesh, material)) {
+        return existing;
+    }
+
+    if (!s_VAO || !material.GetShader()) {
+        return nullptr;
+    }
+    if (s_NextTile + VIEWS > MAX_TILES) {
+        LOG_WARN("Impostor atlas is full, mesh {} is drawn in full detail",
+                 mesh.GetMeshID());
+        return nullptr;
+    }
+
+    // A shader still compiling would bake the fallback or nothing at all
+    if (!material.GetShader()->WaitUntilReady()) {
+        LOG_ERROR("Can't bake impostor for mesh {}: shader failed",
+                  mesh.GetMeshID());
+        return nullptr;
+    }
+
+    GLint previousFramebuffer = 0;
+    GLint previousViewport[4];
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previousFramebuffer);
+    glGetIntegerv(GL_VIEWPORT, previousViewport);
+
+    if (!s_Framebuffer && !CreateAtlas()) {
+        return nullptr;
+    }
+
+    const AABB& bounds = mesh.GetBounds();
+    Impostor impostor;
+    impostor.FirstTile = s_NextTile;
+    impostor.Center = bounds.GetCenter();
+    impostor.Radius = std::max(glm::length(bounds.GetExtents()), 1e-4f);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, s_Framebuffer);
+
+    // Orthographic, so every tile shows the object at the same scale
+    Camera camera;
+    camera.SetProjectionType(Camera::ProjectionType::Orthographic);
+    camera.SetOrthographicSize(impostor.Radius);
+    camera.SetAspectRatio(1.0f);
+    camera.SetClippingPlanes(impostor.Radius * 0.5f, impostor.Radius * 3.5f);
+
+    {
+        GPUProfiler::ScopedPass bakePass("ImpostorBake");
+        for (int pitch = 0; pitch < PITCH_VIEWS; pitch++) {
+            for (int yaw = 0; yaw < YAW_VIEWS; yaw++) {
+                float azimuth = yaw * glm::two_pi<float>() / YAW_VIEWS;
+                float elevation = pitch * PITCH_STEP;
+                glm::vec3 direction(std::sin(azimuth) * std::cos(elevation),
+                                    std::sin(elevation),
+                                    std::cos(azimuth) * std::cos(elevation));
+                camera.SetPosition(impostor.Center +
+                                   direction * impostor.Radius * 2.0f);
+                camera.LookAt(impostor.Center);
+
+                uint32_t tile = s_NextTile + pitch * YAW_VIEWS + yaw;
+                glViewport((tile % TILES_PER_ROW) * TILE_SIZE,
+                           (tile / TILES_PER_ROW) * TILE_SIZE, TILE_SIZE,
+                           TILE_SIZE);
+
+                // Ambient only: no lights, and clusters sized for one tile
+                ClusteredLighting::Update(camera, {}, TILE_SIZE, TILE_SIZE);
+                Renderer::BeginFrame(camera, 0.0f, 0.0f);
+                Renderer::Submit(mesh, material, glm::mat4(1.0f));
+                Renderer::EndFrame();
+            }
+        }
+    }
+
+    // Distant impostors are minified heavily
+    glBindTexture(GL_TEXTURE_2D, s_Texture);
+    glGenerateMipmap(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, previousFramebuffer);
+    glViewport(previousViewport[0], previousViewport[1], previousViewport[2],
+               previousViewport[3]);
+
+    s_NextTile += VIEWS;
+
+    std::lock_guard<std::mutex> lock(s_Mutex);
+    const Impostor* baked =
+        &s_Impostors.emplace(MakeKey(mesh, material), impostor).first->second;
+
+    LOG_INFO("Baked impostor for mesh {} into tiles {}-{}", mesh.GetMeshID(),
+             impostor.FirstTile, s_NextTile - 1);
+    return baked;
+}
+
+const Impostor* ImpostorAtlas::Find(const Mesh& mesh,
+                                    const Material& material) {
+    std::lock_guard<std::mutex> lock(s_Mutex);
+    auto it = s_Impostors.find(MakeKey(mesh, material));
+    return it != s_Impostors.end() ? &it->second : nullptr;
+}
+
+ImpostorInstance ImpostorAtlas::MakeInstance(const Impostor& impostor,
+                                             const glm::mat4& model) {
+    glm::vec3 center = glm::vec3(model * glm::vec4(impostor.Center, 1.0f));
+    float scale = std::max({glm::length(glm::vec3(model[0])),
+                            glm::length(glm::vec3(model[1])),
+                            glm::length(glm::vec3(model[2]))});
+
+    // Rotation around Y, from where the object's +Z axis points
+    float yaw = std::atan2(model[2][0], model[2][2]);
+
+    return {glm::vec4(center, impostor.Radius * scale),
+            glm::vec4(static_cast<float>(impostor.FirstTile), yaw, 0.0f,
+                      0.0f)};
+}
+
+void ImpostorAtlas::Draw(const Camera& camera,
+                         const std::vector<ImpostorInstance>& instances) {
+    if (!s_VAO || !s_Texture || instances.empty() || !s_Shader->IsReady()) {
+        return;
+    }
+
+    GPUProfiler::ScopedPass impostorPass("Impostors");
+
+    size_t instanceBytes = instances.size() * sizeof(ImpostorInstance);
+    glBindBuffer(GL_ARRAY_BUFFER, s_InstanceVBO);
+    glBufferData(GL_ARRAY_BUFFER, instanceBytes, instances.data(),
+                 GL_STREAM_DRAW);
+    RenderStatistics::RecordBufferUpload(instanceBytes);
+
+    s_Shader->Use();
+    s_Shader->SetMat4("viewProjection", camera.GetViewProjectionMatrix());
+    s_Shader->SetVec3("cameraPosition", camera.GetPosition());
+    s_Shader->SetInt("atlas", 0);
+    RenderStatistics::RecordProgramBind();
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, s_Texture);
+    RenderStatistics::RecordTextureBind();
+
+    glBindVertexArray(s_VAO);
+    RenderStatistics::RecordVertexArrayBind();
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4,
+                          static_cast<GLsizei>(instances.size()));
+    RenderStatistics::RecordDraw(instances.size() * 2, instances.size());
+    glBindVertexArray(0);
+}
+
+bool ImpostorAtlas::CreateAtlas() {
+    glGenTextures(1, &s_Texture);
+    glBindTexture(GL_TEXTURE_2D, s_Texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, ATLAS_SIZE, ATLAS_SIZE, 0,
+                 GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+                    GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glGenRenderbuffers(1, &s_Depth);
+    glBindRenderbuffer(GL_RENDERBUFFER, s_Depth);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, ATLAS_SIZE,
+                          ATLAS_SIZE);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    glGenFramebuffers(1, &s_Framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, s_Framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                           GL_TEXTURE_2D, s_Texture, 0);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT,
+                              GL_RENDERBUFFER, s_Depth);
+
+    bool complete =
+        glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    if (complete) {
+        // Tiles never overlap, so one clear serves every later bake
+        glViewport(0, 0, ATLAS_SIZE, ATLAS_SIZE);
+        glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    if (!complete) {
+        LOG_ERROR("Impostor atlas framebuffer is incomplete");
+        glDeleteFramebuffers(1, &s_Framebuffer);
+        glDeleteRenderbuffers(1, &s_Depth);
+        glDeleteTextures(1, &s_Texture);
+        s_Framebuffer = 0;
+        s_Depth = 0;
+        s_Texture = 0;
+        return false;
+    }
+
+    LOG_INFO("Impostor atlas created: {}x{}, {} tiles", ATLAS_SIZE,
+             ATLAS_SIZE, MAX_TILES);
+    return true;
+}
+
+uint64_t ImpostorAtlas::MakeKey(const Mesh& mesh, const Material& material) {
+    return static_cast<uint64_t>(mesh.GetMeshID()) << 32 | material.GetID();
+}
+
+}  // namespace Obelisk
@@ -0,0 +1,89 @@
+#include "Obelisk/Renderer/Material.h"
+#include <cstring>
+#include "Obelisk/Core/Hash.h"
+#include "Obelisk/Renderer/MaterialLibrary.h"
+#include "Obelisk/Renderer/Shader.h"
+#include "Obelisk/Renderer/Texture.h"
+
+namespace Obelisk {
+namespace {
+/**
+ * @brief Identify a shader variant by its ShaderCache key.
+ *
+ * Variants without a cache key (never submitted) fall back to identity.
+ */
+uint64_t GetShaderKey(const Shader* shader) {
+    return shader && shader->GetCacheKey()
+               ? shader->GetCacheKey()
+               : reinterpret_cast<uintptr_t>(shader);
+}
+}  // namespace
+
+Material::Material(std::shared_ptr<Shader> shader, TextureSet textures,
+                   const MaterialBlock& block, uint32_t id, uint32_t slot)
+    : m_Shader(std::move(shader)),
+      m_Textures(std::move(textures)),
+      m_Block(block),
+      m_ID(id),
+      m_Slot(slot) {
+    m_Hash = ComputeHash(m_Shader.get(), m_Textures, m_Block);
+
+    uint64_t program = m_Shader ? m_Shader->GetProgramID() : 0;
+    m_SortKey = (program & 0xFFFF) << 48 |
+                (static_cast<uint64_t>(m_ID) & 0xFFFFFF) << 24;
+}
+
+Material::~Material() { MaterialLibrary::Release(this); }
+
+uint64_t Material::ComputeHash(const Shader* shader,
+                               const TextureSet& textures,
+                               const MaterialBlock& block) {
+    uint64_t hash = Hash::FNV1a(&block, sizeof(block));
+    hash = Hash::Combine(hash, GetShaderKey(shader));
+    for (const auto& texture : textures) {
+        hash = Hash::Combine(hash, reinterpret_cast<uintptr_t>(texture.get()));
+    }
+    return hash;
+}
+
+bool Material::Matches(const Shader* shader, const TextureSet& textures,
+                       const MaterialBlock& block) const {
+    // Bytes rather than floats, the same as the hash
+    return GetShaderKey(m_Shader.get()) == GetShaderKey(shader) &&
+           m_Textures == textures &&
+           std::memcmp(&m_Block, &block, sizeof(block)) == 0;
+}
+
+void Material::SetBlock(const MaterialBlock& block) {
+    std::lock_guard<std::mutex> lock(MaterialLibrary::s_Mutex);
+    m_Block = block;
+    MarkDirty();
+}
+
+void Material::SetBaseColor(const glm::vec4& color) {
+    MaterialBlock block = m_Block;
+    block.BaseColor = color;
+    SetBlock(block);
+}
+
+void Material::SetUVTransform(const glm::vec2& scale,
+                              const glm::vec2& offset) {
+    MaterialBlock block = m_Block;
+    block.UVTransform = glm::vec4(scale, offset);
+    SetBlock(block);
+}
+
+void Material::SetParams(const glm::vec4& params) {
+    MaterialBlock block = m_Block;
+    block.Params = params;
+    SetBlock(block);
+}
+
+void Material::MarkDirty() {
+    uint64_t previousHash = m_Hash;
+    m_Hash = ComputeHash(m_Shader.get(), m_Textures, m_Block);
+    MaterialLibrary::Rehash(this, previousHash);
+    MaterialLibrary::MarkDirty(this);
+}
+
+}  // namespace Obelisk
@@ -0,0 +1,185 @@
+#include "Obelisk/Renderer/MaterialLibrary.h"
+#include "Obelisk/Renderer/RenderStats.h"
+#include "Obelisk/Renderer/Renderer.h"
+#include <algorithm>
+#include <bit>
+
+namespace Obelisk {
+
+// Static member definitions
+std::unordered_multimap<uint64_t, std::weak_ptr<Material>>
+    MaterialLibrary::s_Materials;
+std::vector<Material*> MaterialLibrary::s_Slots;
+std::vector<uint32_t> MaterialLibrary::s_FreeSlots;
+std::vector<Material*> MaterialLibrary::s_Dirty;
+unsigned int MaterialLibrary::s_Buffer = 0;
+uint32_t MaterialLibrary::s_Capacity = 0;
+size_t MaterialLibrary::s_SlotStride = 0;
+uint32_t MaterialLibrary::s_NextID = 1;
+size_t MaterialLibrary::s_UploadCount = 0;
+std::mutex MaterialLibrary::s_Mutex;
+
+void MaterialLibrary::Initialize() {
+    std::lock_guard<std::mutex> lock(s_Mutex);
+    if (s_Buffer) {
+        return;
+    }
+
+    GLint alignment = 256;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+    size_t align = static_cast<size_t>(std::max(alignment, 1));
+    s_SlotStride = (sizeof(MaterialBlock) + align - 1) / align * align;
+
+    glGenBuffers(1, &s_Buffer);
+    Grow(std::max<uint32_t>(
+        INITIAL_CAPACITY,
+        std::bit_ceil(static_cast<uint32_t>(s_Slots.size()))));
+
+    LOG_INFO("MaterialLibrary initialized: {} byte slots", s_SlotStride);
+}
+
+void MaterialLibrary::Shutdown() {
+    std::lock_guard<std::mutex> lock(s_Mutex);
+    if (s_Buffer) {
+        glDeleteBuffers(1, &s_Buffer);
+        s_Buffer = 0;
+    }
+    s_Capacity = 0;
+}
+
+std::shared_ptr<Material> MaterialLibrary::Create(
+    std::shared_ptr<Shader> shader, const Material::TextureSet& textures,
+    const MaterialBlock& block) {
+    uint64_t hash = Material::ComputeHash(shader.get(), textures, block);
+
+    std::lock_guard<std::mutex> lock(s_Mutex);
+    // Entries sharing a hash may differ in content: the hash can collide,
+    // and Rehash() moves changed materials next to unrelated ones
+    auto [begin, end] = s_Materials.equal_range(hash);
+    for (auto it = begin; it != end;) {
+        std::shared_ptr<Material> existing = it->second.lock();
+        if (!existing) {
+            it = s_Materials.erase(it);
+            continue;
+        }
+        if (existing->Matches(shader.get(), textures, block)) {
+            return existing;
+        }
+        ++it;
+    }
+
+    uint32_t slot;
+    if (!s_FreeSlots.empty()) {
+        slot = s_FreeSlots.back();
+        s_FreeSlots.pop_back();
+    } else {
+        slot = static_cast<uint32_t>(s_Slots.size());
+        s_Slots.push_back(nullptr);
+    }
+
+    // The constructor is private, so std::make_shared cannot be used
+    std::shared_ptr<Material> material(
+        new Material(std::move(shader), textures, block, s_NextID++, slot));
+    s_Slots[slot] = material.get();
+    s_Materials.emplace(hash, material);
+    MarkDirty(material.get());
+
+    LOG_TRACE("Material {} created in slot {}", material->GetID(), slot);
+    return material;
+}
+
+void MaterialLibrary::UploadDirty() {
+    std::lock_guard<std::mutex> lock(s_Mutex);
+    s_UploadCount = 0;
+    if (!s_Buffer) {
+        return;
+    }
+
+    if (s_Slots.size() > s_Capacity) {
+        Grow(std::bit_ceil(static_cast<uint32_t>(s_Slots.size())));
+    }
+    if (s_Dirty.empty()) {
+        return;
+    }
+
+    glBindBuffer(GL_UNIFORM_BUFFER, s_Buffer);
+    for (Material* material : s_Dirty) {
+        glBufferSubData(GL_UNIFORM_BUFFER, material->m_Slot * s_SlotStride,
+                        sizeof(MaterialBlock), &material->m_Block);
+        RenderStatistics::RecordUniformUpload(sizeof(MaterialBlock));
+        material->m_Dirty = false;
+    }
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    s_UploadCount = s_Dirty.size();
+    s_Dirty.clear();
+}
+
+void MaterialLibrary::Bind(const Material& material) {
+    glBindBufferRange(GL_UNIFORM_BUFFER,
+                      static_cast<unsigned int>(UniformBinding::Material),
+                      s_Buffer, material.m_Slot * s_SlotStride,
+                      sizeof(MaterialBlock));
+}
+
+void MaterialLibrary::MarkDirty(Material* material) {
+    if (!material->m_Dirty) {
+        material->m_Dirty = true;
+        s_Dirty.push_back(material);
+    }
+}
+
+void MaterialLibrary::Rehash(Material* material, uint64_t previousHash) {
+    if (material->m_Hash == previousHash) {
+        return;
+    }
+
+    // The bucket may hold colliding materials, so the entry is found by
+    // identity; Create() compares content before sharing any of them
+    auto [begin, end] = s_Materials.equal_range(previousHash);
+    for (auto it = begin; it != end; ++it) {
+        if (it->second.lock().get() == material) {
+            std::weak_ptr<Material> entry = std::move(it->second);
+            s_Materials.erase(it);
+            s_Materials.emplace(material->m_Hash, std::move(entry));
+            return;
+        }
+    }
+}
+
+void MaterialLibrary::Release(Material* material) {
+    std::lock_guard<std::mutex> lock(s_Mutex);
+
+    // The weak pointer has already expired, so drop every expired entry
+    auto [begin, end] = s_Materials.equal_range(material->m_Hash);
+    for (auto it = begin; it != end;) {
+        it = it->second.expired() ? s_Materials.erase(it) : std::next(it);
+    }
+
+    if (material->m_Dirty) {
+        std::erase(s_Dirty, material);
+    }
+
+    s_Slots[material->m_Slot] = nullptr;
+    s_FreeSlots.push_back(material->m_Slot);
+}
+
+void MaterialLibrary::Grow(uint32_t capacity) {
+    s_Capacity = capacity;
+
+    glBindBuffer(GL_UNIFORM_BUFFER, s_Buffer);
+    glBufferData(GL_UNIFORM_BUFFER, s_Capacity * s_SlotStride, nullptr,
+                 GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    // Fresh storage holds none of the existing blocks
+    for (Material* material : s_Slots) {
+        if (material) {
+            MarkDirty(material);
+        }
+    }
+
+    LOG_TRACE("MaterialLibrary buffer resized to {} slots", s_Capacity);
+}
+
+}  // namespace Obelisk
@@ -1,10 +1,13 @@
 #include "Obelisk/Renderer/Mesh.h"
+#include <fstream>
+#include "Obelisk/Core/AssetManager.h"
+#include "Obelisk/Renderer/CookedFormat.h"
 
 namespace Obelisk {
 uint32_t Mesh::s_NextMeshID = 0;
 
 Mesh::Mesh(std::vector<Vertex> const& vertices,
-           std::vector<unsigned int> const& indices) {
+           std::vector<unsigned int> const& indices, bool keepCPUGeometry) {
     m_MeshID = s_NextMeshID++;
 
     glGenVertexArrays(1, &m_VAO);
@@ -43,6 +46,18 @@ Mesh::Mesh(std::vector<Vertex> const& vertices,
     m_NumVertices = vertices.size();
     m_NumIndices = indices.size();
 
+    for (const Vertex& vertex : vertices) {
+        m_Bounds.Expand(vertex.Position);
+    }
+
+    if (keepCPUGeometry) {
+        m_CPUPositions.reserve(vertices.size());
+        for (const Vertex& vertex : vertices) {
+            m_CPUPositions.push_back(vertex.Position);
+        }
+        m_CPUIndices = indices;
+    }
+
     LOG_TRACE("MeshID {} created", m_MeshID);
 }
 
@@ -62,7 +77,89 @@ Mesh::~Mesh() {
     LOG_TRACE("MeshID {} destroyed", m_MeshID);
 }
 
+std::shared_ptr<Mesh> Mesh::Load(const std::string& path,
+                                 bool keepCPUGeometry) {
+    std::filesystem::path fullPath =
+        AssetManager::GetAssetPath("meshes/" + path + COOKED_MESH_EXTENSION);
+    std::ifstream file(fullPath, std::ios::binary);
+    if (!file.is_open()) {
+        LOG_ERROR("Cooked mesh not found: {} (run ObeliskCook)",
+                  fullPath.string());
+        return nullptr;
+    }
+
+    CookedMeshHeader header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || header.Magic != COOKED_MESH_MAGIC ||
+        header.Version != COOKED_FORMAT_VERSION) {
+        LOG_ERROR("Stale or invalid cooked mesh: {}", fullPath.string());
+        return nullptr;
+    }
+
+    std::vector<Vertex> vertices(header.VertexCount);
+    std::vector<unsigned int> indices(header.IndexCount);
+    file.read(reinterpret_cast<char*>(vertices.data()),
+              sizeof(Vertex) * vertices.size());
+    file.read(reinterpret_cast<char*>(indices.data()),
+              sizeof(unsigned int) * indices.size());
+    if (!file) {
+        LOG_ERROR("Cooked mesh is truncated: {}", fullPath.string());
+        return nullptr;
+    }
+
+    LOG_TRACE("Loaded cooked mesh: {} ({} vertices, {} indices)",
+              fullPath.string(), vertices.size(), indices.size());
+    return std::make_shared<Mesh>(vertices, indices, keepCPUGeometry);
+}
+
 void Mesh::Bind() const { glBindVertexArray(m_VAO); }
 
 void Mesh::Unbind() { glBindVertexArray(0); }
+
+void Mesh::ReadBack(std::vector<Vertex>& vertices,
+                    std::vector<unsigned int>& indices) const {
+    vertices.resize(m_NumVertices);
+    indices.resize(m_NumIndices);
+    if (!m_VAO) {
+        return;
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+    glGetBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(Vertex) * vertices.size(),
+                       vertices.data());
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // The element buffer binding is VAO state, so read it through the VAO
+    glBindVertexArray(m_VAO);
+    glGetBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0,
+                       sizeof(unsigned int) * indices.size(), indices.data());
+    glBindVertexArray(0);
+}
+
+bool Mesh::Raycast(const Ray& ray, float maxDistance, float& distance) const {
+    float entry;
+    if (!ray.Intersects(m_Bounds, maxDistance, entry)) {
+        return false;
+    }
+
+    // Each hit shortens the ray, so only closer triangles count afterwards
+    bool hit = false;
+    for (size_t i = 0; i + 2 < m_CPUIndices.size(); i += 3) {
+        float triangle;
+        if (ray.Intersects(m_CPUPositions[m_CPUIndices[i]],
+                           m_CPUPositions[m_CPUIndices[i + 1]],
+                           m_CPUPositions[m_CPUIndices[i + 2]], maxDistance,
+                           triangle)) {
+            maxDistance = triangle;
+            hit = true;
+        }
+    }
+    distance = maxDistance;
+    return hit;
+}
+
+void Mesh::ReleaseCPUGeometry() {
+    m_CPUPositions = {};
+    m_CPUIndices = {};
+}
 }  // namespace Obelisk
\ No newline at end of file
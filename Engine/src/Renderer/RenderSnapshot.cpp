@@ -0,0 +1,12 @@
+#include "Obelisk/Renderer/RenderSnapshot.h"
+#include "Obelisk/Renderer/Renderer.h"
+
+namespace Obelisk {
+
+void RenderSnapshot::Submit() const {
+    for (const DrawRecord& draw : Draws) {
+        Renderer::Submit(*draw.DrawMesh, *draw.DrawMaterial, draw.Model);
+    }
+}
+
+}  // namespace Obelisk
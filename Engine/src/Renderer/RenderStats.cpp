@@ -0,0 +1,158 @@
+#include "Obelisk/Renderer/RenderStats.h"
+#include "Obelisk/Renderer/GPUProfiler.h"
+#include <algorithm>
+#include <format>
+#include <fstream>
+
+namespace Obelisk {
+
+// Static member definitions
+RenderStats RenderStatistics::s_Current;
+std::array<RenderStats, RenderStatistics::HISTORY_SIZE>
+    RenderStatistics::s_History;
+size_t RenderStatistics::s_HistoryIndex = 0;
+size_t RenderStatistics::s_HistoryCount = 0;
+size_t RenderStatistics::s_FrameCount = 0;
+std::chrono::high_resolution_clock::time_point RenderStatistics::s_FrameStart;
+std::mutex RenderStatistics::s_Mutex;
+
+void RenderStatistics::BeginFrame() {
+    s_Current = RenderStats();
+    s_Current.Frame = s_FrameCount;
+    s_FrameStart = std::chrono::high_resolution_clock::now();
+}
+
+void RenderStatistics::EndFrame(float cpuFrameTimeMS) {
+    std::chrono::duration<float, std::milli> renderTime =
+        std::chrono::high_resolution_clock::now() - s_FrameStart;
+    s_Current.RenderTimeMS = renderTime.count();
+    s_Current.CPUFrameTimeMS = cpuFrameTimeMS;
+    s_Current.GPUFrameTimeMS = GPUProfiler::GetFrameTimeMS();
+
+    std::lock_guard<std::mutex> lock(s_Mutex);
+    s_History[s_HistoryIndex] = s_Current;
+    s_HistoryIndex = (s_HistoryIndex + 1) % HISTORY_SIZE;
+    s_HistoryCount = std::min(s_HistoryCount + 1, HISTORY_SIZE);
+    s_FrameCount++;
+}
+
+void RenderStatistics::RecordCulling(size_t batchesTested,
+                                     size_t batchesCulled,
+                                     size_t entitiesTested,
+                                     size_t entitiesCulled) {
+    s_Current.BatchesTested += batchesTested;
+    s_Current.BatchesCulled += batchesCulled;
+    s_Current.EntitiesTested += entitiesTested;
+    s_Current.EntitiesCulled += entitiesCulled;
+}
+
+RenderStats RenderStatistics::GetLast() {
+    std::lock_guard<std::mutex> lock(s_Mutex);
+    if (s_HistoryCount == 0) {
+        return RenderStats();
+    }
+    return s_History[(s_HistoryIndex + HISTORY_SIZE - 1) % HISTORY_SIZE];
+}
+
+std::vector<RenderStats> RenderStatistics::GetHistory() {
+    std::lock_guard<std::mutex> lock(s_Mutex);
+    std::vector<RenderStats> history;
+    history.reserve(s_HistoryCount);
+
+    size_t oldest = (s_HistoryIndex + HISTORY_SIZE - s_HistoryCount) %
+                    HISTORY_SIZE;
+    for (size_t i = 0; i < s_HistoryCount; i++) {
+        history.push_back(s_History[(oldest + i) % HISTORY_SIZE]);
+    }
+    return history;
+}
+
+RenderStats RenderStatistics::GetAverage(size_t frames) {
+    std::vector<RenderStats> history = GetHistory();
+    frames = std::min(frames, history.size());
+
+    RenderStats sum;
+    if (frames == 0) {
+        return sum;
+    }
+
+    for (size_t i = history.size() - frames; i < history.size(); i++) {
+        const RenderStats& stats = history[i];
+        sum.DrawCalls += stats.DrawCalls;
+        sum.Instances += stats.Instances;
+        sum.Triangles += stats.Triangles;
+        sum.ProgramBinds += stats.ProgramBinds;
+        sum.VertexArrayBinds += stats.VertexArrayBinds;
+        sum.TextureBinds += stats.TextureBinds;
+        sum.UniformUploads += stats.UniformUploads;
+        sum.BytesStreamed += stats.BytesStreamed;
+        sum.BatchesTested += stats.BatchesTested;
+        sum.BatchesCulled += stats.BatchesCulled;
+        sum.EntitiesTested += stats.EntitiesTested;
+        sum.EntitiesCulled += stats.EntitiesCulled;
+        sum.CPUFrameTimeMS += stats.CPUFrameTimeMS;
+        sum.RenderTimeMS += stats.RenderTimeMS;
+        sum.GPUFrameTimeMS += stats.GPUFrameTimeMS;
+    }
+
+    // Round counters to the nearest integer rather than truncating
+    auto average = [frames](size_t total) {
+        return (total + frames / 2) / frames;
+    };
+
+    RenderStats result;
+    result.Frame = history.back().Frame;
+    result.DrawCalls = average(sum.DrawCalls);
+    result.Instances = average(sum.Instances);
+    result.Triangles = average(sum.Triangles);
+    result.ProgramBinds = average(sum.ProgramBinds);
+    result.VertexArrayBinds = average(sum.VertexArrayBinds);
+    result.TextureBinds = average(sum.TextureBinds);
+    result.UniformUploads = average(sum.UniformUploads);
+    result.BytesStreamed = average(sum.BytesStreamed);
+    result.BatchesTested = average(sum.BatchesTested);
+    result.BatchesCulled = average(sum.BatchesCulled);
+    result.EntitiesTested = average(sum.EntitiesTested);
+    result.EntitiesCulled = average(sum.EntitiesCulled);
+    result.CPUFrameTimeMS = sum.CPUFrameTimeMS / frames;
+    result.RenderTimeMS = sum.RenderTimeMS / frames;
+    result.GPUFrameTimeMS = sum.GPUFrameTimeMS / frames;
+    return result;
+}
+
+bool RenderStatistics::WriteCSV(const std::filesystem::path& path) {
+    std::ofstream file(path);
+    if (!file) {
+        LOG_ERROR("Failed to open {} for render stats", path.string());
+        return false;
+    }
+
+    std::vector<RenderStats> history = GetHistory();
+    file << "frame,draw_calls,instances,triangles,program_binds,"
+            "vertex_array_binds,texture_binds,uniform_uploads,"
+            "bytes_streamed,batches_tested,batches_culled,entities_tested,"
+            "entities_culled,cpu_frame_ms,render_ms,gpu_frame_ms\n";
+    for (const RenderStats& stats : history) {
+        file << std::format(
+            "{},{},{},{},{},{},{},{},{},{},{},{},{},{:.3f},{:.3f},{:.3f}\n",
+            stats.Frame, stats.DrawCalls, stats.Instances, stats.Triangles,
+            stats.ProgramBinds, stats.VertexArrayBinds, stats.TextureBinds,
+            stats.UniformUploads, stats.BytesStreamed, stats.BatchesTested,
+            stats.BatchesCulled, stats.EntitiesTested, stats.EntitiesCulled,
+            stats.CPUFrameTimeMS, stats.RenderTimeMS, stats.GPUFrameTimeMS);
+    }
+
+    LOG_INFO("Wrote {} frames of render stats to {}", history.size(),
+             path.string());
+    return static_cast<bool>(file);
+}
+
+void RenderStatistics::Reset() {
+    std::lock_guard<std::mutex> lock(s_Mutex);
+    s_Current = RenderStats();
+    s_HistoryIndex = 0;
+    s_HistoryCount = 0;
+    s_FrameCount = 0;
+}
+
+}  // namespace Obelisk
@@ -0,0 +1,116 @@
+#include "Obelisk/Renderer/RenderThread.h"
+#include "Obelisk/Renderer/GPUProfiler.h"
+#include "Obelisk/Renderer/Window.h"
+#include <chrono>
+#include <utility>
+
+namespace Obelisk {
+
+RenderThread::RenderThread(Window& window) : m_Window(window) {}
+
+RenderThread::~RenderThread() { Stop(); }
+
+void RenderThread::Start() {
+    if (m_Running) {
+        return;
+    }
+
+    // A context can only be current on one thread at a time
+    m_Window.ReleaseContext();
+    m_Running = true;
+    m_Thread = std::thread(&RenderThread::ThreadMain, this);
+
+    LOG_INFO("Render thread started");
+}
+
+void RenderThread::Stop() {
+    if (!m_Thread.joinable()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Running = false;
+    }
+    m_WorkAvailable.notify_one();
+    m_Thread.join();
+
+    m_Window.MakeContextCurrent();
+    LOG_INFO("Render thread stopped");
+}
+
+void RenderThread::Submit() {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_Idle.wait(lock, [this] { return !m_Busy && !m_Pending; });
+
+    std::chrono::duration<double, std::milli> waitTime =
+        std::chrono::high_resolution_clock::now() - start;
+    m_WaitTimeMS = waitTime.count();
+
+    // The render thread is idle, so state it reads can be handed over safely
+    RenderSnapshot& snapshot = m_Snapshots[m_WriteIndex];
+    m_Window.Latch(snapshot);
+    GPUProfiler::Publish();
+    m_Pending = &snapshot;
+    m_WriteIndex ^= 1;
+
+    lock.unlock();
+    m_WorkAvailable.notify_one();
+}
+
+void RenderThread::Enqueue(std::function<void()> command) {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Commands.push_back(std::move(command));
+    }
+    m_WorkAvailable.notify_one();
+}
+
+void RenderThread::Flush() {
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_Idle.wait(lock, [this] {
+        return !m_Busy && !m_Pending && m_Commands.empty();
+    });
+}
+
+void RenderThread::ThreadMain() {
+    m_Window.MakeContextCurrent();
+
+    std::vector<std::function<void()>> commands;
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (true) {
+        m_WorkAvailable.wait(lock, [this] {
+            return m_Pending || !m_Commands.empty() || !m_Running;
+        });
+
+        // Drain everything handed over before stopping
+        if (!m_Pending && m_Commands.empty()) {
+            break;
+        }
+
+        const RenderSnapshot* snapshot = std::exchange(m_Pending, nullptr);
+        commands.swap(m_Commands);
+        m_Busy = true;
+        lock.unlock();
+
+        for (auto& command : commands) {
+            command();
+        }
+        commands.clear();
+
+        if (snapshot) {
+            m_Window.Render(*snapshot);
+            m_Window.Present();
+        }
+
+        lock.lock();
+        m_Busy = false;
+        m_Idle.notify_all();
+    }
+
+    m_Window.ReleaseContext();
+}
+
+}  // namespace Obelisk
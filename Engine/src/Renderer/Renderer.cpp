@@ -0,0 +1,224 @@
+#include "Obelisk/Renderer/Renderer.h"
+#include "Obelisk/Core/Camera.h"
+#include "Obelisk/Core/Time.h"
+#include "Obelisk/Renderer/ClusteredLighting.h"
+#include "Obelisk/Renderer/MaterialLibrary.h"
+#include "Obelisk/Renderer/Mesh.h"
+#include "Obelisk/Renderer/RenderStats.h"
+#include "Obelisk/Renderer/Shader.h"
+#include "Obelisk/Renderer/Texture.h"
+#include <algorithm>
+#include <limits>
+
+namespace Obelisk {
+
+namespace {
+/**
+ * @brief Block names and the binding points they are assigned.
+ */
+constexpr std::pair<const char*, UniformBinding> UNIFORM_BLOCKS[] = {
+    {"PerFrame", UniformBinding::PerFrame},
+    {"PerDraw", UniformBinding::PerDraw},
+    {"Material", UniformBinding::Material},
+};
+
+/**
+ * @brief Sampler uniforms for material texture units, by unit.
+ */
+constexpr const char* MATERIAL_SAMPLERS[Material::MAX_TEXTURES] = {
+    "textureSampler", "materialTexture1", "materialTexture2",
+    "materialTexture3"};
+
+constexpr unsigned int ToIndex(UniformBinding binding) {
+    return static_cast<unsigned int>(binding);
+}
+}  // namespace
+
+// Static member definitions
+std::unique_ptr<UniformRingBuffer> Renderer::s_Uniforms;
+std::vector<Renderer::DrawItem> Renderer::s_Draws;
+size_t Renderer::s_FrameBlockOffset = 0;
+size_t Renderer::s_DrawCount = 0;
+size_t Renderer::s_StateChanges = 0;
+bool Renderer::s_InFrame = false;
+
+void Renderer::Initialize() {
+    if (s_Uniforms) {
+        return;
+    }
+
+    s_Uniforms = std::make_unique<UniformRingBuffer>(INITIAL_RING_SIZE);
+    LOG_INFO("Renderer initialized");
+}
+
+void Renderer::Shutdown() {
+    s_Draws.clear();
+    s_Uniforms.reset();
+    s_InFrame = false;
+}
+
+void Renderer::BeginFrame(const Camera& camera) {
+    BeginFrame(camera, Time::GetTotalTime(), Time::GetDeltaTime());
+}
+
+void Renderer::BeginFrame(const Camera& camera, float totalTime,
+                          float deltaTime) {
+    if (!s_Uniforms) {
+        return;
+    }
+    if (s_InFrame) {
+        LOG_WARN("Renderer::BeginFrame called twice without EndFrame");
+    }
+
+    s_Uniforms->BeginFrame();
+    s_Draws.clear();
+
+    PerFrameBlock frame;
+    frame.View = camera.GetViewMatrix();
+    frame.Projection = camera.GetProjectionMatrix();
+    frame.ViewProjection = frame.Projection * frame.View;
+    frame.CameraPosition = glm::vec4(camera.GetPosition(), 1.0f);
+    frame.Time = glm::vec4(totalTime, deltaTime, 0.0f, 0.0f);
+    s_FrameBlockOffset = s_Uniforms->Push(frame);
+
+    s_InFrame = true;
+}
+
+void Renderer::Submit(const Mesh& mesh, const Material& material,
+                      const glm::mat4& model, const glm::vec4& params) {
+    if (!s_InFrame) {
+        LOG_ERROR("Renderer::Submit called outside BeginFrame/EndFrame");
+        return;
+    }
+
+    Shader* shader = material.GetShader().get();
+    if (!shader) {
+        LOG_ERROR("Can't draw Mesh without Shader!");
+        return;
+    }
+
+    // Shaders still compiling in the background draw with the fallback, if any
+    if (!shader->IsReady()) {
+        shader = Shader::GetFallback();
+        if (!shader) {
+            return;
+        }
+    }
+
+    PerDrawBlock block;
+    block.Model = model;
+    block.NormalMatrix = glm::transpose(glm::inverse(model));
+    block.Params = params;
+
+    uint64_t sortKey = material.GetSortKey() | (mesh.GetMeshID() & 0xFFFFFF);
+    s_Draws.push_back(
+        {sortKey, &mesh, shader, &material, s_Uniforms->Push(block)});
+}
+
+void Renderer::EndFrame() {
+    if (!s_InFrame) {
+        return;
+    }
+    s_InFrame = false;
+
+    MaterialLibrary::UploadDirty();
+
+    // Group draws by program, then material, then mesh
+    std::sort(s_Draws.begin(), s_Draws.end(),
+              [](const DrawItem& a, const DrawItem& b) {
+                  return a.SortKey < b.SortKey;
+              });
+
+    // One upload for every block of the frame
+    s_Uniforms->Upload();
+    s_Uniforms->BindRange(ToIndex(UniformBinding::PerFrame),
+                          s_FrameBlockOffset, sizeof(PerFrameBlock));
+
+    const Shader* currentShader = nullptr;
+    const Material* currentMaterial = nullptr;
+    const Mesh* currentMesh = nullptr;
+    s_StateChanges = 0;
+
+    // Other passes may have left anything bound, so the first bind always
+    // goes through
+    unsigned int boundTextures[Material::MAX_TEXTURES];
+    std::fill(std::begin(boundTextures), std::end(boundTextures),
+              std::numeric_limits<unsigned int>::max());
+
+    for (const DrawItem& draw : s_Draws) {
+        if (draw.DrawShader != currentShader) {
+            currentShader = draw.DrawShader;
+            BindProgram(*currentShader);
+            s_StateChanges++;
+        }
+
+        if (draw.DrawMaterial != currentMaterial) {
+            currentMaterial = draw.DrawMaterial;
+            for (int unit = 0; unit < Material::MAX_TEXTURES; unit++) {
+                const Texture* texture = currentMaterial->GetTexture(unit);
+                unsigned int id = texture ? texture->GetID() : 0;
+                if (id != boundTextures[unit]) {
+                    boundTextures[unit] = id;
+                    glActiveTexture(GL_TEXTURE0 + unit);
+                    glBindTexture(GL_TEXTURE_2D, id);
+                    RenderStatistics::RecordTextureBind();
+                }
+            }
+            MaterialLibrary::Bind(*currentMaterial);
+            s_StateChanges++;
+        }
+
+        if (draw.DrawMesh != currentMesh) {
+            currentMesh = draw.DrawMesh;
+            currentMesh->Bind();
+            RenderStatistics::RecordVertexArrayBind();
+            s_StateChanges++;
+        }
+
+        s_Uniforms->BindRange(ToIndex(UniformBinding::PerDraw),
+                              draw.BlockOffset, sizeof(PerDrawBlock));
+        glDrawElements(GL_TRIANGLES, currentMesh->GetNumberOfIndices(),
+                       GL_UNSIGNED_INT, nullptr);
+        RenderStatistics::RecordDraw(currentMesh->GetNumberOfIndices() / 3);
+    }
+
+    if (currentMesh) {
+        Mesh::Unbind();
+    }
+
+    s_Uniforms->EndFrame();
+    s_DrawCount = s_Draws.size();
+    s_Draws.clear();
+}
+
+void Renderer::BindProgram(const Shader& shader) {
+    shader.Use();
+    RenderStatistics::RecordProgramBind();
+    ClusteredLighting::Apply(shader);
+}
+
+void Renderer::BindUniformBlocks(unsigned int program) {
+    for (const auto& [name, binding] : UNIFORM_BLOCKS) {
+        GLuint index = glGetUniformBlockIndex(program, name);
+        if (index != GL_INVALID_INDEX) {
+            glUniformBlockBinding(program, index, ToIndex(binding));
+        }
+    }
+}
+
+void Renderer::BindSamplers(unsigned int program) {
+    // Programs can become ready in the middle of a Flush(), so the current
+    // one is put back afterwards
+    GLint previous = 0;
+    glGetIntegerv(GL_CURRENT_PROGRAM, &previous);
+    glUseProgram(program);
+    for (int unit = 0; unit < Material::MAX_TEXTURES; unit++) {
+        GLint location = glGetUniformLocation(program, MATERIAL_SAMPLERS[unit]);
+        if (location != -1) {
+            glUniform1i(location, unit);
+        }
+    }
+    glUseProgram(previous);
+}
+
+}  // namespace Obelisk
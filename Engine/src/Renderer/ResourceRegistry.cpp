@@ -0,0 +1,38 @@
+#include "Obelisk/Renderer/ResourceRegistry.h"
+#include "Obelisk/Renderer/Material.h"
+#include "Obelisk/Renderer/Mesh.h"
+#include "Obelisk/Renderer/Shader.h"
+#include "Obelisk/Renderer/Texture.h"
+
+namespace Obelisk {
+
+ResourcePool<Mesh> ResourceRegistry::s_Meshes;
+ResourcePool<Material> ResourceRegistry::s_Materials;
+ResourcePool<Shader> ResourceRegistry::s_Shaders;
+ResourcePool<Texture> ResourceRegistry::s_Textures;
+uint64_t ResourceRegistry::s_Frame = 0;
+
+std::vector<std::shared_ptr<void>> ResourceRegistry::EndFrame() {
+    std::vector<std::shared_ptr<void>> expired;
+    s_Frame++;
+    if (s_Frame < RELEASE_DELAY) {
+        return expired;
+    }
+
+    uint64_t lastFrame = s_Frame - RELEASE_DELAY;
+    s_Materials.Collect(lastFrame, expired);
+    s_Meshes.Collect(lastFrame, expired);
+    s_Shaders.Collect(lastFrame, expired);
+    s_Textures.Collect(lastFrame, expired);
+    return expired;
+}
+
+void ResourceRegistry::Shutdown() {
+    s_Materials.Clear();
+    s_Meshes.Clear();
+    s_Shaders.Clear();
+    s_Textures.Clear();
+    s_Frame = 0;
+}
+
+}  // namespace Obelisk
@@ -1,37 +1,37 @@
 #include "Obelisk/Renderer/Shader.h"
-#include <filesystem>
-#include <fstream>
+#include <chrono>
+#include "Obelisk/Renderer/GLExtensions.h"
+#include "Obelisk/Renderer/RenderStats.h"
+#include "Obelisk/Renderer/Renderer.h"
+#include "Obelisk/Renderer/ShaderCache.h"
+#include "Obelisk/Renderer/ShaderPreprocessor.h"
 
 namespace Obelisk {
-Shader::Shader(const std::string& vertexPath, const std::string& fragmentPath) {
-    std::string vertexSource = LoadShaderSource(vertexPath);
-    const char* vertexCStr = vertexSource.c_str();
-
-    std::string fragmentSource = LoadShaderSource(fragmentPath);
-    const char* fragmentCStr = fragmentSource.c_str();
+std::shared_ptr<Shader> Shader::s_Fallback;
 
-    unsigned int vertex = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertex, 1, &vertexCStr, nullptr);
-    glCompileShader(vertex);
-    CheckCompileErrors(vertex, "vertex");
+Shader::Shader(const std::string& vertexPath, const std::string& fragmentPath,
+               ShaderCompileMode mode)
+    : Shader(vertexPath, fragmentPath, {}, mode) {}
 
-    unsigned int fragment = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragment, 1, &fragmentCStr, nullptr);
-    glCompileShader(fragment);
-    CheckCompileErrors(fragment, "fragment");
+Shader::Shader(const std::string& vertexPath, const std::string& fragmentPath,
+               const std::vector<std::string>& defines, ShaderCompileMode mode)
+    : m_Defines(defines) {
+    Submit(vertexPath, fragmentPath);
 
-    m_ProgramID = glCreateProgram();
-    glAttachShader(m_ProgramID, vertex);
-    glAttachShader(m_ProgramID, fragment);
-    glLinkProgram(m_ProgramID);
-
-    CheckCompileErrors(m_ProgramID, "program");
-
-    glDeleteShader(vertex);
-    glDeleteShader(fragment);
+    if (mode == ShaderCompileMode::Immediate) {
+        WaitUntilReady();
+    }
 }
 
 Shader::~Shader() {
+    if (m_VertexStage) {
+        glDeleteShader(m_VertexStage);
+    }
+
+    if (m_FragmentStage) {
+        glDeleteShader(m_FragmentStage);
+    }
+
     if (m_ProgramID) {
         glDeleteProgram(m_ProgramID);
         LOG_TRACE("ShaderProgramID {} destroyed.", m_ProgramID);
@@ -39,43 +39,6 @@ Shader::~Shader() {
     }
 }
 
-std::string Shader::LoadShaderSource(const std::string& filepath) {
-    std::ifstream file;
-    file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-
-    try {
-        // Use AssetManager to get the full path
-        std::filesystem::path fullPath =
-            AssetManager::GetAssetPath("shaders/" + filepath);
-
-        // Check if asset exists before trying to open
-        if (!AssetManager::AssetExists("shaders/" + filepath)) {
-            LOG_ERROR("Shader file not found: {}", filepath);
-            LOG_ERROR("Searched path: {}", fullPath.string());
-            LOG_ERROR(AssetManager::GetDebugInfo());
-            return "";
-        }
-
-        file.open(fullPath);
-
-        if (!file.is_open()) {
-            LOG_ERROR("Failed to open shader file: {}", fullPath.string());
-            return "";
-        }
-
-        std::stringstream buffer;
-        buffer << file.rdbuf();
-        file.close();
-
-        LOG_TRACE("Successfully loaded shader: {}", fullPath.string());
-        return buffer.str();
-    } catch (const std::ifstream::failure& e) {
-        LOG_ERROR("Failed to read shader file \"{}\": {}", filepath, e.what());
-        LOG_ERROR(AssetManager::GetDebugInfo());
-        return "";
-    }
-}
-
 unsigned int Shader::GetUniformLocation(const std::string& uniformName) const {
     const unsigned int location =
         glGetUniformLocation(m_ProgramID, uniformName.c_str());
@@ -100,40 +63,179 @@ void Shader::CheckCompileErrors(unsigned int shader, const std::string& type) {
     }
 }
 
+void Shader::Submit(const std::string& vertexPath,
+                    const std::string& fragmentPath) {
+    auto submitStart = std::chrono::high_resolution_clock::now();
+    m_Name = vertexPath + ", " + fragmentPath;
+    m_VertexPath = vertexPath;
+    m_FragmentPath = fragmentPath;
+
+    std::string definesString;
+    for (const auto& define : m_Defines) {
+        definesString += define + ";";
+    }
+    if (!definesString.empty()) {
+        m_Name += " [" + definesString + "]";
+    }
+
+    std::string vertexSource =
+        ShaderPreprocessor::Process(vertexPath, m_Defines);
+    std::string fragmentSource =
+        ShaderPreprocessor::Process(fragmentPath, m_Defines);
+    m_CacheKey =
+        ShaderCache::ComputeKey(vertexSource, fragmentSource, definesString);
+
+    m_ProgramID = glCreateProgram();
+    if (ShaderCache::Load(m_CacheKey, m_ProgramID)) {
+        m_State = ShaderState::Ready;
+        Renderer::BindUniformBlocks(m_ProgramID);
+        Renderer::BindSamplers(m_ProgramID);
+
+        std::chrono::duration<double, std::milli> buildTime =
+            std::chrono::high_resolution_clock::now() - submitStart;
+        ShaderCache::RecordBuildTime(buildTime.count(), true);
+        LOG_TRACE("ShaderProgramID {} ready ({}) in {:.2f}ms [cached]",
+                  m_ProgramID, m_Name, buildTime.count());
+        return;
+    }
+
+    // Start over with a clean program in case a rejected binary was loaded
+    glDeleteProgram(m_ProgramID);
+    m_ProgramID = glCreateProgram();
+
+    // Hand everything to the driver without querying any status, so that
+    // compilation can overlap with the submission of other programs
+    const char* vertexCStr = vertexSource.c_str();
+    const char* fragmentCStr = fragmentSource.c_str();
+
+    m_VertexStage = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(m_VertexStage, 1, &vertexCStr, nullptr);
+    glCompileShader(m_VertexStage);
+
+    m_FragmentStage = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(m_FragmentStage, 1, &fragmentCStr, nullptr);
+    glCompileShader(m_FragmentStage);
+
+    glAttachShader(m_ProgramID, m_VertexStage);
+    glAttachShader(m_ProgramID, m_FragmentStage);
+    ShaderCache::PrepareForLink(m_ProgramID);
+    glLinkProgram(m_ProgramID);
+
+    m_State = ShaderState::Pending;
+
+    std::chrono::duration<double, std::milli> submitTime =
+        std::chrono::high_resolution_clock::now() - submitStart;
+    m_BuildTimeMS = submitTime.count();
+}
+
+void Shader::Finalize() {
+    if (m_State != ShaderState::Pending) return;
+
+    auto finalizeStart = std::chrono::high_resolution_clock::now();
+
+    CheckCompileErrors(m_ProgramID, "program");
+    if (m_Success) {
+        m_State = ShaderState::Ready;
+        Renderer::BindUniformBlocks(m_ProgramID);
+        Renderer::BindSamplers(m_ProgramID);
+        ShaderCache::Store(m_CacheKey, m_ProgramID);
+    } else {
+        // Only dig into the individual stages once linking has failed
+        CheckCompileErrors(m_VertexStage, "vertex");
+        CheckCompileErrors(m_FragmentStage, "fragment");
+        m_State = ShaderState::Failed;
+    }
+
+    glDetachShader(m_ProgramID, m_VertexStage);
+    glDetachShader(m_ProgramID, m_FragmentStage);
+    glDeleteShader(m_VertexStage);
+    glDeleteShader(m_FragmentStage);
+    m_VertexStage = 0;
+    m_FragmentStage = 0;
+
+    std::chrono::duration<double, std::milli> finalizeTime =
+        std::chrono::high_resolution_clock::now() - finalizeStart;
+    m_BuildTimeMS += finalizeTime.count();
+    ShaderCache::RecordBuildTime(m_BuildTimeMS, false);
+
+    LOG_TRACE("ShaderProgramID {} {} ({}) in {:.2f}ms", m_ProgramID,
+              m_State == ShaderState::Ready ? "ready" : "failed", m_Name,
+              m_BuildTimeMS);
+}
+
+bool Shader::IsReady() {
+    if (m_State == ShaderState::Pending) {
+        if (GLExtensions::HasParallelShaderCompile()) {
+            int completed = GL_FALSE;
+            glGetProgramiv(m_ProgramID, GL_COMPLETION_STATUS_KHR, &completed);
+            if (!completed) {
+                return false;
+            }
+        }
+
+        Finalize();
+    }
+
+    return m_State == ShaderState::Ready;
+}
+
+bool Shader::WaitUntilReady() {
+    Finalize();
+    return m_State == ShaderState::Ready;
+}
+
+void Shader::SetFallback(std::shared_ptr<Shader> shader) {
+    s_Fallback = std::move(shader);
+}
+
+Shader* Shader::GetFallback() {
+    if (s_Fallback && s_Fallback->IsReady()) {
+        return s_Fallback.get();
+    }
+    return nullptr;
+}
+
 void Shader::Use() const { glUseProgram(m_ProgramID); }
 
 void Shader::SetBool(const std::string& name, bool value) const {
     Use();
     glUniform1i(GetUniformLocation(name), value);
+    RenderStatistics::RecordUniformUpload(sizeof(int));
 }
 
 void Shader::SetInt(const std::string& name, int value) const {
     Use();
     glUniform1i(GetUniformLocation(name), value);
+    RenderStatistics::RecordUniformUpload(sizeof(int));
 }
 
 void Shader::SetFloat(const std::string& name, float value) const {
     Use();
     glUniform1f(GetUniformLocation(name), value);
+    RenderStatistics::RecordUniformUpload(sizeof(float));
 }
 
 void Shader::SetVec2(const std::string& name, const glm::vec2& value) const {
     Use();
     glUniform2f(GetUniformLocation(name), value.x, value.y);
+    RenderStatistics::RecordUniformUpload(sizeof(value));
 }
 
 void Shader::SetVec3(const std::string& name, const glm::vec3& value) const {
     Use();
     glUniform3f(GetUniformLocation(name), value.x, value.y, value.z);
+    RenderStatistics::RecordUniformUpload(sizeof(value));
 }
 
 void Shader::SetVec4(const std::string& name, const glm::vec4& value) const {
     Use();
     glUniform4f(GetUniformLocation(name), value.x, value.y, value.z, value.w);
+    RenderStatistics::RecordUniformUpload(sizeof(value));
 }
 
 void Shader::SetMat4(const std::string& name, const glm::mat4& value) const {
     Use();
     glUniformMatrix4fv(GetUniformLocation(name), 1, GL_FALSE, &value[0][0]);
+    RenderStatistics::RecordUniformUpload(sizeof(value));
 }
 }  // namespace Obelisk
\ No newline at end of file
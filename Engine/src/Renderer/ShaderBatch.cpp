@@ -0,0 +1,44 @@
+#include "Obelisk/Renderer/ShaderBatch.h"
+#include <algorithm>
+
+namespace Obelisk {
+
+std::shared_ptr<Shader> ShaderBatch::Add(const std::string& vertexPath,
+                                         const std::string& fragmentPath) {
+    auto shader = std::make_shared<Shader>(vertexPath, fragmentPath,
+                                           ShaderCompileMode::Deferred);
+
+    // Cache hits are ready straight away and need no further tracking
+    if (shader->IsPending()) {
+        m_Pending.push_back(shader);
+    }
+
+    return shader;
+}
+
+size_t ShaderBatch::Poll() {
+    std::erase_if(m_Pending, [](const std::shared_ptr<Shader>& shader) {
+        shader->IsReady();
+        return !shader->IsPending();
+    });
+
+    return m_Pending.size();
+}
+
+size_t ShaderBatch::Wait() {
+    size_t failed = 0;
+    for (const auto& shader : m_Pending) {
+        if (!shader->WaitUntilReady()) {
+            failed++;
+        }
+    }
+    m_Pending.clear();
+
+    if (failed > 0) {
+        LOG_WARN("ShaderBatch finished with {} failed program(s)", failed);
+    }
+
+    return failed;
+}
+
+}  // namespace Obelisk
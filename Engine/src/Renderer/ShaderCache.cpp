@@ -0,0 +1,203 @@
+#include "Obelisk/Renderer/ShaderCache.h"
+#include <format>
+#include <fstream>
+#include "Obelisk/Core/Hash.h"
+#include "Obelisk/Renderer/GLCapture.h"
+#include "Obelisk/Renderer/GLExtensions.h"
+
+namespace Obelisk {
+
+namespace {
+constexpr uint32_t CACHE_MAGIC = 0x4353424F;  // "OBSC"
+constexpr uint32_t CACHE_VERSION = 1;
+
+/**
+ * @brief Header written in front of every cached program binary.
+ */
+struct CacheEntryHeader {
+        uint32_t Magic;    ///< Always CACHE_MAGIC
+        uint32_t Version;  ///< Cache layout version
+        uint64_t Key;      ///< Key the entry was stored under
+        uint32_t Format;   ///< Driver-specific binary format enum
+        uint32_t Length;   ///< Size of the binary blob in bytes
+};
+
+const char* GetGLString(GLenum name) {
+    const auto* value = reinterpret_cast<const char*>(glGetString(name));
+    return value ? value : "";
+}
+}  // namespace
+
+// Static member definitions
+std::filesystem::path ShaderCache::s_CacheDirectory;
+uint64_t ShaderCache::s_DriverHash = 0;
+bool ShaderCache::s_Enabled = false;
+
+size_t ShaderCache::s_Hits = 0;
+size_t ShaderCache::s_Misses = 0;
+size_t ShaderCache::s_Rejected = 0;
+double ShaderCache::s_HitTimeMS = 0.0;
+double ShaderCache::s_MissTimeMS = 0.0;
+
+void ShaderCache::Initialize(const std::filesystem::path& directory) {
+    s_CacheDirectory = directory;
+
+    s_DriverHash = Hash::FNV1a(GetGLString(GL_VENDOR));
+    s_DriverHash = Hash::FNV1a(GetGLString(GL_RENDERER), s_DriverHash);
+    s_DriverHash = Hash::FNV1a(GetGLString(GL_VERSION), s_DriverHash);
+
+    if (!GLExtensions::HasProgramBinary()) {
+        s_Enabled = false;
+        LOG_INFO("ShaderCache disabled: program binaries not supported");
+        return;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(s_CacheDirectory, error);
+    if (error) {
+        s_Enabled = false;
+        LOG_WARN("ShaderCache disabled: cannot create {} ({})",
+                 s_CacheDirectory.string(), error.message());
+        return;
+    }
+
+    s_Enabled = true;
+    LOG_INFO("ShaderCache initialized at: {}", s_CacheDirectory.string());
+}
+
+uint64_t ShaderCache::ComputeKey(const std::string& vertexSource,
+                                 const std::string& fragmentSource,
+                                 const std::string& defines) {
+    uint64_t key = Hash::Combine(s_DriverHash, CACHE_VERSION);
+    key = Hash::Combine(key, Hash::FNV1a(vertexSource));
+    key = Hash::Combine(key, Hash::FNV1a(fragmentSource));
+    key = Hash::Combine(key, Hash::FNV1a(defines));
+    return key;
+}
+
+bool ShaderCache::Load(uint64_t key, unsigned int program) {
+    if (!s_Enabled) return false;
+
+    // Captures must compile from source to stay replayable on other drivers
+    if (GLCapture::IsCapturing()) return false;
+
+    std::filesystem::path entryPath = GetEntryPath(key);
+    std::ifstream file(entryPath, std::ios::binary);
+    if (!file.is_open()) {
+        LOG_TRACE("ShaderCache miss: {:016x}", key);
+        return false;
+    }
+
+    CacheEntryHeader header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || header.Magic != CACHE_MAGIC ||
+        header.Version != CACHE_VERSION || header.Key != key) {
+        LOG_WARN("ShaderCache entry {} is corrupt, ignoring",
+                 entryPath.string());
+        return false;
+    }
+
+    std::vector<char> binary(header.Length);
+    file.read(binary.data(), header.Length);
+    if (!file) {
+        LOG_WARN("ShaderCache entry {} is truncated, ignoring",
+                 entryPath.string());
+        return false;
+    }
+
+    GLExtensions::ProgramBinary(program, header.Format, binary.data(),
+                                static_cast<GLsizei>(header.Length));
+
+    int success = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success) {
+        // Typically a driver update; drop the entry so it gets rebuilt
+        s_Rejected++;
+        LOG_INFO("ShaderCache entry {:016x} rejected by driver", key);
+        file.close();
+        std::error_code error;
+        std::filesystem::remove(entryPath, error);
+        return false;
+    }
+
+    LOG_TRACE("ShaderCache hit: {:016x} ({} bytes)", key, header.Length);
+    return true;
+}
+
+void ShaderCache::PrepareForLink(unsigned int program) {
+    if (!s_Enabled) return;
+
+    GLExtensions::ProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT,
+                                    GL_TRUE);
+}
+
+void ShaderCache::Store(uint64_t key, unsigned int program) {
+    if (!s_Enabled) return;
+
+    int length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) {
+        LOG_WARN("ShaderCache: driver returned no binary for program {}",
+                 program);
+        return;
+    }
+
+    std::vector<char> binary(length);
+    GLenum format = 0;
+    GLExtensions::GetProgramBinary(program, length, nullptr, &format,
+                                   binary.data());
+
+    CacheEntryHeader header{CACHE_MAGIC, CACHE_VERSION, key,
+                            static_cast<uint32_t>(format),
+                            static_cast<uint32_t>(length)};
+
+    // Write to a temporary file first so a crash never leaves a torn entry
+    std::filesystem::path entryPath = GetEntryPath(key);
+    std::filesystem::path tempPath = entryPath;
+    tempPath += ".tmp";
+
+    std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        LOG_WARN("ShaderCache: failed to write {}", tempPath.string());
+        return;
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(binary.data(), length);
+    file.close();
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, entryPath, error);
+    if (error) {
+        LOG_WARN("ShaderCache: failed to store {} ({})", entryPath.string(),
+                 error.message());
+        std::filesystem::remove(tempPath, error);
+        return;
+    }
+
+    LOG_TRACE("ShaderCache stored: {:016x} ({} bytes)", key, length);
+}
+
+void ShaderCache::RecordBuildTime(double milliseconds, bool cacheHit) {
+    if (cacheHit) {
+        s_Hits++;
+        s_HitTimeMS += milliseconds;
+    } else {
+        s_Misses++;
+        s_MissTimeMS += milliseconds;
+    }
+}
+
+void ShaderCache::LogStatistics() {
+    LOG_INFO(
+        "Shader startup: {} cached ({:.2f}ms), {} compiled ({:.2f}ms), {} "
+        "rejected{}",
+        s_Hits, s_HitTimeMS, s_Misses, s_MissTimeMS, s_Rejected,
+        s_Enabled ? "" : " [cache disabled]");
+}
+
+std::filesystem::path ShaderCache::GetEntryPath(uint64_t key) {
+    return s_CacheDirectory / std::format("{:016x}.bin", key);
+}
+
+}  // namespace Obelisk
@@ -0,0 +1,183 @@
+#include "Obelisk/Renderer/ShaderPreprocessor.h"
+#include <algorithm>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include "Obelisk/Core/AssetManager.h"
+
+namespace Obelisk {
+
+namespace {
+/**
+ * @brief Strip leading whitespace from a line.
+ */
+std::string_view TrimLeft(std::string_view line) {
+    size_t start = line.find_first_not_of(" \t");
+    return start == std::string_view::npos ? std::string_view{}
+                                           : line.substr(start);
+}
+
+/**
+ * @brief Extract the file name from an `#include "name"` directive.
+ *
+ * @return The quoted name, or an empty string if the directive is malformed
+ */
+std::string ParseIncludeName(std::string_view directive) {
+    size_t open = directive.find('"');
+    size_t close = directive.find('"', open + 1);
+    if (open == std::string_view::npos || close == std::string_view::npos) {
+        return "";
+    }
+    return std::string(directive.substr(open + 1, close - open - 1));
+}
+}  // namespace
+
+// Static member definitions
+std::unordered_map<std::string, std::string> ShaderPreprocessor::s_SourceCache;
+std::vector<std::string> ShaderPreprocessor::s_FileNames;
+
+std::string ShaderPreprocessor::Process(
+    const std::string& filepath, const std::vector<std::string>& defines) {
+    std::unordered_set<std::string> included;
+    std::string output;
+
+    if (!Expand(filepath, defines, included, output, 0)) {
+        return "";
+    }
+
+    return output;
+}
+
+std::string ShaderPreprocessor::GetFileName(int sourceIndex) {
+    if (sourceIndex < 0 ||
+        static_cast<size_t>(sourceIndex) >= s_FileNames.size()) {
+        return "";
+    }
+    return s_FileNames[sourceIndex];
+}
+
+void ShaderPreprocessor::ClearCache() {
+    s_SourceCache.clear();
+    LOG_TRACE("Shader source cache cleared");
+}
+
+const std::string* ShaderPreprocessor::GetSource(const std::string& filepath) {
+    auto cached = s_SourceCache.find(filepath);
+    if (cached != s_SourceCache.end()) {
+        return &cached->second;
+    }
+
+    std::ifstream file;
+    file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+
+    try {
+        // Use AssetManager to get the full path
+        std::filesystem::path fullPath =
+            AssetManager::GetAssetPath("shaders/" + filepath);
+
+        // Check if asset exists before trying to open
+        if (!AssetManager::AssetExists("shaders/" + filepath)) {
+            LOG_ERROR("Shader file not found: {}", filepath);
+            LOG_ERROR("Searched path: {}", fullPath.string());
+            LOG_ERROR(AssetManager::GetDebugInfo());
+            return nullptr;
+        }
+
+        file.open(fullPath);
+
+        if (!file.is_open()) {
+            LOG_ERROR("Failed to open shader file: {}", fullPath.string());
+            return nullptr;
+        }
+
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        file.close();
+
+        LOG_TRACE("Successfully loaded shader: {}", fullPath.string());
+        return &s_SourceCache.emplace(filepath, buffer.str()).first->second;
+    } catch (const std::ifstream::failure& e) {
+        LOG_ERROR("Failed to read shader file \"{}\": {}", filepath, e.what());
+        LOG_ERROR(AssetManager::GetDebugInfo());
+        return nullptr;
+    }
+}
+
+int ShaderPreprocessor::GetFileIndex(const std::string& filepath) {
+    auto it = std::find(s_FileNames.begin(), s_FileNames.end(), filepath);
+    if (it != s_FileNames.end()) {
+        return static_cast<int>(it - s_FileNames.begin());
+    }
+
+    s_FileNames.push_back(filepath);
+    return static_cast<int>(s_FileNames.size() - 1);
+}
+
+bool ShaderPreprocessor::Expand(const std::string& filepath,
+                                const std::vector<std::string>& defines,
+                                std::unordered_set<std::string>& included,
+                                std::string& output, int depth) {
+    const std::string* source = GetSource(filepath);
+    if (!source) {
+        return false;
+    }
+
+    int fileIndex = GetFileIndex(filepath);
+    included.insert(filepath);
+
+    std::istringstream stream(*source);
+    std::string line;
+    int lineNumber = 0;
+    bool versionFound = false;
+
+    while (std::getline(stream, line)) {
+        lineNumber++;
+        std::string_view directive = TrimLeft(line);
+
+        if (depth == 0 && directive.starts_with("#version")) {
+            versionFound = true;
+            output += line;
+            output += '\n';
+
+            for (const auto& define : defines) {
+                output += "#define " + define + "\n";
+            }
+            output += std::format("#line {} {}\n", lineNumber + 1, fileIndex);
+            continue;
+        }
+
+        if (directive.starts_with("#include")) {
+            std::string includeName = ParseIncludeName(directive);
+            if (includeName.empty()) {
+                LOG_ERROR("Malformed #include in {}({}): {}", filepath,
+                          lineNumber, line);
+                return false;
+            }
+
+            // Every file is expanded at most once, which also breaks cycles
+            if (!included.contains(includeName)) {
+                output += std::format("#line 1 {}\n",
+                                      GetFileIndex(includeName));
+                if (!Expand(includeName, defines, included, output,
+                            depth + 1)) {
+                    LOG_ERROR("Included from {}({})", filepath, lineNumber);
+                    return false;
+                }
+            }
+
+            output += std::format("#line {} {}\n", lineNumber + 1, fileIndex);
+            continue;
+        }
+
+        output += line;
+        output += '\n';
+    }
+
+    if (depth == 0 && !versionFound && !defines.empty()) {
+        LOG_WARN("No #version in {}, defines were not injected", filepath);
+    }
+
+    return true;
+}
+
+}  // namespace Obelisk
@@ -0,0 +1,66 @@
+#include "Obelisk/Renderer/ShaderVariantSet.h"
+
+namespace Obelisk {
+
+ShaderVariantSet::ShaderVariantSet(std::string vertexPath,
+                                   std::string fragmentPath,
+                                   std::vector<std::string> features)
+    : m_VertexPath(std::move(vertexPath)),
+      m_FragmentPath(std::move(fragmentPath)),
+      m_Features(std::move(features)) {
+    if (m_Features.size() > MAX_FEATURES) {
+        LOG_ERROR("ShaderVariantSet ({}, {}) has {} features, only {} fit",
+                  m_VertexPath, m_FragmentPath, m_Features.size(),
+                  MAX_FEATURES);
+        m_Features.resize(MAX_FEATURES);
+    }
+}
+
+ShaderVariantKey ShaderVariantSet::GetFeatureBit(
+    std::string_view feature) const {
+    for (size_t i = 0; i < m_Features.size(); ++i) {
+        if (m_Features[i] == feature) {
+            return ShaderVariantKey(1) << i;
+        }
+    }
+    return 0;
+}
+
+ShaderVariantKey ShaderVariantSet::MakeKey(
+    std::initializer_list<std::string_view> features) const {
+    ShaderVariantKey key = 0;
+    for (std::string_view feature : features) {
+        ShaderVariantKey bit = GetFeatureBit(feature);
+        if (!bit) {
+            LOG_WARN("Unknown shader feature \"{}\" for ({}, {})", feature,
+                     m_VertexPath, m_FragmentPath);
+        }
+        key |= bit;
+    }
+    return key;
+}
+
+std::shared_ptr<Shader> ShaderVariantSet::Get(ShaderVariantKey key,
+                                              ShaderCompileMode mode) {
+    auto it = m_Variants.find(key);
+    if (it != m_Variants.end()) {
+        return it->second;
+    }
+
+    std::vector<std::string> defines;
+    for (size_t i = 0; i < m_Features.size(); ++i) {
+        if (key & (ShaderVariantKey(1) << i)) {
+            defines.push_back(m_Features[i]);
+        }
+    }
+
+    auto shader =
+        std::make_shared<Shader>(m_VertexPath, m_FragmentPath, defines, mode);
+    m_Variants.emplace(key, shader);
+
+    LOG_TRACE("Compiled shader variant {:#x} of ({}, {})", key, m_VertexPath,
+              m_FragmentPath);
+    return shader;
+}
+
+}  // namespace Obelisk
@@ -0,0 +1,336 @@
+#include "Obelisk/Renderer/SpriteBatch.h"
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <glm/gtc/packing.hpp>
+#include "Obelisk/Core/Camera.h"
+#include "Obelisk/Core/JobSystem.h"
+#include "Obelisk/Renderer/GPUProfiler.h"
+#include "Obelisk/Renderer/RenderStats.h"
+#include "Obelisk/Renderer/Shader.h"
+#include "Obelisk/Renderer/Texture.h"
+
+namespace Obelisk {
+
+namespace {
+// Sort key layout: layer (16 bits) | texture index (16) | sprite index (32)
+constexpr int TEXTURE_SHIFT = 32;
+constexpr int LAYER_SHIFT = 48;
+
+/**
+ * @brief Sort keys by layer and texture, keeping submission order for ties.
+ *
+ * Keys are generated in submission order with the sprite index in the low 32
+ * bits, so a stable LSD radix sort over the upper 32 bits alone yields the
+ * full order. Digits that are equal across all keys (typically the layer, and
+ * the high byte of the texture index) are skipped.
+ */
+void SortKeys(std::vector<uint64_t>& keys, std::vector<uint64_t>& scratch) {
+    const size_t count = keys.size();
+    scratch.resize(count);
+
+    size_t histograms[4][256] = {};
+    for (uint64_t key : keys) {
+        for (int digit = 0; digit < 4; digit++) {
+            histograms[digit][(key >> (TEXTURE_SHIFT + digit * 8)) & 0xFF]++;
+        }
+    }
+
+    for (int digit = 0; digit < 4; digit++) {
+        const int shift = TEXTURE_SHIFT + digit * 8;
+        size_t* histogram = histograms[digit];
+        if (histogram[(keys[0] >> shift) & 0xFF] == count) {
+            continue;
+        }
+
+        size_t offset = 0;
+        for (int bucket = 0; bucket < 256; bucket++) {
+            size_t bucketSize = histogram[bucket];
+            histogram[bucket] = offset;
+            offset += bucketSize;
+        }
+
+        for (uint64_t key : keys) {
+            scratch[histogram[(key >> shift) & 0xFF]++] = key;
+        }
+        keys.swap(scratch);
+    }
+}
+}  // namespace
+
+SpriteBatch::SpriteBatch() {
+    m_Shader = std::make_unique<Shader>("sprite.vert", "sprite.frag");
+
+    // Every quad uses the same index pattern, so the index buffer is static
+    std::vector<uint16_t> indices(MAX_SPRITES_PER_DRAW * 6);
+    for (uint32_t i = 0; i < MAX_SPRITES_PER_DRAW; i++) {
+        auto base = static_cast<uint16_t>(i * 4);
+        uint16_t* quad = &indices[i * 6];
+        quad[0] = base;
+        quad[1] = base + 1;
+        quad[2] = base + 2;
+        quad[3] = base + 2;
+        quad[4] = base + 3;
+        quad[5] = base;
+    }
+
+    glGenVertexArrays(1, &m_VAO);
+    glGenBuffers(1, &m_VBO);
+    glGenBuffers(1, &m_EBO);
+
+    glBindVertexArray(m_VAO);
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(uint16_t),
+                 indices.data(), GL_STATIC_DRAW);
+
+    glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+
+    // Position attribute
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(SpriteVertex),
+                          (void*)offsetof(SpriteVertex, Position));
+    glEnableVertexAttribArray(0);
+
+    // Texture Coords attribute
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(SpriteVertex),
+                          (void*)offsetof(SpriteVertex, TexCoord));
+    glEnableVertexAttribArray(1);
+
+    // Color attribute
+    glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(SpriteVertex),
+                          (void*)offsetof(SpriteVertex, Color));
+    glEnableVertexAttribArray(2);
+
+    // Texture slot attribute
+    glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, sizeof(SpriteVertex),
+                          (void*)offsetof(SpriteVertex, TextureSlot));
+    glEnableVertexAttribArray(3);
+
+    // Cleanup
+    glBindVertexArray(0);
+}
+
+SpriteBatch::~SpriteBatch() {
+    if (m_VAO) {
+        glDeleteVertexArrays(1, &m_VAO);
+    }
+
+    if (m_VBO) {
+        glDeleteBuffers(1, &m_VBO);
+    }
+
+    if (m_EBO) {
+        glDeleteBuffers(1, &m_EBO);
+    }
+}
+
+void SpriteBatch::Begin(const Camera& camera) {
+    if (m_Active) {
+        LOG_WARN("SpriteBatch::Begin called twice without End");
+    }
+
+    m_Camera = &camera;
+    m_Active = true;
+    m_SpriteCount = 0;
+    m_DrawCallCount = 0;
+}
+
+void SpriteBatch::Draw(const Texture& texture, const Sprite& sprite) {
+    if (!m_Active) {
+        LOG_ERROR("SpriteBatch::Draw called outside Begin/End");
+        return;
+    }
+
+    // The texture index is only 16 bits wide in the sort key
+    auto found = m_TextureIndices.find(texture.GetID());
+    if (found == m_TextureIndices.end()) {
+        if (m_Textures.size() == MAX_TEXTURES) {
+            Flush();
+        }
+        found = m_TextureIndices
+                    .emplace(texture.GetID(),
+                             static_cast<uint32_t>(m_Textures.size()))
+                    .first;
+        m_Textures.push_back(texture.GetID());
+    }
+
+    auto layer = static_cast<uint16_t>(
+        std::clamp(sprite.Layer, -32768, 32767) + 32768);
+    auto spriteIndex = static_cast<uint32_t>(m_Sprites.size());
+    m_Keys.push_back(static_cast<uint64_t>(layer) << LAYER_SHIFT |
+                     static_cast<uint64_t>(found->second) << TEXTURE_SHIFT |
+                     spriteIndex);
+
+    m_Sprites.push_back({sprite.Position, sprite.Size, sprite.UVRect,
+                         glm::radians(sprite.Rotation),
+                         glm::packUnorm4x8(sprite.Tint)});
+}
+
+void SpriteBatch::Draw(const Texture& texture, const glm::vec2& position,
+                       const glm::vec2& size, float rotation, int layer) {
+    Sprite sprite;
+    sprite.Position = position;
+    sprite.Size = size;
+    sprite.Rotation = rotation;
+    sprite.Layer = layer;
+    Draw(texture, sprite);
+}
+
+void SpriteBatch::End() {
+    if (!m_Active) {
+        LOG_WARN("SpriteBatch::End called without Begin");
+        return;
+    }
+
+    Flush();
+    m_Active = false;
+    m_Camera = nullptr;
+}
+
+void SpriteBatch::Flush() {
+    const size_t count = m_Sprites.size();
+    if (count == 0) {
+        return;
+    }
+
+    if (m_Shader->IsReady()) {
+        GPUProfiler::ScopedPass spritePass("Sprites");
+
+        SortKeys(m_Keys, m_SortScratch);
+        BuildDrawCommands();
+
+        m_Vertices.resize(count * 4);
+        JobSystem::ParallelFor(count, 4096, [this](size_t begin, size_t end) {
+            BuildVertices(begin, end);
+        });
+
+        // Sprites are drawn in sorted order with alpha blending
+        GLboolean depthTest = glIsEnabled(GL_DEPTH_TEST);
+        GLboolean cullFace = glIsEnabled(GL_CULL_FACE);
+        GLboolean blend = glIsEnabled(GL_BLEND);
+        glDisable(GL_DEPTH_TEST);
+        glDisable(GL_CULL_FACE);
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+        m_Shader->Use();
+        RenderStatistics::RecordProgramBind();
+        if (!m_SamplersBound) {
+            for (uint32_t slot = 0; slot < MAX_TEXTURE_SLOTS; slot++) {
+                m_Shader->SetInt(std::format("uTextures[{}]", slot), slot);
+            }
+            m_SamplersBound = true;
+        }
+        m_Shader->SetMat4("viewProjection",
+                          m_Camera->GetViewProjectionMatrix());
+
+        glBindVertexArray(m_VAO);
+        glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+        glBufferData(GL_ARRAY_BUFFER, m_Vertices.size() * sizeof(SpriteVertex),
+                     m_Vertices.data(), GL_STREAM_DRAW);
+        RenderStatistics::RecordVertexArrayBind();
+        RenderStatistics::RecordBufferUpload(m_Vertices.size() *
+                                             sizeof(SpriteVertex));
+
+        unsigned int bound[MAX_TEXTURE_SLOTS] = {};
+        for (const DrawCommand& draw : m_Draws) {
+            for (uint32_t slot = 0; slot < draw.TextureCount; slot++) {
+                if (bound[slot] != draw.Textures[slot]) {
+                    bound[slot] = draw.Textures[slot];
+                    glActiveTexture(GL_TEXTURE0 + slot);
+                    glBindTexture(GL_TEXTURE_2D, bound[slot]);
+                    RenderStatistics::RecordTextureBind();
+                }
+            }
+
+            glDrawElementsBaseVertex(GL_TRIANGLES, draw.Count * 6,
+                                     GL_UNSIGNED_SHORT, nullptr,
+                                     draw.First * 4);
+            RenderStatistics::RecordDraw(draw.Count * 2, draw.Count);
+        }
+
+        glBindVertexArray(0);
+        glActiveTexture(GL_TEXTURE0);
+
+        if (depthTest) {
+            glEnable(GL_DEPTH_TEST);
+        }
+        if (cullFace) {
+            glEnable(GL_CULL_FACE);
+        }
+        if (!blend) {
+            glDisable(GL_BLEND);
+        }
+
+        m_SpriteCount += count;
+        m_DrawCallCount += m_Draws.size();
+    }
+
+    m_Sprites.clear();
+    m_Keys.clear();
+    m_Textures.clear();
+    m_TextureIndices.clear();
+}
+
+void SpriteBatch::BuildDrawCommands() {
+    m_Draws.clear();
+    m_Slots.resize(m_Keys.size());
+
+    DrawCommand* draw = nullptr;
+    for (size_t i = 0; i < m_Keys.size(); i++) {
+        uint32_t textureIndex = (m_Keys[i] >> TEXTURE_SHIFT) & 0xFFFF;
+        unsigned int texture = m_Textures[textureIndex];
+
+        if (!draw || draw->Count == MAX_SPRITES_PER_DRAW) {
+            draw = &m_Draws.emplace_back();
+            draw->First = static_cast<uint32_t>(i);
+        }
+
+        // Sorted input means the texture is usually the most recent slot
+        uint32_t slot = draw->TextureCount;
+        for (uint32_t s = draw->TextureCount; s-- > 0;) {
+            if (draw->Textures[s] == texture) {
+                slot = s;
+                break;
+            }
+        }
+
+        if (slot == draw->TextureCount) {
+            if (draw->TextureCount == MAX_TEXTURE_SLOTS) {
+                draw = &m_Draws.emplace_back();
+                draw->First = static_cast<uint32_t>(i);
+                slot = 0;
+            }
+            draw->Textures[draw->TextureCount++] = texture;
+        }
+
+        m_Slots[i] = static_cast<uint8_t>(slot);
+        draw->Count++;
+    }
+}
+
+void SpriteBatch::BuildVertices(size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) {
+        const QueuedSprite& sprite =
+            m_Sprites[static_cast<uint32_t>(m_Keys[i])];
+        SpriteVertex* quad = &m_Vertices[i * 4];
+
+        float sine = std::sin(sprite.Rotation);
+        float cosine = std::cos(sprite.Rotation);
+        glm::vec2 right = glm::vec2(cosine, sine) * (sprite.Size.x * 0.5f);
+        glm::vec2 up = glm::vec2(-sine, cosine) * (sprite.Size.y * 0.5f);
+        float slot = m_Slots[i];
+
+        const glm::vec4& uv = sprite.UVRect;
+        quad[0] = {sprite.Position - right - up, {uv.x, uv.y}, sprite.Color,
+                   slot};
+        quad[1] = {sprite.Position + right - up, {uv.z, uv.y}, sprite.Color,
+                   slot};
+        quad[2] = {sprite.Position + right + up, {uv.z, uv.w}, sprite.Color,
+                   slot};
+        quad[3] = {sprite.Position - right + up, {uv.x, uv.w}, sprite.Color,
+                   slot};
+    }
+}
+
+}  // namespace Obelisk
@@ -1,4 +1,8 @@
 #include "Obelisk/Renderer/Texture.h"
+#include <cstring>
+#include <fstream>
+#include "Obelisk/Renderer/CookedFormat.h"
+#include "Obelisk/Renderer/GLExtensions.h"
 
 namespace Obelisk {
 Texture::Texture(const std::string& path) {
@@ -10,6 +14,11 @@ Texture::Texture(const std::string& path) {
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
+    // Prefer the blob written by ObeliskCook: no decoding, no mip generation
+    if (LoadCooked(path)) {
+        return;
+    }
+
     int width, height, nrChannels;
     stbi_set_flip_vertically_on_load(true);
 
@@ -57,6 +66,79 @@ Texture::Texture(const std::string& path) {
               fullPath.string(), width, height, nrChannels);
 }
 
+bool Texture::LoadCooked(const std::string& path) {
+    std::filesystem::path cookedPath = AssetManager::GetAssetPath(
+        "textures/" + path + COOKED_TEXTURE_EXTENSION);
+    std::ifstream file(cookedPath, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    std::vector<char> data(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(data.data(), static_cast<std::streamsize>(data.size()));
+
+    CookedTextureHeader header{};
+    if (!file || data.size() < sizeof(header)) {
+        LOG_WARN("Cooked texture is truncated: {}", cookedPath.string());
+        return false;
+    }
+    std::memcpy(&header, data.data(), sizeof(header));
+    if (header.Magic != COOKED_TEXTURE_MAGIC ||
+        header.Version != COOKED_FORMAT_VERSION || header.MipCount == 0) {
+        LOG_WARN("Ignoring stale or invalid cooked texture: {}",
+                 cookedPath.string());
+        return false;
+    }
+    if (header.Format == CookedTextureFormat::BC1 &&
+        !GLExtensions::HasS3TC()) {
+        LOG_TRACE("S3TC unsupported, loading {} from source", path);
+        return false;
+    }
+
+    // Validate every level before touching the texture
+    size_t expectedSize = sizeof(header);
+    for (uint32_t level = 0; level < header.MipCount; level++) {
+        expectedSize += GetCookedMipSize(header.Format,
+                                         std::max(1u, header.Width >> level),
+                                         std::max(1u, header.Height >> level));
+    }
+    if (data.size() != expectedSize) {
+        LOG_WARN("Cooked texture size mismatch: {}", cookedPath.string());
+        return false;
+    }
+
+    GLenum format = header.Format == CookedTextureFormat::R8 ? GL_RED : GL_RGBA;
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    const char* level = data.data() + sizeof(header);
+    for (uint32_t i = 0; i < header.MipCount; i++) {
+        auto width = static_cast<GLsizei>(std::max(1u, header.Width >> i));
+        auto height = static_cast<GLsizei>(std::max(1u, header.Height >> i));
+        size_t size = GetCookedMipSize(header.Format, width, height);
+
+        if (header.Format == CookedTextureFormat::BC1) {
+            glCompressedTexImage2D(GL_TEXTURE_2D, i,
+                                   GL_COMPRESSED_RGB_S3TC_DXT1_EXT, width,
+                                   height, 0, static_cast<GLsizei>(size),
+                                   level);
+        } else {
+            glTexImage2D(GL_TEXTURE_2D, i, format, width, height, 0, format,
+                         GL_UNSIGNED_BYTE, level);
+        }
+        level += size;
+    }
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL,
+                    static_cast<GLint>(header.MipCount - 1));
+
+    LOG_TRACE("Loaded cooked texture: {} ({}x{}, {} mips)",
+              cookedPath.string(), header.Width, header.Height,
+              header.MipCount);
+    return true;
+}
+
 Texture::~Texture() {
     if (m_TextureID) {
         glDeleteTextures(1, &m_TextureID);
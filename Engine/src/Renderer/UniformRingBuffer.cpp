@@ -0,0 +1,123 @@
+#include "Obelisk/Renderer/UniformRingBuffer.h"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include "Obelisk/Renderer/RenderStats.h"
+
+namespace Obelisk {
+
+UniformRingBuffer::UniformRingBuffer(size_t regionSize) {
+    GLint alignment = 256;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+    m_Alignment = static_cast<size_t>(std::max(alignment, 1));
+
+    glGenBuffers(1, &m_Buffer);
+    Grow(regionSize);
+
+    LOG_TRACE("UniformRingBuffer created: {} x {} bytes, {} byte alignment",
+              FRAMES_IN_FLIGHT, m_RegionSize, m_Alignment);
+}
+
+UniformRingBuffer::~UniformRingBuffer() {
+    for (GLsync& fence : m_Fences) {
+        if (fence) {
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+    }
+
+    if (m_Buffer) {
+        glDeleteBuffers(1, &m_Buffer);
+    }
+}
+
+void UniformRingBuffer::BeginFrame() {
+    m_Region = (m_Region + 1) % FRAMES_IN_FLIGHT;
+    m_Staging.clear();
+    m_Uploaded = 0;
+
+    GLsync& fence = m_Fences[m_Region];
+    if (!fence) {
+        return;
+    }
+
+    // Only block when the GPU is still reading this region
+    GLenum status = glClientWaitSync(fence, 0, 0);
+    if (status == GL_TIMEOUT_EXPIRED) {
+        m_WaitCount++;
+        status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT,
+                                  1'000'000'000);
+    }
+    if (status == GL_WAIT_FAILED) {
+        LOG_ERROR("Waiting for uniform ring region {} failed", m_Region);
+    }
+
+    glDeleteSync(fence);
+    fence = nullptr;
+}
+
+void UniformRingBuffer::EndFrame() {
+    GLsync& fence = m_Fences[m_Region];
+    if (fence) {
+        glDeleteSync(fence);
+    }
+    fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+size_t UniformRingBuffer::Allocate(const void* data, size_t size) {
+    size_t offset = (m_Staging.size() + m_Alignment - 1) / m_Alignment *
+                    m_Alignment;
+    m_Staging.resize(offset + size);
+    std::memcpy(m_Staging.data() + offset, data, size);
+    return offset;
+}
+
+void UniformRingBuffer::Upload() {
+    if (m_Staging.size() > m_RegionSize) {
+        Grow(std::bit_ceil(m_Staging.size()));
+    }
+    if (m_Uploaded == m_Staging.size()) {
+        return;
+    }
+
+    glBindBuffer(GL_UNIFORM_BUFFER, m_Buffer);
+    glBufferSubData(GL_UNIFORM_BUFFER, m_Region * m_RegionSize + m_Uploaded,
+                    m_Staging.size() - m_Uploaded,
+                    m_Staging.data() + m_Uploaded);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    RenderStatistics::RecordUniformUpload(m_Staging.size() - m_Uploaded);
+    m_Uploaded = m_Staging.size();
+}
+
+void UniformRingBuffer::BindRange(unsigned int binding, size_t offset,
+                                  size_t size) const {
+    glBindBufferRange(GL_UNIFORM_BUFFER, binding, m_Buffer,
+                      m_Region * m_RegionSize + offset, size);
+}
+
+void UniformRingBuffer::Grow(size_t regionSize) {
+    // Round up so every region starts at an aligned offset
+    m_RegionSize =
+        (regionSize + m_Alignment - 1) / m_Alignment * m_Alignment;
+
+    // Fresh storage: nothing the GPU still reads can be overwritten
+    for (GLsync& fence : m_Fences) {
+        if (fence) {
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+    }
+
+    glBindBuffer(GL_UNIFORM_BUFFER, m_Buffer);
+    glBufferData(GL_UNIFORM_BUFFER, m_RegionSize * FRAMES_IN_FLIGHT, nullptr,
+                 GL_STREAM_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    // Everything staged so far has to go into the new storage
+    m_Uploaded = 0;
+
+    LOG_TRACE("UniformRingBuffer regions resized to {} bytes", m_RegionSize);
+}
+
+}  // namespace Obelisk
@@ -1,19 +1,43 @@
 #include "Obelisk/Renderer/Window.h"
 #include "Obelisk/Core/Camera.h"
+#include "Obelisk/Core/Time.h"
 #include "Obelisk/Input/Keyboard.h"
 #include "Obelisk/Input/Mouse.h"
-#include "Obelisk/Scene/Entity.h"
+#include "Obelisk/Renderer/ClusteredLighting.h"
+#include "Obelisk/Renderer/DebugDraw.h"
+#include "Obelisk/Renderer/GLCapture.h"
+#include "Obelisk/Renderer/GLExtensions.h"
+#include "Obelisk/Renderer/GPUCulling.h"
+#include "Obelisk/Renderer/GPUProfiler.h"
+#include "Obelisk/Renderer/ImpostorAtlas.h"
+#include "Obelisk/Renderer/RenderStats.h"
+#include "Obelisk/Renderer/Renderer.h"
 #include "Obelisk/Scene/Scene.h"
 #include "stb_image.h"
 
+#ifdef OBELISK_HEADLESS_EGL
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
 namespace Obelisk {
 Window::~Window() {
     if (m_Window) {
         glfwDestroyWindow(m_Window);
     }
+    DestroyHeadless();
 }
 
-int Window::Create(int width, int height, const std::string& title) {
+int Window::Create(int width, int height, const std::string& title,
+                   WindowBackend backend) {
+    m_Backend = backend;
+    m_Width = width;
+    m_Height = height;
+
+    if (backend == WindowBackend::Headless) {
+        return CreateHeadless(width, height);
+    }
+
     if (!glfwInit()) {
         LOG_ERROR("Failed to initialize GLFW");
         return -1;
@@ -40,16 +64,24 @@ int Window::Create(int width, int height, const std::string& title) {
     }
 
     glfwMakeContextCurrent(m_Window);
+    glfwSetWindowUserPointer(m_Window, this);
     if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
         LOG_ERROR("Failed to initialize GLAD");
         glfwTerminate();
         return -1;
     }
 
+    GLExtensions::Initialize((GLADloadproc)glfwGetProcAddress);
+    GPUProfiler::Initialize();
+
     glViewport(0, 0, width, height);
     glfwSetFramebufferSizeCallback(
         m_Window, [](GLFWwindow* window, int width, int height) {
-            glViewport(0, 0, width, height);
+            // Render() updates the viewport, possibly on the render thread
+            auto* self =
+                static_cast<Window*>(glfwGetWindowUserPointer(window));
+            self->m_Width = width;
+            self->m_Height = height;
         });
 
     // Set input callbacks
@@ -79,33 +111,321 @@ int Window::Create(int width, int height, const std::string& title) {
 }
 
 void Window::Tick() {
-    glClearColor(0.2f, 0.3f, 0.8f, 1.0f);
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    Capture(m_Snapshot);
+    Latch(m_Snapshot);
+    Render(m_Snapshot);
+    GPUProfiler::Publish();
+    PollEvents();
+    Present();
+}
 
+void Window::Capture(RenderSnapshot& snapshot) {
     if (m_Scene) {
-        Camera* camera = m_Scene->GetCamera();
-        if (camera) {
-            // Use camera-based rendering for proper 3D pipeline
-            for (auto entity : m_Scene->GetEntities()) {
-                entity->Draw(*camera);
-            }
-        } else {
-            // Fallback to legacy rendering if no camera is set
-            LOG_WARN("No camera set for scene, using legacy rendering");
-            for (auto entity : m_Scene->GetEntities()) {
-                entity->Draw();
-            }
+        m_Scene->Capture(snapshot);
+        if (!snapshot.HasCamera) {
+            LOG_WARN("No camera set for scene, nothing to render");
         }
     } else {
+        snapshot.Clear();
         LOG_WARN("No active scene!");
     }
 
+    snapshot.Width = m_Width;
+    snapshot.Height = m_Height;
+    snapshot.TotalTime = Time::GetTotalTime();
+    snapshot.DeltaTime = Time::GetDeltaTime();
+    snapshot.FrameTimeMS = Time::GetFrameTimeMS();
+}
+
+void Window::Latch(const RenderSnapshot& snapshot) {
+    // Debug shapes go on top of everything and are gone next frame
+    if (snapshot.HasCamera) {
+        DebugDraw::Latch(snapshot.ViewCamera);
+    } else {
+        DebugDraw::Clear();
+    }
+}
+
+void Window::Render(const RenderSnapshot& snapshot) {
+    RenderStatistics::BeginFrame();
+    RenderStatistics::RecordCulling(snapshot.BatchesTested,
+                                    snapshot.BatchesCulled,
+                                    snapshot.EntitiesTested,
+                                    snapshot.EntitiesCulled);
+    GPUProfiler::BeginFrame();
+
+    if (snapshot.Width != m_ViewportWidth ||
+        snapshot.Height != m_ViewportHeight) {
+        m_ViewportWidth = snapshot.Width;
+        m_ViewportHeight = snapshot.Height;
+        glViewport(0, 0, m_ViewportWidth, m_ViewportHeight);
+    }
+
+    glClearColor(0.2f, 0.3f, 0.8f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    if (snapshot.HasCamera) {
+        GPUProfiler::ScopedPass scenePass("Scene");
+
+        ClusteredLighting::Update(snapshot.ViewCamera, snapshot.Lights,
+                                  snapshot.Width, snapshot.Height);
+
+        if (snapshot.UseGPUCulling) {
+            GPUCulling::Update(snapshot.GPUTransforms);
+            GPUCulling::Cull(snapshot.ViewCamera);
+        }
+
+        Renderer::BeginFrame(snapshot.ViewCamera, snapshot.TotalTime,
+                             snapshot.DeltaTime);
+        snapshot.Submit();
+        Renderer::EndFrame();
+
+        if (snapshot.UseGPUCulling) {
+            GPUCulling::Draw(snapshot.ViewCamera, snapshot.TotalTime,
+                             snapshot.DeltaTime);
+        }
+
+        ImpostorAtlas::Draw(snapshot.ViewCamera, snapshot.Impostors);
+
+        // Occluders for the next frame: everything opaque has been drawn
+        if (snapshot.UseGPUCulling) {
+            GPUCulling::BuildDepthPyramid(snapshot.Width, snapshot.Height);
+        }
+    }
+
+    if (m_RenderCallback) {
+        m_RenderCallback(snapshot);
+    }
+
+    if (snapshot.HasCamera) {
+        DebugDraw::Flush(snapshot.ViewCamera);
+    }
+
     glUseProgram(0);
 
-    glfwPollEvents();
+    GPUProfiler::EndFrame();
+    GLCapture::EndFrame();
+    RenderStatistics::EndFrame(snapshot.FrameTimeMS);
+
+    m_FrameCount++;
+}
+
+void Window::Present() {
+    if (m_Backend == WindowBackend::Headless) {
+        // Nothing to present; flush so the frame completes without a swap
+        glFlush();
+        return;
+    }
+
     glfwSwapBuffers(m_Window);
 }
 
-bool Window::ShouldClose() const { return glfwWindowShouldClose(m_Window); }
+void Window::PollEvents() {
+    if (m_Backend != WindowBackend::Headless) {
+        glfwPollEvents();
+    }
+}
+
+void Window::MakeContextCurrent() {
+#ifdef OBELISK_HEADLESS_EGL
+    if (m_EGLDisplay) {
+        auto surface = m_EGLSurface ? static_cast<EGLSurface>(m_EGLSurface)
+                                    : EGL_NO_SURFACE;
+        eglMakeCurrent(static_cast<EGLDisplay>(m_EGLDisplay), surface,
+                       surface, static_cast<EGLContext>(m_EGLContext));
+        return;
+    }
+#endif
+
+    glfwMakeContextCurrent(m_Window);
+}
+
+void Window::ReleaseContext() {
+#ifdef OBELISK_HEADLESS_EGL
+    if (m_EGLDisplay) {
+        eglMakeCurrent(static_cast<EGLDisplay>(m_EGLDisplay), EGL_NO_SURFACE,
+                       EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        return;
+    }
+#endif
+
+    glfwMakeContextCurrent(nullptr);
+}
+
+bool Window::ShouldClose() const {
+    if (m_CloseRequested ||
+        (m_FrameLimit > 0 && m_FrameCount >= m_FrameLimit)) {
+        return true;
+    }
+
+    return m_Window && glfwWindowShouldClose(m_Window);
+}
+
+void Window::ReadPixels(std::vector<uint8_t>& pixels) const {
+    pixels.resize(static_cast<size_t>(m_Width) * m_Height * 4);
+
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, m_Width, m_Height, GL_RGBA, GL_UNSIGNED_BYTE,
+                 pixels.data());
+}
+
+int Window::CreateHeadless(int width, int height) {
+#ifdef OBELISK_HEADLESS_EGL
+    EGLDisplay display = EGL_NO_DISPLAY;
+
+    // The surfaceless platform needs no X11/Wayland connection or GPU device
+    auto getPlatformDisplay =
+        reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+            eglGetProcAddress("eglGetPlatformDisplayEXT"));
+    if (getPlatformDisplay) {
+        display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA,
+                                     EGL_DEFAULT_DISPLAY, nullptr);
+    }
+    if (display == EGL_NO_DISPLAY) {
+        display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    }
+
+    EGLint major = 0;
+    EGLint minor = 0;
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor)) {
+        LOG_ERROR("Failed to initialize EGL display (0x{:x})", eglGetError());
+        return -1;
+    }
+    m_EGLDisplay = display;
+
+    if (!eglBindAPI(EGL_OPENGL_API)) {
+        LOG_ERROR("EGL implementation does not support desktop OpenGL");
+        DestroyHeadless();
+        return -1;
+    }
+
+    const EGLint configAttributes[] = {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT, EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_RED_SIZE,     8,               EGL_GREEN_SIZE,      8,
+        EGL_BLUE_SIZE,    8,               EGL_ALPHA_SIZE,      8,
+        EGL_DEPTH_SIZE,   24,              EGL_NONE};
+    EGLConfig config = nullptr;
+    EGLint configCount = 0;
+    if (!eglChooseConfig(display, configAttributes, &config, 1,
+                         &configCount) ||
+        configCount == 0) {
+        LOG_ERROR("No suitable EGL config found (0x{:x})", eglGetError());
+        DestroyHeadless();
+        return -1;
+    }
+
+    const EGLint contextAttributes[] = {
+        EGL_CONTEXT_MAJOR_VERSION,       3,
+        EGL_CONTEXT_MINOR_VERSION,       3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE};
+    EGLContext context =
+        eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttributes);
+    if (context == EGL_NO_CONTEXT) {
+        LOG_ERROR("Failed to create EGL context (0x{:x})", eglGetError());
+        DestroyHeadless();
+        return -1;
+    }
+    m_EGLContext = context;
+
+    // Without EGL_KHR_surfaceless_context a (small) pbuffer must be current
+    const char* extensions = eglQueryString(display, EGL_EXTENSIONS);
+    bool surfaceless =
+        extensions && std::string_view(extensions).find(
+                          "EGL_KHR_surfaceless_context") != std::string::npos;
+    EGLSurface surface = EGL_NO_SURFACE;
+    if (!surfaceless) {
+        const EGLint pbufferAttributes[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1,
+                                            EGL_NONE};
+        surface = eglCreatePbufferSurface(display, config, pbufferAttributes);
+        if (surface == EGL_NO_SURFACE) {
+            LOG_ERROR("Failed to create EGL pbuffer (0x{:x})", eglGetError());
+            DestroyHeadless();
+            return -1;
+        }
+        m_EGLSurface = surface;
+    }
+
+    if (!eglMakeCurrent(display, surface, surface, context)) {
+        LOG_ERROR("Failed to make EGL context current (0x{:x})",
+                  eglGetError());
+        DestroyHeadless();
+        return -1;
+    }
+
+    if (!gladLoadGLLoader((GLADloadproc)eglGetProcAddress)) {
+        LOG_ERROR("Failed to initialize GLAD");
+        DestroyHeadless();
+        return -1;
+    }
+
+    GLExtensions::Initialize((GLADloadproc)eglGetProcAddress);
+    GPUProfiler::Initialize();
+
+    // All rendering goes to an offscreen framebuffer of the requested size
+    glGenRenderbuffers(1, &m_ColorBuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, m_ColorBuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+
+    glGenRenderbuffers(1, &m_DepthBuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, m_DepthBuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+
+    glGenFramebuffers(1, &m_Framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, m_Framebuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                              GL_RENDERBUFFER, m_ColorBuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT,
+                              GL_RENDERBUFFER, m_DepthBuffer);
+
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        LOG_ERROR("Offscreen framebuffer is incomplete");
+        DestroyHeadless();
+        return -1;
+    }
+
+    glViewport(0, 0, width, height);
+    glEnable(GL_DEPTH_TEST);
+
+    LOG_INFO("Initialised headless OpenGL context ({}x{}, {})", width, height,
+             surfaceless ? "surfaceless" : "pbuffer");
+    LOG_INFO("> EGL v{}.{}, OpenGL v{}", major, minor,
+             reinterpret_cast<const char*>(glGetString(GL_VERSION)));
+    LOG_INFO("> Graphics Card: {}, {}",
+             reinterpret_cast<const char*>(glGetString(GL_RENDERER)),
+             reinterpret_cast<const char*>(glGetString(GL_VENDOR)));
+    return 1;
+#else
+    LOG_ERROR("Headless rendering requires building with OBELISK_HEADLESS_EGL");
+    return -1;
+#endif
+}
+
+void Window::DestroyHeadless() {
+#ifdef OBELISK_HEADLESS_EGL
+    if (!m_EGLDisplay) {
+        return;
+    }
+
+    if (m_EGLContext) {
+        // Zero names are ignored, but GL is only loaded once these exist
+        if (m_ColorBuffer) {
+            glDeleteFramebuffers(1, &m_Framebuffer);
+            glDeleteRenderbuffers(1, &m_ColorBuffer);
+            glDeleteRenderbuffers(1, &m_DepthBuffer);
+        }
+        eglMakeCurrent(m_EGLDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE,
+                       EGL_NO_CONTEXT);
+        eglDestroyContext(m_EGLDisplay, m_EGLContext);
+    }
+    if (m_EGLSurface) {
+        eglDestroySurface(m_EGLDisplay, m_EGLSurface);
+    }
+    eglTerminate(m_EGLDisplay);
+#endif
+
+    m_Framebuffer = m_ColorBuffer = m_DepthBuffer = 0;
+    m_EGLDisplay = m_EGLSurface = m_EGLContext = nullptr;
+}
 
 }  // namespace Obelisk
\ No newline at end of file
@@ -0,0 +1,223 @@
+#include "Obelisk/Scene/AABBTree.h"
+
+namespace Obelisk {
+
+namespace {
+AABB Union(const AABB& a, const AABB& b) {
+    AABB result = a;
+    result.Expand(b);
+    return result;
+}
+
+AABB Fatten(const AABB& box, float margin) {
+    return AABB(box.Min - glm::vec3(margin), box.Max + glm::vec3(margin));
+}
+}  // namespace
+
+uint32_t AABBTree::Insert(EntityID entity, const AABB& box) {
+    uint32_t leaf = AllocateNode();
+    Node& node = m_Nodes[leaf];
+    node.Box = Fatten(box, m_Margin);
+    node.Entity = entity;
+    node.Height = 0;
+
+    InsertLeaf(leaf);
+    m_LeafCount++;
+    return leaf;
+}
+
+void AABBTree::Remove(uint32_t proxy) {
+    RemoveLeaf(proxy);
+    FreeNode(proxy);
+    m_LeafCount--;
+}
+
+bool AABBTree::Move(uint32_t proxy, const AABB& box) {
+    // Fat boxes left far larger than their bounds, e.g. after a mesh swap,
+    // are shrunk as well
+    const AABB& current = m_Nodes[proxy].Box;
+    if (current.Contains(box) &&
+        Fatten(box, 4.0f * m_Margin).Contains(current)) {
+        return false;
+    }
+
+    RemoveLeaf(proxy);
+    m_Nodes[proxy].Box = Fatten(box, m_Margin);
+    InsertLeaf(proxy);
+    return true;
+}
+
+void AABBTree::Clear() {
+    m_Nodes.clear();
+    m_Root = NULL_NODE;
+    m_FreeList = NULL_NODE;
+    m_LeafCount = 0;
+}
+
+uint32_t AABBTree::AllocateNode() {
+    if (m_FreeList == NULL_NODE) {
+        m_Nodes.emplace_back();
+        return static_cast<uint32_t>(m_Nodes.size() - 1);
+    }
+
+    uint32_t node = m_FreeList;
+    m_FreeList = m_Nodes[node].Parent;
+    m_Nodes[node] = Node();
+    return node;
+}
+
+void AABBTree::FreeNode(uint32_t node) {
+    m_Nodes[node] = Node();
+    m_Nodes[node].Parent = m_FreeList;
+    m_FreeList = node;
+}
+
+void AABBTree::InsertLeaf(uint32_t leaf) {
+    if (m_Root == NULL_NODE) {
+        m_Root = leaf;
+        m_Nodes[leaf].Parent = NULL_NODE;
+        return;
+    }
+
+    // Descend while pushing the leaf further down is cheaper than pairing
+    // it with the current node. Every ancestor grows by the leaf either
+    // way, which is the inherited cost.
+    AABB leafBox = m_Nodes[leaf].Box;
+    uint32_t sibling = m_Root;
+    while (!m_Nodes[sibling].IsLeaf()) {
+        const Node& node = m_Nodes[sibling];
+        float area = node.Box.GetSurfaceArea();
+        float combinedArea = Union(node.Box, leafBox).GetSurfaceArea();
+        float cost = 2.0f * combinedArea;
+        float inheritedCost = 2.0f * (combinedArea - area);
+
+        auto descendCost = [&](uint32_t child) {
+            const Node& childNode = m_Nodes[child];
+            float childArea = Union(childNode.Box, leafBox).GetSurfaceArea();
+            if (!childNode.IsLeaf()) {
+                childArea -= childNode.Box.GetSurfaceArea();
+            }
+            return childArea + inheritedCost;
+        };
+        float cost1 = descendCost(node.Child1);
+        float cost2 = descendCost(node.Child2);
+        if (cost < cost1 && cost < cost2) {
+            break;
+        }
+        sibling = cost1 < cost2 ? node.Child1 : node.Child2;
+    }
+
+    uint32_t oldParent = m_Nodes[sibling].Parent;
+    uint32_t newParent = AllocateNode();
+    Node& parent = m_Nodes[newParent];
+    parent.Parent = oldParent;
+    parent.Box = Union(leafBox, m_Nodes[sibling].Box);
+    parent.Height = m_Nodes[sibling].Height + 1;
+    parent.Child1 = sibling;
+    parent.Child2 = leaf;
+    m_Nodes[sibling].Parent = newParent;
+    m_Nodes[leaf].Parent = newParent;
+
+    if (oldParent == NULL_NODE) {
+        m_Root = newParent;
+    } else if (m_Nodes[oldParent].Child1 == sibling) {
+        m_Nodes[oldParent].Child1 = newParent;
+    } else {
+        m_Nodes[oldParent].Child2 = newParent;
+    }
+
+    Refit(oldParent);
+}
+
+void AABBTree::RemoveLeaf(uint32_t leaf) {
+    if (leaf == m_Root) {
+        m_Root = NULL_NODE;
+        return;
+    }
+
+    uint32_t parent = m_Nodes[leaf].Parent;
+    uint32_t grandParent = m_Nodes[parent].Parent;
+    uint32_t sibling = m_Nodes[parent].Child1 == leaf
+                           ? m_Nodes[parent].Child2
+                           : m_Nodes[parent].Child1;
+
+    // The sibling takes the parent's place
+    m_Nodes[sibling].Parent = grandParent;
+    if (grandParent == NULL_NODE) {
+        m_Root = sibling;
+    } else if (m_Nodes[grandParent].Child1 == parent) {
+        m_Nodes[grandParent].Child1 = sibling;
+    } else {
+        m_Nodes[grandParent].Child2 = sibling;
+    }
+    FreeNode(parent);
+
+    Refit(grandParent);
+}
+
+void AABBTree::Refit(uint32_t node) {
+    while (node != NULL_NODE) {
+        node = Balance(node);
+
+        Node& current = m_Nodes[node];
+        const Node& child1 = m_Nodes[current.Child1];
+        const Node& child2 = m_Nodes[current.Child2];
+        current.Height = 1 + std::max(child1.Height, child2.Height);
+        current.Box = Union(child1.Box, child2.Box);
+
+        node = current.Parent;
+    }
+}
+
+uint32_t AABBTree::Balance(uint32_t a) {
+    Node& nodeA = m_Nodes[a];
+    if (nodeA.IsLeaf() || nodeA.Height < 2) {
+        return a;
+    }
+
+    uint32_t b = nodeA.Child1;
+    uint32_t c = nodeA.Child2;
+    int32_t balance = m_Nodes[c].Height - m_Nodes[b].Height;
+    if (balance >= -1 && balance <= 1) {
+        return a;
+    }
+
+    // Lift the taller child into a's place; a keeps the other child and
+    // takes the shorter of the lifted node's children
+    uint32_t up = balance > 1 ? c : b;
+    uint32_t stay = balance > 1 ? b : c;
+    Node& nodeUp = m_Nodes[up];
+    uint32_t f = nodeUp.Child1;
+    uint32_t g = nodeUp.Child2;
+
+    nodeUp.Child1 = a;
+    nodeUp.Parent = nodeA.Parent;
+    nodeA.Parent = up;
+    if (nodeUp.Parent == NULL_NODE) {
+        m_Root = up;
+    } else if (m_Nodes[nodeUp.Parent].Child1 == a) {
+        m_Nodes[nodeUp.Parent].Child1 = up;
+    } else {
+        m_Nodes[nodeUp.Parent].Child2 = up;
+    }
+
+    uint32_t keep = m_Nodes[f].Height > m_Nodes[g].Height ? f : g;
+    uint32_t give = keep == f ? g : f;
+    nodeUp.Child2 = keep;
+    if (balance > 1) {
+        nodeA.Child2 = give;
+    } else {
+        nodeA.Child1 = give;
+    }
+    m_Nodes[give].Parent = a;
+
+    const Node& stayNode = m_Nodes[stay];
+    const Node& giveNode = m_Nodes[give];
+    nodeA.Box = Union(stayNode.Box, giveNode.Box);
+    nodeA.Height = 1 + std::max(stayNode.Height, giveNode.Height);
+    nodeUp.Box = Union(nodeA.Box, m_Nodes[keep].Box);
+    nodeUp.Height = 1 + std::max(nodeA.Height, m_Nodes[keep].Height);
+    return up;
+}
+
+}  // namespace Obelisk
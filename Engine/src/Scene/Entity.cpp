@@ -1,90 +1,197 @@
 #include "Obelisk/Scene/Entity.h"
-#include "Obelisk/Core/Camera.h"
+#include "Obelisk/Renderer/MaterialLibrary.h"
+#include "Obelisk/Renderer/Renderer.h"
+#include "Obelisk/Scene/Scene.h"
 
 namespace Obelisk {
-Entity::Entity() {
-    m_Mesh = nullptr;
-    m_Shader = nullptr;
-    m_Texture = nullptr;
+bool Entity::IsValid() const {
+    return m_Scene && m_Scene->GetRegistry().IsAlive(m_ID);
 }
 
-Entity::Entity(std::shared_ptr<Mesh> mesh, std::shared_ptr<Shader> shader,
-               std::shared_ptr<Texture> texture) {
-    m_Mesh = mesh;
-    m_Shader = shader;
-    m_Texture = texture;
+TransformRef Entity::GetTransform() const {
+    return m_Scene->GetRegistry().Get<Transform>(m_ID);
 }
 
-void Entity::SetMesh(std::shared_ptr<Mesh> mesh) { m_Mesh = mesh; }
+bool Entity::SetParent(Entity parent) {
+    if (parent.IsValid() && parent.GetScene() != m_Scene) {
+        LOG_ERROR("Can't parent entities of different scenes!");
+        return false;
+    }
+    return m_Scene->GetRegistry().GetPool<Transform>().SetParent(
+        m_ID, parent.GetID());
+}
 
-void Entity::SetShader(std::shared_ptr<Shader> shader) { m_Shader = shader; }
+Entity Entity::GetParent() const {
+    EntityID parent =
+        m_Scene->GetRegistry().GetPool<Transform>().GetParent(m_ID);
+    return parent.IsNull() ? Entity() : Entity(m_Scene, parent);
+}
 
-void Entity::SetTexture(std::shared_ptr<Texture> texture) {
-    m_Texture = texture;
+void Entity::SetMesh(MeshHandle mesh) {
+    Registry& registry = m_Scene->GetRegistry();
+    const Mesh* resource = ResourceRegistry::Get(mesh);
+    // New bounds move the entity in the scene's spatial index
+    registry.GetPool<Transform>().MarkMoved(m_ID);
+    if (!resource) {
+        registry.Remove<MeshRef>(m_ID);
+        registry.Add<LocalBounds>(m_ID);
+        return;
+    }
+
+    registry.Add<LocalBounds>(m_ID, resource->GetBounds());
+    registry.Add<MeshRef>(m_ID, mesh);
 }
 
-std::shared_ptr<Mesh> Entity::GetMesh() const { return m_Mesh; }
+void Entity::SetMesh(std::shared_ptr<Mesh> mesh) {
+    SetMesh(ResourceRegistry::AddReleasedWhenUnused(std::move(mesh)));
+}
 
-std::shared_ptr<Shader> Entity::GetShader() const { return m_Shader; }
+void Entity::SetMaterial(MaterialHandle material) {
+    if (!ResourceRegistry::IsValid(material)) {
+        m_Scene->GetRegistry().Remove<MaterialRef>(m_ID);
+        return;
+    }
 
-std::shared_ptr<Texture> Entity::GetTexture() const { return m_Texture; }
+    m_Scene->GetRegistry().Add<MaterialRef>(m_ID, material);
+}
 
-void Entity::Draw(const Camera& camera) const {
-    if (!m_Mesh) {
-        LOG_ERROR("No mesh attached to entity!");
+void Entity::SetMaterial(std::shared_ptr<Material> material) {
+    SetMaterial(ResourceRegistry::AddReleasedWhenUnused(std::move(material)));
+}
+
+void Entity::SetShader(ShaderHandle shader) {
+    SetShader(ResourceRegistry::GetShared(shader));
+}
+
+void Entity::SetShader(std::shared_ptr<Shader> shader) {
+    const Material* material = GetMaterial();
+    if (!material) {
+        SetMaterial(MaterialLibrary::Create(shader));
         return;
     }
 
-    if (!m_Shader) {
-        LOG_ERROR("Can't draw Mesh without Shader!");
+    SetMaterial(MaterialLibrary::Create(shader, material->GetTextures(),
+                                        material->GetBlock()));
+}
+
+void Entity::SetTexture(TextureHandle texture) {
+    SetTexture(ResourceRegistry::GetShared(texture));
+}
+
+void Entity::SetTexture(std::shared_ptr<Texture> texture) {
+    const Material* material = GetMaterial();
+    if (!material) {
+        LOG_ERROR("Can't set a texture on an entity without a shader!");
         return;
     }
 
-    m_Shader->Use();
+    Material::TextureSet textures = material->GetTextures();
+    textures[0] = texture;
+    SetMaterial(MaterialLibrary::Create(material->GetShader(), textures,
+                                        material->GetBlock()));
+}
+
+void Entity::SetStatic(bool isStatic) {
+    if (isStatic) {
+        m_Scene->GetRegistry().Add<StaticTag>(m_ID);
+    } else {
+        m_Scene->GetRegistry().Remove<StaticTag>(m_ID);
+    }
+}
+
+bool Entity::IsStatic() const {
+    return m_Scene->GetRegistry().Has<StaticTag>(m_ID);
+}
 
-    // Set the model-view-projection matrices
-    glm::mat4 modelMatrix = m_Transform.GetModelMatrix();
-    glm::mat4 viewMatrix = camera.GetViewMatrix();
-    glm::mat4 projectionMatrix = camera.GetProjectionMatrix();
+MeshHandle Entity::GetMeshHandle() const {
+    const MeshRef* mesh = m_Scene->GetRegistry().TryGet<MeshRef>(m_ID);
+    return mesh ? mesh->Handle : MeshHandle();
+}
 
-    m_Shader->SetMat4("model", modelMatrix);
-    m_Shader->SetMat4("view", viewMatrix);
-    m_Shader->SetMat4("projection", projectionMatrix);
+MaterialHandle Entity::GetMaterialHandle() const {
+    const MaterialRef* material =
+        m_Scene->GetRegistry().TryGet<MaterialRef>(m_ID);
+    return material ? material->Handle : MaterialHandle();
+}
 
-    if (m_Texture) {
-        m_Texture->Bind();
+Mesh* Entity::GetMesh() const {
+    return ResourceRegistry::Get(GetMeshHandle());
+}
+
+AABB Entity::GetBounds() const {
+    Registry& registry = m_Scene->GetRegistry();
+    const AABB& bounds = registry.Get<LocalBounds>(m_ID).Box;
+    if (bounds.IsEmpty()) {
+        return AABB();
     }
 
-    m_Mesh->Bind();
-    glDrawElements(GL_TRIANGLES, m_Mesh->GetNumberOfIndices(), GL_UNSIGNED_INT,
-                   nullptr);
-    m_Mesh->Unbind();
+    return bounds.Transformed(registry.Get<Transform>(m_ID).GetModelMatrix());
+}
+
+Material* Entity::GetMaterial() const {
+    return ResourceRegistry::Get(GetMaterialHandle());
+}
+
+Shader* Entity::GetShader() const {
+    const Material* material = GetMaterial();
+    return material ? material->GetShader().get() : nullptr;
+}
+
+Texture* Entity::GetTexture() const {
+    const Material* material = GetMaterial();
+    return material ? material->GetTextures()[0].get() : nullptr;
+}
+
+void Entity::Submit() const {
+    const Mesh* mesh = GetMesh();
+    const Material* material = GetMaterial();
+    if (!mesh) {
+        LOG_ERROR("No mesh attached to entity!");
+        return;
+    }
+
+    if (!material) {
+        LOG_ERROR("Can't draw Mesh without Shader!");
+        return;
+    }
+
+    Renderer::Submit(*mesh, *material, GetTransform().GetModelMatrix());
 }
 
 void Entity::Draw() const {
-    if (!m_Mesh) {
+    const Mesh* mesh = GetMesh();
+    const Material* material = GetMaterial();
+    if (!mesh) {
         LOG_ERROR("No mesh attached to entity!");
         return;
     }
 
-    if (!m_Shader) {
+    if (!material || !material->GetShader()) {
         LOG_ERROR("Can't draw Mesh without Shader!");
         return;
     }
 
-    m_Shader->Use();
+    // Shaders still compiling in the background draw with the fallback, if any
+    Shader* shader = material->GetShader()->IsReady()
+                         ? material->GetShader().get()
+                         : Shader::GetFallback();
+    if (!shader) {
+        return;
+    }
+
+    shader->Use();
 
     // Legacy method - uses combined transform matrix
-    glm::mat4 modelMatrix = m_Transform.GetModelMatrix();
-    m_Shader->SetMat4("transform", modelMatrix);
+    glm::mat4 modelMatrix = GetTransform().GetModelMatrix();
+    shader->SetMat4("transform", modelMatrix);
 
-    if (m_Texture) {
-        m_Texture->Bind();
+    if (const Texture* texture = material->GetTexture(0)) {
+        texture->Bind();
     }
 
-    m_Mesh->Bind();
-    glDrawElements(GL_TRIANGLES, m_Mesh->GetNumberOfIndices(), GL_UNSIGNED_INT,
+    mesh->Bind();
+    glDrawElements(GL_TRIANGLES, mesh->GetNumberOfIndices(), GL_UNSIGNED_INT,
                    nullptr);
-    m_Mesh->Unbind();
+    mesh->Unbind();
 }
 }  // namespace Obelisk
\ No newline at end of file
@@ -0,0 +1,48 @@
+#include "Obelisk/Scene/Registry.h"
+
+namespace Obelisk {
+
+EntityID Registry::Create() {
+    if (!m_FreeIndices.empty()) {
+        uint32_t index = m_FreeIndices.back();
+        m_FreeIndices.pop_back();
+        return {index, m_Generations[index]};
+    }
+
+    m_Generations.push_back(0);
+    return {static_cast<uint32_t>(m_Generations.size() - 1), 0};
+}
+
+void Registry::Create(std::span<EntityID> ids) {
+    size_t reused = std::min(ids.size(), m_FreeIndices.size());
+    for (size_t i = 0; i < reused; i++) {
+        ids[i] = Create();
+    }
+
+    auto index = static_cast<uint32_t>(m_Generations.size());
+    m_Generations.resize(m_Generations.size() + ids.size() - reused, 0);
+    for (size_t i = reused; i < ids.size(); i++) {
+        ids[i] = {index++, 0};
+    }
+}
+
+void Registry::Destroy(EntityID id) {
+    if (!IsAlive(id)) {
+        return;
+    }
+
+    for (auto& [type, pool] : m_Pools) {
+        pool->Remove(id);
+    }
+
+    // Outstanding copies of the ID stop matching the slot
+    m_Generations[id.Index]++;
+    m_FreeIndices.push_back(id.Index);
+}
+
+bool Registry::IsAlive(EntityID id) const {
+    return id.Index < m_Generations.size() &&
+           m_Generations[id.Index] == id.Generation;
+}
+
+}  // namespace Obelisk
@@ -0,0 +1,560 @@
+#include "Obelisk/Scene/Scene.h"
+#include "Obelisk/Core/Camera.h"
+#include "Obelisk/Core/Frustum.h"
+#include "Obelisk/Core/JobSystem.h"
+#include "Obelisk/Renderer/GPUCulling.h"
+#include "Obelisk/Renderer/ImpostorAtlas.h"
+#include "Obelisk/Renderer/MaterialLibrary.h"
+
+namespace Obelisk {
+
+Entity Scene::CreateEntity() {
+    EntityID id = m_Registry.Create();
+    m_Registry.Add<Transform>(id);
+    m_Registry.Add<LocalBounds>(id);
+    return Entity(this, id);
+}
+
+Entity Scene::CreateEntity(MeshHandle mesh, MaterialHandle material) {
+    Entity entity = CreateEntity();
+    entity.SetMesh(mesh);
+    entity.SetMaterial(material);
+    return entity;
+}
+
+Entity Scene::CreateEntity(std::shared_ptr<Mesh> mesh,
+                           std::shared_ptr<Material> material) {
+    Entity entity = CreateEntity();
+    entity.SetMesh(std::move(mesh));
+    entity.SetMaterial(std::move(material));
+    return entity;
+}
+
+Entity Scene::CreateEntity(std::shared_ptr<Mesh> mesh,
+                           std::shared_ptr<Shader> shader,
+                           std::shared_ptr<Texture> texture) {
+    return CreateEntity(std::move(mesh),
+                        MaterialLibrary::Create(shader, {texture}));
+}
+
+void Scene::DestroyEntity(Entity entity) {
+    if (entity.GetScene() != this || !m_Registry.IsAlive(entity.GetID())) {
+        return;
+    }
+
+    ComponentPool<SpatialProxy>& proxies = m_Registry.GetPool<SpatialProxy>();
+    auto destroy = [&](EntityID id) {
+        if (const SpatialProxy* proxy = proxies.TryGet(id)) {
+            m_SpatialIndex.Remove(proxy->Proxy);
+        }
+        m_Registry.Destroy(id);
+    };
+
+    // Deepest first, so no child is left without its parent in between
+    std::vector<EntityID> descendants =
+        m_Registry.GetPool<Transform>().GetDescendants(entity.GetID());
+    for (auto it = descendants.rbegin(); it != descendants.rend(); ++it) {
+        destroy(*it);
+    }
+    destroy(entity.GetID());
+
+    // The grid lists the entities until it is rebuilt
+    m_GridStale = m_SpatialIndexType == SpatialIndexType::HashGrid;
+}
+
+void Scene::UpdateSpatialIndex() {
+    TransformStorage& transforms = m_Registry.GetPool<Transform>();
+    transforms.UpdateMatrices();
+    transforms.ConsumeMoved(m_MovedEntities);
+
+    if (m_SpatialIndexType == SpatialIndexType::HashGrid) {
+        if (!m_MovedEntities.empty() || m_GridStale) {
+            RebuildSpatialGrid();
+        }
+        return;
+    }
+
+    ComponentPool<LocalBounds>& localBounds = m_Registry.GetPool<LocalBounds>();
+    ComponentPool<SpatialProxy>& proxies = m_Registry.GetPool<SpatialProxy>();
+    for (EntityID id : m_MovedEntities) {
+        // Destroyed entities left the index in DestroyEntity()
+        if (!transforms.Has(id) || !localBounds.Has(id)) {
+            continue;
+        }
+
+        const AABB& box = localBounds.Get(id).Box;
+        SpatialProxy* proxy = proxies.TryGet(id);
+        if (box.IsEmpty()) {
+            // Entities without a mesh have nothing to find
+            if (proxy) {
+                m_SpatialIndex.Remove(proxy->Proxy);
+                proxies.Remove(id);
+            }
+            continue;
+        }
+
+        AABB bounds =
+            box.Transformed(transforms.GetMatrix(transforms.GetSlot(id)));
+        if (proxy) {
+            proxy->Bounds = bounds;
+            m_SpatialIndex.Move(proxy->Proxy, bounds);
+        } else {
+            proxies.Emplace(id, m_SpatialIndex.Insert(id, bounds), bounds);
+        }
+    }
+}
+
+void Scene::SetSpatialIndexType(SpatialIndexType type, float cellSize) {
+    if (type == SpatialIndexType::HashGrid) {
+        m_SpatialIndex.Clear();
+        m_Registry.Clear<SpatialProxy>();
+        m_SpatialGrid = SpatialHashGrid(cellSize);
+        m_GridStale = true;
+    } else if (m_SpatialIndexType == SpatialIndexType::HashGrid) {
+        m_SpatialGrid.Clear();
+        m_GridEntities.clear();
+        m_GridBounds.Clear();
+        m_GridCenters.clear();
+        m_GridSmallCount = 0;
+
+        // The tree only hears of entities that move, so all of them do
+        TransformStorage& transforms = m_Registry.GetPool<Transform>();
+        for (EntityID id : transforms.GetEntities()) {
+            transforms.MarkMoved(id);
+        }
+    }
+    m_SpatialIndexType = type;
+}
+
+void Scene::RebuildSpatialGrid() {
+    TransformStorage& transforms = m_Registry.GetPool<Transform>();
+    ComponentPool<LocalBounds>& localBounds = m_Registry.GetPool<LocalBounds>();
+    const std::vector<EntityID>& ids = localBounds.GetEntities();
+    const std::vector<LocalBounds>& boxes = localBounds.GetComponents();
+
+    // Entities without a mesh have nothing to find
+    m_GridEntities.clear();
+    for (size_t i = 0; i < ids.size(); i++) {
+        if (!boxes[i].Box.IsEmpty() && transforms.Has(ids[i])) {
+            m_GridEntities.push_back(ids[i]);
+        }
+    }
+
+    size_t count = m_GridEntities.size();
+    m_GridBounds.Resize(count);
+    m_GridCenters.resize(count);
+    const std::vector<glm::mat4>& matrices = transforms.GetMatrices();
+    JobSystem::ParallelFor(
+        count, SpatialHashGrid::PARALLEL_BATCH, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                EntityID id = m_GridEntities[i];
+                AABB bounds = localBounds.Get(id).Box.Transformed(
+                    matrices[transforms.GetSlot(id)]);
+                m_GridBounds.Set(i, bounds);
+                m_GridCenters[i] = bounds.GetCenter();
+            }
+        });
+
+    // Queries are padded by the largest extents in the grid, so entities
+    // larger than a cell are swapped to the end and kept out of it
+    float cellSize = m_SpatialGrid.GetCellSize();
+    size_t smallCount = count;
+    m_GridMaxExtents = glm::vec3(0.0f);
+    for (size_t i = 0; i < smallCount;) {
+        AABB bounds = m_GridBounds.Get(i);
+        glm::vec3 extents = bounds.GetExtents();
+        if (std::max({extents.x, extents.y, extents.z}) * 2.0f <= cellSize) {
+            m_GridMaxExtents = glm::max(m_GridMaxExtents, extents);
+            i++;
+            continue;
+        }
+        smallCount--;
+        std::swap(m_GridEntities[i], m_GridEntities[smallCount]);
+        std::swap(m_GridCenters[i], m_GridCenters[smallCount]);
+        m_GridBounds.Set(i, m_GridBounds.Get(smallCount));
+        m_GridBounds.Set(smallCount, bounds);
+    }
+    m_GridSmallCount = smallCount;
+
+    m_SpatialGrid.Build(
+        std::span<const glm::vec3>(m_GridCenters).first(smallCount));
+    m_GridStale = false;
+}
+
+template <typename Func>
+void Scene::ForEachGridItem(const AABB& box, Func&& func) const {
+    // No grid item reaches further than m_GridMaxExtents past its center
+    AABB reach(box.Min - m_GridMaxExtents, box.Max + m_GridMaxExtents);
+    if (m_SpatialGrid.CountCells(reach) > m_GridSmallCount) {
+        for (uint32_t item = 0; item < m_GridBounds.Size(); item++) {
+            if (m_GridBounds.Get(item).Intersects(box)) {
+                func(item);
+            }
+        }
+        return;
+    }
+
+    m_SpatialGrid.ForEachCell(reach, [&](std::span<const uint32_t> items,
+                                         std::span<const glm::vec3>) {
+        for (uint32_t item : items) {
+            if (m_GridBounds.Get(item).Intersects(box)) {
+                func(item);
+            }
+        }
+    });
+    for (auto item = static_cast<uint32_t>(m_GridSmallCount);
+         item < m_GridBounds.Size(); item++) {
+        if (m_GridBounds.Get(item).Intersects(box)) {
+            func(item);
+        }
+    }
+}
+
+void Scene::QueryAABB(const AABB& box, std::vector<Entity>& results) {
+    UpdateSpatialIndex();
+    if (m_SpatialIndexType == SpatialIndexType::HashGrid) {
+        ForEachGridItem(box, [&](uint32_t item) {
+            results.emplace_back(this, m_GridEntities[item]);
+        });
+        return;
+    }
+
+    ComponentPool<SpatialProxy>& proxies = m_Registry.GetPool<SpatialProxy>();
+    m_SpatialIndex.QueryAABB(box, [&](EntityID id) {
+        if (proxies.Get(id).Bounds.Intersects(box)) {
+            results.emplace_back(this, id);
+        }
+        return true;
+    });
+}
+
+void Scene::QuerySphere(const glm::vec3& center, float radius,
+                        std::vector<Entity>& results) {
+    UpdateSpatialIndex();
+    float radiusSquared = radius * radius;
+    auto touches = [&](const AABB& bounds) {
+        glm::vec3 offset = center - glm::clamp(center, bounds.Min, bounds.Max);
+        return glm::dot(offset, offset) <= radiusSquared;
+    };
+
+    if (m_SpatialIndexType == SpatialIndexType::HashGrid) {
+        ForEachGridItem(AABB::FromCenterExtents(center, glm::vec3(radius)),
+                        [&](uint32_t item) {
+                            if (touches(m_GridBounds.Get(item))) {
+                                results.emplace_back(this,
+                                                     m_GridEntities[item]);
+                            }
+                        });
+        return;
+    }
+
+    ComponentPool<SpatialProxy>& proxies = m_Registry.GetPool<SpatialProxy>();
+    m_SpatialIndex.QuerySphere(center, radius, [&](EntityID id) {
+        if (touches(proxies.Get(id).Bounds)) {
+            results.emplace_back(this, id);
+        }
+        return true;
+    });
+}
+
+void Scene::QueryFrustum(const Frustum& frustum,
+                         std::vector<Entity>& results) {
+    UpdateSpatialIndex();
+    if (m_SpatialIndexType == SpatialIndexType::HashGrid) {
+        // A frustum covers too many cells to be worth looking up
+        for (size_t i = 0; i < m_GridBounds.Size(); i++) {
+            if (frustum.Intersects(m_GridBounds.Get(i))) {
+                results.emplace_back(this, m_GridEntities[i]);
+            }
+        }
+        return;
+    }
+
+    ComponentPool<SpatialProxy>& proxies = m_Registry.GetPool<SpatialProxy>();
+    m_SpatialIndex.QueryFrustum(frustum, [&](EntityID id) {
+        if (frustum.Intersects(proxies.Get(id).Bounds)) {
+            results.emplace_back(this, id);
+        }
+        return true;
+    });
+}
+
+bool Scene::Raycast(const Ray& ray, float maxDistance, RaycastHit& hit) {
+    UpdateSpatialIndex();
+    bool found = false;
+    if (m_SpatialIndexType == SpatialIndexType::HashGrid) {
+        // A long ray crosses too many cells to be worth looking them up;
+        // the packed bounds are tested a packet at a time instead
+        m_GridBounds.Raycast(
+            ray, maxDistance, [&](uint32_t item, float distance) {
+                hit.HitEntity = Entity(this, m_GridEntities[item]);
+                hit.Distance = distance;
+                found = true;
+                return distance;
+            });
+        return found;
+    }
+
+    ComponentPool<SpatialProxy>& proxies = m_Registry.GetPool<SpatialProxy>();
+    m_SpatialIndex.Raycast(ray, maxDistance, [&](EntityID id, float limit) {
+        float distance;
+        if (!ray.Intersects(proxies.Get(id).Bounds, limit, distance)) {
+            return limit;
+        }
+
+        // Only closer entities are looked for from here on
+        hit.HitEntity = Entity(this, id);
+        hit.Distance = distance;
+        found = true;
+        return distance;
+    });
+    return found;
+}
+
+bool Scene::Pick(const Ray& ray, float maxDistance, RaycastHit& hit) {
+    UpdateSpatialIndex();
+    bool found = false;
+    float limit = maxDistance;
+    auto test = [&](EntityID id) {
+        float distance;
+        if (IntersectMesh(id, ray, limit, distance)) {
+            hit.HitEntity = Entity(this, id);
+            hit.Distance = distance;
+            limit = distance;
+            found = true;
+        }
+        return limit;
+    };
+
+    if (m_SpatialIndexType == SpatialIndexType::HashGrid) {
+        m_GridBounds.Raycast(ray, maxDistance, [&](uint32_t item, float) {
+            return test(m_GridEntities[item]);
+        });
+        return found;
+    }
+
+    ComponentPool<SpatialProxy>& proxies = m_Registry.GetPool<SpatialProxy>();
+    m_SpatialIndex.Raycast(ray, maxDistance, [&](EntityID id, float) {
+        // Triangles are only tested inside the exact bounds
+        float distance;
+        if (!ray.Intersects(proxies.Get(id).Bounds, limit, distance)) {
+            return limit;
+        }
+        return test(id);
+    });
+    return found;
+}
+
+bool Scene::Pick(const glm::vec2& screenPosition, RaycastHit& hit) {
+    if (!m_Camera) {
+        return false;
+    }
+    // The far plane distance is along the view axis and from the camera,
+    // so it is not the length of an off-center ray from the near plane
+    float length;
+    Ray ray = m_Camera->ScreenPointToRay(screenPosition, length);
+    return Pick(ray, length, hit);
+}
+
+bool Scene::IntersectMesh(EntityID id, const Ray& ray, float maxDistance,
+                          float& distance) {
+    const MeshRef* meshRef = m_Registry.GetPool<MeshRef>().TryGet(id);
+    const Mesh* mesh = meshRef ? ResourceRegistry::Get(meshRef->Handle)
+                               : nullptr;
+    if (!mesh) {
+        return false;
+    }
+
+    // Distances along an untransformed, unnormalized direction are the
+    // same in both spaces, so hits need no converting back
+    TransformStorage& transforms = m_Registry.GetPool<Transform>();
+    glm::mat4 toLocal =
+        glm::inverse(transforms.GetMatrix(transforms.GetSlot(id)));
+    Ray local(glm::vec3(toLocal * glm::vec4(ray.Origin, 1.0f)),
+              glm::vec3(toLocal * glm::vec4(ray.Direction, 0.0f)));
+    return mesh->Raycast(local, maxDistance, distance);
+}
+
+void Scene::Finalize(float chunkSize) {
+    m_Registry.Clear<BatchedTag>();
+    m_Registry.Clear<GPUCulledTag>();
+
+    std::vector<Entity> batchable;
+    ComponentPool<StaticTag>& statics = m_Registry.GetPool<StaticTag>();
+    m_Registry.GetView<MeshRef, MaterialRef>().Each(
+        [&](EntityID id, MeshRef& meshRef, MaterialRef& materialRef) {
+            const Mesh* mesh = ResourceRegistry::Get(meshRef.Handle);
+            const Material* material =
+                ResourceRegistry::Get(materialRef.Handle);
+            if (!mesh || !material) {
+                return;
+            }
+
+            if (mesh->IsImpostorEnabled()) {
+                ImpostorAtlas::Bake(*mesh, *material);
+            } else if (statics.Has(id)) {
+                batchable.emplace_back(this, id);
+            }
+        });
+
+    m_StaticBatches = StaticBatch::Build(batchable, chunkSize);
+    for (const Entity& entity : batchable) {
+        m_Registry.Add<BatchedTag>(entity.GetID());
+    }
+
+    m_GPUEntities.clear();
+    m_GPUCulled = false;
+    if (GPUCulling::IsEnabled() && GPUCulling::IsSupported()) {
+        BuildGPUCulling();
+    }
+}
+
+void Scene::BuildGPUCulling() {
+    std::vector<GPUCullingItem> staticItems;
+    for (const StaticBatch& batch : m_StaticBatches) {
+        staticItems.push_back({batch.BatchMesh.get(),
+                               batch.BatchMaterial.get(), glm::mat4(1.0f)});
+    }
+
+    // Impostor entities keep switching representation on the CPU
+    std::vector<GPUCullingItem> dynamicItems;
+    std::vector<EntityID> gpuEntities;
+    ComponentPool<BatchedTag>& batched = m_Registry.GetPool<BatchedTag>();
+    m_Registry.GetView<Transform, MeshRef, MaterialRef>().Each(
+        [&](EntityID id, TransformRef transform, MeshRef& meshRef,
+            MaterialRef& materialRef) {
+            const Mesh* mesh = ResourceRegistry::Get(meshRef.Handle);
+            const Material* material =
+                ResourceRegistry::Get(materialRef.Handle);
+            if (batched.Has(id) || !mesh || !material ||
+                mesh->IsImpostorEnabled() || !material->GetShader()) {
+                return;
+            }
+            dynamicItems.push_back(
+                {mesh, material, transform.GetModelMatrix()});
+            gpuEntities.push_back(id);
+        });
+
+    if (!GPUCulling::Build(staticItems, dynamicItems)) {
+        LOG_WARN("GPU culling unavailable for this scene, culling on the CPU");
+        return;
+    }
+
+    for (EntityID id : gpuEntities) {
+        m_Registry.Add<GPUCulledTag>(id);
+    }
+    m_GPUEntities = std::move(gpuEntities);
+    m_GPUCulled = true;
+}
+
+void Scene::Capture(RenderSnapshot& snapshot) {
+    snapshot.Clear();
+    m_CulledCount = 0;
+    if (!m_Camera) {
+        return;
+    }
+
+    snapshot.ViewCamera = *m_Camera;
+    snapshot.HasCamera = true;
+    snapshot.Lights = m_Lights;
+
+    // Rebuild every matrix moved since the last capture in one batched
+    // pass, then refit the spatial index around the entities that moved
+    UpdateSpatialIndex();
+    TransformStorage& transforms = m_Registry.GetPool<Transform>();
+
+    // While GPUCulling is suspended, its objects are culled here as well
+    bool gpuCulling = m_GPUCulled && GPUCulling::IsActive();
+    if (gpuCulling) {
+        snapshot.UseGPUCulling = true;
+        snapshot.GPUTransforms.reserve(m_GPUEntities.size());
+        for (EntityID id : m_GPUEntities) {
+            // Destroyed entities keep their slot until the next Finalize();
+            // a zero matrix collapses them to nothing
+            snapshot.GPUTransforms.push_back(
+                transforms.Has(id)
+                    ? transforms.GetMatrix(transforms.GetSlot(id))
+                    : glm::mat4(0.0f));
+        }
+    }
+
+    Frustum frustum(m_Camera->GetViewProjectionMatrix());
+    if (!gpuCulling) {
+        for (const StaticBatch& batch : m_StaticBatches) {
+            snapshot.BatchesTested++;
+            if (!frustum.Intersects(batch.Bounds)) {
+                snapshot.BatchesCulled++;
+                continue;
+            }
+            snapshot.Add(*batch.BatchMesh, *batch.BatchMaterial,
+                         glm::mat4(1.0f));
+        }
+    }
+
+    CaptureEntities(snapshot, frustum, gpuCulling);
+
+    m_CulledCount = snapshot.BatchesCulled + snapshot.EntitiesCulled;
+}
+
+void Scene::CaptureEntities(RenderSnapshot& snapshot, const Frustum& frustum,
+                            bool gpuCulling) {
+    glm::vec3 cameraPosition = m_Camera->GetPosition();
+    float impostorDistanceSquared = m_ImpostorDistance * m_ImpostorDistance;
+    TransformStorage& transforms = m_Registry.GetPool<Transform>();
+    ComponentPool<MeshRef>& meshes = m_Registry.GetPool<MeshRef>();
+    ComponentPool<MaterialRef>& materials = m_Registry.GetPool<MaterialRef>();
+    ComponentPool<SpatialProxy>& proxies = m_Registry.GetPool<SpatialProxy>();
+    ComponentPool<BatchedTag>& batched = m_Registry.GetPool<BatchedTag>();
+    ComponentPool<GPUCulledTag>& gpuCulled =
+        m_Registry.GetPool<GPUCulledTag>();
+
+    auto visit = [&](EntityID id, const AABB& bounds) {
+        if (batched.Has(id) || (gpuCulling && gpuCulled.Has(id)) ||
+            !meshes.Has(id) || !materials.Has(id)) {
+            return;
+        }
+
+        // Released resources leave their handles stale
+        const Mesh* mesh = ResourceRegistry::Get(meshes.Get(id).Handle);
+        const Material* material =
+            ResourceRegistry::Get(materials.Get(id).Handle);
+        if (!mesh || !material) {
+            return;
+        }
+
+        snapshot.EntitiesTested++;
+        if (!frustum.Intersects(bounds)) {
+            snapshot.EntitiesCulled++;
+            return;
+        }
+
+        const glm::mat4& model = transforms.GetMatrix(transforms.GetSlot(id));
+        glm::vec3 offset = bounds.GetCenter() - cameraPosition;
+        if (mesh->IsImpostorEnabled() &&
+            glm::dot(offset, offset) > impostorDistanceSquared) {
+            // Drawn in full until Finalize() has baked the impostor
+            if (const Impostor* impostor =
+                    ImpostorAtlas::Find(*mesh, *material)) {
+                snapshot.AddImpostor(*impostor, model);
+                return;
+            }
+        }
+
+        snapshot.Add(*mesh, *material, model);
+    };
+
+    if (m_SpatialIndexType == SpatialIndexType::HashGrid) {
+        for (size_t i = 0; i < m_GridEntities.size(); i++) {
+            visit(m_GridEntities[i], m_GridBounds.Get(i));
+        }
+        return;
+    }
+
+    // Entities whose fat box misses the frustum are never visited
+    m_SpatialIndex.QueryFrustum(frustum, [&](EntityID id) {
+        visit(id, proxies.Get(id).Bounds);
+        return true;
+    });
+}
+
+}  // namespace Obelisk
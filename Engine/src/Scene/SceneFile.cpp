@@ -0,0 +1,406 @@
+#include "Obelisk/Scene/SceneFile.h"
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+#include "Obelisk/Scene/Scene.h"
+
+namespace Obelisk {
+
+// Sections are used in place, so their structs must have the same layout on
+// every platform that reads them
+static_assert(std::is_trivially_copyable_v<LocalBounds> &&
+              sizeof(LocalBounds) == 6 * sizeof(float));
+static_assert(std::is_trivially_copyable_v<PointLight> &&
+              sizeof(PointLight) == 8 * sizeof(float));
+
+namespace {
+
+/**
+ * @brief Resolve a section into a typed view of the mapping.
+ *
+ * @param data Start of the mapped file
+ * @param fileSize Bytes in the file
+ * @param section Section from the header
+ * @param count Elements the section must hold
+ * @param view Receives the elements
+ * @return false if the section is misaligned, too small or past the end
+ */
+template <typename T>
+bool MapSection(const std::byte* data, size_t fileSize,
+                const SceneFileSection& section, size_t count,
+                std::span<const T>& view) {
+    if (section.Offset % SCENE_FILE_ALIGNMENT != 0 ||
+        section.Offset > fileSize || section.Size > fileSize - section.Offset ||
+        section.Size != count * sizeof(T)) {
+        return false;
+    }
+    view = {reinterpret_cast<const T*>(data + section.Offset), count};
+    return true;
+}
+
+/**
+ * @brief Check that every index of an array is below a limit or absent.
+ */
+bool IndicesBelow(std::span<const uint32_t> indices, size_t limit) {
+    return std::all_of(indices.begin(), indices.end(), [limit](uint32_t i) {
+        return i == SCENE_NO_INDEX || i < limit;
+    });
+}
+
+}  // namespace
+
+void SceneResources::AddMesh(const std::string& name, MeshHandle mesh) {
+    m_Meshes[name] = mesh;
+    m_MeshNames[mesh.GetValue()] = name;
+}
+
+void SceneResources::AddMaterial(const std::string& name,
+                                 MaterialHandle material) {
+    m_Materials[name] = material;
+    m_MaterialNames[material.GetValue()] = name;
+}
+
+MeshHandle SceneResources::FindMesh(const std::string& name) const {
+    auto it = m_Meshes.find(name);
+    return it != m_Meshes.end() ? it->second : MeshHandle();
+}
+
+MaterialHandle SceneResources::FindMaterial(const std::string& name) const {
+    auto it = m_Materials.find(name);
+    return it != m_Materials.end() ? it->second : MaterialHandle();
+}
+
+const std::string* SceneResources::GetMeshName(MeshHandle mesh) const {
+    auto it = m_MeshNames.find(mesh.GetValue());
+    return it != m_MeshNames.end() ? &it->second : nullptr;
+}
+
+const std::string* SceneResources::GetMaterialName(
+    MaterialHandle material) const {
+    auto it = m_MaterialNames.find(material.GetValue());
+    return it != m_MaterialNames.end() ? &it->second : nullptr;
+}
+
+bool SceneFile::Open(const std::filesystem::path& path) {
+    Close();
+    if (!m_File.Open(path)) {
+        return false;
+    }
+
+    const std::byte* data = m_File.GetData();
+    size_t size = m_File.GetSize();
+    auto reject = [&](const char* reason) {
+        LOG_ERROR("Failed to load scene {}: {}", path.string(), reason);
+        Close();
+        return false;
+    };
+
+    if (size < sizeof(SceneFileHeader)) {
+        return reject("file is truncated");
+    }
+    const auto* header = reinterpret_cast<const SceneFileHeader*>(data);
+    if (header->Magic != SCENE_FILE_MAGIC) {
+        return reject("not a scene file");
+    }
+    if (header->Version != SCENE_FILE_VERSION) {
+        return reject("unsupported version");
+    }
+
+    // Offsets become views of the mapping; the file itself is never copied
+    size_t count = header->EntityCount;
+    std::span<const uint32_t> meshNames;
+    std::span<const uint32_t> materialNames;
+    std::span<const char> strings;
+    if (!MapSection(data, size, header->Transforms,
+                    count * TransformStorage::ChannelCount, m_Transforms) ||
+        !MapSection(data, size, header->Parents, count, m_Parents) ||
+        !MapSection(data, size, header->Bounds, count, m_Bounds) ||
+        !MapSection(data, size, header->Meshes, count, m_Meshes) ||
+        !MapSection(data, size, header->Materials, count, m_Materials) ||
+        !MapSection(data, size, header->Flags, count, m_Flags) ||
+        !MapSection(data, size, header->MeshNames, header->MeshCount,
+                    meshNames) ||
+        !MapSection(data, size, header->MaterialNames, header->MaterialCount,
+                    materialNames) ||
+        !MapSection(data, size, header->Lights, header->LightCount,
+                    m_Lights) ||
+        !MapSection(data, size, header->Strings, header->Strings.Size,
+                    strings)) {
+        return reject("section out of bounds");
+    }
+
+    // Checked once here so Instantiate() can index without checks
+    if (!IndicesBelow(m_Parents, count) ||
+        !IndicesBelow(m_Meshes, header->MeshCount) ||
+        !IndicesBelow(m_Materials, header->MaterialCount)) {
+        return reject("index out of range");
+    }
+    if (!strings.empty() && strings.back() != '\0') {
+        return reject("unterminated string table");
+    }
+    auto resolve = [&](std::span<const uint32_t> offsets,
+                       std::vector<std::string_view>& names) {
+        names.reserve(offsets.size());
+        for (uint32_t offset : offsets) {
+            if (offset >= strings.size()) {
+                return false;
+            }
+            names.emplace_back(strings.data() + offset);
+        }
+        return true;
+    };
+    if (!resolve(meshNames, m_MeshNames) ||
+        !resolve(materialNames, m_MaterialNames)) {
+        return reject("name out of range");
+    }
+
+    m_Header = header;
+    return true;
+}
+
+void SceneFile::Close() {
+    m_Header = nullptr;
+    m_Transforms = {};
+    m_Parents = {};
+    m_Bounds = {};
+    m_Meshes = {};
+    m_Materials = {};
+    m_Flags = {};
+    m_Lights = {};
+    m_MeshNames.clear();
+    m_MaterialNames.clear();
+    m_File.Close();
+}
+
+bool SceneFile::Instantiate(Scene& scene, const SceneResources& resources,
+                            std::vector<EntityID>* entities) const {
+    if (!IsOpen()) {
+        LOG_ERROR("No scene file is open");
+        return false;
+    }
+
+    // Names are resolved once per table entry rather than per entity
+    std::vector<MeshHandle> meshes;
+    meshes.reserve(m_MeshNames.size());
+    for (std::string_view name : m_MeshNames) {
+        MeshHandle mesh = resources.FindMesh(std::string(name));
+        if (!ResourceRegistry::IsValid(mesh)) {
+            LOG_WARN("Scene mesh '{}' is not registered", name);
+            mesh = MeshHandle();
+        }
+        meshes.push_back(mesh);
+    }
+    std::vector<MaterialHandle> materials;
+    materials.reserve(m_MaterialNames.size());
+    for (std::string_view name : m_MaterialNames) {
+        MaterialHandle material = resources.FindMaterial(std::string(name));
+        if (!ResourceRegistry::IsValid(material)) {
+            LOG_WARN("Scene material '{}' is not registered", name);
+            material = MaterialHandle();
+        }
+        materials.push_back(material);
+    }
+
+    Registry& registry = scene.GetRegistry();
+    size_t count = GetEntityCount();
+    std::vector<EntityID> ids(count);
+    registry.Create(ids);
+
+    // The transforms are already in the storage's layout
+    TransformStorage& transforms = registry.GetPool<Transform>();
+    transforms.Append(ids, m_Transforms);
+
+    std::vector<EntityID> meshIDs;
+    std::vector<MeshRef> meshRefs;
+    std::vector<EntityID> materialIDs;
+    std::vector<MaterialRef> materialRefs;
+    std::vector<EntityID> staticIDs;
+    for (size_t i = 0; i < count; i++) {
+        if (m_Meshes[i] != SCENE_NO_INDEX && !meshes[m_Meshes[i]].IsNull()) {
+            meshIDs.push_back(ids[i]);
+            meshRefs.push_back({meshes[m_Meshes[i]]});
+        }
+        if (m_Materials[i] != SCENE_NO_INDEX &&
+            !materials[m_Materials[i]].IsNull()) {
+            materialIDs.push_back(ids[i]);
+            materialRefs.push_back({materials[m_Materials[i]]});
+        }
+        if (m_Flags[i] & SCENE_ENTITY_STATIC) {
+            staticIDs.push_back(ids[i]);
+        }
+    }
+
+    // The writer stores empty bounds for entities without a mesh, so the
+    // mapped bounds are copied as they are unless a mesh name failed to
+    // resolve and left more entities without one
+    ComponentPool<LocalBounds>& bounds = registry.GetPool<LocalBounds>();
+    if (std::none_of(meshes.begin(), meshes.end(),
+                     [](MeshHandle mesh) { return mesh.IsNull(); })) {
+        bounds.Append(ids, m_Bounds);
+    } else {
+        std::vector<LocalBounds> copy(m_Bounds.begin(), m_Bounds.end());
+        for (size_t i = 0; i < count; i++) {
+            if (m_Meshes[i] != SCENE_NO_INDEX && meshes[m_Meshes[i]].IsNull()) {
+                copy[i] = LocalBounds();
+            }
+        }
+        bounds.Append(ids, copy);
+    }
+    registry.GetPool<MeshRef>().Append(meshIDs, meshRefs);
+    registry.GetPool<MaterialRef>().Append(materialIDs, materialRefs);
+    std::vector<StaticTag> tags(staticIDs.size());
+    registry.GetPool<StaticTag>().Append(staticIDs, tags);
+
+    for (size_t i = 0; i < count; i++) {
+        if (m_Parents[i] != SCENE_NO_INDEX &&
+            !transforms.SetParent(ids[i], ids[m_Parents[i]])) {
+            LOG_WARN("Scene entity {} has an invalid parent", i);
+        }
+    }
+
+    std::vector<PointLight>& lights = scene.GetLights();
+    lights.insert(lights.end(), m_Lights.begin(), m_Lights.end());
+
+    if (entities) {
+        *entities = std::move(ids);
+    }
+    return true;
+}
+
+bool SceneFile::Write(Scene& scene, const std::filesystem::path& path,
+                      const SceneResources& resources) {
+    Registry& registry = scene.GetRegistry();
+    TransformStorage& transforms = registry.GetPool<Transform>();
+    ComponentPool<LocalBounds>& localBounds = registry.GetPool<LocalBounds>();
+    ComponentPool<MeshRef>& meshRefs = registry.GetPool<MeshRef>();
+    ComponentPool<MaterialRef>& materialRefs =
+        registry.GetPool<MaterialRef>();
+    ComponentPool<StaticTag>& staticTags = registry.GetPool<StaticTag>();
+    const std::vector<EntityID>& ids = transforms.GetEntities();
+    size_t count = ids.size();
+
+    std::string strings;
+    auto addString = [&](const std::string& name) {
+        auto offset = static_cast<uint32_t>(strings.size());
+        strings.append(name);
+        strings.push_back('\0');
+        return offset;
+    };
+
+    // Each distinct handle gets one table entry, or SCENE_NO_INDEX when it
+    // has no name to be saved under
+    std::unordered_map<uint32_t, uint32_t> meshIndices;
+    std::unordered_map<uint32_t, uint32_t> materialIndices;
+    std::vector<uint32_t> meshNames;
+    std::vector<uint32_t> materialNames;
+    auto meshIndex = [&](MeshHandle mesh) {
+        auto [it, added] = meshIndices.try_emplace(mesh.GetValue(),
+                                                   SCENE_NO_INDEX);
+        if (added) {
+            if (const std::string* name = resources.GetMeshName(mesh)) {
+                it->second = static_cast<uint32_t>(meshNames.size());
+                meshNames.push_back(addString(*name));
+            } else {
+                LOG_WARN("Scene mesh {} has no name and is not saved",
+                         mesh.GetValue());
+            }
+        }
+        return it->second;
+    };
+    auto materialIndex = [&](MaterialHandle material) {
+        auto [it, added] = materialIndices.try_emplace(material.GetValue(),
+                                                       SCENE_NO_INDEX);
+        if (added) {
+            if (const std::string* name = resources.GetMaterialName(material)) {
+                it->second = static_cast<uint32_t>(materialNames.size());
+                materialNames.push_back(addString(*name));
+            } else {
+                LOG_WARN("Scene material {} has no name and is not saved",
+                         material.GetValue());
+            }
+        }
+        return it->second;
+    };
+
+    std::vector<uint32_t> parents(count, SCENE_NO_INDEX);
+    std::vector<LocalBounds> bounds(count);
+    std::vector<uint32_t> meshes(count, SCENE_NO_INDEX);
+    std::vector<uint32_t> materials(count, SCENE_NO_INDEX);
+    std::vector<uint8_t> flags(count, 0);
+    for (size_t i = 0; i < count; i++) {
+        EntityID id = ids[i];
+        if (EntityID parent = transforms.GetParent(id); !parent.IsNull()) {
+            parents[i] = transforms.GetSlot(parent);
+        }
+        if (const MeshRef* mesh = meshRefs.TryGet(id)) {
+            meshes[i] = meshIndex(mesh->Handle);
+        }
+        // Dropped meshes leave the entity without bounds, as on load
+        if (const LocalBounds* box = localBounds.TryGet(id);
+            box && meshes[i] != SCENE_NO_INDEX) {
+            bounds[i] = *box;
+        }
+        if (const MaterialRef* material = materialRefs.TryGet(id)) {
+            materials[i] = materialIndex(material->Handle);
+        }
+        if (staticTags.Has(id)) {
+            flags[i] |= SCENE_ENTITY_STATIC;
+        }
+    }
+
+    // The file is assembled in memory and written in one go
+    std::vector<char> buffer(sizeof(SceneFileHeader));
+    auto addSection = [&](const void* data, size_t size) {
+        buffer.resize((buffer.size() + SCENE_FILE_ALIGNMENT - 1) /
+                      SCENE_FILE_ALIGNMENT * SCENE_FILE_ALIGNMENT);
+        SceneFileSection section = {buffer.size(), size};
+        const char* bytes = static_cast<const char*>(data);
+        buffer.insert(buffer.end(), bytes, bytes + size);
+        return section;
+    };
+
+    const std::vector<PointLight>& lights = scene.GetLights();
+    SceneFileHeader header = {};
+    header.Magic = SCENE_FILE_MAGIC;
+    header.Version = SCENE_FILE_VERSION;
+    header.EntityCount = static_cast<uint32_t>(count);
+    header.MeshCount = static_cast<uint32_t>(meshNames.size());
+    header.MaterialCount = static_cast<uint32_t>(materialNames.size());
+    header.LightCount = static_cast<uint32_t>(lights.size());
+    header.Transforms = addSection(nullptr, 0);
+    for (uint32_t channel = 0; channel < TransformStorage::ChannelCount;
+         channel++) {
+        // Channels follow each other without padding, as one section
+        const std::vector<float>& values = transforms.GetChannel(
+            static_cast<TransformStorage::Channel>(channel));
+        const char* bytes = reinterpret_cast<const char*>(values.data());
+        buffer.insert(buffer.end(), bytes, bytes + count * sizeof(float));
+    }
+    header.Transforms.Size = buffer.size() - header.Transforms.Offset;
+    header.Parents = addSection(parents.data(), count * sizeof(uint32_t));
+    header.Bounds = addSection(bounds.data(), count * sizeof(LocalBounds));
+    header.Meshes = addSection(meshes.data(), count * sizeof(uint32_t));
+    header.Materials = addSection(materials.data(), count * sizeof(uint32_t));
+    header.Flags = addSection(flags.data(), count);
+    header.MeshNames =
+        addSection(meshNames.data(), meshNames.size() * sizeof(uint32_t));
+    header.MaterialNames = addSection(
+        materialNames.data(), materialNames.size() * sizeof(uint32_t));
+    header.Lights =
+        addSection(lights.data(), lights.size() * sizeof(PointLight));
+    header.Strings = addSection(strings.data(), strings.size());
+    std::memcpy(buffer.data(), &header, sizeof(header));
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    if (!file) {
+        LOG_ERROR("Failed to write scene {}", path.string());
+        return false;
+    }
+
+    LOG_INFO("Saved scene {} ({} entities, {} KB)", path.string(), count,
+             buffer.size() / 1024);
+    return true;
+}
+
+}  // namespace Obelisk
@@ -0,0 +1,247 @@
+#include "Obelisk/Scene/SpatialHashGrid.h"
+#include <bit>
+#include "Obelisk/Core/JobSystem.h"
+
+namespace Obelisk {
+
+void SpatialHashGrid::Build(std::span<const glm::vec3> points) {
+    auto count = static_cast<uint32_t>(points.size());
+
+    // At most half full even when every point has a cell of its own, so
+    // probe sequences stay short
+    uint32_t capacity = std::bit_ceil(std::max(count * 2, 64u));
+    m_Cells.resize(capacity);
+    m_Shift = 64 - std::countr_zero(capacity);
+    JobSystem::ParallelFor(capacity, PARALLEL_BATCH,
+                           [this](size_t begin, size_t end) {
+                               std::fill(m_Cells.begin() + begin,
+                                         m_Cells.begin() + end, Cell());
+                           });
+
+    // Bucket the points by the slice of the table their probe starts in,
+    // so each claiming job below only visits its own points: per-batch
+    // counts, offsets in slice then batch order, then a scatter that keeps
+    // the input order within each slice.
+    size_t slices = JobSystem::GetWorkerCount() + 1;
+    size_t batchCount = (count + PARALLEL_BATCH - 1) / PARALLEL_BATCH;
+    auto batchEnd = [count](size_t batch) {
+        return std::min<size_t>(count, (batch + 1) * PARALLEL_BATCH);
+    };
+    // Inverse of the slice bounds below: the last slice starting at or
+    // before the home slot
+    auto getSlice = [capacity, slices](uint32_t home) {
+        return static_cast<size_t>(((home + 1ull) * slices - 1) / capacity);
+    };
+    m_Homes.resize(count);
+    m_SliceCounts.assign(batchCount * slices, 0);
+    JobSystem::ParallelFor(batchCount, 1, [&](size_t begin, size_t end) {
+        for (size_t batch = begin; batch < end; batch++) {
+            uint32_t* counts = &m_SliceCounts[batch * slices];
+            for (size_t i = batch * PARALLEL_BATCH; i < batchEnd(batch); i++) {
+                m_Homes[i] = GetHome(MakeKey(GetCell(points[i])));
+                counts[getSlice(m_Homes[i])]++;
+            }
+        }
+    });
+    m_SliceStarts.resize(slices + 1);
+    uint32_t sliceOffset = 0;
+    for (size_t slice = 0; slice < slices; slice++) {
+        m_SliceStarts[slice] = sliceOffset;
+        for (size_t batch = 0; batch < batchCount; batch++) {
+            uint32_t& cursor = m_SliceCounts[batch * slices + slice];
+            sliceOffset += std::exchange(cursor, sliceOffset);
+        }
+    }
+    m_SliceStarts[slices] = sliceOffset;
+    m_SlicePoints.resize(count);
+    JobSystem::ParallelFor(batchCount, 1, [&](size_t begin, size_t end) {
+        for (size_t batch = begin; batch < end; batch++) {
+            uint32_t* cursors = &m_SliceCounts[batch * slices];
+            for (size_t i = batch * PARALLEL_BATCH; i < batchEnd(batch); i++) {
+                m_SlicePoints[cursors[getSlice(m_Homes[i])]++] =
+                    static_cast<uint32_t>(i);
+            }
+        }
+    });
+
+    // Each job owns a slice of the table and claims and counts the cells
+    // of the points whose probe starts in it, so no two jobs touch the same
+    // cell and no atomics are needed. Probes that would run past the slice
+    // are left for the calling thread.
+    m_Placements.resize(slices);
+    m_Overflow.resize(slices);
+    JobSystem::ParallelFor(slices, 1, [&](size_t begin, size_t end) {
+        for (size_t slice = begin; slice < end; slice++) {
+            auto last = static_cast<uint32_t>((slice + 1) * capacity / slices);
+            std::vector<Placement>& placements = m_Placements[slice];
+            std::vector<Placement>& overflow = m_Overflow[slice];
+            placements.clear();
+            overflow.clear();
+            for (uint32_t at = m_SliceStarts[slice];
+                 at < m_SliceStarts[slice + 1]; at++) {
+                uint32_t i = m_SlicePoints[at];
+                uint32_t home = m_Homes[i];
+                uint64_t key = MakeKey(GetCell(points[i]));
+                uint32_t slot = ClaimCell(key, home, last & (capacity - 1));
+                if (slot == (last & (capacity - 1))) {
+                    overflow.push_back({i, home});
+                } else {
+                    m_Cells[slot].Count++;
+                    placements.push_back({i, slot});
+                }
+            }
+        }
+    });
+    for (std::vector<Placement>& overflow : m_Overflow) {
+        for (Placement& placement : overflow) {
+            uint64_t key = MakeKey(GetCell(points[placement.Point]));
+            placement.Slot = ClaimCell(key, placement.Slot, NO_LIMIT);
+            m_Cells[placement.Slot].Count++;
+        }
+    }
+
+    // Exclusive prefix sum of the counts in table order: per-block sums,
+    // block offsets, then the cells' ranges. Counts restart at zero to
+    // serve as fill cursors.
+    size_t blockCount = (capacity + PARALLEL_BATCH - 1) / PARALLEL_BATCH;
+    auto blockEnd = [capacity](size_t block) {
+        return std::min<size_t>(capacity, (block + 1) * PARALLEL_BATCH);
+    };
+    m_BlockSums.assign(blockCount, 0);
+    JobSystem::ParallelFor(blockCount, 1, [&](size_t begin, size_t end) {
+        for (size_t block = begin; block < end; block++) {
+            for (size_t i = block * PARALLEL_BATCH; i < blockEnd(block); i++) {
+                m_BlockSums[block] += m_Cells[i].Count;
+            }
+        }
+    });
+    uint32_t offset = 0;
+    for (uint32_t& sum : m_BlockSums) {
+        offset += std::exchange(sum, offset);
+    }
+    JobSystem::ParallelFor(blockCount, 1, [&](size_t begin, size_t end) {
+        for (size_t block = begin; block < end; block++) {
+            uint32_t next = m_BlockSums[block];
+            for (size_t i = block * PARALLEL_BATCH; i < blockEnd(block); i++) {
+                m_Cells[i].Begin = next;
+                next += std::exchange(m_Cells[i].Count, 0);
+            }
+        }
+    });
+
+    // Scatter the points into their cells' ranges, split the same way. All
+    // points of a cell go through the same list, so they keep their order.
+    m_Items.resize(count);
+    m_Points.resize(count);
+    auto scatter = [&](const std::vector<Placement>& placements) {
+        for (const Placement& placement : placements) {
+            Cell& cell = m_Cells[placement.Slot];
+            uint32_t at = cell.Begin + cell.Count++;
+            m_Items[at] = placement.Point;
+            m_Points[at] = points[placement.Point];
+        }
+    };
+    JobSystem::ParallelFor(slices, 1, [&](size_t begin, size_t end) {
+        for (size_t slice = begin; slice < end; slice++) {
+            scatter(m_Placements[slice]);
+        }
+    });
+    for (const std::vector<Placement>& overflow : m_Overflow) {
+        scatter(overflow);
+    }
+}
+
+void SpatialHashGrid::Clear() {
+    m_Cells.clear();
+    m_Shift = 64;
+    m_Items.clear();
+    m_Points.clear();
+    m_Homes.clear();
+    m_SlicePoints.clear();
+}
+
+std::span<uint32_t> SpatialHashGrid::QueryRadius(
+    const glm::vec3& center, float radius, std::span<uint32_t> results) const {
+    size_t found = 0;
+    ForEachInRadius(center, radius, [&](uint32_t index) {
+        if (found < results.size()) {
+            results[found++] = index;
+        }
+    });
+    return results.first(found);
+}
+
+uint64_t SpatialHashGrid::CountCells(const AABB& box) const {
+    glm::ivec3 first = GetCell(box.Min);
+    glm::ivec3 last = GetCell(box.Max);
+    uint64_t count = 1;
+    for (int axis = 0; axis < 3; axis++) {
+        if (last[axis] < first[axis]) {
+            return 0;
+        }
+        auto size = static_cast<uint64_t>(
+            static_cast<int64_t>(last[axis]) - first[axis] + 1);
+        if (count > UINT64_MAX / size) {
+            return UINT64_MAX;
+        }
+        count *= size;
+    }
+    return count;
+}
+
+bool SpatialHashGrid::IsKeyInRange(uint64_t key, const glm::ivec3& first,
+                                   const glm::ivec3& last) {
+    constexpr uint64_t mask = (1ull << KEY_BITS) - 1;
+    for (int axis = 0; axis < 3; axis++) {
+        // A range of 2^21 cells or more covers every wrapped coordinate
+        auto span = static_cast<uint64_t>(static_cast<int64_t>(last[axis]) -
+                                          first[axis]);
+        if (span >= mask) {
+            continue;
+        }
+        uint64_t offset = ((key >> (axis * KEY_BITS)) -
+                           static_cast<uint64_t>(first[axis])) &
+                          mask;
+        if (offset > span) {
+            return false;
+        }
+    }
+    return true;
+}
+
+const SpatialHashGrid::Cell* SpatialHashGrid::FindCell(
+    const glm::ivec3& cell) const {
+    if (m_Cells.empty()) {
+        return nullptr;
+    }
+
+    uint64_t key = MakeKey(cell);
+    auto mask = static_cast<uint32_t>(m_Cells.size() - 1);
+    for (uint32_t slot = GetHome(key);; slot = (slot + 1) & mask) {
+        const Cell& candidate = m_Cells[slot];
+        if (candidate.Key == key) {
+            return &candidate;
+        }
+        if (candidate.Key == EMPTY_KEY) {
+            return nullptr;
+        }
+    }
+}
+
+uint32_t SpatialHashGrid::ClaimCell(uint64_t key, uint32_t home,
+                                    uint32_t end) {
+    auto mask = static_cast<uint32_t>(m_Cells.size() - 1);
+    for (uint32_t slot = home; slot != end; slot = (slot + 1) & mask) {
+        Cell& cell = m_Cells[slot];
+        if (cell.Key == EMPTY_KEY) {
+            cell.Key = key;
+            return slot;
+        }
+        if (cell.Key == key) {
+            return slot;
+        }
+    }
+    return end;
+}
+
+}  // namespace Obelisk
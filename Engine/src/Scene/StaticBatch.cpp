@@ -0,0 +1,107 @@
+#include "Obelisk/Scene/StaticBatch.h"
+#include "Obelisk/Scene/Entity.h"
+#include <map>
+#include <numeric>
+#include <tuple>
+#include <unordered_map>
+
+namespace Obelisk {
+
+namespace {
+/**
+ * @brief CPU copy of a mesh's buffers, read back once per source mesh.
+ */
+struct MeshData {
+        std::vector<Vertex> Vertices;       ///< Object-space vertices
+        std::vector<unsigned int> Indices;  ///< Triangle list
+};
+
+/**
+ * @brief Material and chunk coordinates a batch is built for.
+ */
+using BatchKey = std::tuple<uint32_t, int, int, int>;
+}  // namespace
+
+std::vector<StaticBatch> StaticBatch::Build(
+    const std::vector<Entity>& entities, float chunkSize) {
+    // Ordered by material ID first, so batches come out in sort key order
+    std::map<BatchKey, std::vector<const Entity*>> groups;
+    for (const Entity& entity : entities) {
+        const Material* material = entity.GetMaterial();
+        if (!entity.IsStatic() || !entity.GetMesh() || !material) {
+            continue;
+        }
+
+        glm::ivec3 chunk =
+            glm::ivec3(glm::floor(entity.GetBounds().GetCenter() / chunkSize));
+        groups[{material->GetID(), chunk.x, chunk.y, chunk.z}].push_back(
+            &entity);
+    }
+
+    std::unordered_map<const Mesh*, MeshData> meshData;
+    std::vector<StaticBatch> batches;
+
+    std::vector<Vertex> vertices;
+    std::vector<unsigned int> indices;
+    StaticBatch batch;
+
+    auto flush = [&]() {
+        if (!indices.empty()) {
+            batch.BatchMesh = std::make_unique<Mesh>(vertices, indices);
+            batches.push_back(std::move(batch));
+        }
+        batch = StaticBatch();
+        vertices.clear();
+        indices.clear();
+    };
+
+    for (const auto& [key, group] : groups) {
+        for (const Entity* entity : group) {
+            const Mesh* mesh = entity->GetMesh();
+            auto [it, inserted] = meshData.try_emplace(mesh);
+            if (inserted) {
+                mesh->ReadBack(it->second.Vertices, it->second.Indices);
+            }
+            const MeshData& source = it->second;
+
+            if (!vertices.empty() &&
+                vertices.size() + source.Vertices.size() > MAX_VERTICES) {
+                flush();
+            }
+
+            glm::mat4 model = entity->GetTransform().GetModelMatrix();
+            // Mirroring transforms flip the winding order
+            bool mirrored = glm::determinant(glm::mat3(model)) < 0.0f;
+
+            auto base = static_cast<unsigned int>(vertices.size());
+            for (Vertex vertex : source.Vertices) {
+                vertex.Position = glm::vec3(model * glm::vec4(vertex.Position,
+                                                              1.0f));
+                batch.Bounds.Expand(vertex.Position);
+                vertices.push_back(vertex);
+            }
+            for (size_t i = 0; i + 2 < source.Indices.size(); i += 3) {
+                indices.push_back(base + source.Indices[i]);
+                indices.push_back(base + source.Indices[mirrored ? i + 2
+                                                                 : i + 1]);
+                indices.push_back(base + source.Indices[mirrored ? i + 1
+                                                                 : i + 2]);
+            }
+
+            batch.BatchMaterial =
+                ResourceRegistry::GetShared(entity->GetMaterialHandle());
+            batch.EntityCount++;
+        }
+        flush();
+    }
+
+    LOG_INFO("Static batching merged {} mesh(es) into {} batch(es)",
+             std::accumulate(batches.begin(), batches.end(), size_t{0},
+                             [](size_t sum, const StaticBatch& b) {
+                                 return sum + b.EntityCount;
+                             }),
+             batches.size());
+    return batches;
+}
+
+}  // namespace Obelisk
@@ -4,15 +4,27 @@
 #include "Obelisk/Input/Keyboard.h"
 #include "Obelisk/Input/Mouse.h"
 #include "Obelisk/ObeliskAPI.h"
+#include "Obelisk/Renderer/DebugDraw.h"
+#include "Obelisk/Renderer/GPUCulling.h"
+#include "Obelisk/Renderer/MaterialLibrary.h"
 #include "Obelisk/Renderer/Mesh.h"
+#include "Obelisk/Renderer/RenderStats.h"
+#include "Obelisk/Renderer/ResourceRegistry.h"
 #include "Obelisk/Renderer/Shader.h"
+#include "Obelisk/Renderer/SpriteBatch.h"
 #include "Obelisk/Renderer/Texture.h"
 #include "Obelisk/Scene/Entity.h"
 
-Obelisk::Entity entity;
 Obelisk::Scene scene;
+Obelisk::Entity entity;
 Obelisk::Camera camera;
 
+// Optional 2D stress test, enabled with "--sprites N"
+size_t spriteCount = 0;
+std::unique_ptr<Obelisk::SpriteBatch> spriteBatch;
+std::shared_ptr<Obelisk::Texture> spriteTexture;
+Obelisk::Camera spriteCamera;
+
 void MyInit() {
     // Create a 3D cube instead of a flat quad
     std::vector<Obelisk::Vertex> meshVertices = {
@@ -89,11 +101,52 @@ void MyInit() {
                                              // Top face
                                              20, 21, 22, 22, 23, 20};
 
-    entity = Obelisk::Entity(
-        std::make_shared<Obelisk::Mesh>(meshVertices, meshIndices),
-        std::make_shared<Obelisk::Shader>("basic.vert", "basic.frag"),
-        std::make_shared<Obelisk::Texture>("Testing.jpg"));
-    scene.AddEntity(&entity);
+    auto cubeMesh = std::make_shared<Obelisk::Mesh>(meshVertices, meshIndices);
+    auto cubeShader = std::make_shared<Obelisk::Shader>(
+        "basic.vert", "basic.frag",
+        std::vector<std::string>{"CLUSTERED_LIGHTING"});
+    auto cubeTexture = std::make_shared<Obelisk::Texture>("Testing.jpg");
+
+    // Entities refer to resources by handle; the registry keeps them alive
+    Obelisk::MeshHandle cube = Obelisk::ResourceRegistry::Add(cubeMesh);
+    Obelisk::MaterialHandle cubeMaterial = Obelisk::ResourceRegistry::Add(
+        Obelisk::MaterialLibrary::Create(cubeShader, {cubeTexture}));
+
+    entity = scene.CreateEntity(cube, cubeMaterial);
+
+    // A floor of flattened cubes that never move. They share the cube's
+    // material, so Finalize() merges them into a few static batches.
+    for (int z = -8; z < 8; z++) {
+        for (int x = -8; x < 8; x++) {
+            Obelisk::Entity tile = scene.CreateEntity(cube, cubeMaterial);
+            tile.GetTransform().SetPosition(x + 0.5f, -1.5f, z + 0.5f);
+            tile.GetTransform().SetScale(0.95f, 0.1f, 0.95f);
+            tile.SetStatic(true);
+        }
+    }
+
+    // A field of pillars around the floor. Their mesh is marked for
+    // impostors, so beyond 20 units each one is drawn as a single quad.
+    // Impostors only scale uniformly, so the pillar shape is in the mesh.
+    std::vector<Obelisk::Vertex> pillarVertices = meshVertices;
+    for (Obelisk::Vertex& vertex : pillarVertices) {
+        vertex.Position.y *= 4.0f;
+    }
+    auto pillarMesh =
+        std::make_shared<Obelisk::Mesh>(pillarVertices, meshIndices);
+    pillarMesh->SetImpostorEnabled(true);
+    Obelisk::MeshHandle pillar = Obelisk::ResourceRegistry::Add(pillarMesh);
+    const int pillarCount = 512;
+    for (int i = 0; i < pillarCount; i++) {
+        // Golden angle spiral spreads the pillars evenly
+        float angle = i * 2.39996f;
+        float distance = 15.0f + 70.0f * std::sqrt((i + 0.5f) / pillarCount);
+        Obelisk::Entity instance = scene.CreateEntity(pillar, cubeMaterial);
+        instance.GetTransform().SetPosition(std::cos(angle) * distance, 0.5f,
+                                            std::sin(angle) * distance);
+        instance.GetTransform().SetRotation(0.0f, i * 37.0f, 0.0f);
+    }
+    scene.SetImpostorDistance(20.0f);
 
     // Position the cube at the origin and give it a slight initial rotation
     entity.GetTransform().SetPosition(0.0f, 0.0f, 0.0f);
@@ -101,6 +154,29 @@ void MyInit() {
         15.0f, 25.0f, 0.0f);  // Slight initial rotation to show 3D structure
     entity.GetTransform().SetScale(1.0f, 1.0f, 1.0f);
 
+    // A small cube attached to the big one, which carries it around as it
+    // rotates
+    Obelisk::Entity moon = scene.CreateEntity(cube, cubeMaterial);
+    moon.SetParent(entity);
+    moon.GetTransform().SetPosition(1.2f, 0.0f, 0.0f);
+    moon.GetTransform().SetScale(0.3f, 0.3f, 0.3f);
+
+    // A ring of colored point lights around the cube
+    const glm::vec3 lightColors[] = {{1.0f, 0.3f, 0.3f},
+                                     {0.3f, 1.0f, 0.3f},
+                                     {0.3f, 0.3f, 1.0f},
+                                     {1.0f, 1.0f, 0.6f}};
+    for (int i = 0; i < 4; i++) {
+        float angle = glm::radians(90.0f * i + 45.0f);
+        Obelisk::PointLight light;
+        light.Position =
+            glm::vec3(std::cos(angle), 0.8f, std::sin(angle)) * 2.0f;
+        light.Radius = 6.0f;
+        light.Color = lightColors[i];
+        light.Intensity = 1.5f;
+        scene.AddLight(light);
+    }
+
     // Camera setup and demonstration
     camera.SetPosition(
         glm::vec3(0.0f, 0.0f, 3.0f));        // Position camera 3 units back
@@ -116,6 +192,43 @@ void MyInit() {
     // Set the window's scene and camera for proper 3D rendering
     Obelisk::ObeliskAPI::Get().GetWindow()->SetScene(&scene);
     scene.SetCamera(&camera);
+    scene.Finalize(8.0f);
+
+    if (spriteCount > 0) {
+        spriteBatch = std::make_unique<Obelisk::SpriteBatch>();
+        spriteTexture = std::make_shared<Obelisk::Texture>("Testing.jpg");
+
+        spriteCamera.SetProjectionType(
+            Obelisk::Camera::ProjectionType::Orthographic);
+        spriteCamera.SetAspectRatio(16.0f / 9.0f);
+        spriteCamera.SetOrthographicSize(100.0f);
+        spriteCamera.SetPosition(glm::vec3(0.0f, 0.0f, 1.0f));
+    }
+}
+
+void MyRender(const Obelisk::RenderSnapshot& snapshot) {
+    if (!spriteBatch) {
+        return;
+    }
+
+    // Spinning sprites on a square grid covering the view. Runs on the
+    // render thread when pipelined, so the time comes from the frame drawn.
+    float time = snapshot.TotalTime;
+    auto columns = static_cast<size_t>(std::ceil(std::sqrt(spriteCount)));
+    float spacing = 200.0f / columns;
+
+    spriteBatch->Begin(spriteCamera);
+    Obelisk::Sprite sprite;
+    sprite.Size = glm::vec2(spacing * 0.8f);
+    for (size_t i = 0; i < spriteCount; i++) {
+        float column = static_cast<float>(i % columns);
+        float row = static_cast<float>(i / columns);
+        sprite.Position = glm::vec2(column, row) * spacing - 100.0f;
+        sprite.Rotation = time * 90.0f + i;
+        sprite.Tint = glm::vec4(column / columns, row / columns, 1.0f, 1.0f);
+        spriteBatch->Draw(*spriteTexture, sprite);
+    }
+    spriteBatch->End();
 }
 
 void MyUpdate() {
@@ -191,21 +304,102 @@ void MyUpdate() {
     entity.GetTransform().SetRotation(cubeRotation * 0.7f, cubeRotation,
                                       cubeRotation * 0.5f);
 
+    // F3 toggles light and bounds visualization (debug builds only)
+    static bool showDebug = false;
+    if (Obelisk::Keyboard::IsKeyPressed(OB_KEY_F3)) {
+        showDebug = !showDebug;
+    }
+    if (showDebug) {
+        for (const auto& light : scene.GetLights()) {
+            Obelisk::DebugDraw::Sphere(light.Position, light.Radius,
+                                       glm::vec4(light.Color, 1.0f));
+        }
+        Obelisk::DebugDraw::Box(
+            Obelisk::AABB(glm::vec3(-0.5f), glm::vec3(0.5f)),
+            entity.GetTransform().GetModelMatrix(),
+            glm::vec4(0.0f, 1.0f, 0.0f, 1.0f), false);
+        Obelisk::DebugDraw::Text(glm::vec3(-0.5f, 0.8f, 0.0f), "CUBE", 0.15f);
+    }
+
     // Log frame rate occasionally for performance monitoring
     static float lastFPSLogTime = 0.0f;
     if (Obelisk::Time::HasIntervalPassed(2.0f, lastFPSLogTime)) {
-        LOG_INFO("Performance: {:.1f} FPS, {:.2f}ms frame time, {:.1f} avg FPS",
-                 Obelisk::Time::GetFPS(), Obelisk::Time::GetFrameTimeMS(),
-                 Obelisk::Time::GetAverageFPS());
+        LOG_INFO(
+            "Performance: {:.1f} FPS, {:.2f}ms frame time, {:.2f}ms GPU, "
+            "{:.1f} avg FPS",
+            Obelisk::Time::GetFPS(), Obelisk::Time::GetFrameTimeMS(),
+            Obelisk::Time::GetGPUFrameTimeMS(), Obelisk::Time::GetAverageFPS());
+
+        Obelisk::RenderStats stats = Obelisk::RenderStatistics::GetAverage(60);
+        LOG_INFO(
+            "Rendering: {} draws, {} triangles, {} binds, {} KiB streamed, "
+            "{} culled",
+            stats.DrawCalls, stats.Triangles,
+            stats.ProgramBinds + stats.VertexArrayBinds + stats.TextureBinds,
+            stats.BytesStreamed / 1024,
+            stats.BatchesCulled + stats.EntitiesCulled);
     }
 }
 
-int main() {
+int main(int argc, char** argv) {
+    // "--headless" renders offscreen (e.g. on CI), "--frames N" exits after N,
+    // "--capture file" records the GL stream for ObeliskReplay, "--sprites N"
+    // draws N batched sprites on top of the scene, "--pipelined" renders on a
+    // separate thread, "--stats file" writes per-frame render stats as CSV,
+    // "--cpu-culling" keeps culling on the CPU even where compute is available
+    auto backend = Obelisk::WindowBackend::Windowed;
+    size_t frameLimit = 0;
+    std::string capturePath;
+    std::string statsPath;
+    for (int i = 1; i < argc; i++) {
+        std::string_view arg = argv[i];
+        if (arg == "--headless") {
+            backend = Obelisk::WindowBackend::Headless;
+        } else if (arg == "--frames" && i + 1 < argc) {
+            frameLimit = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--capture" && i + 1 < argc) {
+            capturePath = argv[++i];
+        } else if (arg == "--sprites" && i + 1 < argc) {
+            spriteCount = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--stats" && i + 1 < argc) {
+            statsPath = argv[++i];
+        } else if (arg == "--pipelined") {
+            Obelisk::ObeliskAPI::Get().SetPipelined(true);
+        } else if (arg == "--cpu-culling") {
+            Obelisk::GPUCulling::SetEnabled(false);
+        }
+    }
+
+    if (!capturePath.empty()) {
+        Obelisk::ObeliskAPI::Get().SetCapture(
+            capturePath, frameLimit > 0 ? frameLimit : 120);
+    }
+
+    // A headless run has no close button, so never let it run forever
+    if (backend == Obelisk::WindowBackend::Headless && frameLimit == 0) {
+        frameLimit = 600;
+    }
+
     Obelisk::ObeliskAPI::Get().SetUpdateCallback(MyUpdate);
     Obelisk::ObeliskAPI::Get().SetInitCallback(MyInit);
+    Obelisk::ObeliskAPI::Get().SetRenderCallback(MyRender);
 
-    Obelisk::ObeliskAPI::Get().Init();
+    if (!Obelisk::ObeliskAPI::Get().Init(1280, 720, "Heroes of Colossus",
+                                         backend)) {
+        Obelisk::ObeliskAPI::Get().Shutdown();
+        return 1;
+    }
+    Obelisk::ObeliskAPI::Get().GetWindow()->SetFrameLimit(frameLimit);
     Obelisk::ObeliskAPI::Get().Run();
+
+    if (!statsPath.empty()) {
+        Obelisk::RenderStatistics::WriteCSV(statsPath);
+    }
+
+    // GL objects must be released while the context exists
+    spriteBatch.reset();
+    spriteTexture.reset();
+
     Obelisk::ObeliskAPI::Get().Shutdown();
 
     return 0;
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include <chrono>
+
+namespace ObeliskBench {
+
+/**
+ * @brief Time a function over several iterations.
+ *
+ * One untimed iteration runs first to warm caches and allocations.
+ *
+ * @param iterations Timed iterations
+ * @param function Work to time
+ * @return Average milliseconds per iteration
+ */
+template <typename Function>
+double Measure(size_t iterations, Function&& function) {
+    function();
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; i++) {
+        function();
+    }
+    std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return elapsed.count() / static_cast<double>(iterations);
+}
+
+/**
+ * @brief Compare per-object Transform matrices with TransformStorage.
+ *
+ * @param count Number of transforms
+ * @param iterations Timed iterations per variant
+ */
+void RunTransformBenchmarks(size_t count, size_t iterations);
+
+/**
+ * @brief Time hierarchy propagation when nothing, one root or every root
+ * moves.
+ *
+ * @param count Number of transforms, grouped into small trees
+ * @param iterations Timed iterations per variant
+ */
+void RunHierarchyBenchmarks(size_t count, size_t iterations);
+
+/**
+ * @brief Compare AABBTree queries with linear scans over the same boxes,
+ * and time moving every box.
+ *
+ * @param count Number of boxes
+ * @param iterations Timed iterations per variant
+ */
+void RunSpatialBenchmarks(size_t count, size_t iterations);
+
+/**
+ * @brief Time rebuilding a SpatialHashGrid over points that all move, and
+ * radius queries around some of them.
+ *
+ * @param count Number of points
+ * @param iterations Timed iterations per variant
+ */
+void RunGridBenchmarks(size_t count, size_t iterations);
+
+/**
+ * @brief Compare building a scene entity by entity with loading the same
+ * scene from a SceneFile.
+ *
+ * @param count Number of entities
+ * @param iterations Timed iterations per variant, at most 10
+ */
+void RunSceneBenchmarks(size_t count, size_t iterations);
+
+}  // namespace ObeliskBench
@@ -0,0 +1,65 @@
+#include <filesystem>
+#include <random>
+#include "Benchmarks.h"
+#include "Obelisk/Scene/Scene.h"
+#include "Obelisk/Scene/SceneFile.h"
+
+namespace ObeliskBench {
+
+void RunSceneBenchmarks(size_t count, size_t iterations) {
+    // Scattered entities, one in four static and one in eight attached to
+    // the entity before it, like props placed in a level
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+    std::vector<glm::vec3> positions(count);
+    for (glm::vec3& value : positions) {
+        value = glm::vec3(position(random), position(random), position(random));
+    }
+    auto build = [&](Obelisk::Scene& scene) {
+        Obelisk::Entity previous;
+        for (size_t i = 0; i < count; i++) {
+            Obelisk::Entity entity = scene.CreateEntity();
+            entity.GetTransform().SetPosition(positions[i]);
+            entity.GetTransform().SetRotation(0.0f, positions[i].x, 0.0f);
+            entity.SetStatic(i % 4 == 0);
+            if (i % 8 == 7) {
+                entity.SetParent(previous);
+            }
+            previous = entity;
+        }
+    };
+
+    Obelisk::Scene source;
+    build(source);
+    std::filesystem::path path = std::filesystem::temp_directory_path() /
+                                 (std::string("ObeliskBench") +
+                                  Obelisk::SCENE_FILE_EXTENSION);
+    Obelisk::SceneResources resources;
+    if (!Obelisk::SceneFile::Write(source, path, resources)) {
+        return;
+    }
+
+    // Loading is slow enough that a few iterations suffice
+    iterations = std::min<size_t>(iterations, 10);
+    double create = Measure(iterations, [&]() {
+        Obelisk::Scene scene;
+        build(scene);
+    });
+    double load = Measure(iterations, [&]() {
+        Obelisk::Scene scene;
+        Obelisk::SceneFile file;
+        if (file.Open(path)) {
+            file.Instantiate(scene, resources);
+        }
+    });
+
+    double megabytes =
+        static_cast<double>(std::filesystem::file_size(path)) / (1 << 20);
+    LOG_INFO("Scene create / load           {:8.3f} / {:.3f} ms", create,
+             load);
+    LOG_INFO("Scene file {:.1f} MB, loaded at {:.0f} MB/s", megabytes,
+             megabytes / (load / 1000.0));
+    std::filesystem::remove(path);
+}
+
+}  // namespace ObeliskBench
@@ -0,0 +1,177 @@
+#include <cmath>
+#include <random>
+#include "Benchmarks.h"
+#include "Obelisk/Core/AABBArray.h"
+#include "Obelisk/Core/Frustum.h"
+#include "Obelisk/Scene/AABBTree.h"
+#include "Obelisk/Scene/SpatialHashGrid.h"
+
+namespace ObeliskBench {
+
+void RunSpatialBenchmarks(size_t count, size_t iterations) {
+    // Boxes of 0.5 to 2 units, spread so that density stays the same for
+    // any count
+    float extent = 4.0f * std::cbrt(static_cast<float>(count));
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> position(-extent, extent);
+    std::uniform_real_distribution<float> size(0.25f, 1.0f);
+    std::vector<Obelisk::AABB> boxes(count);
+    for (Obelisk::AABB& box : boxes) {
+        glm::vec3 center(position(random), position(random), position(random));
+        glm::vec3 halfSize(size(random), size(random), size(random));
+        box = Obelisk::AABB(center - halfSize, center + halfSize);
+    }
+
+    Obelisk::AABBTree tree;
+    std::vector<uint32_t> proxies(count);
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < count; i++) {
+        proxies[i] = tree.Insert({i, 0}, boxes[i]);
+    }
+    std::chrono::duration<double, std::milli> build =
+        std::chrono::steady_clock::now() - start;
+
+    // A camera at the center looking along +X, seeing a few percent of
+    // the boxes
+    Obelisk::Frustum frustum(
+        glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f,
+                         extent * 0.5f) *
+        glm::lookAt(glm::vec3(0.0f), glm::vec3(1.0f, 0.0f, 0.0f),
+                    glm::vec3(0.0f, 1.0f, 0.0f)));
+    size_t hits = 0;
+    double frustumLinear = Measure(iterations, [&]() {
+        for (const Obelisk::AABB& box : boxes) {
+            hits += frustum.Intersects(box);
+        }
+    });
+    double frustumTree = Measure(iterations, [&]() {
+        tree.QueryFrustum(frustum, [&](Obelisk::EntityID id) {
+            hits += frustum.Intersects(boxes[id.Index]);
+            return true;
+        });
+    });
+
+    const glm::vec3 center(0.0f);
+    const float radius = 10.0f;
+    double sphereLinear = Measure(iterations, [&]() {
+        for (const Obelisk::AABB& box : boxes) {
+            glm::vec3 offset = center - glm::clamp(center, box.Min, box.Max);
+            hits += glm::dot(offset, offset) <= radius * radius;
+        }
+    });
+    double sphereTree = Measure(iterations, [&]() {
+        tree.QuerySphere(center, radius, [&](Obelisk::EntityID) {
+            hits++;
+            return true;
+        });
+    });
+
+    Obelisk::Ray ray(glm::vec3(0.0f), glm::normalize(glm::vec3(1.0f)));
+    float closest = 0.0f;
+    double rayLinear = Measure(iterations, [&]() {
+        closest = extent * 4.0f;
+        for (const Obelisk::AABB& box : boxes) {
+            float distance;
+            if (ray.Intersects(box, closest, distance)) {
+                closest = distance;
+            }
+        }
+    });
+    Obelisk::AABBArray packed;
+    packed.Resize(count);
+    for (size_t i = 0; i < count; i++) {
+        packed.Set(i, boxes[i]);
+    }
+    double rayPackets = Measure(iterations, [&]() {
+        closest = extent * 4.0f;
+        packed.Raycast(ray, closest, [&](uint32_t, float distance) {
+            closest = distance;
+            return distance;
+        });
+    });
+    double rayTree = Measure(iterations, [&]() {
+        closest = extent * 4.0f;
+        tree.Raycast(ray, closest,
+                     [&](Obelisk::EntityID id, float maxDistance) {
+                         float distance;
+                         if (!ray.Intersects(boxes[id.Index], maxDistance,
+                                             distance)) {
+                             return maxDistance;
+                         }
+                         closest = distance;
+                         return distance;
+                     });
+    });
+
+    // Every box jitters a little and one in a hundred jumps elsewhere, like
+    // a scene of mostly idle entities
+    std::uniform_real_distribution<float> jitter(-0.05f, 0.05f);
+    size_t reinserted = 0;
+    double move = Measure(iterations, [&]() {
+        for (uint32_t i = 0; i < count; i++) {
+            glm::vec3 offset(jitter(random), jitter(random), jitter(random));
+            if (i % 100 == 0) {
+                offset.x = position(random) - boxes[i].GetCenter().x;
+            }
+            boxes[i] = Obelisk::AABB(boxes[i].Min + offset,
+                                     boxes[i].Max + offset);
+            reinserted += tree.Move(proxies[i], boxes[i]);
+        }
+    });
+
+    LOG_INFO("AABBTree build                {:8.3f} ms (height {})",
+             build.count(), tree.GetHeight());
+    LOG_INFO("Frustum, linear / tree        {:8.3f} / {:.3f} ms", frustumLinear,
+             frustumTree);
+    LOG_INFO("Sphere, linear / tree         {:8.3f} / {:.3f} ms", sphereLinear,
+             sphereTree);
+    LOG_INFO("Raycast, linear/packets/tree  {:8.3f} / {:.3f} / {:.3f} ms ({})",
+             rayLinear, rayPackets, rayTree,
+             Obelisk::AABBArray::GetKernelName());
+    LOG_INFO("AABBTree move all             {:8.3f} ms ({} re-inserted)", move,
+             reinserted / (iterations + 1));
+    LOG_TRACE("Checksum {} {}", hits, closest);
+}
+
+void RunGridBenchmarks(size_t count, size_t iterations) {
+    // About one point per cubic unit, every one drifting each frame
+    float extent = 0.5f * std::cbrt(static_cast<float>(count));
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> position(-extent, extent);
+    std::uniform_real_distribution<float> velocity(-0.05f, 0.05f);
+    std::vector<glm::vec3> points(count);
+    std::vector<glm::vec3> velocities(count);
+    for (size_t i = 0; i < count; i++) {
+        points[i] = glm::vec3(position(random), position(random),
+                              position(random));
+        velocities[i] = glm::vec3(velocity(random), velocity(random),
+                                  velocity(random));
+    }
+
+    Obelisk::SpatialHashGrid grid(1.0f);
+    double rebuild = Measure(iterations, [&]() {
+        for (size_t i = 0; i < count; i++) {
+            points[i] += velocities[i];
+        }
+        grid.Build(points);
+    });
+
+    // Neighbors of a fixed sample of the points, as a collision pass would
+    // look them up
+    const size_t queries = std::min<size_t>(count, 10000);
+    const size_t stride = count / queries;
+    uint32_t buffer[256];
+    size_t found = 0;
+    double query = Measure(iterations, [&]() {
+        for (size_t i = 0; i < queries; i++) {
+            found += grid.QueryRadius(points[i * stride], 1.0f, buffer).size();
+        }
+    });
+
+    LOG_INFO("HashGrid move and rebuild     {:8.3f} ms", rebuild);
+    LOG_INFO("HashGrid {} radius queries {:8.3f} ms ({:.1f} found each)",
+             queries, query,
+             static_cast<double>(found) / (queries * (iterations + 1)));
+}
+
+}  // namespace ObeliskBench
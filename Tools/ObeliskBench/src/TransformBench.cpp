@@ -0,0 +1,108 @@
+#include <random>
+#include "Benchmarks.h"
+#include "Obelisk/Components/TransformStorage.h"
+#include "Obelisk/Core/JobSystem.h"
+
+namespace ObeliskBench {
+
+void RunTransformBenchmarks(size_t count, size_t iterations) {
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> distribution(-100.0f, 100.0f);
+    std::vector<glm::vec3> positions(count);
+    for (glm::vec3& position : positions) {
+        position = glm::vec3(distribution(random), distribution(random),
+                             distribution(random));
+    }
+
+    // Every variant moves every object, then builds all matrices, like a
+    // scene where everything is animated
+    float checksum = 0.0f;
+
+    std::vector<Obelisk::Transform> objects(count);
+    double perObject = Measure(iterations, [&]() {
+        for (size_t i = 0; i < count; i++) {
+            objects[i].SetPosition(positions[i]);
+            objects[i].SetRotation(glm::vec3(positions[i].x, 0.0f, 0.0f));
+            checksum += objects[i].GetModelMatrix()[3][0];
+        }
+    });
+
+    Obelisk::TransformStorage storage;
+    for (size_t i = 0; i < count; i++) {
+        storage.Emplace({static_cast<uint32_t>(i), 0});
+    }
+    auto update = [&]() {
+        for (uint32_t slot = 0; slot < count; slot++) {
+            storage.SetPosition(slot, positions[slot]);
+            storage.SetRotation(
+                slot, glm::quat(glm::radians(
+                          glm::vec3(positions[slot].x, 0.0f, 0.0f))));
+        }
+        storage.UpdateMatrices();
+        checksum += storage.GetMatrices()[0][3][0];
+    };
+    double parallel = Measure(iterations, update);
+
+    // Same kernel on the calling thread only
+    Obelisk::JobSystem::Shutdown();
+    double serial = Measure(iterations, update);
+    Obelisk::JobSystem::Initialize();
+
+    LOG_INFO("Transform::GetModelMatrix     {:8.3f} ms", perObject);
+    LOG_INFO("TransformStorage ({}, 1 thread) {:8.3f} ms ({:.1f}x)",
+             Obelisk::TransformStorage::GetKernelName(), serial,
+             perObject / serial);
+    LOG_INFO("TransformStorage ({}, jobs)     {:8.3f} ms ({:.1f}x)",
+             Obelisk::TransformStorage::GetKernelName(), parallel,
+             perObject / parallel);
+    LOG_TRACE("Checksum {}", checksum);
+}
+
+void RunHierarchyBenchmarks(size_t count, size_t iterations) {
+    // Trees of a root with three children, each with three children
+    const uint32_t treeSize = 13;
+    Obelisk::TransformStorage storage;
+    std::vector<uint32_t> roots;
+    for (uint32_t i = 0; i < count; i++) {
+        storage.Emplace({i, 0}).SetPosition(1.0f, 0.0f, 0.0f);
+        uint32_t member = i % treeSize;
+        if (member == 0) {
+            roots.push_back(i);
+        } else {
+            uint32_t parent = member <= 3 ? 0 : (member - 4) / 3 + 1;
+            storage.SetParent({i, 0}, {i - member + parent, 0});
+        }
+    }
+    storage.UpdateMatrices();
+
+    float checksum = 0.0f;
+    float angle = 0.0f;
+    double idle = Measure(iterations, [&]() {
+        storage.UpdateMatrices();
+        checksum += storage.GetMatrices()[0][3][0];
+    });
+    double oneRoot = Measure(iterations, [&]() {
+        angle += 1.0f;
+        storage.Get({roots[0], 0}).SetRotation(0.0f, angle, 0.0f);
+        storage.UpdateMatrices();
+        checksum += storage.GetMatrices()[0][3][0];
+    });
+    double allRoots = Measure(iterations, [&]() {
+        angle += 1.0f;
+        for (uint32_t root : roots) {
+            storage.Get({root, 0}).SetRotation(0.0f, angle, 0.0f);
+        }
+        storage.UpdateMatrices();
+        checksum += storage.GetMatrices()[0][3][0];
+    });
+
+    LOG_INFO("Hierarchy ({} trees), idle       {:8.3f} ms", roots.size(),
+             idle);
+    LOG_INFO("Hierarchy ({} trees), one root   {:8.3f} ms", roots.size(),
+             oneRoot);
+    LOG_INFO("Hierarchy ({} trees), all roots  {:8.3f} ms", roots.size(),
+             allRoots);
+    LOG_TRACE("Checksum {}", checksum);
+}
+
+}  // namespace ObeliskBench
@@ -0,0 +1,49 @@
+#include <charconv>
+#include <string_view>
+#include "Benchmarks.h"
+#include "Obelisk/Core/JobSystem.h"
+
+namespace {
+void PrintUsage() {
+    LOG_INFO("Usage: ObeliskBench [--count N] [--iterations N]");
+}
+
+bool ParseCount(std::string_view text, size_t& value) {
+    auto [end, error] =
+        std::from_chars(text.data(), text.data() + text.size(), value);
+    return error == std::errc() && end == text.data() + text.size() &&
+           value > 0;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+    size_t count = 100000;
+    size_t iterations = 100;
+
+    for (int i = 1; i < argc; i++) {
+        std::string_view arg = argv[i];
+        bool valid = i + 1 < argc;
+        if (valid && arg == "--count") {
+            valid = ParseCount(argv[++i], count);
+        } else if (valid && arg == "--iterations") {
+            valid = ParseCount(argv[++i], iterations);
+        } else {
+            valid = false;
+        }
+
+        if (!valid) {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    LOG_INFO("{} items, {} iterations", count, iterations);
+    Obelisk::JobSystem::Initialize();
+    ObeliskBench::RunTransformBenchmarks(count, iterations);
+    ObeliskBench::RunHierarchyBenchmarks(count, iterations);
+    ObeliskBench::RunSpatialBenchmarks(count, iterations);
+    ObeliskBench::RunGridBenchmarks(count, iterations);
+    ObeliskBench::RunSceneBenchmarks(count, iterations);
+    Obelisk::JobSystem::Shutdown();
+    return 0;
+}
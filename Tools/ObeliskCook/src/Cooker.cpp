@@ -0,0 +1,330 @@
+#include "Cooker.h"
+#include <algorithm>
+#include <cctype>
+#include <format>
+#include <fstream>
+#include <sstream>
+#include "MeshCooker.h"
+#include "Obelisk/Core/AssetManager.h"
+#include "Obelisk/Core/Hash.h"
+#include "Obelisk/Core/JobSystem.h"
+#include "Obelisk/Renderer/CookedFormat.h"
+#include "Obelisk/Renderer/GLExtensions.h"
+#include "Obelisk/Renderer/ShaderPreprocessor.h"
+#include "Obelisk/Renderer/Window.h"
+#include "TextureCooker.h"
+
+using Obelisk::Hash;
+
+namespace ObeliskCook {
+
+namespace {
+// Bump whenever the cooker's output changes for the same input
+constexpr uint64_t COOK_VERSION = 1;
+
+bool ReadFile(const std::filesystem::path& path, std::string& contents) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    contents = buffer.str();
+    return true;
+}
+
+GLenum GetShaderStage(const std::filesystem::path& path) {
+    std::string extension = path.extension().string();
+    if (extension == ".vert") return GL_VERTEX_SHADER;
+    if (extension == ".frag") return GL_FRAGMENT_SHADER;
+    return GL_COMPUTE_SHADER;
+}
+
+/**
+ * @brief Get the number of a `#version` directive, or 0 if there is none.
+ */
+int GetGLSLVersion(const std::string& source) {
+    size_t position = source.find("#version");
+    if (position == std::string::npos) {
+        return 0;
+    }
+    return std::atoi(source.c_str() + position + 8);
+}
+}  // namespace
+
+Cooker::Cooker(std::filesystem::path source, std::filesystem::path output,
+               CookOptions options)
+    : m_SourceDirectory(std::move(source)),
+      m_OutputDirectory(std::move(output)),
+      m_Options(options) {}
+
+bool Cooker::Run() {
+    if (!std::filesystem::is_directory(m_SourceDirectory)) {
+        LOG_ERROR("Source directory not found: {}", m_SourceDirectory.string());
+        return false;
+    }
+    std::filesystem::create_directories(m_OutputDirectory);
+
+    // Shader includes resolve against the sources, not the output
+    Obelisk::AssetManager::Initialize(m_SourceDirectory);
+    if (!m_Options.Force) {
+        LoadManifest();
+    }
+
+    std::vector<Job> jobs;
+    for (const auto& entry :
+         std::filesystem::recursive_directory_iterator(m_SourceDirectory)) {
+        if (entry.is_regular_file()) {
+            std::string path = std::filesystem::relative(entry.path(),
+                                                         m_SourceDirectory)
+                                   .generic_string();
+            jobs.push_back({path, Classify(entry.path()), 0, false});
+        }
+    }
+
+    // Hash everything and keep the sources that changed since the last cook
+    std::vector<size_t> dirtyFiles;
+    std::vector<size_t> dirtyShaders;
+    for (size_t i = 0; i < jobs.size(); i++) {
+        Job& job = jobs[i];
+        job.Hash = HashSource(job);
+
+        auto entry = m_Manifest.find(job.Path);
+        bool upToDate = job.Hash != 0 && entry != m_Manifest.end() &&
+                        entry->second == job.Hash;
+        for (const auto& output : GetOutputs(job)) {
+            upToDate = upToDate && std::filesystem::exists(output);
+        }
+        if (upToDate) {
+            job.Succeeded = true;
+        } else if (job.Type == AssetType::Shader) {
+            dirtyShaders.push_back(i);
+        } else {
+            dirtyFiles.push_back(i);
+        }
+    }
+
+    LOG_INFO("{} asset(s), {} out of date", jobs.size(),
+             dirtyFiles.size() + dirtyShaders.size());
+
+    // Image decoding and compression dominate, so spread them over cores
+    Obelisk::JobSystem::Initialize();
+    Obelisk::JobSystem::ParallelFor(
+        dirtyFiles.size(), 1, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                Job& job = jobs[dirtyFiles[i]];
+                job.Succeeded = CookFile(job);
+            }
+        });
+    Obelisk::JobSystem::Shutdown();
+
+    // Shaders compile on this thread, which owns the context
+    Obelisk::Window window;
+    if (!dirtyShaders.empty() && m_Options.CompileShaders) {
+        m_HasContext = window.Create(1, 1, "ObeliskCook",
+                                     Obelisk::WindowBackend::Headless) >= 0;
+        if (!m_HasContext) {
+            LOG_WARN("No headless OpenGL context; shaders are only "
+                     "preprocessed, not compiled");
+        }
+    }
+    for (size_t i : dirtyShaders) {
+        jobs[i].Succeeded = CookShader(jobs[i]);
+    }
+
+    // Failed sources leave the manifest so the next run retries them
+    m_Manifest.clear();
+    size_t failed = 0;
+    for (const Job& job : jobs) {
+        if (job.Succeeded) {
+            m_Manifest[job.Path] = job.Hash;
+        } else {
+            failed++;
+        }
+    }
+    SaveManifest();
+
+    if (failed > 0) {
+        LOG_ERROR("{} asset(s) failed to cook", failed);
+        return false;
+    }
+    LOG_INFO("Cooked {} asset(s) into {}",
+             dirtyFiles.size() + dirtyShaders.size(),
+             m_OutputDirectory.string());
+    return true;
+}
+
+Cooker::AssetType Cooker::Classify(const std::filesystem::path& path) {
+    std::string extension = path.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return std::tolower(c); });
+
+    if (extension == ".png" || extension == ".jpg" || extension == ".jpeg" ||
+        extension == ".bmp" || extension == ".tga") {
+        return AssetType::Texture;
+    }
+    if (extension == ".obj") {
+        return AssetType::Mesh;
+    }
+    if (extension == ".vert" || extension == ".frag" || extension == ".comp") {
+        return AssetType::Shader;
+    }
+    return AssetType::Copy;
+}
+
+std::vector<std::filesystem::path> Cooker::GetOutputs(const Job& job) const {
+    std::filesystem::path output = m_OutputDirectory / job.Path;
+    switch (job.Type) {
+        case AssetType::Texture:
+            return {output,
+                    output.string() + Obelisk::COOKED_TEXTURE_EXTENSION};
+        case AssetType::Mesh:
+            return {output.string() + Obelisk::COOKED_MESH_EXTENSION};
+        case AssetType::Shader:
+        case AssetType::Copy:
+            break;
+    }
+    return {output};
+}
+
+uint64_t Cooker::HashSource(const Job& job) const {
+    std::string contents;
+    if (job.Type == AssetType::Shader) {
+        // Covers every included file as well
+        std::filesystem::path path = std::filesystem::relative(
+            m_SourceDirectory / job.Path, m_SourceDirectory / "shaders");
+        contents = Obelisk::ShaderPreprocessor::Process(path.generic_string(),
+                                                        {});
+        if (contents.empty()) {
+            return 0;
+        }
+    } else if (!ReadFile(m_SourceDirectory / job.Path, contents)) {
+        return 0;
+    }
+
+    uint64_t hash = Hash::FNV1a(contents);
+    hash = Hash::Combine(hash, COOK_VERSION);
+    hash = Hash::Combine(hash, Obelisk::COOKED_FORMAT_VERSION);
+    if (job.Type == AssetType::Texture) {
+        hash = Hash::Combine(hash, m_Options.Compress ? 1 : 0);
+    }
+    return hash;
+}
+
+bool Cooker::CookFile(const Job& job) const {
+    std::filesystem::path source = m_SourceDirectory / job.Path;
+    std::filesystem::path output = m_OutputDirectory / job.Path;
+    std::error_code error;
+    std::filesystem::create_directories(output.parent_path(), error);
+
+    if (job.Type == AssetType::Mesh) {
+        LOG_TRACE("Cooking mesh {}", job.Path);
+        return MeshCooker::Cook(
+            source, output.string() + Obelisk::COOKED_MESH_EXTENSION);
+    }
+
+    // Textures keep their source next to the blob as the fallback for
+    // contexts without S3TC
+    std::filesystem::copy_file(
+        source, output, std::filesystem::copy_options::overwrite_existing,
+        error);
+    if (error) {
+        LOG_ERROR("Failed to copy {}: {}", job.Path, error.message());
+        return false;
+    }
+
+    if (job.Type == AssetType::Texture) {
+        LOG_TRACE("Cooking texture {}", job.Path);
+        return TextureCooker::Cook(
+            source, output.string() + Obelisk::COOKED_TEXTURE_EXTENSION,
+            m_Options.Compress);
+    }
+    return true;
+}
+
+bool Cooker::CookShader(const Job& job) const {
+    LOG_TRACE("Validating shader {}", job.Path);
+
+    // HashSource() already ran the preprocessor, so this hits its cache
+    std::filesystem::path path = std::filesystem::relative(
+        m_SourceDirectory / job.Path, m_SourceDirectory / "shaders");
+    std::string source =
+        Obelisk::ShaderPreprocessor::Process(path.generic_string(), {});
+    if (source.empty()) {
+        LOG_ERROR("{}: file or one of its includes could not be read",
+                  job.Path);
+        return false;
+    }
+    if (GetGLSLVersion(source) == 0) {
+        LOG_ERROR("{}: missing #version directive", job.Path);
+        return false;
+    }
+    if (m_HasContext && !CompileShader(job, source)) {
+        return false;
+    }
+
+    std::filesystem::path output = m_OutputDirectory / job.Path;
+    std::error_code error;
+    std::filesystem::create_directories(output.parent_path(), error);
+    std::filesystem::copy_file(
+        m_SourceDirectory / job.Path, output,
+        std::filesystem::copy_options::overwrite_existing, error);
+    if (error) {
+        LOG_ERROR("Failed to copy {}: {}", job.Path, error.message());
+        return false;
+    }
+    return true;
+}
+
+bool Cooker::CompileShader(const Job& job, const std::string& source) const {
+    int version = GetGLSLVersion(source);
+    if (!Obelisk::GLExtensions::IsVersionAtLeast(version / 100,
+                                                 version % 100 / 10)) {
+        LOG_WARN("{}: GLSL {} is newer than the cooking context; skipped "
+                 "compilation",
+                 job.Path, version);
+        return true;
+    }
+
+    GLuint shader = glCreateShader(GetShaderStage(job.Path));
+    const char* text = source.c_str();
+    glShaderSource(shader, 1, &text, nullptr);
+    glCompileShader(shader);
+
+    GLint success = 0;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    if (!success) {
+        GLint length = 0;
+        glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &length);
+        std::string log(std::max(length, 1), '\0');
+        glGetShaderInfoLog(shader, length, nullptr, log.data());
+        LOG_ERROR("{} failed to compile:\n{}", job.Path, log);
+    }
+    glDeleteShader(shader);
+    return success != 0;
+}
+
+void Cooker::LoadManifest() {
+    std::ifstream file(m_OutputDirectory / MANIFEST_NAME);
+    std::string line;
+    while (std::getline(file, line)) {
+        size_t space = line.find(' ');
+        if (space == std::string::npos) {
+            continue;
+        }
+        m_Manifest[line.substr(space + 1)] =
+            std::strtoull(line.c_str(), nullptr, 16);
+    }
+}
+
+void Cooker::SaveManifest() const {
+    std::ofstream file(m_OutputDirectory / MANIFEST_NAME, std::ios::trunc);
+    for (const auto& [path, hash] : m_Manifest) {
+        file << std::format("{:016x} {}\n", hash, path);
+    }
+    if (!file) {
+        LOG_WARN("Failed to write the cook manifest");
+    }
+}
+
+}  // namespace ObeliskCook
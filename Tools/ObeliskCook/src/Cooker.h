@@ -0,0 +1,138 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include <filesystem>
+#include <map>
+
+namespace ObeliskCook {
+
+/**
+ * @brief Options controlling a cook.
+ */
+struct CookOptions {
+        bool Compress = true;        ///< Compress opaque textures to BC1
+        bool CompileShaders = true;  ///< Compile shaders in a headless context
+        bool Force = false;          ///< Ignore the manifest, cook everything
+};
+
+/**
+ * @brief Cooks an asset tree into a runtime asset tree, incrementally.
+ *
+ * Every file below the source directory is mirrored into the output
+ * directory according to its type:
+ * - images (png, jpg, jpeg, bmp, tga) are copied and cooked into a `.otex`
+ *   blob next to the copy (see TextureCooker)
+ * - OBJ models are cooked into a `.omesh` blob (see MeshCooker)
+ * - shaders (vert, frag, comp) are preprocessed and, when a headless context
+ *   can be created, compiled to validate them; then they are copied
+ * - anything else is copied
+ *
+ * A manifest in the output directory records a content hash per source.
+ * Shaders hash their preprocessed source, so editing an included file
+ * recooks every shader that includes it. Hashes also cover the cooked format
+ * version and the options that change the output. Sources whose hash and
+ * outputs are unchanged are skipped; textures and meshes are cooked in
+ * parallel on the JobSystem.
+ *
+ * @example
+ * ```cpp
+ * Cooker cooker("assets", "build/assets", CookOptions{});
+ * bool ok = cooker.Run();
+ * ```
+ */
+class Cooker {
+    public:
+        static constexpr const char* MANIFEST_NAME =
+            "cook_manifest.txt";  ///< Written to the output directory
+
+    private:
+        /**
+         * @brief How a source file is processed.
+         */
+        enum class AssetType { Texture, Mesh, Shader, Copy };
+
+        /**
+         * @brief One source file to cook.
+         */
+        struct Job {
+                std::string Path;  ///< Relative to both directories
+                AssetType Type;    ///< How to process it
+                uint64_t Hash;     ///< Content hash including options
+                bool Succeeded;    ///< Set once processed
+        };
+
+        std::filesystem::path m_SourceDirectory;  ///< Asset sources
+        std::filesystem::path m_OutputDirectory;  ///< Cooked asset tree
+        CookOptions m_Options;                    ///< Cook settings
+        bool m_HasContext = false;                ///< Shaders can be compiled
+        std::map<std::string, uint64_t>
+            m_Manifest;  ///< Hash of each source at its last successful cook
+
+    public:
+        /**
+         * @brief Prepare a cook.
+         *
+         * @param source Source asset directory
+         * @param output Output asset directory, created if missing
+         * @param options Cook settings
+         */
+        Cooker(std::filesystem::path source, std::filesystem::path output,
+               CookOptions options);
+
+        /**
+         * @brief Cook every out-of-date source and update the manifest.
+         *
+         * @return true if every source cooked (or was up to date)
+         */
+        bool Run();
+
+    private:
+        /**
+         * @brief Classify a source file by its extension.
+         */
+        static AssetType Classify(const std::filesystem::path& path);
+
+        /**
+         * @brief Get the files a source produces in the output directory.
+         */
+        std::vector<std::filesystem::path> GetOutputs(const Job& job) const;
+
+        /**
+         * @brief Hash a source's content and the options that affect it.
+         *
+         * @return Hash, or 0 if the source could not be read
+         */
+        uint64_t HashSource(const Job& job) const;
+
+        /**
+         * @brief Process one texture, mesh or copied file.
+         */
+        bool CookFile(const Job& job) const;
+
+        /**
+         * @brief Validate a shader and copy it.
+         */
+        bool CookShader(const Job& job) const;
+
+        /**
+         * @brief Compile a preprocessed shader in the headless context.
+         *
+         * @param job Shader being cooked
+         * @param source Preprocessed source
+         * @return true if it compiled, or if the context cannot compile its
+         * GLSL version (a warning is logged)
+         */
+        bool CompileShader(const Job& job, const std::string& source) const;
+
+        /**
+         * @brief Read the manifest of the previous cook, if any.
+         */
+        void LoadManifest();
+
+        /**
+         * @brief Write the manifest for the sources that cooked.
+         */
+        void SaveManifest() const;
+};
+
+}  // namespace ObeliskCook
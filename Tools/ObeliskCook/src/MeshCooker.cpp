@@ -0,0 +1,304 @@
+#include "MeshCooker.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include "Obelisk/Renderer/CookedFormat.h"
+
+using Obelisk::Vertex;
+
+namespace ObeliskCook {
+
+namespace {
+constexpr int32_t NOT_CACHED = -1;
+constexpr int32_t NO_TRIANGLE = -1;
+
+/**
+ * @brief Score of a vertex in Forsyth's cache optimizer.
+ *
+ * Vertices of the last triangle get a fixed score so the next triangle does
+ * not favour one of its edges; older cache entries decay with their
+ * position. Vertices with few triangles left get a boost, so they are
+ * finished off instead of leaving isolated triangles for later.
+ *
+ * @param cachePosition Position in the simulated cache, or NOT_CACHED
+ * @param remaining Triangles still to emit that use the vertex
+ */
+float VertexScore(int32_t cachePosition, uint32_t remaining) {
+    if (remaining == 0) {
+        return -1.0f;
+    }
+
+    float score = 0.0f;
+    if (cachePosition >= 0 && cachePosition < 3) {
+        score = 0.75f;
+    } else if (cachePosition >= 3) {
+        float scale = 1.0f / static_cast<float>(MeshCooker::CACHE_SIZE - 3);
+        score = std::pow(
+            1.0f - static_cast<float>(cachePosition - 3) * scale, 1.5f);
+    }
+    return score + 2.0f / std::sqrt(static_cast<float>(remaining));
+}
+
+/**
+ * @brief Parse one `v`, `v/vt`, `v//vn` or `v/vt/vn` face corner.
+ *
+ * @param token Corner text
+ * @param positionCount Positions read so far, for negative indices
+ * @param uvCount Texture coordinates read so far
+ * @param position Receives the zero-based position index
+ * @param uv Receives the zero-based texture coordinate index, or -1
+ * @return true if the indices are valid
+ */
+bool ParseCorner(const std::string& token, size_t positionCount,
+                 size_t uvCount, int64_t& position, int64_t& uv) {
+    auto resolve = [](long long index, size_t count) -> int64_t {
+        if (index > 0 && static_cast<size_t>(index) <= count) {
+            return index - 1;
+        }
+        if (index < 0 && static_cast<size_t>(-index) <= count) {
+            return static_cast<int64_t>(count) + index;
+        }
+        return -1;
+    };
+
+    size_t slash = token.find('/');
+    position = resolve(std::atoll(token.c_str()), positionCount);
+    uv = -1;
+    if (slash != std::string::npos && slash + 1 < token.size() &&
+        token[slash + 1] != '/') {
+        uv = resolve(std::atoll(token.c_str() + slash + 1), uvCount);
+        if (uv < 0) {
+            return false;
+        }
+    }
+    return position >= 0;
+}
+}  // namespace
+
+bool MeshCooker::Cook(const std::filesystem::path& source,
+                      const std::filesystem::path& output) {
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    if (!ParseOBJ(source, vertices, indices)) {
+        return false;
+    }
+    if (indices.empty()) {
+        LOG_ERROR("{} contains no faces", source.string());
+        return false;
+    }
+
+    OptimizeVertexCache(indices, vertices.size());
+    OptimizeVertexFetch(vertices, indices);
+
+    Obelisk::CookedMeshHeader header{};
+    header.Magic = Obelisk::COOKED_MESH_MAGIC;
+    header.Version = Obelisk::COOKED_FORMAT_VERSION;
+    header.VertexCount = static_cast<uint32_t>(vertices.size());
+    header.IndexCount = static_cast<uint32_t>(indices.size());
+
+    std::ofstream file(output, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(vertices.data()),
+               static_cast<std::streamsize>(sizeof(Vertex) * vertices.size()));
+    file.write(reinterpret_cast<const char*>(indices.data()),
+               static_cast<std::streamsize>(sizeof(uint32_t) * indices.size()));
+    if (!file) {
+        LOG_ERROR("Failed to write {}", output.string());
+        return false;
+    }
+    return true;
+}
+
+bool MeshCooker::ParseOBJ(const std::filesystem::path& source,
+                          std::vector<Vertex>& vertices,
+                          std::vector<uint32_t>& indices) {
+    std::ifstream file(source);
+    if (!file.is_open()) {
+        LOG_ERROR("Failed to open {}", source.string());
+        return false;
+    }
+
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec3> colors;
+    std::vector<glm::vec2> uvs;
+    std::unordered_map<uint64_t, uint32_t> uniqueVertices;
+    std::vector<uint32_t> polygon;
+
+    std::string line;
+    size_t lineNumber = 0;
+    while (std::getline(file, line)) {
+        lineNumber++;
+        std::istringstream stream(line);
+        std::string keyword;
+        stream >> keyword;
+
+        if (keyword == "v") {
+            glm::vec3 position(0.0f);
+            glm::vec3 color(1.0f);
+            stream >> position.x >> position.y >> position.z;
+            if (stream >> color.x) {
+                stream >> color.y >> color.z;
+            }
+            positions.push_back(position);
+            colors.push_back(color);
+        } else if (keyword == "vt") {
+            glm::vec2 uv(0.0f);
+            stream >> uv.x >> uv.y;
+            uvs.push_back(uv);
+        } else if (keyword == "f") {
+            polygon.clear();
+            std::string token;
+            while (stream >> token) {
+                int64_t position = -1;
+                int64_t uv = -1;
+                if (!ParseCorner(token, positions.size(), uvs.size(), position,
+                                 uv)) {
+                    LOG_ERROR("{}:{}: invalid face corner '{}'",
+                              source.string(), lineNumber, token);
+                    return false;
+                }
+
+                uint64_t key = static_cast<uint64_t>(position) << 32 |
+                               static_cast<uint32_t>(uv + 1);
+                auto [it, inserted] = uniqueVertices.try_emplace(
+                    key, static_cast<uint32_t>(vertices.size()));
+                if (inserted) {
+                    glm::vec2 coords = uv >= 0 ? uvs[uv] : glm::vec2(0.0f);
+                    vertices.push_back(
+                        {positions[position], colors[position], coords});
+                }
+                polygon.push_back(it->second);
+            }
+
+            if (polygon.size() < 3) {
+                LOG_ERROR("{}:{}: face with fewer than 3 corners",
+                          source.string(), lineNumber);
+                return false;
+            }
+            for (size_t i = 1; i + 1 < polygon.size(); i++) {
+                indices.insert(indices.end(),
+                               {polygon[0], polygon[i], polygon[i + 1]});
+            }
+        }
+    }
+    return true;
+}
+
+void MeshCooker::OptimizeVertexCache(std::vector<uint32_t>& indices,
+                                     size_t vertexCount) {
+    size_t triangleCount = indices.size() / 3;
+
+    // Triangles of every vertex; the first remaining[v] entries of a
+    // vertex's range are the ones not emitted yet
+    std::vector<uint32_t> remaining(vertexCount, 0);
+    for (uint32_t index : indices) {
+        remaining[index]++;
+    }
+    std::vector<uint32_t> offsets(vertexCount + 1, 0);
+    for (size_t v = 0; v < vertexCount; v++) {
+        offsets[v + 1] = offsets[v] + remaining[v];
+    }
+    std::vector<uint32_t> adjacency(indices.size());
+    std::vector<uint32_t> filled(vertexCount, 0);
+    for (size_t t = 0; t < triangleCount; t++) {
+        for (size_t k = 0; k < 3; k++) {
+            uint32_t v = indices[t * 3 + k];
+            adjacency[offsets[v] + filled[v]++] = static_cast<uint32_t>(t);
+        }
+    }
+
+    std::vector<int32_t> cachePosition(vertexCount, NOT_CACHED);
+    std::vector<float> vertexScore(vertexCount);
+    for (size_t v = 0; v < vertexCount; v++) {
+        vertexScore[v] = VertexScore(NOT_CACHED, remaining[v]);
+    }
+
+    std::vector<bool> emitted(triangleCount, false);
+
+    std::vector<uint32_t> output;
+    output.reserve(indices.size());
+    std::vector<uint32_t> cache;
+    std::vector<uint32_t> newCache;
+    size_t nextUnemitted = 0;
+    int64_t best = NO_TRIANGLE;
+
+    for (size_t emittedCount = 0; emittedCount < triangleCount;
+         emittedCount++) {
+        // Nothing in the cache is left to draw: continue in input order
+        if (best == NO_TRIANGLE) {
+            while (emitted[nextUnemitted]) {
+                nextUnemitted++;
+            }
+            best = static_cast<int64_t>(nextUnemitted);
+        }
+
+        const uint32_t* triangle = &indices[best * 3];
+        output.insert(output.end(), triangle, triangle + 3);
+        emitted[best] = true;
+
+        // The emitted triangle's vertices move to the front of the cache
+        newCache.assign(triangle, triangle + 3);
+        for (size_t k = 0; k < 3; k++) {
+            uint32_t v = triangle[k];
+            uint32_t* first = &adjacency[offsets[v]];
+            uint32_t* last = first + remaining[v];
+            *std::find(first, last, static_cast<uint32_t>(best)) = *(last - 1);
+            remaining[v]--;
+        }
+        for (uint32_t v : cache) {
+            if (v != triangle[0] && v != triangle[1] && v != triangle[2]) {
+                newCache.push_back(v);
+            }
+        }
+
+        for (size_t i = 0; i < newCache.size(); i++) {
+            uint32_t v = newCache[i];
+            cachePosition[v] =
+                i < CACHE_SIZE ? static_cast<int32_t>(i) : NOT_CACHED;
+            vertexScore[v] = VertexScore(cachePosition[v], remaining[v]);
+        }
+        if (newCache.size() > CACHE_SIZE) {
+            newCache.resize(CACHE_SIZE);
+        }
+        cache.swap(newCache);
+
+        // Only triangles touching the cache changed score
+        best = NO_TRIANGLE;
+        float bestScore = -1.0f;
+        for (uint32_t v : cache) {
+            for (uint32_t i = 0; i < remaining[v]; i++) {
+                uint32_t t = adjacency[offsets[v] + i];
+                float score = vertexScore[indices[t * 3]] +
+                              vertexScore[indices[t * 3 + 1]] +
+                              vertexScore[indices[t * 3 + 2]];
+                if (score > bestScore) {
+                    bestScore = score;
+                    best = t;
+                }
+            }
+        }
+    }
+
+    indices.swap(output);
+}
+
+void MeshCooker::OptimizeVertexFetch(std::vector<Vertex>& vertices,
+                                     std::vector<uint32_t>& indices) {
+    constexpr uint32_t UNASSIGNED = 0xFFFFFFFF;
+    std::vector<uint32_t> remap(vertices.size(), UNASSIGNED);
+    std::vector<Vertex> ordered;
+    ordered.reserve(vertices.size());
+
+    for (uint32_t& index : indices) {
+        if (remap[index] == UNASSIGNED) {
+            remap[index] = static_cast<uint32_t>(ordered.size());
+            ordered.push_back(vertices[index]);
+        }
+        index = remap[index];
+    }
+
+    vertices.swap(ordered);
+}
+
+}  // namespace ObeliskCook
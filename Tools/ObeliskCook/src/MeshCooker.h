@@ -0,0 +1,75 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include <filesystem>
+#include "Obelisk/Renderer/Mesh.h"
+
+namespace ObeliskCook {
+
+/**
+ * @brief Turns Wavefront OBJ models into cooked meshes.
+ *
+ * Positions, texture coordinates and the common `v x y z r g b` vertex
+ * colour extension are read; normals, groups and materials are ignored since
+ * Obelisk::Vertex has no place for them. Polygons are triangulated as fans.
+ *
+ * The result is optimized for drawing: corners sharing a position and
+ * texture coordinate become one vertex, triangles are reordered for the
+ * post-transform vertex cache (Forsyth's algorithm), and vertices are then
+ * renumbered in the order the triangles first use them, so vertex fetches
+ * walk memory linearly.
+ *
+ * @example
+ * ```cpp
+ * MeshCooker::Cook("assets/meshes/rock.obj",
+ *                  "build/assets/meshes/rock.obj.omesh");
+ * ```
+ */
+class MeshCooker {
+    public:
+        static constexpr uint32_t CACHE_SIZE =
+            32;  ///< Simulated post-transform cache entries
+
+        /**
+         * @brief Cook one model.
+         *
+         * @param source OBJ file to read
+         * @param output Cooked mesh to write
+         * @return true if the cooked mesh was written
+         */
+        static bool Cook(const std::filesystem::path& source,
+                         const std::filesystem::path& output);
+
+    private:
+        /**
+         * @brief Parse an OBJ file into indexed triangles.
+         *
+         * @param source OBJ file to read
+         * @param vertices Receives unique vertices
+         * @param indices Receives three indices per triangle
+         * @return true on success, false on unreadable or malformed input
+         */
+        static bool ParseOBJ(const std::filesystem::path& source,
+                             std::vector<Obelisk::Vertex>& vertices,
+                             std::vector<uint32_t>& indices);
+
+        /**
+         * @brief Reorder triangles to maximize post-transform cache hits.
+         *
+         * @param indices Triangle list to reorder in place
+         * @param vertexCount Number of vertices the indices refer to
+         */
+        static void OptimizeVertexCache(std::vector<uint32_t>& indices,
+                                        size_t vertexCount);
+
+        /**
+         * @brief Renumber vertices in first-use order and drop unused ones.
+         *
+         * @param vertices Vertices to reorder in place
+         * @param indices Indices to remap in place
+         */
+        static void OptimizeVertexFetch(std::vector<Obelisk::Vertex>& vertices,
+                                        std::vector<uint32_t>& indices);
+};
+
+}  // namespace ObeliskCook
@@ -0,0 +1,260 @@
+#include "TextureCooker.h"
+#include <stb_image.h>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include "Obelisk/Renderer/CookedFormat.h"
+
+using Obelisk::CookedTextureFormat;
+
+namespace ObeliskCook {
+
+namespace {
+uint16_t To565(const glm::vec3& color) {
+    auto r = static_cast<uint16_t>(std::lround(color.x * 31.0f / 255.0f));
+    auto g = static_cast<uint16_t>(std::lround(color.y * 63.0f / 255.0f));
+    auto b = static_cast<uint16_t>(std::lround(color.z * 31.0f / 255.0f));
+    return static_cast<uint16_t>(r << 11 | g << 5 | b);
+}
+
+glm::vec3 From565(uint16_t color) {
+    uint32_t r = color >> 11 & 0x1F;
+    uint32_t g = color >> 5 & 0x3F;
+    uint32_t b = color & 0x1F;
+    return {static_cast<float>(r << 3 | r >> 2),
+            static_cast<float>(g << 2 | g >> 4),
+            static_cast<float>(b << 3 | b >> 2)};
+}
+
+float DistanceSquared(const glm::vec3& a, const glm::vec3& b) {
+    glm::vec3 delta = a - b;
+    return glm::dot(delta, delta);
+}
+}  // namespace
+
+bool TextureCooker::Cook(const std::filesystem::path& source,
+                         const std::filesystem::path& output, bool compress) {
+    // Match Texture's loader, which flips rows for OpenGL. Set per thread,
+    // since textures are cooked in parallel
+    stbi_set_flip_vertically_on_load_thread(true);
+
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+    if (!stbi_info(source.string().c_str(), &width, &height, &channels)) {
+        LOG_ERROR("Failed to read image {}: {}", source.string(),
+                  stbi_failure_reason());
+        return false;
+    }
+
+    int wanted = channels == 1 ? 1 : 4;
+    unsigned char* pixels = stbi_load(source.string().c_str(), &width, &height,
+                                      &channels, wanted);
+    if (!pixels) {
+        LOG_ERROR("Failed to decode image {}: {}", source.string(),
+                  stbi_failure_reason());
+        return false;
+    }
+
+    Image image;
+    image.Width = static_cast<uint32_t>(width);
+    image.Height = static_cast<uint32_t>(height);
+    image.Channels = static_cast<uint32_t>(wanted);
+    image.Pixels.assign(pixels, pixels + static_cast<size_t>(width) * height *
+                                             wanted);
+    stbi_image_free(pixels);
+
+    bool opaque = true;
+    if (image.Channels == 4) {
+        for (size_t i = 3; i < image.Pixels.size() && opaque; i += 4) {
+            opaque = image.Pixels[i] == 255;
+        }
+    }
+
+    CookedTextureFormat format = CookedTextureFormat::RGBA8;
+    if (image.Channels == 1) {
+        format = CookedTextureFormat::R8;
+    } else if (compress && opaque) {
+        format = CookedTextureFormat::BC1;
+    }
+
+    Obelisk::CookedTextureHeader header{};
+    header.Magic = Obelisk::COOKED_TEXTURE_MAGIC;
+    header.Version = Obelisk::COOKED_FORMAT_VERSION;
+    header.Format = format;
+    header.Width = image.Width;
+    header.Height = image.Height;
+    header.MipCount = std::bit_width(std::max(image.Width, image.Height));
+
+    std::vector<uint8_t> blob(reinterpret_cast<const uint8_t*>(&header),
+                              reinterpret_cast<const uint8_t*>(&header + 1));
+    std::vector<uint8_t> block;
+    for (uint32_t level = 0; level < header.MipCount; level++) {
+        if (level > 0) {
+            image = Downsample(image);
+        }
+
+        if (format == CookedTextureFormat::BC1) {
+            CompressBC1(image, block);
+            blob.insert(blob.end(), block.begin(), block.end());
+        } else {
+            blob.insert(blob.end(), image.Pixels.begin(), image.Pixels.end());
+        }
+    }
+
+    std::ofstream file(output, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(blob.data()),
+               static_cast<std::streamsize>(blob.size()));
+    if (!file) {
+        LOG_ERROR("Failed to write {}", output.string());
+        return false;
+    }
+    return true;
+}
+
+TextureCooker::Image TextureCooker::Downsample(const Image& image) {
+    Image result;
+    result.Width = std::max(1u, image.Width / 2);
+    result.Height = std::max(1u, image.Height / 2);
+    result.Channels = image.Channels;
+    result.Pixels.resize(static_cast<size_t>(result.Width) * result.Height *
+                         result.Channels);
+
+    auto sample = [&image](uint32_t x, uint32_t y, uint32_t channel) {
+        x = std::min(x, image.Width - 1);
+        y = std::min(y, image.Height - 1);
+        return static_cast<uint32_t>(
+            image.Pixels[(static_cast<size_t>(y) * image.Width + x) *
+                             image.Channels +
+                         channel]);
+    };
+
+    for (uint32_t y = 0; y < result.Height; y++) {
+        for (uint32_t x = 0; x < result.Width; x++) {
+            for (uint32_t c = 0; c < result.Channels; c++) {
+                uint32_t sum = sample(x * 2, y * 2, c) +
+                               sample(x * 2 + 1, y * 2, c) +
+                               sample(x * 2, y * 2 + 1, c) +
+                               sample(x * 2 + 1, y * 2 + 1, c);
+                result.Pixels[(static_cast<size_t>(y) * result.Width + x) *
+                                  result.Channels +
+                              c] = static_cast<uint8_t>((sum + 2) / 4);
+            }
+        }
+    }
+    return result;
+}
+
+void TextureCooker::CompressBC1(const Image& image,
+                                std::vector<uint8_t>& output) {
+    uint32_t blocksX = (image.Width + 3) / 4;
+    uint32_t blocksY = (image.Height + 3) / 4;
+    output.resize(static_cast<size_t>(blocksX) * blocksY * 8);
+
+    glm::vec3 colors[16];
+    for (uint32_t by = 0; by < blocksY; by++) {
+        for (uint32_t bx = 0; bx < blocksX; bx++) {
+            for (uint32_t i = 0; i < 16; i++) {
+                uint32_t x = std::min(bx * 4 + i % 4, image.Width - 1);
+                uint32_t y = std::min(by * 4 + i / 4, image.Height - 1);
+                const uint8_t* pixel =
+                    &image.Pixels[(static_cast<size_t>(y) * image.Width + x) *
+                                  4];
+                colors[i] = glm::vec3(pixel[0], pixel[1], pixel[2]);
+            }
+            CompressBlock(colors,
+                          &output[(static_cast<size_t>(by) * blocksX + bx) *
+                                  8]);
+        }
+    }
+}
+
+void TextureCooker::CompressBlock(const glm::vec3 colors[16],
+                                  uint8_t* output) {
+    glm::vec3 mean(0.0f);
+    for (int i = 0; i < 16; i++) {
+        mean += colors[i];
+    }
+    mean /= 16.0f;
+
+    glm::mat3 covariance(0.0f);
+    for (int i = 0; i < 16; i++) {
+        glm::vec3 d = colors[i] - mean;
+        covariance += glm::outerProduct(d, d);
+    }
+
+    // Power iteration converges on the principal axis in a few steps; the
+    // largest column is a better start than a fixed vector, which could be
+    // orthogonal to that axis
+    glm::vec3 axis = covariance[0];
+    for (int i = 1; i < 3; i++) {
+        if (glm::dot(covariance[i], covariance[i]) > glm::dot(axis, axis)) {
+            axis = covariance[i];
+        }
+    }
+    for (int i = 0; i < 8; i++) {
+        axis = covariance * axis;
+        float length = glm::length(axis);
+        if (length < 1e-6f) {
+            break;
+        }
+        axis /= length;
+    }
+
+    float minProjection = std::numeric_limits<float>::max();
+    float maxProjection = std::numeric_limits<float>::lowest();
+    glm::vec3 minColor = mean;
+    glm::vec3 maxColor = mean;
+    for (int i = 0; i < 16; i++) {
+        float projection = glm::dot(colors[i] - mean, axis);
+        if (projection < minProjection) {
+            minProjection = projection;
+            minColor = colors[i];
+        }
+        if (projection > maxProjection) {
+            maxProjection = projection;
+            maxColor = colors[i];
+        }
+    }
+
+    // color0 > color1 selects the opaque four-colour mode
+    uint16_t color0 = To565(maxColor);
+    uint16_t color1 = To565(minColor);
+    if (color0 < color1) {
+        std::swap(color0, color1);
+    }
+
+    uint32_t indices = 0;
+    if (color0 != color1) {
+        glm::vec3 palette[4];
+        palette[0] = From565(color0);
+        palette[1] = From565(color1);
+        palette[2] = (palette[0] * 2.0f + palette[1]) / 3.0f;
+        palette[3] = (palette[0] + palette[1] * 2.0f) / 3.0f;
+
+        for (int i = 0; i < 16; i++) {
+            uint32_t best = 0;
+            float bestDistance = DistanceSquared(colors[i], palette[0]);
+            for (uint32_t p = 1; p < 4; p++) {
+                float distance = DistanceSquared(colors[i], palette[p]);
+                if (distance < bestDistance) {
+                    bestDistance = distance;
+                    best = p;
+                }
+            }
+            indices |= best << (i * 2);
+        }
+    }
+
+    output[0] = static_cast<uint8_t>(color0 & 0xFF);
+    output[1] = static_cast<uint8_t>(color0 >> 8);
+    output[2] = static_cast<uint8_t>(color1 & 0xFF);
+    output[3] = static_cast<uint8_t>(color1 >> 8);
+    for (int i = 0; i < 4; i++) {
+        output[4 + i] = static_cast<uint8_t>(indices >> (i * 8) & 0xFF);
+    }
+}
+
+}  // namespace ObeliskCook
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include <filesystem>
+
+namespace ObeliskCook {
+
+/**
+ * @brief Turns images into cooked textures (see Obelisk::CookedFormat.h).
+ *
+ * Images are decoded with stb_image and flipped like the runtime loader
+ * flips them. The full mip chain is built with a 2x2 box filter, matching
+ * what glGenerateMipmap produces. Opaque colour images are then compressed
+ * to BC1 (DXT1); images with alpha stay RGBA8 and single-channel images R8.
+ *
+ * @example
+ * ```cpp
+ * TextureCooker::Cook("assets/textures/brick.png",
+ *                     "build/assets/textures/brick.png.otex", true);
+ * ```
+ */
+class TextureCooker {
+    private:
+        /**
+         * @brief One decoded mip level.
+         */
+        struct Image {
+                uint32_t Width = 0;           ///< Width in pixels
+                uint32_t Height = 0;          ///< Height in pixels
+                uint32_t Channels = 0;        ///< 1 (R8) or 4 (RGBA8)
+                std::vector<uint8_t> Pixels;  ///< Rows bottom-up, packed
+        };
+
+    public:
+        /**
+         * @brief Cook one image.
+         *
+         * @param source Image to read
+         * @param output Cooked texture to write
+         * @param compress Whether opaque images may be compressed to BC1
+         * @return true if the cooked texture was written
+         */
+        static bool Cook(const std::filesystem::path& source,
+                         const std::filesystem::path& output, bool compress);
+
+    private:
+        /**
+         * @brief Halve an image with a 2x2 box filter.
+         *
+         * Odd edges clamp, so a 5 pixel wide level becomes 2 pixels.
+         */
+        static Image Downsample(const Image& image);
+
+        /**
+         * @brief Compress an RGBA8 level to BC1 blocks.
+         *
+         * @param image Level to compress; edge blocks repeat the last pixels
+         * @param output Receives GetCookedMipSize() bytes
+         */
+        static void CompressBC1(const Image& image,
+                                std::vector<uint8_t>& output);
+
+        /**
+         * @brief Compress one 4x4 block of RGB colours.
+         *
+         * Endpoints are the extremes of the colours along their principal
+         * axis; every pixel then picks the closest of the four palette
+         * entries.
+         *
+         * @param colors Block pixels, row by row, in 0-255
+         * @param output Receives the 8 byte block
+         */
+        static void CompressBlock(const glm::vec3 colors[16], uint8_t* output);
+};
+
+}  // namespace ObeliskCook
@@ -0,0 +1,47 @@
+#include <chrono>
+#include <string_view>
+#include "Cooker.h"
+
+namespace {
+void PrintUsage() {
+    LOG_INFO(
+        "Usage: ObeliskCook <source dir> <output dir> [--force] "
+        "[--no-compress] [--no-compile]");
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+    std::vector<std::string_view> directories;
+    ObeliskCook::CookOptions options;
+
+    for (int i = 1; i < argc; i++) {
+        std::string_view arg = argv[i];
+        if (arg == "--force") {
+            options.Force = true;
+        } else if (arg == "--no-compress") {
+            options.Compress = false;
+        } else if (arg == "--no-compile") {
+            options.CompileShaders = false;
+        } else if (!arg.starts_with("--")) {
+            directories.push_back(arg);
+        } else {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    if (directories.size() != 2) {
+        PrintUsage();
+        return 1;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    ObeliskCook::Cooker cooker(directories[0], directories[1], options);
+    bool success = cooker.Run();
+    auto elapsed = std::chrono::duration<float>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+
+    LOG_INFO("Cook finished in {:.2f}s", elapsed);
+    return success ? 0 : 1;
+}
@@ -0,0 +1,648 @@
+#include "Replayer.h"
+#include <cstring>
+#include <fstream>
+#include <string>
+
+using Obelisk::GLCaptureCommand;
+
+namespace ObeliskReplay {
+
+namespace {
+constexpr size_t COMMAND_HEADER_SIZE = sizeof(uint16_t) + sizeof(uint32_t);
+
+/**
+ * @brief Sequential reader over one command payload.
+ */
+class PayloadReader {
+    private:
+        const uint8_t* m_Data;
+        size_t m_Size;
+        size_t m_Offset = 0;
+
+    public:
+        PayloadReader(const uint8_t* data, size_t size)
+            : m_Data(data), m_Size(size) {}
+
+        template <typename T>
+        T Read() {
+            T value{};
+            if (m_Offset + sizeof(T) <= m_Size) {
+                std::memcpy(&value, m_Data + m_Offset, sizeof(T));
+            }
+            m_Offset += sizeof(T);
+            return value;
+        }
+
+        /**
+         * @brief Read a length-prefixed payload; returns nullptr if empty.
+         */
+        const uint8_t* ReadBytes(uint64_t& size) {
+            size = Read<uint64_t>();
+            if (size == 0 || m_Offset + size > m_Size) {
+                size = 0;
+                return nullptr;
+            }
+            const uint8_t* bytes = m_Data + m_Offset;
+            m_Offset += size;
+            return bytes;
+        }
+
+        std::vector<GLuint> ReadNames() {
+            std::vector<GLuint> names(Read<uint32_t>());
+            for (auto& name : names) {
+                name = Read<uint32_t>();
+            }
+            return names;
+        }
+};
+
+const void* ToPointer(uint64_t offset) {
+    return reinterpret_cast<const void*>(static_cast<uintptr_t>(offset));
+}
+}  // namespace
+
+bool Replayer::Load(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        LOG_ERROR("Failed to open capture: {}", path.string());
+        return false;
+    }
+
+    file.read(reinterpret_cast<char*>(&m_Header), sizeof(m_Header));
+    if (!file || m_Header.Magic != Obelisk::GL_CAPTURE_MAGIC) {
+        LOG_ERROR("Not a GL capture file: {}", path.string());
+        return false;
+    }
+    if (m_Header.Version != Obelisk::GL_CAPTURE_VERSION) {
+        LOG_ERROR("Unsupported capture version {} (expected {})",
+                  m_Header.Version, Obelisk::GL_CAPTURE_VERSION);
+        return false;
+    }
+
+    m_Stream.resize(m_Header.StreamSize);
+    file.read(reinterpret_cast<char*>(m_Stream.data()),
+              static_cast<std::streamsize>(m_Stream.size()));
+    if (!file) {
+        LOG_ERROR("Capture is truncated: {}", path.string());
+        return false;
+    }
+
+    // Split the stream at its frame markers
+    m_Frames.clear();
+    size_t frameBegin = 0;
+    size_t offset = 0;
+    while (offset + COMMAND_HEADER_SIZE <= m_Stream.size()) {
+        uint16_t command = 0;
+        uint32_t size = 0;
+        std::memcpy(&command, m_Stream.data() + offset, sizeof(command));
+        std::memcpy(&size, m_Stream.data() + offset + sizeof(command),
+                    sizeof(size));
+        offset += COMMAND_HEADER_SIZE + size;
+
+        if (command == static_cast<uint16_t>(GLCaptureCommand::Frame)) {
+            m_Frames.emplace_back(frameBegin, offset);
+            frameBegin = offset;
+        }
+    }
+
+    if (offset != m_Stream.size()) {
+        LOG_WARN("Capture stream ends mid-command, ignoring the remainder");
+    }
+
+    // Whatever framebuffer the replay context renders to stands in for 0
+    GLint framebuffer = 0;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &framebuffer);
+    m_DefaultFramebuffer = static_cast<GLuint>(framebuffer);
+
+    LOG_INFO("Loaded capture {}: {} frame(s), {} commands, {} KiB",
+             path.string(), m_Frames.size(), m_Header.CommandCount,
+             m_Stream.size() / 1024);
+    return true;
+}
+
+void Replayer::ReplayFrame(size_t index) {
+    auto [offset, end] = m_Frames[index];
+    while (offset < end) {
+        uint16_t command = 0;
+        uint32_t size = 0;
+        std::memcpy(&command, m_Stream.data() + offset, sizeof(command));
+        std::memcpy(&size, m_Stream.data() + offset + sizeof(command),
+                    sizeof(size));
+        offset += COMMAND_HEADER_SIZE;
+
+        Execute(static_cast<GLCaptureCommand>(command),
+                m_Stream.data() + offset, size);
+        offset += size;
+    }
+}
+
+void Replayer::Execute(GLCaptureCommand command, const uint8_t* payload,
+                       size_t size) {
+    PayloadReader in(payload, size);
+    uint64_t bytes = 0;
+
+    switch (command) {
+        case GLCaptureCommand::Frame:
+            break;
+
+        // === Object lifetime ===
+        case GLCaptureCommand::GenBuffers: {
+            auto captured = in.ReadNames();
+            std::vector<GLuint> names(captured.size());
+            glGenBuffers(static_cast<GLsizei>(names.size()), names.data());
+            AddNames(ObjectType::Buffer, captured, names);
+            break;
+        }
+        case GLCaptureCommand::GenTextures: {
+            auto captured = in.ReadNames();
+            std::vector<GLuint> names(captured.size());
+            glGenTextures(static_cast<GLsizei>(names.size()), names.data());
+            AddNames(ObjectType::Texture, captured, names);
+            break;
+        }
+        case GLCaptureCommand::GenVertexArrays: {
+            auto captured = in.ReadNames();
+            std::vector<GLuint> names(captured.size());
+            glGenVertexArrays(static_cast<GLsizei>(names.size()),
+                              names.data());
+            AddNames(ObjectType::VertexArray, captured, names);
+            break;
+        }
+        case GLCaptureCommand::GenFramebuffers: {
+            auto captured = in.ReadNames();
+            std::vector<GLuint> names(captured.size());
+            glGenFramebuffers(static_cast<GLsizei>(names.size()),
+                              names.data());
+            AddNames(ObjectType::Framebuffer, captured, names);
+            break;
+        }
+        case GLCaptureCommand::GenRenderbuffers: {
+            auto captured = in.ReadNames();
+            std::vector<GLuint> names(captured.size());
+            glGenRenderbuffers(static_cast<GLsizei>(names.size()),
+                               names.data());
+            AddNames(ObjectType::Renderbuffer, captured, names);
+            break;
+        }
+        case GLCaptureCommand::DeleteBuffers: {
+            auto names = RemoveNames(ObjectType::Buffer, in.ReadNames());
+            glDeleteBuffers(static_cast<GLsizei>(names.size()), names.data());
+            break;
+        }
+        case GLCaptureCommand::DeleteTextures: {
+            auto names = RemoveNames(ObjectType::Texture, in.ReadNames());
+            glDeleteTextures(static_cast<GLsizei>(names.size()), names.data());
+            break;
+        }
+        case GLCaptureCommand::DeleteVertexArrays: {
+            auto names = RemoveNames(ObjectType::VertexArray, in.ReadNames());
+            glDeleteVertexArrays(static_cast<GLsizei>(names.size()),
+                                 names.data());
+            break;
+        }
+        case GLCaptureCommand::DeleteFramebuffers: {
+            auto names = RemoveNames(ObjectType::Framebuffer, in.ReadNames());
+            glDeleteFramebuffers(static_cast<GLsizei>(names.size()),
+                                 names.data());
+            break;
+        }
+        case GLCaptureCommand::DeleteRenderbuffers: {
+            auto names =
+                RemoveNames(ObjectType::Renderbuffer, in.ReadNames());
+            glDeleteRenderbuffers(static_cast<GLsizei>(names.size()),
+                                  names.data());
+            break;
+        }
+        case GLCaptureCommand::CreateShader: {
+            GLenum type = in.Read<GLenum>();
+            GLuint captured = in.Read<GLuint>();
+            AddNames(ObjectType::Shader, {captured}, {glCreateShader(type)});
+            break;
+        }
+        case GLCaptureCommand::CreateProgram: {
+            GLuint captured = in.Read<GLuint>();
+            AddNames(ObjectType::Program, {captured}, {glCreateProgram()});
+            break;
+        }
+        case GLCaptureCommand::DeleteShader: {
+            auto names = RemoveNames(ObjectType::Shader, {in.Read<GLuint>()});
+            glDeleteShader(names[0]);
+            break;
+        }
+        case GLCaptureCommand::DeleteProgram: {
+            GLuint captured = in.Read<GLuint>();
+            auto ownedBy = [captured](const auto& entry) {
+                return static_cast<GLuint>(entry.first >> 32) == captured;
+            };
+            std::erase_if(m_UniformLocations, ownedBy);
+            std::erase_if(m_UniformBlocks, ownedBy);
+            glDeleteProgram(RemoveNames(ObjectType::Program, {captured})[0]);
+            break;
+        }
+
+        // === Shaders ===
+        case GLCaptureCommand::ShaderSource: {
+            GLuint shader = MapName(ObjectType::Shader, in.Read<GLuint>());
+            const auto* source =
+                reinterpret_cast<const GLchar*>(in.ReadBytes(bytes));
+            GLint length = static_cast<GLint>(bytes);
+            glShaderSource(shader, 1, &source, &length);
+            break;
+        }
+        case GLCaptureCommand::CompileShader:
+            glCompileShader(MapName(ObjectType::Shader, in.Read<GLuint>()));
+            break;
+        case GLCaptureCommand::AttachShader: {
+            GLuint program = MapName(ObjectType::Program, in.Read<GLuint>());
+            glAttachShader(program,
+                           MapName(ObjectType::Shader, in.Read<GLuint>()));
+            break;
+        }
+        case GLCaptureCommand::DetachShader: {
+            GLuint program = MapName(ObjectType::Program, in.Read<GLuint>());
+            glDetachShader(program,
+                           MapName(ObjectType::Shader, in.Read<GLuint>()));
+            break;
+        }
+        case GLCaptureCommand::LinkProgram:
+            glLinkProgram(MapName(ObjectType::Program, in.Read<GLuint>()));
+            break;
+        case GLCaptureCommand::UseProgram:
+            m_CurrentProgram = in.Read<GLuint>();
+            glUseProgram(MapName(ObjectType::Program, m_CurrentProgram));
+            break;
+        case GLCaptureCommand::GetUniformLocation: {
+            GLuint captured = in.Read<GLuint>();
+            GLint location = in.Read<GLint>();
+            const auto* name = in.ReadBytes(bytes);
+            std::string uniform(reinterpret_cast<const char*>(name), bytes);
+            if (location >= 0) {
+                uint64_t key = (static_cast<uint64_t>(captured) << 32) |
+                               static_cast<uint32_t>(location);
+                m_UniformLocations[key] = glGetUniformLocation(
+                    MapName(ObjectType::Program, captured), uniform.c_str());
+            }
+            break;
+        }
+        case GLCaptureCommand::GetUniformBlockIndex: {
+            GLuint captured = in.Read<GLuint>();
+            GLuint index = in.Read<GLuint>();
+            const auto* name = in.ReadBytes(bytes);
+            std::string block(reinterpret_cast<const char*>(name), bytes);
+            if (index != GL_INVALID_INDEX) {
+                uint64_t key = (static_cast<uint64_t>(captured) << 32) | index;
+                m_UniformBlocks[key] = glGetUniformBlockIndex(
+                    MapName(ObjectType::Program, captured), block.c_str());
+            }
+            break;
+        }
+        case GLCaptureCommand::UniformBlockBinding: {
+            GLuint captured = in.Read<GLuint>();
+            GLuint index = in.Read<GLuint>();
+            GLuint binding = in.Read<GLuint>();
+            auto it = m_UniformBlocks.find(
+                (static_cast<uint64_t>(captured) << 32) | index);
+            if (it != m_UniformBlocks.end() && it->second != GL_INVALID_INDEX) {
+                glUniformBlockBinding(MapName(ObjectType::Program, captured),
+                                      it->second, binding);
+            }
+            break;
+        }
+        case GLCaptureCommand::Uniform1i: {
+            GLint location = MapUniform(in.Read<GLint>());
+            glUniform1i(location, in.Read<GLint>());
+            break;
+        }
+        case GLCaptureCommand::Uniform1f: {
+            GLint location = MapUniform(in.Read<GLint>());
+            glUniform1f(location, in.Read<GLfloat>());
+            break;
+        }
+        case GLCaptureCommand::Uniform2f: {
+            GLint location = MapUniform(in.Read<GLint>());
+            GLfloat x = in.Read<GLfloat>();
+            GLfloat y = in.Read<GLfloat>();
+            glUniform2f(location, x, y);
+            break;
+        }
+        case GLCaptureCommand::Uniform3f: {
+            GLint location = MapUniform(in.Read<GLint>());
+            GLfloat x = in.Read<GLfloat>();
+            GLfloat y = in.Read<GLfloat>();
+            GLfloat z = in.Read<GLfloat>();
+            glUniform3f(location, x, y, z);
+            break;
+        }
+        case GLCaptureCommand::Uniform4f: {
+            GLint location = MapUniform(in.Read<GLint>());
+            GLfloat x = in.Read<GLfloat>();
+            GLfloat y = in.Read<GLfloat>();
+            GLfloat z = in.Read<GLfloat>();
+            GLfloat w = in.Read<GLfloat>();
+            glUniform4f(location, x, y, z, w);
+            break;
+        }
+        case GLCaptureCommand::UniformMatrix4fv: {
+            GLint location = MapUniform(in.Read<GLint>());
+            GLsizei count = in.Read<GLsizei>();
+            GLboolean transpose = static_cast<GLboolean>(in.Read<uint32_t>());
+
+            // Copy out, the payload is not guaranteed to be float-aligned
+            const uint8_t* data = in.ReadBytes(bytes);
+            std::vector<GLfloat> values(bytes / sizeof(GLfloat));
+            std::memcpy(values.data(), data, values.size() * sizeof(GLfloat));
+            glUniformMatrix4fv(location, count, transpose, values.data());
+            break;
+        }
+
+        // === Buffers and vertex layout ===
+        case GLCaptureCommand::BindBuffer: {
+            GLenum target = in.Read<GLenum>();
+            glBindBuffer(target,
+                         MapName(ObjectType::Buffer, in.Read<GLuint>()));
+            break;
+        }
+        case GLCaptureCommand::BindBufferBase: {
+            GLenum target = in.Read<GLenum>();
+            GLuint index = in.Read<GLuint>();
+            glBindBufferBase(target, index,
+                             MapName(ObjectType::Buffer, in.Read<GLuint>()));
+            break;
+        }
+        case GLCaptureCommand::BindBufferRange: {
+            GLenum target = in.Read<GLenum>();
+            GLuint index = in.Read<GLuint>();
+            GLuint buffer = MapName(ObjectType::Buffer, in.Read<GLuint>());
+            auto offset = static_cast<GLintptr>(in.Read<uint64_t>());
+            auto size = static_cast<GLsizeiptr>(in.Read<uint64_t>());
+            glBindBufferRange(target, index, buffer, offset, size);
+            break;
+        }
+        case GLCaptureCommand::BufferData: {
+            GLenum target = in.Read<GLenum>();
+            GLenum usage = in.Read<GLenum>();
+            auto bufferSize = static_cast<GLsizeiptr>(in.Read<uint64_t>());
+            glBufferData(target, bufferSize, in.ReadBytes(bytes), usage);
+            break;
+        }
+        case GLCaptureCommand::BufferSubData: {
+            GLenum target = in.Read<GLenum>();
+            auto offset = static_cast<GLintptr>(in.Read<uint64_t>());
+            const uint8_t* data = in.ReadBytes(bytes);
+            glBufferSubData(target, offset, static_cast<GLsizeiptr>(bytes),
+                            data);
+            break;
+        }
+        case GLCaptureCommand::BindVertexArray:
+            glBindVertexArray(
+                MapName(ObjectType::VertexArray, in.Read<GLuint>()));
+            break;
+        case GLCaptureCommand::VertexAttribPointer: {
+            GLuint index = in.Read<GLuint>();
+            GLint components = in.Read<GLint>();
+            GLenum type = in.Read<GLenum>();
+            auto normalized = static_cast<GLboolean>(in.Read<uint32_t>());
+            GLsizei stride = in.Read<GLsizei>();
+            const void* offset = ToPointer(in.Read<uint64_t>());
+            glVertexAttribPointer(index, components, type, normalized, stride,
+                                  offset);
+            break;
+        }
+        case GLCaptureCommand::EnableVertexAttribArray:
+            glEnableVertexAttribArray(in.Read<GLuint>());
+            break;
+        case GLCaptureCommand::VertexAttribDivisor: {
+            GLuint index = in.Read<GLuint>();
+            glVertexAttribDivisor(index, in.Read<GLuint>());
+            break;
+        }
+
+        // === Textures ===
+        case GLCaptureCommand::ActiveTexture:
+            glActiveTexture(in.Read<GLenum>());
+            break;
+        case GLCaptureCommand::BindTexture: {
+            GLenum target = in.Read<GLenum>();
+            glBindTexture(target,
+                          MapName(ObjectType::Texture, in.Read<GLuint>()));
+            break;
+        }
+        case GLCaptureCommand::TexBuffer: {
+            GLenum target = in.Read<GLenum>();
+            GLenum internalFormat = in.Read<GLenum>();
+            glTexBuffer(target, internalFormat,
+                        MapName(ObjectType::Buffer, in.Read<GLuint>()));
+            break;
+        }
+        case GLCaptureCommand::TexImage2D: {
+            GLenum target = in.Read<GLenum>();
+            GLint level = in.Read<GLint>();
+            GLint internalFormat = in.Read<GLint>();
+            GLsizei width = in.Read<GLsizei>();
+            GLsizei height = in.Read<GLsizei>();
+            GLenum format = in.Read<GLenum>();
+            GLenum type = in.Read<GLenum>();
+            glTexImage2D(target, level, internalFormat, width, height, 0,
+                         format, type, in.ReadBytes(bytes));
+            break;
+        }
+        case GLCaptureCommand::CompressedTexImage2D: {
+            GLenum target = in.Read<GLenum>();
+            GLint level = in.Read<GLint>();
+            GLenum internalFormat = in.Read<GLenum>();
+            GLsizei width = in.Read<GLsizei>();
+            GLsizei height = in.Read<GLsizei>();
+            const uint8_t* data = in.ReadBytes(bytes);
+            glCompressedTexImage2D(target, level, internalFormat, width, height,
+                                   0, static_cast<GLsizei>(bytes), data);
+            break;
+        }
+        case GLCaptureCommand::TexParameteri: {
+            GLenum target = in.Read<GLenum>();
+            GLenum name = in.Read<GLenum>();
+            glTexParameteri(target, name, in.Read<GLint>());
+            break;
+        }
+        case GLCaptureCommand::GenerateMipmap:
+            glGenerateMipmap(in.Read<GLenum>());
+            break;
+        case GLCaptureCommand::PixelStorei: {
+            GLenum name = in.Read<GLenum>();
+            glPixelStorei(name, in.Read<GLint>());
+            break;
+        }
+
+        // === Framebuffers ===
+        case GLCaptureCommand::BindFramebuffer: {
+            GLenum target = in.Read<GLenum>();
+            glBindFramebuffer(
+                target, MapName(ObjectType::Framebuffer, in.Read<GLuint>()));
+            break;
+        }
+        case GLCaptureCommand::BindRenderbuffer: {
+            GLenum target = in.Read<GLenum>();
+            glBindRenderbuffer(
+                target, MapName(ObjectType::Renderbuffer, in.Read<GLuint>()));
+            break;
+        }
+        case GLCaptureCommand::RenderbufferStorage: {
+            GLenum target = in.Read<GLenum>();
+            GLenum format = in.Read<GLenum>();
+            GLsizei width = in.Read<GLsizei>();
+            glRenderbufferStorage(target, format, width, in.Read<GLsizei>());
+            break;
+        }
+        case GLCaptureCommand::FramebufferRenderbuffer: {
+            GLenum target = in.Read<GLenum>();
+            GLenum attachment = in.Read<GLenum>();
+            GLenum renderbufferTarget = in.Read<GLenum>();
+            GLuint renderbuffer =
+                MapName(ObjectType::Renderbuffer, in.Read<GLuint>());
+            glFramebufferRenderbuffer(target, attachment, renderbufferTarget,
+                                      renderbuffer);
+            break;
+        }
+        case GLCaptureCommand::FramebufferTexture2D: {
+            GLenum target = in.Read<GLenum>();
+            GLenum attachment = in.Read<GLenum>();
+            GLenum textureTarget = in.Read<GLenum>();
+            GLuint texture = MapName(ObjectType::Texture, in.Read<GLuint>());
+            glFramebufferTexture2D(target, attachment, textureTarget, texture,
+                                   in.Read<GLint>());
+            break;
+        }
+
+        case GLCaptureCommand::BlitFramebuffer: {
+            GLint srcX0 = in.Read<GLint>();
+            GLint srcY0 = in.Read<GLint>();
+            GLint srcX1 = in.Read<GLint>();
+            GLint srcY1 = in.Read<GLint>();
+            GLint dstX0 = in.Read<GLint>();
+            GLint dstY0 = in.Read<GLint>();
+            GLint dstX1 = in.Read<GLint>();
+            GLint dstY1 = in.Read<GLint>();
+            GLbitfield mask = in.Read<GLbitfield>();
+            glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1,
+                              dstY1, mask, in.Read<GLenum>());
+            break;
+        }
+
+        // === State and drawing ===
+        case GLCaptureCommand::Enable:
+            glEnable(in.Read<GLenum>());
+            break;
+        case GLCaptureCommand::Disable:
+            glDisable(in.Read<GLenum>());
+            break;
+        case GLCaptureCommand::BlendFunc: {
+            GLenum source = in.Read<GLenum>();
+            glBlendFunc(source, in.Read<GLenum>());
+            break;
+        }
+        case GLCaptureCommand::DepthMask:
+            glDepthMask(static_cast<GLboolean>(in.Read<uint32_t>()));
+            break;
+        case GLCaptureCommand::Viewport: {
+            GLint x = in.Read<GLint>();
+            GLint y = in.Read<GLint>();
+            GLsizei width = in.Read<GLsizei>();
+            glViewport(x, y, width, in.Read<GLsizei>());
+            break;
+        }
+        case GLCaptureCommand::ClearColor: {
+            GLfloat r = in.Read<GLfloat>();
+            GLfloat g = in.Read<GLfloat>();
+            GLfloat b = in.Read<GLfloat>();
+            glClearColor(r, g, b, in.Read<GLfloat>());
+            break;
+        }
+        case GLCaptureCommand::Clear:
+            glClear(in.Read<GLbitfield>());
+            break;
+        case GLCaptureCommand::DrawArrays: {
+            GLenum mode = in.Read<GLenum>();
+            GLint first = in.Read<GLint>();
+            glDrawArrays(mode, first, in.Read<GLsizei>());
+            break;
+        }
+        case GLCaptureCommand::DrawArraysInstanced: {
+            GLenum mode = in.Read<GLenum>();
+            GLint first = in.Read<GLint>();
+            GLsizei count = in.Read<GLsizei>();
+            glDrawArraysInstanced(mode, first, count, in.Read<GLsizei>());
+            break;
+        }
+        case GLCaptureCommand::DrawElements: {
+            GLenum mode = in.Read<GLenum>();
+            GLsizei count = in.Read<GLsizei>();
+            GLenum type = in.Read<GLenum>();
+            glDrawElements(mode, count, type, ToPointer(in.Read<uint64_t>()));
+            break;
+        }
+        case GLCaptureCommand::DrawElementsBaseVertex: {
+            GLenum mode = in.Read<GLenum>();
+            GLsizei count = in.Read<GLsizei>();
+            GLenum type = in.Read<GLenum>();
+            const void* offset = ToPointer(in.Read<uint64_t>());
+            glDrawElementsBaseVertex(mode, count, type, offset,
+                                     in.Read<GLint>());
+            break;
+        }
+
+        default:
+            m_UnknownCommands++;
+            break;
+    }
+}
+
+GLuint Replayer::MapName(ObjectType type, GLuint name) const {
+    if (name == 0) {
+        return type == ObjectType::Framebuffer ? m_DefaultFramebuffer : 0;
+    }
+
+    const auto& names = m_Names[static_cast<size_t>(type)];
+    auto it = names.find(name);
+    if (it == names.end()) {
+        LOG_WARN("Capture references unknown object {} (type {})", name,
+                 static_cast<int>(type));
+        return 0;
+    }
+    return it->second;
+}
+
+GLint Replayer::MapUniform(GLint location) const {
+    if (location < 0) {
+        return location;
+    }
+
+    uint64_t key = (static_cast<uint64_t>(m_CurrentProgram) << 32) |
+                   static_cast<uint32_t>(location);
+    auto it = m_UniformLocations.find(key);
+    return it != m_UniformLocations.end() ? it->second : -1;
+}
+
+void Replayer::AddNames(ObjectType type, const std::vector<GLuint>& captured,
+                        const std::vector<GLuint>& replayed) {
+    auto& names = m_Names[static_cast<size_t>(type)];
+    for (size_t i = 0; i < captured.size(); i++) {
+        names[captured[i]] = replayed[i];
+    }
+}
+
+std::vector<GLuint> Replayer::RemoveNames(
+    ObjectType type, const std::vector<GLuint>& captured) {
+    std::vector<GLuint> replayed;
+    replayed.reserve(captured.size());
+
+    auto& names = m_Names[static_cast<size_t>(type)];
+    for (GLuint name : captured) {
+        auto it = names.find(name);
+        replayed.push_back(it != names.end() ? it->second : 0);
+        if (it != names.end()) {
+            names.erase(it);
+        }
+    }
+    return replayed;
+}
+
+}  // namespace ObeliskReplay
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "ObeliskPCH.h"
+#include <array>
+#include <filesystem>
+#include "Obelisk/Renderer/GLCaptureFormat.h"
+
+namespace ObeliskReplay {
+
+/**
+ * @brief Re-issues a GL capture recorded by Obelisk::GLCapture.
+ *
+ * The capture is loaded into memory and split at its Frame markers. Frames
+ * can then be replayed one at a time against the current context. Object
+ * names and uniform locations recorded by the capturing driver are mapped to
+ * the ones returned by the replaying driver.
+ *
+ * @example
+ * ```cpp
+ * Replayer replayer;
+ * if (replayer.Load("frames.obcap")) {
+ *     for (size_t i = 0; i < replayer.GetFrameCount(); i++) {
+ *         replayer.ReplayFrame(i);
+ *     }
+ * }
+ * ```
+ */
+class Replayer {
+    private:
+        /**
+         * @brief Object namespaces with their own name tables.
+         */
+        enum class ObjectType {
+            Buffer,
+            Texture,
+            VertexArray,
+            Framebuffer,
+            Renderbuffer,
+            Shader,
+            Program,
+            Count
+        };
+
+        Obelisk::GLCaptureHeader m_Header{};  ///< File header
+        std::vector<uint8_t> m_Stream;        ///< Serialized commands
+        std::vector<std::pair<size_t, size_t>>
+            m_Frames;  ///< [begin, end) stream offsets of each frame
+
+        std::array<std::unordered_map<GLuint, GLuint>,
+                   static_cast<size_t>(ObjectType::Count)>
+            m_Names;  ///< Captured to replayed object names
+        std::unordered_map<uint64_t, GLint>
+            m_UniformLocations;  ///< (program, location) to replayed location
+        std::unordered_map<uint64_t, GLuint>
+            m_UniformBlocks;  ///< (program, block index) to replayed index
+        GLuint m_CurrentProgram = 0;      ///< Captured name of bound program
+        GLuint m_DefaultFramebuffer = 0;  ///< Replay target for framebuffer 0
+        size_t m_UnknownCommands = 0;     ///< Commands skipped as unknown
+
+    public:
+        /**
+         * @brief Load a capture file.
+         *
+         * @param path Capture file written by GLCapture
+         * @return true if the file is a valid capture
+         */
+        bool Load(const std::filesystem::path& path);
+
+        /**
+         * @brief Issue the commands of one frame.
+         *
+         * Frames must be replayed in order the first time, since earlier
+         * frames create the objects later ones use.
+         *
+         * @param index Frame index
+         */
+        void ReplayFrame(size_t index);
+
+        /**
+         * @brief Get the number of frames in the capture.
+         * @return Frame count
+         */
+        size_t GetFrameCount() const { return m_Frames.size(); }
+
+        /**
+         * @brief Get the file header.
+         * @return Header of the loaded capture
+         */
+        const Obelisk::GLCaptureHeader& GetHeader() const { return m_Header; }
+
+        /**
+         * @brief Get the number of commands skipped because their id was not
+         * known to this replayer.
+         * @return Skipped command count
+         */
+        size_t GetUnknownCommandCount() const { return m_UnknownCommands; }
+
+    private:
+        /**
+         * @brief Execute one command.
+         *
+         * @param command Command id
+         * @param payload Start of the command payload
+         * @param size Payload size in bytes
+         */
+        void Execute(Obelisk::GLCaptureCommand command, const uint8_t* payload,
+                     size_t size);
+
+        /**
+         * @brief Map a captured object name to the replayed one.
+         */
+        GLuint MapName(ObjectType type, GLuint name) const;
+
+        /**
+         * @brief Map a captured uniform location of the bound program.
+         */
+        GLint MapUniform(GLint location) const;
+
+        /**
+         * @brief Record names created by the replaying driver.
+         */
+        void AddNames(ObjectType type, const std::vector<GLuint>& captured,
+                      const std::vector<GLuint>& replayed);
+
+        /**
+         * @brief Map captured names for deletion and forget them.
+         */
+        std::vector<GLuint> RemoveNames(ObjectType type,
+                                        const std::vector<GLuint>& captured);
+};
+
+}  // namespace ObeliskReplay
@@ -0,0 +1,154 @@
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <numeric>
+#include <string_view>
+#include "Obelisk/Renderer/Window.h"
+#include "Replayer.h"
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Timings of one replayed frame.
+ */
+struct FrameTiming {
+        float SubmitMS;    ///< CPU time spent issuing the frame's commands
+        float CompleteMS;  ///< Time until the GPU finished the frame
+};
+
+float ElapsedMS(Clock::time_point start, Clock::time_point end) {
+    return std::chrono::duration<float, std::milli>(end - start).count();
+}
+
+void LogStatistics(const char* label, std::vector<float> samples) {
+    if (samples.empty()) return;
+
+    std::sort(samples.begin(), samples.end());
+    float average = std::accumulate(samples.begin(), samples.end(), 0.0f) /
+                    static_cast<float>(samples.size());
+    float p95 = samples[(samples.size() - 1) * 95 / 100];
+
+    LOG_INFO("{:<9} min {:7.3f}ms  avg {:7.3f}ms  p95 {:7.3f}ms  max {:7.3f}ms",
+             label, samples.front(), average, p95, samples.back());
+}
+
+void PrintUsage() {
+    LOG_INFO(
+        "Usage: ObeliskReplay <capture> [--loops N] [--windowed] "
+        "[--verbose]");
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+    std::string capturePath;
+    size_t loops = 1;
+    bool windowed = false;
+    bool verbose = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string_view arg = argv[i];
+        if (arg == "--loops" && i + 1 < argc) {
+            loops = std::max<size_t>(1, std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--windowed") {
+            windowed = true;
+        } else if (arg == "--verbose") {
+            verbose = true;
+        } else if (!arg.starts_with("--")) {
+            capturePath = arg;
+        } else {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    if (capturePath.empty()) {
+        PrintUsage();
+        return 1;
+    }
+
+    // Size the context like the one the capture was recorded in
+    Obelisk::Window window;
+    std::ifstream probe(capturePath, std::ios::binary);
+    Obelisk::GLCaptureHeader header{};
+    probe.read(reinterpret_cast<char*>(&header), sizeof(header));
+    int width = header.Width > 0 ? static_cast<int>(header.Width) : 1280;
+    int height = header.Height > 0 ? static_cast<int>(header.Height) : 720;
+
+    auto backend = windowed ? Obelisk::WindowBackend::Windowed
+                            : Obelisk::WindowBackend::Headless;
+    if (window.Create(width, height, "Obelisk Replay", backend) < 0) {
+        LOG_ERROR("Failed to create a rendering context");
+        return 1;
+    }
+    if (windowed) {
+        glfwSwapInterval(0);  // Never wait for vsync while benchmarking
+    }
+
+    ObeliskReplay::Replayer replayer;
+    if (!replayer.Load(capturePath)) {
+        return 1;
+    }
+    if (replayer.GetFrameCount() == 0) {
+        LOG_ERROR("Capture contains no frames");
+        return 1;
+    }
+
+    LOG_INFO("Renderer: {}",
+             reinterpret_cast<const char*>(glGetString(GL_RENDERER)));
+
+    // The first pass creates every object; later loops skip frame 0, which
+    // holds resource creation, and only re-issue the per-frame workload
+    std::vector<FrameTiming> timings;
+    FrameTiming firstFrame{};
+    for (size_t loop = 0; loop < loops; loop++) {
+        size_t firstIndex = loop == 0 ? 0 : 1;
+        for (size_t i = firstIndex; i < replayer.GetFrameCount(); i++) {
+            auto start = Clock::now();
+            replayer.ReplayFrame(i);
+            auto submitted = Clock::now();
+            glFinish();
+            auto completed = Clock::now();
+
+            FrameTiming timing{ElapsedMS(start, submitted),
+                               ElapsedMS(start, completed)};
+            if (loop == 0 && i == 0) {
+                firstFrame = timing;
+            } else {
+                timings.push_back(timing);
+            }
+
+            if (verbose) {
+                LOG_INFO("Frame {:4}: submit {:.3f}ms, complete {:.3f}ms", i,
+                         timing.SubmitMS, timing.CompleteMS);
+            }
+
+            if (windowed) {
+                glfwSwapBuffers(glfwGetCurrentContext());
+                glfwPollEvents();
+            }
+        }
+    }
+
+    if (replayer.GetUnknownCommandCount() > 0) {
+        LOG_WARN("Skipped {} unknown command(s); the capture was written by a "
+                 "newer engine",
+                 replayer.GetUnknownCommandCount());
+    }
+
+    LOG_INFO("First frame (includes resource creation): submit {:.3f}ms, "
+             "complete {:.3f}ms",
+             firstFrame.SubmitMS, firstFrame.CompleteMS);
+
+    std::vector<float> submit;
+    std::vector<float> complete;
+    for (const auto& timing : timings) {
+        submit.push_back(timing.SubmitMS);
+        complete.push_back(timing.CompleteMS);
+    }
+
+    LOG_INFO("{} frame(s) replayed over {} loop(s)", timings.size(), loops);
+    LogStatistics("Submit", submit);
+    LogStatistics("Complete", complete);
+    return 0;
+}
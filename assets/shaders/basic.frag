@@ -1,12 +1,21 @@
 #version 330 core
 
+#include "clustered_lighting.glsl"
+#include "uniform_blocks.glsl"
+
 out vec4 fragColor;
 
 in vec3 color;
 in vec2 textureCoord;
+#ifdef CLUSTERED_LIGHTING
+in vec3 viewPosition;
+#endif
 
 uniform sampler2D textureSampler;
 
 void main() {
-    fragColor = texture(textureSampler, textureCoord);
+    fragColor = texture(textureSampler, textureCoord) * baseColor;
+#ifdef CLUSTERED_LIGHTING
+    fragColor.rgb *= ComputeClusteredLighting(viewPosition);
+#endif
 }
\ No newline at end of file
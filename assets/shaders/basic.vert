@@ -3,18 +3,33 @@
 layout(location = 0) in vec3 aPos;
 layout(location = 1) in vec3 aColor;
 layout(location = 2) in vec2 aTextureCoord;
+#ifdef GPU_DRIVEN
+// Model matrix of the instance, written by the GPU culling pass
+layout(location = 3) in mat4 aInstanceModel;
+#endif
 
 out vec3 color;
 out vec2 textureCoord;
+#ifdef CLUSTERED_LIGHTING
+out vec3 viewPosition;
+#endif
 
-// Separate matrices for proper 3D rendering
-uniform mat4 model;       // Model transformation matrix
-uniform mat4 view;        // View matrix (camera)
-uniform mat4 projection;  // Projection matrix
+// Matrices and material parameters come from the engine uniform blocks
+#include "uniform_blocks.glsl"
 
 void main() {
+#ifdef GPU_DRIVEN
+    mat4 objectToWorld = aInstanceModel;
+#else
+    mat4 objectToWorld = model;
+#endif
+
     // Standard MVP (Model-View-Projection) transformation
-    gl_Position = projection * view * model * vec4(aPos, 1.0);
+    vec4 viewSpace = view * objectToWorld * vec4(aPos, 1.0);
+    gl_Position = projection * viewSpace;
     color = aColor;
-    textureCoord = aTextureCoord;
+    textureCoord = aTextureCoord * uvTransform.xy + uvTransform.zw;
+#ifdef CLUSTERED_LIGHTING
+    viewPosition = viewSpace.xyz;
+#endif
 }
\ No newline at end of file
@@ -0,0 +1,49 @@
+// Clustered forward lighting, see Obelisk::ClusteredLighting.
+// Only active when the shader is built with the CLUSTERED_LIGHTING define.
+#ifdef CLUSTERED_LIGHTING
+
+uniform usamplerBuffer uClusterGrid;   // (offset, count) per cluster
+uniform usamplerBuffer uLightIndices;  // Light indices of all clusters
+uniform samplerBuffer uLightData;      // Position/radius and color per light
+
+uniform vec3 uClusterDims;         // Clusters along x, y and z
+uniform vec2 uClusterScreenSize;   // Viewport size in pixels
+uniform vec2 uClusterDepthParams;  // Slice = log(depth) * x - y
+uniform vec3 uAmbientLight;
+
+int GetClusterIndex(vec3 viewPos) {
+    ivec3 dims = ivec3(uClusterDims);
+    ivec2 tile = ivec2(gl_FragCoord.xy / uClusterScreenSize * uClusterDims.xy);
+    int slice = int(log(-viewPos.z) * uClusterDepthParams.x -
+                    uClusterDepthParams.y);
+
+    tile = clamp(tile, ivec2(0), dims.xy - 1);
+    slice = clamp(slice, 0, dims.z - 1);
+    return tile.x + dims.x * (tile.y + dims.y * slice);
+}
+
+vec3 ComputeClusteredLighting(vec3 viewPos) {
+    // Meshes carry no normals, so use the flat face normal
+    vec3 normal = normalize(cross(dFdx(viewPos), dFdy(viewPos)));
+
+    uvec2 cluster = texelFetch(uClusterGrid, GetClusterIndex(viewPos)).xy;
+    vec3 lighting = uAmbientLight;
+
+    for (uint i = 0u; i < cluster.y; i++) {
+        int light = int(texelFetch(uLightIndices, int(cluster.x + i)).x);
+        vec4 positionRadius = texelFetch(uLightData, light * 2);
+        vec3 color = texelFetch(uLightData, light * 2 + 1).rgb;
+
+        vec3 toLight = positionRadius.xyz - viewPos;
+        float distance = length(toLight);
+        float attenuation =
+            clamp(1.0 - distance / positionRadius.w, 0.0, 1.0);
+        float diffuse = max(dot(normal, toLight / distance), 0.0);
+
+        lighting += color * diffuse * attenuation * attenuation;
+    }
+
+    return lighting;
+}
+
+#endif
@@ -0,0 +1,20 @@
+#version 330 core
+
+out vec4 fragColor;
+
+in vec2 textureCoord;
+
+uniform sampler2D atlas;
+
+void main() {
+    vec4 color = texture(atlas, textureCoord);
+
+    // Alpha-tested, so impostors need no sorting
+    if (color.a < 0.5) {
+        discard;
+    }
+
+    // The atlas is cleared to transparent black, so filtered texels along
+    // the silhouette are darkened in proportion to their coverage
+    fragColor = vec4(color.rgb / color.a, 1.0);
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+#version 330 core
+
+layout(location = 0) in vec2 aCorner;
+layout(location = 1) in vec4 aCenterRadius;
+layout(location = 2) in vec4 aParams;
+
+out vec2 textureCoord;
+
+uniform mat4 viewProjection;
+uniform vec3 cameraPosition;
+
+// Must match ImpostorAtlas
+const float YAW_VIEWS = 8.0;
+const float PITCH_VIEWS = 3.0;
+const float PITCH_STEP = 0.5235988;  // 30 degrees
+const int TILES_PER_ROW = 32;
+const float TWO_PI = 6.2831853;
+
+void main() {
+    vec3 center = aCenterRadius.xyz;
+    float radius = aCenterRadius.w;
+    vec3 direction = normalize(cameraPosition - center);
+
+    // Pick the baked view closest to the direction in object space
+    float azimuth = atan(direction.x, direction.z) - aParams.y;
+    float yaw = mod(floor(azimuth / TWO_PI * YAW_VIEWS + 0.5), YAW_VIEWS);
+    float elevation = asin(clamp(direction.y, -1.0, 1.0));
+    float pitch = clamp(floor(elevation / PITCH_STEP + 0.5), 0.0,
+                        PITCH_VIEWS - 1.0);
+    int tile = int(aParams.x + pitch * YAW_VIEWS + yaw + 0.5);
+
+    // Face the camera, keeping world up like the baked views
+    vec3 forward = -direction;
+    vec3 right = cross(forward, vec3(0.0, 1.0, 0.0));
+    right = dot(right, right) > 1e-6 ? normalize(right) : vec3(1.0, 0.0, 0.0);
+    vec3 up = cross(right, forward);
+
+    vec3 position = center + (right * aCorner.x + up * aCorner.y) * radius;
+    gl_Position = viewProjection * vec4(position, 1.0);
+
+    vec2 tileOrigin = vec2(tile % TILES_PER_ROW, tile / TILES_PER_ROW);
+    textureCoord = (tileOrigin + aCorner * 0.5 + 0.5) / float(TILES_PER_ROW);
+}
\ No newline at end of file
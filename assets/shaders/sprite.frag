@@ -0,0 +1,40 @@
+#version 330 core
+
+out vec4 fragColor;
+
+in vec2 textureCoord;
+in vec4 tint;
+flat in int textureSlot;
+
+// Must match SpriteBatch::MAX_TEXTURE_SLOTS
+uniform sampler2D uTextures[16];
+
+// GLSL 3.30 only allows constant sampler array indices. Gradients are taken
+// outside the switch, since neighboring pixels may use other slots.
+vec4 SampleSlot(int slot, vec2 uv, vec2 dx, vec2 dy) {
+    switch (slot) {
+        case 0: return textureGrad(uTextures[0], uv, dx, dy);
+        case 1: return textureGrad(uTextures[1], uv, dx, dy);
+        case 2: return textureGrad(uTextures[2], uv, dx, dy);
+        case 3: return textureGrad(uTextures[3], uv, dx, dy);
+        case 4: return textureGrad(uTextures[4], uv, dx, dy);
+        case 5: return textureGrad(uTextures[5], uv, dx, dy);
+        case 6: return textureGrad(uTextures[6], uv, dx, dy);
+        case 7: return textureGrad(uTextures[7], uv, dx, dy);
+        case 8: return textureGrad(uTextures[8], uv, dx, dy);
+        case 9: return textureGrad(uTextures[9], uv, dx, dy);
+        case 10: return textureGrad(uTextures[10], uv, dx, dy);
+        case 11: return textureGrad(uTextures[11], uv, dx, dy);
+        case 12: return textureGrad(uTextures[12], uv, dx, dy);
+        case 13: return textureGrad(uTextures[13], uv, dx, dy);
+        case 14: return textureGrad(uTextures[14], uv, dx, dy);
+        case 15: return textureGrad(uTextures[15], uv, dx, dy);
+    }
+    return vec4(1.0, 0.0, 1.0, 1.0);
+}
+
+void main() {
+    vec2 dx = dFdx(textureCoord);
+    vec2 dy = dFdy(textureCoord);
+    fragColor = SampleSlot(textureSlot, textureCoord, dx, dy) * tint;
+}
\ No newline at end of file
@@ -0,0 +1,19 @@
+#version 330 core
+
+layout(location = 0) in vec2 aPos;
+layout(location = 1) in vec2 aTextureCoord;
+layout(location = 2) in vec4 aColor;
+layout(location = 3) in float aTextureSlot;
+
+out vec2 textureCoord;
+out vec4 tint;
+flat out int textureSlot;
+
+uniform mat4 viewProjection;
+
+void main() {
+    gl_Position = viewProjection * vec4(aPos, 0.0, 1.0);
+    textureCoord = aTextureCoord;
+    tint = aColor;
+    textureSlot = int(aTextureSlot + 0.5);
+}
\ No newline at end of file
@@ -0,0 +1,22 @@
+// Engine uniform blocks, see Obelisk::Renderer. Binding points are assigned
+// by the engine when the program is linked.
+
+layout(std140) uniform PerFrame {
+    mat4 view;            // World to view space
+    mat4 projection;      // View to clip space
+    mat4 viewProjection;  // World to clip space
+    vec4 cameraPosition;  // World-space camera position
+    vec4 time;            // x: total time, y: delta time
+};
+
+layout(std140) uniform PerDraw {
+    mat4 model;         // Object to world space
+    mat4 normalMatrix;  // Inverse transpose of model
+    vec4 drawParams;    // Free per-draw parameters
+};
+
+layout(std140) uniform Material {
+    vec4 baseColor;       // Multiplied with the first material texture
+    vec4 uvTransform;     // xy: UV scale, zw: UV offset
+    vec4 materialParams;  // Free material parameters
+};